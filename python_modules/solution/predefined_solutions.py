@@ -1376,6 +1376,48 @@ def frequency_analysis(prb, systemPrefix= 'sym_band', shift:float= None):
     solProc.setup()
     return solProc.analysis
 
+class HarmonicSteadyStateAnalysis(SolutionProcedure):
+    ''' Steady-state response of the model to harmonic loads (the loads
+        currently applied to the domain) for a list of frequencies.'''
+
+    def __init__(self, prb, frequencies, name= None, printFlag= 0, constraintHandlerType= 'transformation', numberingMethod= 'rcm', lossFactor= 0.0):
+        ''' Constructor.
+
+        :param prb: XC finite element problem.
+        :param frequencies: frequencies (Hz) to compute the response for.
+        :param name: identifier for the solution procedure.
+        :param printFlag: if not zero print convergence results on each step.
+        :param constraintHandlerType: type of the constraint handler (plain, penalty, transformation or langrange).
+        :param numberingMethod: numbering method (plain or reverse Cuthill-McKee or alternative minimum degree).
+        :param lossFactor: hysteretic damping loss factor.
+        '''
+        super(HarmonicSteadyStateAnalysis,self).__init__(name, constraintHandlerType, printFlag= printFlag, numberingMethod= numberingMethod, soeType= 'band_gen_lin_soe', solverType= 'band_gen_lin_lapack_solver', integratorType= None, solutionAlgorithmType= 'linear_soln_algo', analysisType= 'harmonic_steady_state_analysis')
+        self.feProblem= prb
+        self.frequencies= frequencies
+        self.lossFactor= lossFactor
+
+    def integratorSetup(self):
+        ''' The harmonic analysis assembles the system by itself, so
+            no integrator is needed.'''
+        self.integrator= None
+
+    def analysisSetup(self):
+        ''' Create the analysis object. '''
+        super(HarmonicSteadyStateAnalysis,self).analysisSetup()
+        self.analysis.frequencies= xc.Vector(self.frequencies)
+        self.analysis.lossFactor= self.lossFactor
+
+    def solve(self):
+        ''' Compute the steady-state response for all the frequencies.'''
+        if(not self.analysis):
+            self.setup()
+        result= self.analysis.analyze()
+        if(result!=0):
+            className= type(self).__name__
+            methodName= sys._getframe(0).f_code.co_name
+            lmsg.error(className+'.'+methodName+'; can\'t compute the harmonic response.')
+        return result
+
 class IllConditioningAnalysisBase(SolutionProcedure):
     ''' Base class for ill-conditioning
         solution procedures.
@@ -1612,6 +1654,49 @@ class SpectraLinearBucklingAnalysis(LinearBucklingAnalysis):
         super().__init__(prb= prb, numModes= numModes, constraintHandlerType= constraintHandlerType, numberingMethod= numberingMethod, convTestType= convTestType, convergenceTestTol= convergenceTestTol, maxNumIter= 1000, soeType= soeType, solverType= solverType, solutionAlgorithmType= solutionAlgorithmType, eigenSOEType= eigenSOEType, eigenSolverType= eigenSolverType, printFlag= printFlag)
     
 # Displacement control analysis.
+class BatchedLinearBucklingAnalysis(SolutionProcedure):
+    ''' Linear buckling analysis of a set of load combinations sharing
+        the factorization of the elastic stiffness matrix.'''
+
+    def __init__(self, prb, numModes, combinations, name= None, printFlag= 0, constraintHandlerType= 'transformation', numberingMethod= 'rcm'):
+        ''' Constructor.
+
+        :param prb: XC finite element problem.
+        :param numModes: number of buckling modes to compute for each combination.
+        :param combinations: dictionary containing, for each combination name, a dictionary with the factors that correspond to each load pattern (i.e. {'ULS01': {'G':1.35, 'Q':1.5}, 'ULS02': {'G':1.0, 'Q':1.5}}). The load patterns must be added to the domain before running the analysis.
+        :param name: identifier for the solution procedure.
+        :param printFlag: if not zero print convergence results on each step.
+        :param constraintHandlerType: type of the constraint handler (plain, penalty, transformation or langrange).
+        :param numberingMethod: numbering method (plain or reverse Cuthill-McKee or alternative minimum degree).
+        '''
+        super(BatchedLinearBucklingAnalysis,self).__init__(name, constraintHandlerType, printFlag= printFlag, numberingMethod= numberingMethod, soeType= 'band_gen_lin_soe', solverType= 'band_gen_lin_lapack_solver', integratorType= None, solutionAlgorithmType= 'linear_soln_algo', analysisType= 'batched_linear_buckling_analysis')
+        self.feProblem= prb
+        self.numModes= numModes
+        self.combinations= combinations
+
+    def integratorSetup(self):
+        ''' The batched linear buckling analysis assembles the matrices
+            by itself, so no integrator is needed.'''
+        self.integrator= None
+
+    def analysisSetup(self):
+        ''' Create the analysis object. '''
+        super(BatchedLinearBucklingAnalysis,self).analysisSetup()
+        self.analysis.numModes= self.numModes
+        for combName in self.combinations:
+            self.analysis.addCombination(combName, self.combinations[combName])
+
+    def solve(self):
+        ''' Compute the critical load factors for all the combinations.'''
+        if(not self.analysis):
+            self.setup()
+        result= self.analysis.analyze()
+        if(result!=0):
+            className= type(self).__name__
+            methodName= sys._getframe(0).f_code.co_name
+            lmsg.error(className+'.'+methodName+'; can\'t compute the critical load factors.')
+        return result
+
 class DisplacementControlBase(SolutionProcedure):
     ''' Base class for displacement control analysis.
 
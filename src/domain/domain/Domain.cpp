@@ -1286,7 +1286,10 @@ void XC::Domain::setDomainChangeStamp(int newStamp)
 //! invoked whenever a Node, Element or Constraint object is added to the
 //! domain.  
 void XC::Domain::domainChange(void)
-  { hasDomainChangedFlag= true; }
+  {
+    hasDomainChangedFlag= true;
+    mesh.domainChange(); // element groups must be rebuilt.
+  }
 
 //! @brief Returns true if the model has changed.
 //!
@@ -236,7 +236,7 @@ XC::TimeSeries *XC::MotionHistory::integrate(TimeSeries *theSeries) const
     const double dT= getDelta();
     if(dT>0.0)
       {
-        retval= theIntegrator->integrate(theSeries, dT);
+        retval= theIntegrator->getIntegral(theSeries, dT);
         if(!retval)
           std::cerr << method_identifier
 	            << "; no TimeSeriesIntegrator defined, "
@@ -276,7 +276,7 @@ XC::TimeSeries* XC::MotionHistory::differentiate(TimeSeries *theSeries) const
     const double dT= getDelta();
     if(dT>0.0)
       {
-	retval= theIntegrator->differentiate(theSeries, dT);
+	retval= theIntegrator->getDerivative(theSeries, dT);
         if(!retval)
           std::cerr << method_identifier
 	            << "; no TimeSeriesIntegrator defined, "
@@ -486,6 +486,23 @@ void XC::MotionHistory::loadAccelTimeFile(const std::string &fileNameAccel, cons
 		<< "; unable to create PathTimeSeries.\n";
   }
 
+//! @brief Load the accelerations from a binary file (see PathSeriesBase).
+void XC::MotionHistory::loadAccelBinaryFile(const std::string &fileNameAccel,const double &theFactor)
+  {
+    clearSeries();
+    PathTimeSeries *tmp= new PathTimeSeries();
+    tmp->setFactor(theFactor);
+    if(tmp->readFromBinaryFile(fileNameAccel))
+      theAccelSeries= tmp;
+    else
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+		  << "; unable to read accelerations from file: "
+		  << fileNameAccel << std::endl;
+	delete tmp;
+      }
+  }
+
 //! @brief Return a Python dictionary with the object members values.
 boost::python::dict XC::MotionHistory::getPyDict(void) const
   {
@@ -107,6 +107,7 @@ class MotionHistory: public CommandEntity
     // AddingSensitivity:END ///////////////////////////////////////////
     void loadAccelFile(const std::string &fileNameAccel,const double &timeStep,const double &theFactor);
     void loadAccelTimeFile(const std::string &fileNameAccel, const std::string &fileNameTime,const double &theFactor);
+    void loadAccelBinaryFile(const std::string &fileNameAccel,const double &theFactor= 1.0);
 
     boost::python::dict getPyDict(void) const;
     void setPyDict(const boost::python::dict &);
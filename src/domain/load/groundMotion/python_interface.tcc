@@ -42,6 +42,7 @@ class_<XC::MotionHistory, bases<CommandEntity>, boost::noncopyable >("MotionHist
   .add_property("vel", make_function( &XC::MotionHistory::getVelHistory, return_internal_reference<>()),&XC::MotionHistory::setVelHistory,"Get/set the history of velocities.")
   .add_property("disp", make_function( &XC::MotionHistory::getDispHistory, return_internal_reference<>()),&XC::MotionHistory::setDispHistory,"Get/set the history of displacements.")
   .def("getNumberOfDataPoints",&XC::MotionHistory::getNumDataPoints,"Returns the number of data points.")
+  .def("loadAccelBinaryFile",&XC::MotionHistory::loadAccelBinaryFile,"loadAccelBinaryFile(fileName, factor): read the accelerations from a binary file.")
   ;
 
 class_<XC::GroundMotionRecord , bases<XC::GroundMotion>, boost::noncopyable >("GroundMotionRecord", no_init)
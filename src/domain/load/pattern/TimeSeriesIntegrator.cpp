@@ -59,8 +59,98 @@
 
 #include <domain/load/pattern/TimeSeriesIntegrator.h>
 #include <domain/load/pattern/TimeSeries.h>
+#include <domain/load/pattern/time_series/PathSeriesBase.h>
+
+XC::TimeSeriesIntegrator::cache_map XC::TimeSeriesIntegrator::cache;
+std::deque<XC::TimeSeriesIntegrator::cache_key> XC::TimeSeriesIntegrator::cacheQueue;
+size_t XC::TimeSeriesIntegrator::maxCacheSize= 256;
+std::mutex XC::TimeSeriesIntegrator::cacheMutex;
 
 //! @brief Constructor.
 XC::TimeSeriesIntegrator::TimeSeriesIntegrator (int classTag)
 :MovableObject(classTag)
   {}
+
+//! @brief Return the integral (integration= true) or the derivative
+//! of the series, reusing the result of previous computations
+//! if possible.
+//!
+//! Only the series defined by a path (see PathSeriesBase) are cached,
+//! the other ones are integrated each time. The caller owns the returned
+//! object.
+XC::TimeSeries *XC::TimeSeriesIntegrator::get_cached(TimeSeries *theSeries, double delta, bool integration) const
+  {
+    const PathSeriesBase *path= dynamic_cast<const PathSeriesBase *>(theSeries);
+    if(!path || (maxCacheSize==0))
+      return (integration ? integrate(theSeries, delta) : differentiate(theSeries, delta));
+
+    const cache_key key(getClassTag(), integration, delta, path->getFingerprint());
+    {
+      std::lock_guard<std::mutex> lock(cacheMutex);
+      cache_map::const_iterator i= cache.find(key);
+      if(i!=cache.end())
+	{
+	  // Check the data (the fingerprint is a hash value).
+	  const PathSeriesBase *cachedPath= dynamic_cast<const PathSeriesBase *>(i->second.source.get());
+	  if(cachedPath && path->hasSameData(*cachedPath))
+	    return i->second.result->getCopy();
+	}
+    }
+    TimeSeries *retval= (integration ? integrate(theSeries, delta) : differentiate(theSeries, delta));
+    if(retval)
+      {
+	std::lock_guard<std::mutex> lock(cacheMutex);
+	if(cache.find(key)==cache.end()) // on collision the first entry is kept.
+	  {
+	    cache_entry &entry= cache[key];
+	    entry.source= std::shared_ptr<TimeSeries>(theSeries->getCopy());
+	    entry.result= std::shared_ptr<TimeSeries>(retval->getCopy());
+	    cacheQueue.push_back(key);
+	    while(cacheQueue.size()>maxCacheSize)
+	      {
+		cache.erase(cacheQueue.front());
+		cacheQueue.pop_front();
+	      }
+	  }
+      }
+    return retval;
+  }
+
+//! @brief Return the integral of the series (see get_cached).
+XC::TimeSeries *XC::TimeSeriesIntegrator::getIntegral(TimeSeries *theSeries, double delta) const
+  { return get_cached(theSeries, delta, true); }
+
+//! @brief Return the derivative of the series (see get_cached).
+XC::TimeSeries *XC::TimeSeriesIntegrator::getDerivative(TimeSeries *theSeries, double delta) const
+  { return get_cached(theSeries, delta, false); }
+
+//! @brief Remove all the cached series.
+void XC::TimeSeriesIntegrator::clearCache(void)
+  {
+    std::lock_guard<std::mutex> lock(cacheMutex);
+    cache.clear();
+    cacheQueue.clear();
+  }
+
+//! @brief Return the number of cached series.
+size_t XC::TimeSeriesIntegrator::getCacheSize(void)
+  {
+    std::lock_guard<std::mutex> lock(cacheMutex);
+    return cache.size();
+  }
+
+//! @brief Return the maximum number of cached series.
+size_t XC::TimeSeriesIntegrator::getMaxCacheSize(void)
+  { return maxCacheSize; }
+
+//! @brief Set the maximum number of cached series (zero disables the cache).
+void XC::TimeSeriesIntegrator::setMaxCacheSize(const size_t &sz)
+  {
+    std::lock_guard<std::mutex> lock(cacheMutex);
+    maxCacheSize= sz;
+    while(cacheQueue.size()>maxCacheSize)
+      {
+	cache.erase(cacheQueue.front());
+	cacheQueue.pop_front();
+      }
+  }
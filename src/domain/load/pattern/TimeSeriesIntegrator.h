@@ -63,6 +63,11 @@
 #define TimeSeriesIntegrator_h
 
 #include <utility/actor/actor/MovableObject.h>
+#include <map>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <tuple>
 
 namespace XC {
 class TimeSeries;
@@ -72,8 +77,33 @@ class TimeSeries;
 //! @brief Time integration of time series. A TimeSeriesIntegrator
 //! describes the numerical integration of a ground motion record
 //! used in a dynamic analysis.
+//!
+//! The results of integrating (or differentiating) path series are
+//! kept in a cache shared by all the integrators, keyed by the
+//! integrator type, the time increment and the contents of the series
+//! (see PathSeriesBase::getFingerprint). A copy of the source series
+//! is stored with each result, so a hit is accepted only if the
+//! data of both series are equal. This way the ground motions
+//! that are created again and again from the same records (i. e.
+//! in incremental dynamic analysis or multi-support excitation) are
+//! not integrated again.
 class TimeSeriesIntegrator: public MovableObject
   {
+  private:
+    typedef std::tuple<int, bool, double, size_t> cache_key; //!< (class tag, integration, delta, fingerprint)
+    //! @brief Cached result and the series it was computed from.
+    struct cache_entry
+      {
+        std::shared_ptr<TimeSeries> source; //!< copy of the integrated/differentiated series.
+        std::shared_ptr<TimeSeries> result; //!< integral or derivative of the source.
+      };
+    typedef std::map<cache_key, cache_entry> cache_map;
+    static cache_map cache; //!< integrated/differentiated series.
+    static std::deque<cache_key> cacheQueue; //!< insertion order of the cache entries.
+    static size_t maxCacheSize; //!< maximum number of cached series.
+    static std::mutex cacheMutex;
+
+    TimeSeries *get_cached(TimeSeries *, double, bool) const;
   public:
     TimeSeriesIntegrator(int classTag);
     virtual TimeSeriesIntegrator *getCopy(void) const= 0;
@@ -81,6 +111,13 @@ class TimeSeriesIntegrator: public MovableObject
       {}
     virtual TimeSeries* integrate(TimeSeries *theSeries, double delta) const= 0;
     virtual TimeSeries* differentiate(TimeSeries *theSeries, double delta) const= 0;
+    TimeSeries *getIntegral(TimeSeries *theSeries, double delta) const;
+    TimeSeries *getDerivative(TimeSeries *theSeries, double delta) const;
+
+    static void clearCache(void);
+    static size_t getCacheSize(void);
+    static size_t getMaxCacheSize(void);
+    static void setMaxCacheSize(const size_t &);
   };
 } // end of XC namespace
 
@@ -105,11 +105,7 @@ void XC::EarthquakePattern::applyLoad(double time)
 		(uDotDotG)(i) = theMotions[i]->getAccel(currentTime);
 	      }
 
-	    NodeIter &theNodes= theDomain->getNodes();
-	    Node *theNode= nullptr;
-	    while((theNode = theNodes()) != 0) 
-	      theNode->addInertiaLoadToUnbalance(uDotDotG, 1.0);
-
+	    addInertiaLoadToNodes(uDotDotG);
 
 	    ElementIter &theElements = theDomain->getElements();
 	    Element *theElement= nullptr;
@@ -119,6 +115,22 @@ void XC::EarthquakePattern::applyLoad(double time)
       }
   }
     
+//! @brief Adds the inertial loads corresponding to the ground
+//! accelerations being passed as parameter to the domain nodes.
+//!
+//! Default implementation: each node computes the product M*R*accelG.
+void XC::EarthquakePattern::addInertiaLoadToNodes(const Vector &accelG)
+  {
+    Domain *theDomain= getDomain();
+    if(theDomain)
+      {
+	NodeIter &theNodes= theDomain->getNodes();
+	Node *theNode= nullptr;
+	while((theNode = theNodes()) != 0) 
+	  theNode->addInertiaLoadToUnbalance(accelG, 1.0);
+      }
+  }
+
 void XC::EarthquakePattern::applyLoadSensitivity(double time)
   {
     // see if quick return, i.e. no Ground Motions or domain set
@@ -92,6 +92,7 @@ class EarthquakePattern: public EQBasePattern
   protected:
     void copy(const Vector *,const Vector *);
     int addMotion(GroundMotion &);
+    virtual void addInertiaLoadToNodes(const Vector &);
     int sendData(Communicator &);
     int recvData(const Communicator &);
   public:
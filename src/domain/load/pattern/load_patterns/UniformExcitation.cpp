@@ -73,11 +73,13 @@
 //! @brief Constructor.
 XC::UniformExcitation::UniformExcitation(int tag)
   :EarthquakePattern(tag, PATTERN_TAG_UniformExcitation),
-   theMotion(nullptr), theDof(0), vel0(0.0), fact(1.0) {}
+   theMotion(nullptr), theDof(0), vel0(0.0), fact(1.0),
+   influenceVectors(), influenceGeoTag(-1), influenceMassStamp(0) {}
 
 //! @brief Constructor.
 XC::UniformExcitation::UniformExcitation(GroundMotion &_theMotion, int dof, int tag, double velZero, const double &f)
-  :EarthquakePattern(tag, PATTERN_TAG_UniformExcitation), theMotion(&_theMotion), theDof(dof), vel0(velZero), fact(f)
+  :EarthquakePattern(tag, PATTERN_TAG_UniformExcitation), theMotion(&_theMotion), theDof(dof), vel0(velZero), fact(f),
+   influenceVectors(), influenceGeoTag(-1), influenceMassStamp(0)
   {
     // add the motion to the list of ground motions
     addMotion(*theMotion);
@@ -99,6 +101,7 @@ XC::GroundMotion &XC::UniformExcitation::getGroundMotionRecord(void)
 void XC::UniformExcitation::setDomain(Domain *theDomain) 
   {
     EarthquakePattern::setDomain(theDomain);
+    clearInfluenceVectors();
 
     // now we go through and set all the node velocities to be vel0
     // for those nodes not fixed in the dirn!
@@ -129,15 +132,68 @@ void XC::UniformExcitation::setDomain(Domain *theDomain)
       }
   }
 
-//! @brief Applies the load.
-//!
-//! @param time: instant to calculate the value of the load.
+//! @brief Return the influence vector (the column of the R matrix) that
+//! corresponds to the node argument.
 //!
-//! Checks to see if the number of nodes in the domain has changed, if
-//! there has been a change it invokes {\em setNumColR(1)} and then 
-//! {\em setR(theDof, 0, 1.0)} on each Node. It then invokes the base classes
-//! applyLoad() method. THIS SHOULD BE CHANGED TO USE LATEST domainChanged().
-void XC::UniformExcitation::applyLoad(double time)
+//! All entries but those corresponding to the degree of freedom
+//! direction are zero. For rotational excitations the translational
+//! terms due to the node position are included.
+XC::Vector XC::UniformExcitation::getInfluenceVector(const Node &theNode) const
+  {
+    Vector retval(theNode.getNumberDOF());
+    const Vector &crds= theNode.getCrds();
+    const int ndm= crds.Size();
+
+    if(ndm == 1)
+      { retval(theDof)= fact; }
+    else if(ndm == 2)
+      {
+	if(theDof < 2)
+	  { retval(theDof)= fact; }
+	else if(theDof == 2)
+	  {
+	    const double xCrd = crds(0);
+	    const double yCrd = crds(1);
+	    retval(0)= -fact*yCrd;
+	    retval(1)= fact*xCrd;
+	    retval(2)= fact;
+	  }
+      }
+    else if(ndm == 3)
+      {
+	if(theDof < 3)
+	  { retval(theDof)= fact; }
+	else if(theDof == 3)
+	  {
+	    const double yCrd = crds(1);
+	    const double zCrd = crds(2);
+	    retval(1)= -fact*zCrd;
+	    retval(2)= fact*yCrd;
+	    retval(3)= fact;
+	  }
+	else if(theDof == 4)
+	  {
+	    const double xCrd = crds(0);
+	    const double zCrd = crds(2);
+	    retval(0)= fact*zCrd;
+	    retval(2)= -fact*xCrd;
+	    retval(4)= fact;
+	  }
+	else if(theDof == 5)
+	  {
+	    const double xCrd = crds(0);
+	    const double yCrd = crds(1);
+	    retval(0)= -fact*yCrd;
+	    retval(1)= fact*xCrd;
+	    retval(5)= fact;
+	  }
+      }
+    return retval;
+  }
+
+//! @brief Set the R matrix of each node of the domain (the elements
+//! use it to compute their inertial loads).
+void XC::UniformExcitation::setNodesR(void)
   {
     Domain *theDomain = getDomain();
     if(theDomain)
@@ -147,56 +203,87 @@ void XC::UniformExcitation::applyLoad(double time)
 	while ((theNode = theNodes()) != 0)
 	  {
 	    theNode->setNumColR(1);
-	    const Vector &crds=theNode->getCrds();
-	    const int ndm= crds.Size();
+	    const Vector r= getInfluenceVector(*theNode);
+	    const int sz= r.Size();
+	    for(int i= 0;i<sz;i++)
+	      if(r(i)!=0.0)
+		theNode->setR(i, 0, r(i));
+	  }
+      }
+  }
 
-	    if(ndm == 1)
-	      {	theNode->setR(theDof, 0, fact); }
-	    else if(ndm == 2)
-	      {
-		if(theDof < 2)
-		  { theNode->setR(theDof, 0, fact); }
-		else if(theDof == 2)
-		  {
-		    const double xCrd = crds(0);
-		    const double yCrd = crds(1);
-		    theNode->setR(0, 0, -fact*yCrd);
-		    theNode->setR(1, 0, fact*xCrd);
-		    theNode->setR(2, 0, fact);
-		  }
-	      }
-	    else if(ndm == 3)
+//! @brief Clears the cached M*r products so they are recomputed
+//! on the next call to applyLoad.
+void XC::UniformExcitation::clearInfluenceVectors(void)
+  {
+    influenceVectors.clear();
+    influenceGeoTag= -1;
+  }
+
+//! @brief Compute (if needed) the M*r products of the nodes with mass.
+//!
+//! The products are recomputed only if the domain geometry or any
+//! nodal mass has changed since the last computation, so the inertial
+//! loads of each time step are obtained without forming the products
+//! of the nodal mass matrices again.
+void XC::UniformExcitation::updateInfluenceVectors(void)
+  {
+    Domain *theDomain = getDomain();
+    if(theDomain)
+      {
+	const int geoTag= theDomain->getCurrentGeoTag();
+	const size_t massStamp= Node::getMassStamp();
+	if((geoTag!=influenceGeoTag) || (massStamp!=influenceMassStamp))
+	  {
+	    influenceVectors.clear();
+	    NodeIter &theNodes = theDomain->getNodes();
+	    Node *theNode= nullptr;
+	    while((theNode = theNodes()) != 0)
 	      {
-		if(theDof < 3)
-		  {
-		    theNode->setR(theDof, 0, fact);
-		  }
-		else if(theDof == 3)
+		const Matrix &mass= theNode->getMass();
+		if(mass.Norm2()>0.0)
 		  {
-		    const double yCrd = crds(1);
-		    const double zCrd = crds(2);
-		    theNode->setR(1, 0, -fact*zCrd);
-		    theNode->setR(2, 0, fact*yCrd);
-		    theNode->setR(3, 0, fact);
-		  }
-		else if(theDof == 4)
-		  {
-		    const double xCrd = crds(0);
-		    const double zCrd = crds(2);
-		    theNode->setR(0, 0, fact*zCrd);
-		    theNode->setR(2, 0, -fact*xCrd);
-		    theNode->setR(4, 0, fact);
-		  }
-		else if(theDof == 5)
-		  {
-		    const double xCrd = crds(0);
-		    const double yCrd = crds(1);
-		    theNode->setR(0, 0, -fact*yCrd);
-		    theNode->setR(1, 0, fact*xCrd);
-		    theNode->setR(5, 0, fact);
+		    const Vector r= getInfluenceVector(*theNode);
+		    Vector Mr(r.Size());
+		    Mr.addMatrixVector(0.0, mass, r, 1.0);
+		    if(Mr.Norm2()>0.0)
+		      influenceVectors.push_back(std::make_pair(theNode, Mr));
 		  }
 	      }
+	    influenceGeoTag= geoTag;
+	    influenceMassStamp= massStamp;
 	  }
+      }
+  }
+
+//! @brief Adds the inertial loads to the domain nodes using the cached
+//! M*r products (-accelG(0)*M*r for each node with mass).
+void XC::UniformExcitation::addInertiaLoadToNodes(const Vector &accelG)
+  {
+    updateInfluenceVectors();
+    const double a= accelG(0);
+    for(InfluenceVectors::const_iterator i= influenceVectors.begin(); i!=influenceVectors.end(); i++)
+      {
+	Node *theNode= i->first;
+	if(theNode->isAlive())
+	  theNode->addUnbalancedLoad(i->second, -a);
+      }
+  }
+
+//! @brief Applies the load.
+//!
+//! @param time: instant to calculate the value of the load.
+//!
+//! Sets the R matrix of each node (to be used by the elements) and
+//! then invokes the base class applyLoad() method. The inertial loads
+//! of the nodes are computed from the cached M*r products
+//! (see addInertiaLoadToNodes).
+void XC::UniformExcitation::applyLoad(double time)
+  {
+    Domain *theDomain = getDomain();
+    if(theDomain)
+      {
+	setNodesR();
         EarthquakePattern::applyLoad(time);
       }
     return;
@@ -238,6 +325,7 @@ int XC::UniformExcitation::recvData(const Communicator &comm)
     int res= EarthquakePattern::recvData(comm);
     res+= comm.receiveInt(theDof,getDbTagData(),CommMetaData(23));
     res+= comm.receiveDoubles(vel0,fact,getDbTagData(),CommMetaData(24));
+    clearInfluenceVectors();
     theMotion= receiveGroundMotionPtr(theMotion,getDbTagData(),comm,BrokedPtrCommMetaData(25,26,27));
     return res;
   }
@@ -63,8 +63,11 @@
 #define UniformExcitation_h
 
 #include "EarthquakePattern.h"
+#include <vector>
 
 namespace XC {
+class Node;
+
 //! @ingroup LPatterns
 //
 //! @brief Load pattern for a earthquake with a similar
@@ -84,11 +87,20 @@ class UniformExcitation: public EarthquakePattern
     double vel0; //!< the initial velocity, should be neg of ug dot(0)
     double fact; //!< factor that multiplies the signal.
 
+    typedef std::vector<std::pair<Node *, Vector> > InfluenceVectors;
+    InfluenceVectors influenceVectors; //!< cached M*r products of the nodes with mass.
+    int influenceGeoTag; //!< domain geometry tag when influenceVectors were computed.
+    size_t influenceMassStamp; //!< nodal mass stamp when influenceVectors were computed.
+
+    Vector getInfluenceVector(const Node &) const;
+    void setNodesR(void);
+    void updateInfluenceVectors(void);
     UniformExcitation(const UniformExcitation &);
     UniformExcitation &operator=(const UniformExcitation &);
   protected:
     int sendData(Communicator &);
     int recvData(const Communicator &);
+    void addInertiaLoadToNodes(const Vector &);
 
   public:
     UniformExcitation(int tag= 0);
@@ -102,7 +114,10 @@ class UniformExcitation: public EarthquakePattern
 
     //! @brief set the affected dof.
     inline void setDof(const int &dof)
-      { theDof= dof; }
+      {
+	theDof= dof;
+	clearInfluenceVectors();
+      }
     //! @brief return the affected dof.
     inline int getDof(void) const
       { return theDof; }
@@ -114,10 +129,17 @@ class UniformExcitation: public EarthquakePattern
       { return vel0; }
     //! @brief set multiplication factor.
     inline void setFactor(const double &f)
-      { fact= f; }
+      {
+	fact= f;
+	clearInfluenceVectors();
+      }
     //! @brief return multiplication factor.
     inline double getFactor(void) const
       { return fact; }
+    void clearInfluenceVectors(void);
+    //! @brief Return the number of cached influence vectors.
+    inline size_t getNumInfluenceVectors(void) const
+      { return influenceVectors.size(); }
     int sendSelf(Communicator &);
     int recvSelf(const Communicator &);
 
@@ -124,7 +124,12 @@ class_<XC::LoadCombinationGroup, bases<XC::LoadHandlerMember,XC::LoadCombination
   ;
 
 
-class_<XC::TimeSeriesIntegrator , bases<XC::MovableObject>, boost::noncopyable >("TimeSeriesIntegrator", no_init);
+class_<XC::TimeSeriesIntegrator , bases<XC::MovableObject>, boost::noncopyable >("TimeSeriesIntegrator", no_init)
+  .def("clearCache", &XC::TimeSeriesIntegrator::clearCache,"Remove the cached integrated series.").staticmethod("clearCache")
+  .def("getCacheSize", &XC::TimeSeriesIntegrator::getCacheSize,"Return the number of cached integrated series.").staticmethod("getCacheSize")
+  .def("getMaxCacheSize", &XC::TimeSeriesIntegrator::getMaxCacheSize,"Return the maximum number of cached integrated series.").staticmethod("getMaxCacheSize")
+  .def("setMaxCacheSize", &XC::TimeSeriesIntegrator::setMaxCacheSize,"Set the maximum number of cached integrated series (zero disables the cache).").staticmethod("setMaxCacheSize")
+  ;
 
 #include "time_series_integrator/python_interface.tcc"
 
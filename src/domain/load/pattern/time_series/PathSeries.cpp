@@ -68,6 +68,7 @@
 #include <cmath>
 #include <fstream>
 #include <iomanip>
+#include <boost/functional/hash.hpp>
 
 #include "utility/actor/actor/MovableVector.h"
 #include "utility/matrix/ID.h"
@@ -147,6 +148,63 @@ void XC::PathSeries::readFromFile(const std::string &fileName)
     prepend_zero_if_appropriate();
   }
 
+//! @brief Read path from a binary file (see PathSeriesBase).
+//!
+//! The time increment and the start time are read from the file
+//! which must not store the time values (constant time increment).
+bool XC::PathSeries::readFromBinaryFile(const std::string &fileName)
+  {
+    Vector time;
+    double dt= pathTimeIncr, t0= startTime;
+    bool retval= read_binary_file(fileName, time, thePath, dt, t0);
+    if(retval)
+      {
+	if(time.Size()>0)
+	  {
+	    std::cerr << getClassName() << "::" << __FUNCTION__
+		      << "; file: " << fileName
+		      << " contains time values; use a PathTimeSeries"
+		      << " to read it." << std::endl;
+	    thePath.resize(0);
+	    retval= false;
+	  }
+	else
+	  {
+	    if(dt>0.0)
+	      pathTimeIncr= dt;
+	    startTime= t0;
+	    prepend_zero_if_appropriate();
+	  }
+      }
+    return retval;
+  }
+
+//! @brief Write the path to a binary file (see PathSeriesBase).
+bool XC::PathSeries::writeToBinaryFile(const std::string &fileName) const
+  { return write_binary_file(fileName, nullptr, thePath, pathTimeIncr, startTime); }
+
+//! @brief Return a hash value computed from the series data.
+size_t XC::PathSeries::getFingerprint(void) const
+  {
+    size_t retval= PathSeriesBase::getFingerprint();
+    boost::hash_combine(retval, pathTimeIncr);
+    boost::hash_combine(retval, startTime);
+    return retval;
+  }
+
+//! @brief Return true if the series argument has the same data
+//! than this one (see PathSeriesBase::hasSameData).
+bool XC::PathSeries::hasSameData(const PathSeriesBase &other) const
+  {
+    bool retval= PathSeriesBase::hasSameData(other);
+    if(retval)
+      {
+        const PathSeries *tmp= dynamic_cast<const PathSeries *>(&other);
+        retval= tmp && (pathTimeIncr==tmp->pathTimeIncr) && (startTime==tmp->startTime);
+      }
+    return retval;
+  }
+
 //! @brief Returns the value of the factor at the pseudo-time.
 //!
 //! Determines the load factor based on the \p pseudoTime and the data
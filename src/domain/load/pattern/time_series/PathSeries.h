@@ -121,6 +121,10 @@ class PathSeries: public PathSeriesBase
       {return this->prependZero;}
 
     void readFromFile(const std::string &fileName);
+    bool readFromBinaryFile(const std::string &fileName);
+    bool writeToBinaryFile(const std::string &fileName) const;
+    size_t getFingerprint(void) const;
+    bool hasSameData(const PathSeriesBase &) const;
     
     boost::python::dict getPyDict(void) const;
     void setPyDict(const boost::python::dict &);
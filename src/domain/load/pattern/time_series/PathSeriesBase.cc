@@ -31,9 +31,33 @@
 #include <utility/matrix/Vector.h>
 
 #include <fstream>
+#include <cstring>
+#include <algorithm>
+#include <cstdint>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <boost/functional/hash.hpp>
 #include "utility/actor/actor/CommMetaData.h"
 #include "utility/matrix/ID.h"
 
+namespace
+  {
+    //! @brief Signature of the binary path files.
+    const char binary_path_signature[8]= {'X','C','P','A','T','H','0','1'};
+
+    //! @brief Header of the binary path files.
+    struct binary_path_header
+      {
+	char signature[8]; //!< file signature.
+	uint64_t numDataPoints; //!< number of points.
+	uint64_t hasTime; //!< 1 if the time values are stored.
+	double timeIncr; //!< time increment (if time values are not stored).
+	double startTime; //!< start time.
+      };
+  }
+
 //! @brief Constructor.
 XC::PathSeriesBase::PathSeriesBase(int classTag, const double &theFactor, bool last)	
   : CFactorSeries(classTag,theFactor), useLast(last) {}
@@ -85,6 +109,122 @@ size_t XC::PathSeriesBase::load_vector_from_file(Vector &v,std::istream &is)
     return count;
   }
 
+//! @brief Read the points from a binary file.
+//!
+//! The file is memory-mapped and the values copied directly into the
+//! vectors (no text parsing).
+//! @param fName: name of the file.
+//! @param time: time values (empty if not stored in the file).
+//! @param path: data values.
+//! @param dt: time increment stored in the file.
+//! @param t0: start time stored in the file.
+bool XC::PathSeriesBase::read_binary_file(const std::string &fName, Vector &time, Vector &path, double &dt, double &t0) const
+  {
+    bool retval= false;
+    const int fd= open(fName.c_str(), O_RDONLY);
+    if(fd<0)
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+		  << "; WARNING - could not open file "
+		  << fName << std::endl;
+	return retval;
+      }
+    struct stat st;
+    const size_t headerSize= sizeof(binary_path_header);
+    if((fstat(fd, &st)<0) || (static_cast<size_t>(st.st_size)<headerSize))
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+		  << "; WARNING - file "
+		  << fName << " is not a binary path file." << std::endl;
+	close(fd);
+	return retval;
+      }
+    const size_t fileSize= st.st_size;
+    void *addr= mmap(nullptr, fileSize, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if(addr==MAP_FAILED)
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+		  << "; WARNING - could not map file "
+		  << fName << std::endl;
+	return retval;
+      }
+    binary_path_header header;
+    memcpy(&header, addr, headerSize);
+    const size_t n= header.numDataPoints;
+    const size_t numColumns= (header.hasTime ? 2 : 1);
+    if(memcmp(header.signature, binary_path_signature, 8)!=0)
+      std::cerr << getClassName() << "::" << __FUNCTION__
+		<< "; WARNING - file "
+		<< fName << " is not a binary path file." << std::endl;
+    else if(fileSize<headerSize+numColumns*n*sizeof(double))
+      std::cerr << getClassName() << "::" << __FUNCTION__
+		<< "; WARNING - file "
+		<< fName << " is truncated." << std::endl;
+    else
+      {
+	const double *data= reinterpret_cast<const double *>(static_cast<const char *>(addr)+headerSize);
+	dt= header.timeIncr;
+	t0= header.startTime;
+	if(header.hasTime)
+	  {
+	    time.resize(n);
+	    if(n>0)
+	      memcpy(time.getDataPtr(), data, n*sizeof(double));
+	    data+= n;
+	  }
+	else
+	  time.resize(0);
+	path.resize(n);
+	if(n>0)
+	  memcpy(path.getDataPtr(), data, n*sizeof(double));
+	retval= (n>0);
+      }
+    munmap(addr, fileSize);
+    return retval;
+  }
+
+//! @brief Write the points to a binary file.
+//!
+//! @param fName: name of the file.
+//! @param time: time values (if null they are not written).
+//! @param path: data values.
+//! @param dt: time increment.
+//! @param t0: start time.
+bool XC::PathSeriesBase::write_binary_file(const std::string &fName, const Vector *time, const Vector &path, const double &dt, const double &t0) const
+  {
+    std::ofstream out(fName.c_str(), std::ios::out | std::ios::binary);
+    if(!out)
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+		  << "; WARNING - could not open file "
+		  << fName << std::endl;
+	return false;
+      }
+    const size_t n= path.Size();
+    if(time && (time->Size()!=static_cast<int>(n)))
+      {
+	std::cerr << getClassName() << "::" << __FUNCTION__
+		  << "; WARNING - time and path vectors "
+		  << "do not contain the same number of points.\n";
+	return false;
+      }
+    binary_path_header header;
+    memcpy(header.signature, binary_path_signature, 8);
+    header.numDataPoints= n;
+    header.hasTime= (time ? 1 : 0);
+    header.timeIncr= dt;
+    header.startTime= t0;
+    out.write(reinterpret_cast<const char *>(&header), sizeof(header));
+    if(n>0)
+      {
+	if(time)
+	  out.write(reinterpret_cast<const char *>(time->getDataPtr()), n*sizeof(double));
+	out.write(reinterpret_cast<const char *>(path.getDataPtr()), n*sizeof(double));
+      }
+    return out.good();
+  }
+
 //! @brief Return the peak value of the factor.
 double XC::PathSeriesBase::getPeakFactor(void) const
   {
@@ -108,6 +248,43 @@ double XC::PathSeriesBase::getPeakFactor(void) const
     return retval;
   }
 
+//! @brief Return a hash value computed from the series data.
+//!
+//! Used to identify series with the same contents (i.e. to reuse the
+//! result of its integration, see TimeSeriesIntegrator).
+size_t XC::PathSeriesBase::getFingerprint(void) const
+  {
+    size_t retval= 0;
+    boost::hash_combine(retval, getClassTag());
+    boost::hash_combine(retval, cFactor);
+    boost::hash_combine(retval, useLast);
+    boost::hash_combine(retval, thePath.Size());
+    const double *p= thePath.getDataPtr();
+    if(p)
+      boost::hash_range(retval, p, p+thePath.Size());
+    return retval;
+  }
+
+//! @brief Return true if both vectors have the same values.
+bool XC::PathSeriesBase::equal_vectors(const Vector &a, const Vector &b)
+  {
+    bool retval= (a.Size()==b.Size());
+    if(retval && (a.Size()>0))
+      retval= std::equal(a.getDataPtr(), a.getDataPtr()+a.Size(), b.getDataPtr());
+    return retval;
+  }
+
+//! @brief Return true if the series argument has the same data
+//! than this one.
+//!
+//! Used to verify that two series with the same fingerprint are
+//! really equal (see TimeSeriesIntegrator).
+bool XC::PathSeriesBase::hasSameData(const PathSeriesBase &other) const
+  {
+    return ((getClassTag()==other.getClassTag()) && (cFactor==other.cFactor)
+	    && (useLast==other.useLast) && equal_vectors(thePath, other.thePath));
+  }
+
 //! @brief Printing stuff.
 void XC::PathSeriesBase::Print(std::ostream &s, int flag) const
   {
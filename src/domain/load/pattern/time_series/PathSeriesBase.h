@@ -40,6 +40,15 @@ class Vector;
 //
 //! @brief Base class for time-dependent functions defined
 //! by a series of points (ti,fi).
+//!
+//! Besides the plain text files, the points can be read from (and
+//! written to) a binary file with the following layout (native byte
+//! order): an 8 character signature ("XCPATH01"), the number of points
+//! n (uint64), a flag (uint64) that is 1 if the time values are stored,
+//! the time increment and the start time (doubles) and then the
+//! n time values (if stored) followed by the n data values. Binary files
+//! are memory-mapped when loaded, so thousands of records can be read
+//! without parsing text.
 class PathSeriesBase: public CFactorSeries
   {
   protected:
@@ -47,7 +56,10 @@ class PathSeriesBase: public CFactorSeries
     bool useLast;
 
     static size_t load_vector_from_file(Vector &v,std::istream &is);
+    bool read_binary_file(const std::string &, Vector &, Vector &, double &, double &) const;
+    bool write_binary_file(const std::string &, const Vector *, const Vector &, const double &, const double &) const;
 
+    static bool equal_vectors(const Vector &, const Vector &);
     int sendData(Communicator &comm);
     int recvData(const Communicator &comm);
   public:
@@ -58,6 +70,8 @@ class PathSeriesBase: public CFactorSeries
     size_t getNumDataPoints(void) const;
     size_t getNumDataPointsOnFile(const std::string &) const;
     double getPeakFactor(void) const;
+    virtual size_t getFingerprint(void) const;
+    virtual bool hasSameData(const PathSeriesBase &) const;
 
     inline Vector getPath(void) const
       { return thePath; }
@@ -64,8 +64,9 @@
 #include <domain/load/pattern/time_series/PathTimeSeries.h>
 #include <utility/matrix/Vector.h>
 #include <cmath>
-
+#include <algorithm>
 #include <fstream>
+#include <boost/functional/hash.hpp>
 
 #include <iomanip>
 #include "utility/actor/actor/CommMetaData.h"
@@ -74,7 +75,7 @@
 
 //! @brief Default constructor.
 XC::PathTimeSeries::PathTimeSeries(void)
-  :PathSeriesBase(TSERIES_TAG_PathTimeSeries), currentTimeLoc(0) {}
+  :PathSeriesBase(TSERIES_TAG_PathTimeSeries), currentTimeLoc(0), timeIncr(0.0) {}
 
 //! @brief Constructor.
 //!
@@ -82,7 +83,8 @@ XC::PathTimeSeries::PathTimeSeries(void)
 //! @param theTimePath: vector containing the time values (abscissae).
 //! @param theFactor:  constant factor used in the relation.
 XC::PathTimeSeries::PathTimeSeries(const Vector &theLoadPath, const Vector &theTimePath, double theFactor, bool last)
-  :PathSeriesBase(TSERIES_TAG_PathTimeSeries,theLoadPath,theFactor, last),time(theTimePath), currentTimeLoc(0) {}
+  :PathSeriesBase(TSERIES_TAG_PathTimeSeries,theLoadPath,theFactor, last),time(theTimePath), currentTimeLoc(0), timeIncr(0.0)
+  { setup_time_increment(); }
 
 
 //! @brief Constructor.
@@ -91,13 +93,13 @@ XC::PathTimeSeries::PathTimeSeries(const Vector &theLoadPath, const Vector &theT
 //! @param fileTimeName: name of the file containing the time values.
 //! @param theFactor:  constant factor used in the relation.
 XC::PathTimeSeries::PathTimeSeries(const std::string &filePathName,const std::string &fileTimeName, double theFactor, bool last)
-  :PathSeriesBase(TSERIES_TAG_PathTimeSeries, theFactor, last), currentTimeLoc(0)
+  :PathSeriesBase(TSERIES_TAG_PathTimeSeries, theFactor, last), currentTimeLoc(0), timeIncr(0.0)
   { readFromFiles(filePathName,fileTimeName); }
 
 
 //! @brief Constructor.
 XC::PathTimeSeries::PathTimeSeries(const std::string &fileName, double theFactor, bool last)
-  :PathSeriesBase(TSERIES_TAG_PathTimeSeries, theFactor, last), currentTimeLoc(0)
+  :PathSeriesBase(TSERIES_TAG_PathTimeSeries, theFactor, last), currentTimeLoc(0), timeIncr(0.0)
   { readFromFile(fileName); }
 
 //! @brief Read path from file.
@@ -157,6 +159,7 @@ bool XC::PathTimeSeries::readFromFile(const std::string &fileName)
             theFile1.close();
           }
       }
+    setup_time_increment();
     return (numDataPoints!=0);
   }
 
@@ -234,6 +237,116 @@ bool XC::PathTimeSeries::readFromFiles(const std::string &filePathName,const std
 	              << "; zero values read from file: "
 	              << fileTimeName << std::endl;
       }
+    setup_time_increment();
+    return retval;
+  }
+
+//! @brief Read the path from a binary file (see PathSeriesBase).
+//!
+//! If the file doesn't store the time values, they are computed from
+//! the start time and the time increment stored in the file.
+bool XC::PathTimeSeries::readFromBinaryFile(const std::string &fileName)
+  {
+    double dt= 0.0, t0= 0.0;
+    const bool retval= read_binary_file(fileName, time, thePath, dt, t0);
+    if(retval && (time.Size()!=thePath.Size()))
+      {
+	const int n= thePath.Size();
+	time.resize(n);
+	for(int i= 0;i<n;i++)
+	  time(i)= t0+i*dt;
+      }
+    currentTimeLoc= 0;
+    setup_time_increment();
+    return retval;
+  }
+
+//! @brief Write the path and the time values to a binary file
+//! (see PathSeriesBase).
+bool XC::PathTimeSeries::writeToBinaryFile(const std::string &fileName) const
+  {
+    const double t0= (time.Size()>0 ? time(0) : 0.0);
+    return write_binary_file(fileName, &time, thePath, timeIncr, t0);
+  }
+
+//! @brief Return a hash value computed from the series data.
+size_t XC::PathTimeSeries::getFingerprint(void) const
+  {
+    size_t retval= PathSeriesBase::getFingerprint();
+    const double *t= time.getDataPtr();
+    if(t)
+      boost::hash_range(retval, t, t+time.Size());
+    return retval;
+  }
+
+//! @brief Return true if the series argument has the same data
+//! than this one (see PathSeriesBase::hasSameData).
+bool XC::PathTimeSeries::hasSameData(const PathSeriesBase &other) const
+  {
+    bool retval= PathSeriesBase::hasSameData(other);
+    if(retval)
+      {
+        const PathTimeSeries *tmp= dynamic_cast<const PathTimeSeries *>(&other);
+        retval= tmp && equal_vectors(time, tmp->time);
+      }
+    return retval;
+  }
+
+//! @brief Compute the time increment if the time values are equally spaced
+//! (if not, the time increment is set to zero).
+void XC::PathTimeSeries::setup_time_increment(void)
+  {
+    timeIncr= 0.0;
+    const int sz= time.Size();
+    if(sz>1)
+      {
+	const double t0= time(0);
+	const double dt= (time(sz-1)-t0)/(sz-1);
+	if(dt>0.0)
+	  {
+	    const double tol= 1e-9*dt;
+	    bool uniform= true;
+	    for(int i= 1;i<sz;i++)
+	      if(std::abs(time(i)-(t0+i*dt))>tol)
+		{
+		  uniform= false;
+		  break;
+		}
+	    if(uniform)
+	      timeIncr= dt;
+	  }
+      }
+    if(currentTimeLoc>=sz)
+      currentTimeLoc= 0;
+  }
+
+//! @brief Return the index i of the interval [time(i), time(i+1)] that
+//! contains the given time (it is assumed that time(0)<=t<=time(n-1) and n>1).
+//!
+//! For equally spaced time values the index is computed directly, otherwise
+//! the interval of the last query is checked first and then a binary search
+//! is performed.
+int XC::PathTimeSeries::find_time_interval(const double &t) const
+  {
+    const int sizem2= time.Size()-2;
+    int retval= currentTimeLoc;
+    if(timeIncr>0.0)
+      {
+	retval= static_cast<int>((t-time(0))/timeIncr);
+	retval= std::max(0,std::min(retval,sizem2));
+	// correct round-off errors.
+	while((retval>0) && (t<time(retval)))
+	  retval--;
+	while((retval<sizem2) && (t>time(retval+1)))
+	  retval++;
+      }
+    else if((retval<0) || (retval>sizem2) || (t<time(retval)) || (t>time(retval+1)))
+      {
+	const double *first= time.getDataPtr();
+	const double *last= first+time.Size();
+	retval= static_cast<int>(std::upper_bound(first, last, t)-first)-1;
+	retval= std::max(0,std::min(retval,sizem2));
+      }
     return retval;
   }
 
@@ -252,62 +365,34 @@ double XC::PathTimeSeries::getTimeIncr(double pseudoTime) const
 //! points times the factor \p cFactor.
 double XC::PathTimeSeries::getFactor(double pseudoTime) const
   {
+    const int size= time.Size();
     // check for a quick return
-    if(thePath.Size()<1)
+    if((thePath.Size()<1) || (size<1))
       return 0.0;
 
-    // determine indexes into the data array whose boundary holds the time
-    double time1= time(currentTimeLoc);
-
     // check for another quick return
-    if(pseudoTime < time1 && currentTimeLoc == 0)
+    if(pseudoTime < time(0))
       return 0.0;
-    if(pseudoTime == time1)
-      return cFactor * thePath(currentTimeLoc);
-
-    const int size= time.Size();
-    const int sizem1= size - 1;
-    const int sizem2= size - 2;
 
     // check we are not at the end
-    if(pseudoTime > time1 && currentTimeLoc == sizem1)
+    const int sizem1= size - 1;
+    if(pseudoTime >= time(sizem1))
       {
-	if (useLast == false)
+	if(pseudoTime == time(sizem1))
+	  {
+	    currentTimeLoc= sizem1;
+	    return cFactor*thePath(sizem1);
+	  }
+	else if(useLast == false)
 	  return 0.0;
 	else
 	  return cFactor*thePath[sizem1];
       }
 
     // otherwise go find the current interval
-    double time2= time(currentTimeLoc+1);
-    if(pseudoTime > time2)
-      {
-        while((pseudoTime > time2) && (currentTimeLoc < sizem2))
-          {
-            currentTimeLoc++;
-            time1= time2;
-            time2= time(currentTimeLoc+1);
-          }
-        // if pseudo time greater than ending time return 0
-        if(pseudoTime > time2)
-	  {
-	    if(useLast == false)
-	      return 0.0;
-	    else
-	      return cFactor*thePath[sizem1];
-	  }
-      }
-    else if(pseudoTime < time1)
-      {
-        while((pseudoTime < time1) && (currentTimeLoc > 0))
-          {
-            currentTimeLoc--;
-            time2= time1;
-            time1= time(currentTimeLoc);
-          }
-        // if starting time less than initial starting time return 0
-        if(pseudoTime < time1) return 0.0;
-      }
+    currentTimeLoc= find_time_interval(pseudoTime);
+    const double time1= time(currentTimeLoc);
+    const double time2= time(currentTimeLoc+1);
     const double value1= thePath(currentTimeLoc);
     const double value2= thePath(currentTimeLoc+1);
     return cFactor*(value1 + (value2-value1)*(pseudoTime-time1)/(time2 - time1));
@@ -346,6 +431,7 @@ void XC::PathTimeSeries::setPyDict(const boost::python::dict &d)
     PathSeriesBase::setPyDict(d);
     this->time= Vector(boost::python::extract<boost::python::list>(d["time"]));
     this->currentTimeLoc= boost::python::extract<int>(d["current_time_loc"]);
+    setup_time_increment();
   }
 
 //! @brief Send members through the communicator argument.
@@ -363,6 +449,7 @@ int XC::PathTimeSeries::recvData(const Communicator &comm)
     int res= PathSeriesBase::recvData(comm);
     res+= comm.receiveVector(time,getDbTagData(),CommMetaData(5));
     res+= comm.receiveInt(currentTimeLoc,getDbTagData(),CommMetaData(6));
+    setup_time_increment();
     return res;
   }
 
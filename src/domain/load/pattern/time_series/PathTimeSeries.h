@@ -81,11 +81,20 @@ class Vector;
 //! time values. For a pseudo time not at a path point, linear interpolation
 //! is performed to determine the load factor. If the time specified is
 //! beyond the last path point a load factor of \f$0.0\f$ will be returned.
+//!
+//! The interval that contains the pseudo time is located in constant
+//! time when the time values are equally spaced and by binary search
+//! otherwise, so non-monotonic queries (sub-stepping, revertToLastCommit)
+//! don't need to walk along the series.
 class PathTimeSeries: public PathSeriesBase
   {
   private:
     Vector time; //!< vector containing the time values of data points
     mutable int currentTimeLoc; //!< current location in time
+    double timeIncr; //!< time increment if the time values are equally spaced (0.0 otherwise).
+
+    void setup_time_increment(void);
+    int find_time_interval(const double &) const;
   protected:
     int sendData(Communicator &comm);
     int recvData(const Communicator &comm);
@@ -108,7 +117,10 @@ class PathTimeSeries: public PathSeriesBase
     inline Vector getTime(void) const
       { return time; }
     inline void setTime(const Vector &d)
-      { time= d; }
+      {
+	time= d;
+	setup_time_increment();
+      }
     inline int getCurrentTimeLoc(void) const
       { return currentTimeLoc; }
     inline void setCurrentTimeLoc(const int &d)
@@ -119,6 +131,10 @@ class PathTimeSeries: public PathSeriesBase
 
     bool readFromFile(const std::string &fileName);
     bool readFromFiles(const std::string &filePathName,const std::string &fileTimeName);
+    bool readFromBinaryFile(const std::string &fileName);
+    bool writeToBinaryFile(const std::string &fileName) const;
+    size_t getFingerprint(void) const;
+    bool hasSameData(const PathSeriesBase &) const;
 
     // methods for output
     int sendSelf(Communicator &);
@@ -60,6 +60,8 @@ class_<XC::PathSeries, bases<XC::PathSeriesBase>, boost::noncopyable >("PathSeri
   .add_property("timeIncr", get_time_increment_void, &XC::PathSeries::setTimeIncr, "Get/set the time increment value.")
   .add_property("startTime", &XC::PathSeries::getStartTime, &XC::PathSeries::setStartTime, "Get/set the start time.")
   .def("readFromFile",&XC::PathSeries::readFromFile,"Read motion data from file.")
+  .def("readFromBinaryFile",&XC::PathSeries::readFromBinaryFile,"Read motion data from a binary file.")
+  .def("writeToBinaryFile",&XC::PathSeries::writeToBinaryFile,"Write motion data to a binary file.")
   ;
 
 class_<XC::PathTimeSeries, bases<XC::PathSeriesBase>, boost::noncopyable >("PathTimeSeries", no_init)
@@ -67,6 +69,8 @@ class_<XC::PathTimeSeries, bases<XC::PathSeriesBase>, boost::noncopyable >("Path
   .add_property("currentTimeLoc", &XC::PathTimeSeries::getCurrentTimeLoc,&XC::PathTimeSeries::setCurrentTimeLoc)
   .def("readFromFile",&XC::PathTimeSeries::readFromFile,"Read motion data from file.")
   .def("readFromFiles",&XC::PathTimeSeries::readFromFiles,"Read motion data from files.")
+  .def("readFromBinaryFile",&XC::PathTimeSeries::readFromBinaryFile,"Read motion data from a binary file.")
+  .def("writeToBinaryFile",&XC::PathTimeSeries::writeToBinaryFile,"Write motion data to a binary file.")
   ;
 
 class_<XC::DiscretizedRandomProcessSeries, bases<XC::TimeSeries>, boost::noncopyable >("DiscretizedRandomProcessSeries", no_init)
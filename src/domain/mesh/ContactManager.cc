@@ -0,0 +1,303 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis C. Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//ContactManager.cc
+
+#include "ContactManager.h"
+#include "domain/mesh/Mesh.h"
+#include "domain/mesh/node/Node.h"
+#include "domain/mesh/element/Element.h"
+#include "domain/mesh/element/utils/NodePtrsWithIDs.h"
+#include "utility/geom/pos_vec/Pos3d.h"
+#include "utility/matrix/ID.h"
+#include "utility/tagged/DefaultTag.h"
+
+//! @brief Constructor.
+XC::ContactManager::ContactManager(Mesh *owr)
+  : CommandEntity(owr), prototype(nullptr),
+    activationGap(0.0), releaseGap(0.0), automaticUpdate(true),
+    numCreated(0), numActivated(0), numReleased(0) {}
+
+//! @brief Destructor.
+XC::ContactManager::~ContactManager(void)
+  { free_prototype(); }
+
+//! @brief Frees the prototype element.
+void XC::ContactManager::free_prototype(void)
+  {
+    if(prototype)
+      {
+        delete prototype;
+        prototype= nullptr;
+      }
+  }
+
+//! @brief Return a pointer to the mesh that owns this object.
+XC::Mesh *XC::ContactManager::getMesh(void)
+  {
+    Mesh *retval= dynamic_cast<Mesh *>(Owner());
+    if(!retval)
+      std::cerr << getClassName() << "::" << __FUNCTION__
+		<< "; mesh needed." << std::endl;
+    return retval;
+  }
+
+//! @brief Set the nodes of the primary surface.
+void XC::ContactManager::setPrimaryNodeTags(const ID &tags)
+  {
+    primaryNodeTags.resize(tags.Size());
+    for(int i= 0;i<tags.Size();i++)
+      primaryNodeTags[i]= tags(i);
+  }
+
+//! @brief Set the nodes of the secondary surface.
+void XC::ContactManager::setSecondaryNodeTags(const ID &tags)
+  {
+    secondaryNodeTags.resize(tags.Size());
+    for(int i= 0;i<tags.Size();i++)
+      secondaryNodeTags[i]= tags(i);
+  }
+
+//! @brief Set the element that will be copied to create the contact
+//! pairs. The first node of the new elements will be the secondary
+//! one and the second one the primary node (as in ZeroLengthContact2D
+//! or ZeroLengthContact3D).
+void XC::ContactManager::setPrototype(const Element &e)
+  {
+    if(e.getNumExternalNodes()!=2)
+      std::cerr << getClassName() << "::" << __FUNCTION__
+		<< "; element: " << e.getClassName()
+		<< " has " << e.getNumExternalNodes()
+		<< " nodes, a node to node contact element is needed."
+		<< std::endl;
+    else
+      {
+        free_prototype();
+        prototype= e.getCopy();
+      }
+  }
+
+//! @brief Set the gap under which the pairs are activated.
+void XC::ContactManager::setActivationGap(const double &d)
+  {
+    activationGap= d;
+    if(releaseGap<activationGap)
+      releaseGap= activationGap;
+  }
+
+//! @brief Set the gap over which the pairs are deactivated. It must not
+//! be smaller than the activation gap (otherwise the pairs would be
+//! activated and deactivated in the same update).
+void XC::ContactManager::setReleaseGap(const double &d)
+  {
+    if(d<activationGap)
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+		  << "; release gap: " << d
+		  << " is smaller than the activation gap: "
+		  << activationGap << ". Using the activation gap."
+		  << std::endl;
+        releaseGap= activationGap;
+      }
+    else
+      releaseGap= d;
+  }
+
+//! @brief Return true if the surfaces, the prototype element
+//! and the activation gap are defined.
+bool XC::ContactManager::isDefined(void) const
+  {
+    return (prototype && !primaryNodeTags.empty() && !secondaryNodeTags.empty() && (activationGap>0.0));
+  }
+
+//! @brief Creates the contact element for the pair (secondary, primary).
+XC::Element *XC::ContactManager::create_pair(Mesh &mesh, const int &secondaryTag, const int &primaryTag)
+  {
+    DefaultTag &defaultTag= Element::getDefaultTag();
+    Element *retval= prototype->getCopy();
+    retval->setTag(defaultTag.getTag());
+    ID nodeTags(2);
+    nodeTags(0)= secondaryTag;
+    nodeTags(1)= primaryTag;
+    // The node pointers are set when the element is added to the mesh.
+    retval->getNodePtrs().set_id_nodes(nodeTags);
+    if(mesh.addElement(retval))
+      {
+        pairs[pair_key(secondaryTag, primaryTag)]= retval->getTag();
+        defaultTag++;
+      }
+    else
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+		  << "; can't create the contact element for nodes: "
+		  << secondaryTag << " and " << primaryTag
+		  << std::endl;
+        delete retval;
+        retval= nullptr;
+      }
+    return retval;
+  }
+
+//! @brief Build the k-d tree with the current position
+//! of the primary nodes.
+void XC::ContactManager::build_tree(Mesh &mesh)
+  {
+    kdtree.clear();
+    for(std::vector<int>::const_iterator i= primaryNodeTags.begin();i!=primaryNodeTags.end();i++)
+      {
+        const Node *n= mesh.getNode(*i);
+        if(n)
+          kdtree.insert(*n, n->getCurrentPosition3d());
+      }
+  }
+
+//! @brief Deactivate the pairs whose nodes are farther than the release gap.
+void XC::ContactManager::release_pairs(Mesh &mesh)
+  {
+    pair_map::iterator i= pairs.begin();
+    while(i!=pairs.end())
+      {
+        Element *e= mesh.getElement(i->second);
+        if(!e) // Removed from the mesh.
+          {
+            i= pairs.erase(i);
+            continue;
+          }
+        if(e->isAlive())
+          {
+            const Node *secondary= mesh.getNode(i->first.first);
+            const Node *primary= mesh.getNode(i->first.second);
+            if(secondary && primary)
+              {
+                const double d= secondary->getCurrentPosition3d().dist(primary->getCurrentPosition3d());
+                if(d>releaseGap)
+                  {
+                    e->kill();
+                    numReleased++;
+                  }
+              }
+          }
+        i++;
+      }
+  }
+
+//! @brief Activate (creating them if needed) the pairs whose nodes are
+//! closer than the activation gap.
+void XC::ContactManager::activate_pairs(Mesh &mesh)
+  {
+    for(std::vector<int>::const_iterator i= secondaryNodeTags.begin();i!=secondaryNodeTags.end();i++)
+      {
+        const Node *secondary= mesh.getNode(*i);
+        if(!secondary)
+          continue;
+        const std::deque<const Node *> near= kdtree.getNodesWithinRange(secondary->getCurrentPosition3d(), activationGap);
+        for(std::deque<const Node *>::const_iterator j= near.begin();j!=near.end();j++)
+          {
+            const int primaryTag= (*j)->getTag();
+            if(primaryTag==*i) // Same node.
+              continue;
+            pair_map::const_iterator k= pairs.find(pair_key(*i, primaryTag));
+            if(k!=pairs.end())
+              {
+                Element *e= mesh.getElement(k->second);
+                if(e && e->isDead())
+                  {
+                    e->alive();
+                    numActivated++;
+                  }
+              }
+            else if(create_pair(mesh, *i, primaryTag))
+              numCreated++;
+          }
+      }
+  }
+
+//! @brief Update the contact pairs according to the current position
+//! of the nodes.
+//!
+//! Only the creation of new pairs changes the model topology (and
+//! triggers the renumbering of the DOFs in the next analysis step),
+//! the activation and deactivation of existing pairs doesn't.
+int XC::ContactManager::update(void)
+  {
+    numCreated= 0;
+    numActivated= 0;
+    numReleased= 0;
+    if(!isDefined())
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+		  << "; the surfaces, the prototype element and the"
+		  << " activation gap must be defined." << std::endl;
+        return -1;
+      }
+    Mesh *mesh= getMesh();
+    if(!mesh)
+      return -1;
+    release_pairs(*mesh);
+    build_tree(*mesh);
+    activate_pairs(*mesh);
+    return 0;
+  }
+
+//! @brief Return the number of active contact pairs.
+size_t XC::ContactManager::getNumActivePairs(void) const
+  {
+    size_t retval= 0;
+    const Mesh *mesh= dynamic_cast<const Mesh *>(Owner());
+    if(mesh)
+      for(pair_map::const_iterator i= pairs.begin();i!=pairs.end();i++)
+        {
+          const Element *e= mesh->getElement(i->second);
+          if(e && e->isAlive())
+            retval++;
+        }
+    return retval;
+  }
+
+//! @brief Return the tag of the element of the pair (-1 if the pair
+//! has not been created).
+int XC::ContactManager::getPairElementTag(const int &secondaryTag, const int &primaryTag) const
+  {
+    int retval= -1;
+    pair_map::const_iterator i= pairs.find(pair_key(secondaryTag, primaryTag));
+    if(i!=pairs.end())
+      retval= i->second;
+    return retval;
+  }
+
+//! @brief Clears the manager (the contact elements already created
+//! remain in the mesh).
+void XC::ContactManager::clearAll(void)
+  {
+    primaryNodeTags.clear();
+    secondaryNodeTags.clear();
+    free_prototype();
+    pairs.clear();
+    kdtree.clear();
+    numCreated= 0;
+    numActivated= 0;
+    numReleased= 0;
+  }
@@ -0,0 +1,135 @@
+// -*-c++-*-
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis C. Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//ContactManager.h
+
+#ifndef CONTACTMANAGER_H
+#define CONTACTMANAGER_H
+
+#include "utility/kernel/CommandEntity.h"
+#include "domain/mesh/node/KDTreeNodes.h"
+#include <map>
+#include <vector>
+
+namespace XC {
+
+class Mesh;
+class Domain;
+class Element;
+class ID;
+
+//! @ingroup Mesh
+//
+//! @brief Creates and activates node to node contact elements
+//! automatically.
+//!
+//! Instead of creating a contact element for each candidate pair of
+//! nodes, the user defines the primary and secondary surfaces (by its
+//! nodes) and a prototype contact element (i.e. a ZeroLengthContact2D
+//! or ZeroLengthContact3D element). At each committed step the manager
+//! uses a k-d tree built over the current positions of the primary
+//! nodes to find the pairs that are closer than the activation gap:
+//! - If the pair has no element yet, a copy of the prototype is
+//!   created (this is the only operation that changes the model
+//!   topology).
+//! - If the pair element is dead, it is reactivated.
+//! The elements of the pairs that separate more than the release gap
+//! are deactivated (see Element::kill) so the model doesn't need to
+//! be renumbered.
+class ContactManager: public CommandEntity
+  {
+  public:
+    typedef std::pair<int,int> pair_key; //!< (secondary node tag, primary node tag).
+    typedef std::map<pair_key, int> pair_map; //!< contact pair -> element tag.
+  private:
+    std::vector<int> primaryNodeTags; //!< nodes of the primary surface.
+    std::vector<int> secondaryNodeTags; //!< nodes of the secondary surface.
+    Element *prototype; //!< element to copy for the new pairs.
+    double activationGap; //!< pairs closer than this distance are activated.
+    double releaseGap; //!< pairs farther than this distance are deactivated.
+    bool automaticUpdate; //!< if true update the pairs each time the mesh is committed.
+    pair_map pairs; //!< contact pairs created by the manager.
+    KDTreeNodes kdtree; //!< primary nodes in their current position.
+    size_t numCreated; //!< number of pairs created in the last update.
+    size_t numActivated; //!< number of pairs activated in the last update.
+    size_t numReleased; //!< number of pairs deactivated in the last update.
+
+    void free_prototype(void);
+    Mesh *getMesh(void);
+    Element *create_pair(Mesh &, const int &, const int &);
+    void build_tree(Mesh &);
+    void release_pairs(Mesh &);
+    void activate_pairs(Mesh &);
+
+    ContactManager(const ContactManager &);
+    ContactManager &operator=(const ContactManager &);
+  protected:
+    friend class Mesh;
+    ContactManager(Mesh *owr);
+    ~ContactManager(void);
+  public:
+    void setPrimaryNodeTags(const ID &);
+    void setSecondaryNodeTags(const ID &);
+    void setPrototype(const Element &);
+    //! @brief Return the gap under which the pairs are activated.
+    inline double getActivationGap(void) const
+      { return activationGap; }
+    void setActivationGap(const double &);
+    //! @brief Return the gap over which the pairs are deactivated.
+    inline double getReleaseGap(void) const
+      { return releaseGap; }
+    void setReleaseGap(const double &);
+    //! @brief Return true if the pairs are updated each time the
+    //! mesh is committed.
+    inline bool getAutomaticUpdate(void) const
+      { return automaticUpdate; }
+    //! @brief Set if the pairs are updated each time the mesh is committed.
+    inline void setAutomaticUpdate(const bool &b)
+      { automaticUpdate= b; }
+    bool isDefined(void) const;
+
+    int update(void);
+    //! @brief Return the number of contact pairs created so far.
+    inline size_t getNumPairs(void) const
+      { return pairs.size(); }
+    size_t getNumActivePairs(void) const;
+    //! @brief Return the number of pairs created in the last update.
+    inline size_t getNumCreated(void) const
+      { return numCreated; }
+    //! @brief Return the number of pairs activated in the last update.
+    inline size_t getNumActivated(void) const
+      { return numActivated; }
+    //! @brief Return the number of pairs deactivated in the last update.
+    inline size_t getNumReleased(void) const
+      { return numReleased; }
+    int getPairElementTag(const int &, const int &) const;
+    void clearAll(void);
+  };
+
+} // end of XC namespace
+
+#endif
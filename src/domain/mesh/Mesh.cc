@@ -38,6 +38,8 @@
 #include "domain/mesh/element/ElementIter.h"
 #include "domain/mesh/node/NodeIter.h"
 #include <domain/domain/single/SingleDomEleIter.h>
+#include <map>
+#include <typeindex>
 #include <domain/domain/single/SingleDomNodIter.h>
 
 #include <utility/tagged/storage/MapOfTaggedObjects.h>
@@ -117,7 +119,7 @@ void XC::Mesh::init_bounds(void)
 //! @brief Constructor.
 XC::Mesh::Mesh(CommandEntity *owr)
   :MeshComponentContainer(owr,DOMAIN_TAG_Mesh), eleGraphBuiltFlag(false), nodeGraphBuiltFlag(false),
-   theBounds(6), lockers(this)
+   updateBatchesBuiltFlag(false), theBounds(6), lockers(this), contactManager(this)
   {
     alloc_containers();
     alloc_iters();
@@ -129,7 +131,7 @@ XC::Mesh::Mesh(CommandEntity *owr)
 //! @brief Constructor.
 XC::Mesh::Mesh(CommandEntity *owr,TaggedObjectStorage &theNodesStorage,TaggedObjectStorage &theElementsStorage)
   : MeshComponentContainer(owr,DOMAIN_TAG_Mesh), eleGraphBuiltFlag(false),
-    nodeGraphBuiltFlag(false), theNodes(&theNodesStorage), theElements(&theElementsStorage), theBounds(6), lockers(this)
+    nodeGraphBuiltFlag(false), theNodes(&theNodesStorage), theElements(&theElementsStorage), updateBatchesBuiltFlag(false), theBounds(6), lockers(this), contactManager(this)
   {
     // init the iters
     alloc_iters();
@@ -149,7 +151,7 @@ XC::Mesh::Mesh(CommandEntity *owr,TaggedObjectStorage &theNodesStorage,TaggedObj
 XC::Mesh::Mesh(CommandEntity *owr,TaggedObjectStorage &theStorage)
   : MeshComponentContainer(owr,DOMAIN_TAG_Mesh),
     eleGraphBuiltFlag(false), nodeGraphBuiltFlag(false),
-    theBounds(6), lockers(this)
+    updateBatchesBuiltFlag(false), theBounds(6), lockers(this), contactManager(this)
   {
     // init the arrays for storing the mesh components
     theStorage.clearAll(); // clear the storage just in case populated
@@ -181,6 +183,7 @@ void XC::Mesh::clearAll(void)
     // FEProblem objects.
     // Node::getDefaultTag().setTag(0);
     lockers.clearAll();
+    contactManager.clearAll();
 
     // set the bounds around the origin
     theBounds.Zero();
@@ -188,6 +191,7 @@ void XC::Mesh::clearAll(void)
     // rest the flag to be as initial
     nodeGraphBuiltFlag= false;
     eleGraphBuiltFlag= false;
+    domainChange();
   }
 
 //! @brief Destructor.
@@ -378,6 +382,7 @@ bool XC::Mesh::removeElement(int tag)
       }
     // remove the object from the container
     bool res= theElements->removeComponent(tag);
+    domainChange(); // the element groups are out of date.
     return res;
   }
 
@@ -899,7 +904,11 @@ int XC::Mesh::commit(void)
     while((elePtr = theElemIter()) != 0)
       { elePtr->commitState(); }
 
-    return 0;
+    // activate or release the contact pairs for the next step.
+    int retval= 0;
+    if(contactManager.getAutomaticUpdate() && contactManager.isDefined())
+      retval= contactManager.update();
+    return retval;
   }
 
 //! @brief Returns the mesh to its last committed state.
@@ -943,19 +952,43 @@ int XC::Mesh::revertToStart(void)
     return update();
   }
 
+//! @brief Groups the elements by class (see update).
+void XC::Mesh::build_update_batches(void)
+  {
+    std::map<std::type_index, std::vector<Element *> > batches;
+    ElementIter &theEles = this->getElements();
+    Element *theEle;
+    while((theEle = theEles()) != 0)
+      { batches[std::type_index(typeid(*theEle))].push_back(theEle); }
+    updateBatches.clear();
+    updateBatches.reserve(batches.size());
+    for(std::map<std::type_index, std::vector<Element *> >::iterator i= batches.begin(); i!= batches.end(); i++)
+      {
+        updateBatches.push_back(std::vector<Element *>());
+        updateBatches.back().swap(i->second);
+      }
+    updateBatchesBuiltFlag= true;
+  }
+
 //! @brief Update the element's state.
 //! 
 //! Called by the domain to update the state of the
-//! mesh. Iterates over all the elements and invokes {\em update()}. 
+//! mesh. Invokes {\em updateBatch()} for each group of elements
+//! of the same class (see Element::updateBatch). The groups
+//! are rebuilt only when the domain changes (see domainChange).
 int XC::Mesh::update(void)
   {
     int ok = 0;
 
+    if(!updateBatchesBuiltFlag)
+      build_update_batches();
+
     // invoke update on all the ele's
-    ElementIter &theEles = this->getElements();
-    Element *theEle;
-    while((theEle = theEles()) != 0)
-      { ok += theEle->update(); }
+    for(std::vector<std::vector<Element *> >::const_iterator i= updateBatches.begin(); i!= updateBatches.end(); i++)
+      {
+        const std::vector<Element *> &batch= *i;
+        ok+= batch.front()->updateBatch(batch.size(), batch.data());
+      }
 
     if(ok != 0)
       std::cerr << Color::red << getClassName() << "::" << __FUNCTION__
@@ -973,6 +1006,14 @@ void XC::Mesh::setGraphBuiltFlags(const bool &f)
     eleGraphBuiltFlag= f;
   }
 
+//! @brief Marks the element groups used in update as out of date
+//! (called when the domain changes: elements added or removed,...).
+void XC::Mesh::domainChange(void)
+  {
+    updateBatchesBuiltFlag= false;
+    updateBatches.clear();
+  }
+
 //! @brief Imprime el domain.
 void XC::Mesh::Print(std::ostream &s, int flag) const
   {
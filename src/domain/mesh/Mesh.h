@@ -33,9 +33,11 @@
 #include "domain/mesh/MeshComponentContainer.h"
 #include "utility/matrix/Vector.h"
 #include "NodeLockers.h"
+#include "ContactManager.h"
 #include "solution/graph/graph/Graph.h"
 #include "node/KDTreeNodes.h"
 #include "element/utils/KDTreeElements.h"
+#include <vector>
 
 class Pos3d;
 
@@ -80,12 +82,15 @@ class Mesh: public MeshComponentContainer
 
     TaggedObjectStorage *theElements;
     SingleDomEleIter *theEleIter;
+    std::vector<std::vector<Element *> > updateBatches; //!< elements grouped by class (see update).
+    bool updateBatchesBuiltFlag; //!< true if updateBatches corresponds to the current elements.
     KDTreeElements kdtreeElements; //!< space-partitioning data structure for organizing elements. Search finite element by its position (x,y,x).
 
     Vector theBounds;
     int tagNodeCheckReactionException;//!< Exception for checking reactions (see Domain::checkNodalReactions).
 
     NodeLockers lockers; //!< To block deactivated (dead) nodes.
+    ContactManager contactManager; //!< Creates and activates contact pairs.
 
     void alloc_containers(void);
     void alloc_iters(void);
@@ -96,6 +101,7 @@ class Mesh: public MeshComponentContainer
     void add_element_to_domain(Element *);
     void add_nodes_to_domain(void);
     void add_elements_to_domain(void);
+    void build_update_batches(void);
 
     Mesh(const Mesh &other);
     Mesh &operator=(const Mesh &other);
@@ -127,6 +133,7 @@ class Mesh: public MeshComponentContainer
     void clearDOF_GroupPtr(void);
 
     void setGraphBuiltFlags(const bool &f);
+    void domainChange(void);
 
     int initialize(void);
     virtual int setRayleighDampingFactors(const RayleighDampingFactors &rF);
@@ -150,6 +157,10 @@ class Mesh: public MeshComponentContainer
       { return lockers; }
     inline NodeLockers &getNodeLockers(void)
       { return lockers; }
+    inline const ContactManager &getContactManager(void) const
+      { return contactManager; }
+    inline ContactManager &getContactManager(void)
+      { return contactManager; }
 
     bool existElement(int tag);
     virtual Element *getElement(int tag);
@@ -140,6 +140,25 @@ int XC::Element::commitState(void)
 int XC::Element::update(void)
   { return 0; }
 
+//! @brief Updates the state of a batch of elements of the same
+//! class as this one (this element is used only to select the
+//! implementation).
+//!
+//! Called by Mesh::update with the elements grouped by class. The
+//! derived classes can override it to process the batch in a single
+//! pass (e.g. updating their materials through
+//! UniaxialMaterial::setTrialBatch). This base class implementation
+//! calls update() on each element.
+//! @param n: number of elements.
+//! @param elements: elements to update.
+int XC::Element::updateBatch(const size_t &n, Element *const elements[]) const
+  {
+    int retval= 0;
+    for(size_t i= 0;i<n;i++)
+      retval+= elements[i]->update();
+    return retval;
+  }
+
 //! @brief Reverts the element to its initial state.
 //!
 //! The element is to set it's current state to the state it was at before
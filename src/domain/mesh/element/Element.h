@@ -188,6 +188,7 @@ class Element: public MeshComponent
     virtual int revertToLastCommit(void) = 0;
     virtual int revertToStart(void);
     virtual int update(void);
+    virtual int updateBatch(const size_t &, Element *const []) const;
     virtual bool isSubdomain(void);
 
     // methods to return the current linearized stiffness,
@@ -60,6 +60,8 @@
 #include "domain/mesh/element/utils/coordTransformation/ShellCrdTransf3dBase.h"
 #include "utility/actor/actor/MovableVector.h"
 #include "utility/actor/actor/MovableMatrix.h"
+#include "utility/matrix/FixedMatrix.h"
+#include "utility/matrix/FixedVector.h"
 #include "utility/actor/actor/MovableVectors.h"
 #include "utility/geom/d2/Polygon3d.h"
 #include "preprocessor/Preprocessor.h"
@@ -218,16 +220,12 @@ const XC::Matrix &XC::ShellMITC4Base::getInitialStiff(void) const
 
     //  static double Shape[3][numnodes][ngauss]; //all the shape functions
 
-    static Matrix stiffJK(ndf,ndf); //nodeJK stiffness 
-    static Matrix dd(nstress,nstress);  //material tangent
-    static Matrix J0(2,2);  //Jacobian at center
-    static Matrix J0inv(2,2); //inverse of Jacobian at center
+    FixedMatrix<ndf,ndf> stiffJK; //nodeJK stiffness 
+    FixedMatrix<nstress,nstress> dd;  //material tangent
 
     //---------B-matrices------------------------------------
-    static Matrix BJ(nstress,ndf);      // B matrix node J
-    static Matrix BJtran(ndf,nstress);
-    static Matrix BK(nstress,ndf);      // B matrix node k
-    static Matrix BJtranD(ndf,nstress);
+    FixedMatrix<nstress,ndf> BJ;      // B matrix node J
+    FixedMatrix<ndf,nstress> BJtranD; // BJ^T*dd
     static Matrix Bbend(3,3);  // bending B matrix
     static Matrix Bshear(2,3); // shear B matrix
     static Matrix Bmembrane(3,2); // membrane B matrix
@@ -236,7 +234,7 @@ const XC::Matrix &XC::ShellMITC4Base::getInitialStiff(void) const
 
     double *drillPointer;
 
-    static double saveB[nstress][ndf][numnodes];
+    FixedMatrix<nstress,ndf> saveB[numnodes]; // B matrix of each node.
 
     //-------------------------------------------------------
 
@@ -316,14 +314,8 @@ const XC::Matrix &XC::ShellMITC4Base::getInitialStiff(void) const
                 Bshear(0,p)= Bs(0,j*3+p);
                 Bshear(1,p)= Bs(1,j*3+p);
               }//end for p
-            BJ= assembleB( Bmembrane, Bbend, Bshear );
-
 	    //save the B-matrix
-           for(p=0; p<nstress; p++)
-             {
-               for(q=0; q<ndf; q++ )
-                 saveB[p][q][j]= BJ(p,q);
-             }//end for p
+            saveB[j]= FixedMatrix<nstress,ndf>(assembleB( Bmembrane, Bbend, Bshear ));
 
            //drilling B matrix
            drillPointer= computeBdrill( j, shp );
@@ -335,7 +327,7 @@ const XC::Matrix &XC::ShellMITC4Base::getInitialStiff(void) const
              }//end for p
           } // end for j
 
-        dd= physicalProperties[i]->getInitialTangent( );
+        dd= FixedMatrix<nstress,nstress>(physicalProperties[i]->getInitialTangent( ));
         dd*= dvol[i];
 
         //tangent calculations node loops
@@ -344,11 +336,7 @@ const XC::Matrix &XC::ShellMITC4Base::getInitialStiff(void) const
         for(j=0;j<numnodes;j++)
           {
             //extract BJ
-            for(p=0; p<nstress; p++)
-              {
-                for(q=0; q<ndf; q++ )
-                  BJ(p,q)= saveB[p][q][j];
-              }//end for p
+            BJ= saveB[j];
 
             //multiply bending terms by (-1.0) for correct statement
             // of equilibrium  
@@ -358,14 +346,6 @@ const XC::Matrix &XC::ShellMITC4Base::getInitialStiff(void) const
                   BJ(p,q) *= (-1.0);
               } //end for p
 
-            //transpose 
-            //BJtran= transpose( 8, ndf, BJ );
-            for(p=0; p<ndf; p++)
-              {
-                for(q=0; q<nstress; q++) 
-                  BJtran(p,q)= BJ(q,p);
-              }//end for p
-
             //drilling B matrix
             drillPointer= computeBdrill( j, shp );
             for(p=0; p<ndf; p++ )
@@ -374,8 +354,8 @@ const XC::Matrix &XC::ShellMITC4Base::getInitialStiff(void) const
                 drillPointer++;
               }//end for p
 
-            //BJtranD= BJtran * dd;
-            BJtranD.addMatrixProduct(0.0, BJtran,dd,1.0 );
+            //BJtranD= BJ^T * dd;
+            BJtranD.addMatrixTransposeProduct(0.0, BJ,dd,1.0 );
       
             for(p=0; p<ndf; p++) 
               BdrillJ[p]*= ( Ktt*dvol[i] );
@@ -383,16 +363,9 @@ const XC::Matrix &XC::ShellMITC4Base::getInitialStiff(void) const
             kk= 0;
             for(k= 0; k < numnodes; k++ )
               {
-                //extract BK
-                for(p=0; p<nstress; p++)
-                  {
-                    for(q=0; q<ndf; q++ )
-                      BK(p,q)= saveB[p][q][k];
-                  }//end for p
-       
                 //stiffJK= BJtranD * BK;
                 // +  transpose( 1,ndf,BdrillJ ) * BdrillK; 
-                stiffJK.addMatrixProduct(0.0, BJtranD,BK,1.0 );
+                stiffJK.addMatrixProduct(0.0, BJtranD,saveB[k],1.0 );
 
                 //drilling B matrix
                 drillPointer= computeBdrill( k, shp );
@@ -477,21 +450,17 @@ void XC::ShellMITC4Base::formResidAndTangent(int tang_flag) const
     static double shp[3][numnodes];  //shape functions at a gauss point
 
     //  static double Shape[3][numnodes][ngauss]; //all the shape functions
-    static Vector residJ(ndf); //nodeJ residual 
-    static Matrix stiffJK(ndf,ndf); //nodeJK stiffness 
-    static Vector stress(nstress);  //stress resultants
-    static Matrix dd(nstress,nstress);  //material tangent
-    static Matrix J0(2,2);  //Jacobian at center
-    static Matrix J0inv(2,2); //inverse of Jacobian at center
+    FixedVector<ndf> residJ; //nodeJ residual 
+    FixedMatrix<ndf,ndf> stiffJK; //nodeJK stiffness 
+    FixedVector<nstress> stress;  //stress resultants
+    FixedMatrix<nstress,nstress> dd;  //material tangent
 
     double epsDrill= 0.0;  //drilling "strain"
     double tauDrill= 0.0; //drilling "stress"
 
     //---------B-matrices------------------------------------
-    static Matrix BJ(nstress,ndf);      // B matrix node J
-    static Matrix BJtran(ndf,nstress);
-    static Matrix BK(nstress,ndf);      // B matrix node k
-    static Matrix BJtranD(ndf,nstress);
+    FixedMatrix<nstress,ndf> BJ;      // B matrix node J
+    FixedMatrix<ndf,nstress> BJtranD; // BJ^T*dd
     static Matrix Bbend(3,3);  // bending B matrix
     static Matrix Bshear(2,3); // shear B matrix
     static Matrix Bmembrane(3,2); // membrane B matrix
@@ -500,7 +469,7 @@ void XC::ShellMITC4Base::formResidAndTangent(int tang_flag) const
 
     double *drillPointer;
 
-    static double saveB[nstress][ndf][numnodes];
+    FixedMatrix<nstress,ndf> saveB[numnodes]; // B matrix of each node.
 
     //------------------------------------------------------- 
 
@@ -588,21 +557,17 @@ void XC::ShellMITC4Base::formResidAndTangent(int tang_flag) const
                 Bshear(0,p)= Bs(0,j*3+p);
                 Bshear(1,p)= Bs(1,j*3+p);
               }//end for p
-            BJ= assembleB( Bmembrane, Bbend, Bshear );
+            const Matrix &B= assembleB( Bmembrane, Bbend, Bshear );
 
             //save the B-matrix
-            for(p=0; p<nstress; p++)
-              {
-                for(q=0; q<ndf; q++ )
-                  saveB[p][q][j]= BJ(p,q);
-              }//end for p
+            saveB[j]= FixedMatrix<nstress,ndf>(B);
 
             //nodal "displacements" 
             const Vector &ul= theCoordTransf->getBasicTrialDisp(j);
 
             //compute the strain
             //strain += (BJ*ul); 
-            strain.addMatrixVector(1.0, BJ,ul,1.0 );
+            strain.addMatrixVector(1.0, B,ul,1.0 );
 
             //drilling B matrix
             drillPointer= computeBdrill( j, shp );
@@ -625,7 +590,7 @@ void XC::ShellMITC4Base::formResidAndTangent(int tang_flag) const
         success= const_cast<SectionForceDeformation *>(physicalProperties[i])->setTrialSectionDeformation(strain);
 
         //compute the stress
-        stress= physicalProperties[i]->getStressResultant( );
+        stress= FixedVector<nstress>(physicalProperties[i]->getStressResultant( ));
 
         //drilling "stress" 
         tauDrill= Ktt * epsDrill;
@@ -636,7 +601,7 @@ void XC::ShellMITC4Base::formResidAndTangent(int tang_flag) const
 
         if( tang_flag == 1 )
           {
-            dd= physicalProperties[i]->getSectionTangent( );
+            dd= FixedMatrix<nstress,nstress>(physicalProperties[i]->getSectionTangent( ));
             dd *= dvol[i];
           } //end if tang_flag
 
@@ -647,11 +612,7 @@ void XC::ShellMITC4Base::formResidAndTangent(int tang_flag) const
         for(j=0;j<numnodes;j++)
           {
             //extract BJ
-            for(p=0; p<nstress;p++)
-              {
-                for(q=0;q<ndf;q++)
-                  BJ(p,q)= saveB[p][q][j];
-              }//end for p
+            BJ= saveB[j];
 
             //multiply bending terms by (-1.0) for correct statement
             // of equilibrium  
@@ -661,14 +622,8 @@ void XC::ShellMITC4Base::formResidAndTangent(int tang_flag) const
                   BJ(p,q) *= (-1.0);
               } //end for p
 
-            //transpose 
-            for(p=0; p<ndf; p++)
-              {
-                for(q=0; q<nstress; q++) 
-                  BJtran(p,q)= BJ(q,p);
-              }//end for p
-
-            residJ.addMatrixVector(0.0, BJtran,stress,1.0 );
+            //residJ= BJ^T * stress
+            residJ.addMatrixTransposeVector(0.0, BJ,stress,1.0 );
 
             //drilling B matrix
             drillPointer= computeBdrill( j, shp );
@@ -684,20 +639,14 @@ void XC::ShellMITC4Base::formResidAndTangent(int tang_flag) const
 
             if(tang_flag==1)
               {
-                BJtranD.addMatrixProduct(0.0, BJtran,dd,1.0 );
+                //BJtranD= BJ^T * dd;
+                BJtranD.addMatrixTransposeProduct(0.0, BJ,dd,1.0 );
                 for(p=0; p<ndf; p++) 
                   BdrillJ[p] *= ( Ktt*dvol[i] );
 
                 kk= 0;
                 for(k=0;k<numnodes;k++)
                   {
-                    //extract BK
-                    for(p=0; p<nstress; p++)
-                      {
-                        for(q=0; q<ndf; q++ )
-                          BK(p,q)= saveB[p][q][k];
-                      }//end for p
-            
                      //drilling B matrix
                      drillPointer= computeBdrill( k, shp );
                      for(p=0; p<ndf; p++ )
@@ -708,7 +657,7 @@ void XC::ShellMITC4Base::formResidAndTangent(int tang_flag) const
  
                     //stiffJK= BJtranD * BK;
                     // +  transpose( 1,ndf,BdrillJ ) * BdrillK; 
-                    stiffJK.addMatrixProduct(0.0, BJtranD,BK,1.0);
+                    stiffJK.addMatrixProduct(0.0, BJtranD,saveB[k],1.0);
 
                     for(p=0;p<ndf;p++)
                       {
@@ -74,6 +74,8 @@
 
 #include "domain/component/Parameter.h"
 #include "utility/actor/actor/ArrayCommMetaData.h"
+#include <algorithm>
+#include <typeindex>
 
 //! @brief Free the material pointer.
 void XC::Truss::free_material(void)
@@ -334,6 +336,119 @@ int XC::Truss::update(void)
     return theMaterial->setTrialStrain(strain, rate);
   }
 
+//! @brief Work data of Truss::updateBatch: grouping of the batch
+//! materials by class and arrays for the strains and the material
+//! response. It is kept between calls so no memory is allocated on
+//! each update; the grouping is rebuilt only when the materials
+//! of the batch change.
+struct XC::Truss::BatchData
+  {
+    std::vector<const UniaxialMaterial *> materials; //!< materials of the elements (element order).
+    std::vector<const std::type_info *> types; //!< classes of the materials (element order).
+    std::vector<size_t> order; //!< element indexes sorted by material class.
+    std::vector<size_t> groups; //!< position in order of the first element of each group (plus the end).
+    std::vector<UniaxialMaterial *> mats; //!< materials sorted by class.
+    std::vector<double> strains; //!< element strains (element order).
+    std::vector<double> rates; //!< element strain rates (element order).
+    std::vector<double> eps; //!< element strains sorted by material class.
+    std::vector<double> stresses; //!< material stresses sorted by class.
+    std::vector<double> tangents; //!< material tangents sorted by class.
+
+    bool isValid(const size_t &, Element *const []) const;
+    void setup(const size_t &, Element *const []);
+  };
+
+XC::Truss::BatchData XC::Truss::batchData;
+
+//! @brief Returns true if the grouping corresponds to the
+//! materials of the elements argument.
+bool XC::Truss::BatchData::isValid(const size_t &n, Element *const elements[]) const
+  {
+    bool retval= (materials.size()==n);
+    for(size_t i= 0;retval && (i<n);i++)
+      {
+        const UniaxialMaterial *m= static_cast<const Truss *>(elements[i])->theMaterial;
+        retval= (m==materials[i]) && (typeid(*m)==*types[i]);
+      }
+    return retval;
+  }
+
+//! @brief Groups the materials of the elements argument by class.
+void XC::Truss::BatchData::setup(const size_t &n, Element *const elements[])
+  {
+    materials.resize(n);
+    types.resize(n);
+    order.resize(n);
+    for(size_t i= 0;i<n;i++)
+      {
+        const UniaxialMaterial *m= static_cast<const Truss *>(elements[i])->theMaterial;
+        materials[i]= m;
+        types[i]= &typeid(*m);
+        order[i]= i;
+      }
+    std::stable_sort(order.begin(), order.end(), [this](const size_t &a, const size_t &b)
+      { return std::type_index(*types[a])<std::type_index(*types[b]); });
+    mats.resize(n);
+    groups.clear();
+    for(size_t k= 0;k<n;k++)
+      {
+        const size_t i= order[k];
+        mats[k]= static_cast<const Truss *>(elements[i])->theMaterial;
+        if((k==0) || (*types[i]!=*types[order[k-1]]))
+          groups.push_back(k);
+      }
+    groups.push_back(n);
+    strains.resize(n);
+    rates.resize(n);
+    eps.resize(n);
+    stresses.resize(n);
+    tangents.resize(n);
+  }
+
+//! @brief Update the state of a batch of trusses (see Element::updateBatch).
+//!
+//! The strains are computed in a first pass. Then, if all the strain
+//! rates are zero (static analysis), each group of materials of the
+//! same class is updated with a single call to
+//! UniaxialMaterial::setTrialBatch. The grouping and the work arrays
+//! are shared by all the trusses (see BatchData), so this method is
+//! not reentrant.
+int XC::Truss::updateBatch(const size_t &n, Element *const elements[]) const
+  {
+    if(typeid(*this)!=typeid(Truss)) // derived class.
+      return Element::updateBatch(n, elements);
+    int retval= 0;
+    BatchData &bd= batchData;
+    if(!bd.isValid(n, elements))
+      bd.setup(n, elements);
+    bool zeroRates= true;
+    for(size_t i= 0;i<n;i++)
+      {
+        const Truss *t= static_cast<const Truss *>(elements[i]);
+        bd.strains[i]= t->computeCurrentStrain();
+        bd.rates[i]= t->computeCurrentStrainRate();
+        zeroRates= zeroRates && (bd.rates[i]==0.0);
+      }
+    if(zeroRates)
+      {
+        for(size_t k= 0;k<n;k++)
+          bd.eps[k]= bd.strains[bd.order[k]];
+        const size_t numGroups= bd.groups.size()-1;
+        for(size_t g= 0;g<numGroups;g++)
+          {
+            const size_t first= bd.groups[g];
+            const size_t sz= bd.groups[g+1]-first;
+            retval+= bd.mats[first]->setTrialBatch(sz, bd.mats.data()+first, bd.eps.data()+first, bd.stresses.data()+first, bd.tangents.data()+first);
+          }
+      }
+    else
+      {
+        for(size_t i= 0;i<n;i++)
+          retval+= static_cast<const Truss *>(elements[i])->theMaterial->setTrialStrain(bd.strains[i], bd.rates[i]);
+      }
+    return retval;
+  }
+
 //! @brief Returns the tangent stiffness matrix.
 const XC::Matrix &XC::Truss::getTangentStiff(void) const
   {
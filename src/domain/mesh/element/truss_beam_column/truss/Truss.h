@@ -93,6 +93,9 @@ class Truss: public TrussBase
     
     double persistentInitialDeformation; //!< Persistent initial strain at element level. Used to store the deformation during the inactive phase of the element (if any).
 
+    struct BatchData;
+    static BatchData batchData; //!< work data of updateBatch.
+
     void initialize(void);
   protected:
     DbTagData &getDbTagData(void) const;
@@ -125,6 +128,7 @@ class Truss: public TrussBase
     int revertToLastCommit(void);        
     int revertToStart(void);        
     int update(void);
+    int updateBatch(const size_t &, Element *const []) const;
     
     const Material *getMaterial(void) const;
     Material *getMaterial(void);
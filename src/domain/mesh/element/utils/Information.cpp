@@ -160,6 +160,29 @@ int XC::Information::setVector(const XC::Vector &newVector)
     return -1;
 }
 
+//! @brief Make the vector of this object use the memory pointed
+//! by the argument (that must be able to hold n values), so the
+//! values set with setVector are written directly there.
+//!
+//! The current values of the vector are copied to the new storage.
+//! Return 0 if the data holds a vector of size n, -1 otherwise.
+int XC::Information::bindVector(double *dest, const size_t &n)
+  {
+    int retval= -1;
+    if((theType == VectorType) && theVector && (theVector->Size()==int(n)) && (n>0))
+      {
+        std::copy(theVector->getDataPtr(), theVector->getDataPtr()+n, dest);
+        theVector->setData(dest, n);
+        retval= 0;
+      }
+    return retval;
+  }
+
+//! @brief Return true if the vector of this object is stored
+//! at the memory pointed by the argument (see bindVector).
+bool XC::Information::isBoundTo(const double *dest) const
+  { return (theType == VectorType) && theVector && (theVector->getDataPtr()==dest); }
+
 int XC::Information::setMatrix(const XC::Matrix &newMatrix)
 {
   if(theMatrix != 0) {
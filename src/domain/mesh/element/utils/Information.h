@@ -109,6 +109,9 @@ class Information: public MovableObject
     virtual int setVector(const Vector &newVector);
     virtual int setMatrix(const Matrix &newMatrix);
     virtual int setTensor(const BJtensor &newTensor);
+
+    int bindVector(double *, const size_t &);
+    bool isBoundTo(const double *) const;
     
     int sendSelf(Communicator &);  
     int recvSelf(const Communicator &);
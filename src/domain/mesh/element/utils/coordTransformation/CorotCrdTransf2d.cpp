@@ -83,7 +83,6 @@ Journal of Structural Engineering, 133(2):155-165.
 
 // initialize static variables
 XC::Matrix XC::CorotCrdTransf2d::Tlg(6,6);
-XC::Matrix XC::CorotCrdTransf2d::Tbl(3,6);
 XC::Vector XC::CorotCrdTransf2d::uxg(3); 
 XC::Vector XC::CorotCrdTransf2d::pg(6); 
 XC::Vector XC::CorotCrdTransf2d::dub(3); 
@@ -251,6 +250,7 @@ int XC::CorotCrdTransf2d::update(void)
     this->transfLocalDisplsToBasic(ul);
     
     // compute the transformation matrix from local to the basic system
+    // (reused by getGlobalResistingForce and getGlobalStiffMatrix).
     this->getTransfMatrixBasicLocal(Tbl);
     
     return error;
@@ -351,7 +351,7 @@ void XC::CorotCrdTransf2d::getTransfMatrixLocalGlobal(Matrix &Tlg) const
   }
 
 
-void XC::CorotCrdTransf2d::getTransfMatrixBasicLocal(Matrix &Tbl) const
+void XC::CorotCrdTransf2d::getTransfMatrixBasicLocal(FixedMatrix<3,6> &Tbl) const
   {
     // set up exact force transformation matrix from basic to local coordinates
     Tbl(0,0) = -cosAlpha;      
@@ -506,9 +506,8 @@ const XC::Vector &XC::CorotCrdTransf2d::getGlobalResistingForce(const Vector &pb
   {
     
     // transform resisting forces from the basic system to local coordinates
-    this->getTransfMatrixBasicLocal(Tbl);
-    static Vector pl(6);
-    pl.addMatrixTransposeVector(0.0, Tbl, pb, 1.0);    // pl = Tbl ^ pb;
+    FixedVector<6> pl;
+    pl.addMatrixTransposeVector(0.0, Tbl, FixedVector<3>(pb), 1.0);    // pl = Tbl ^ pb;
     
     // add end forces due to element unifLoad loads
     // This assumes member loads are in local system
@@ -549,9 +548,8 @@ const XC::Vector &XC::CorotCrdTransf2d::getGlobalResistingForce(const Vector &pb
 const XC::Matrix &XC::CorotCrdTransf2d::getGlobalStiffMatrix(const Matrix &kb, const Vector &pb) const
   {
     // transform tangent stiffness matrix from the basic system to local coordinates
-    static Matrix kl(6,6);
-    this->getTransfMatrixBasicLocal(Tbl);
-    kl.addMatrixTripleProduct(0.0, Tbl, kb, 1.0);      // kl = Tbl ^ kb * Tbl;
+    FixedMatrix<6,6> kl;
+    kl.addMatrixTripleProduct(0.0, Tbl, FixedMatrix<3,3>(kb), 1.0);      // kl = Tbl ^ kb * Tbl;
     
     // add geometric stiffness matrix
     kl.addMatrix(1.0, this->getGeomStiffMatrix(pb), 1.0);
@@ -971,6 +969,7 @@ int XC::CorotCrdTransf2d::recvData(const Communicator &comm)
     res+= comm.receiveVector(ubcommit,getDbTagData(),CommMetaData(13));
     res+= comm.receiveVector(ubpr,getDbTagData(),CommMetaData(14));
     res+= comm.receiveBool(nodeOffsets,getDbTagData(),CommMetaData(15));
+    this->getTransfMatrixBasicLocal(Tbl);
     if(res<0)
       std::cerr << getClassName() << "::" << __FUNCTION__
 		<< "; failed to receive data." << std::endl;
@@ -1159,10 +1158,10 @@ const XC::Vector &XC::CorotCrdTransf2d::getGlobalResistingForceShapeSensitivity(
   static Vector pl(6);
   pl.Zero();
 
-  static Matrix Abl(3,6);
+  static FixedMatrix<3,6> Abl;
   this->getTransfMatrixBasicLocal(Abl);
 
-  pl.addMatrixTransposeVector(0.0, Abl, q, 1.0); // OPTIMIZE LATER
+  pl.addMatrixTransposeVector(0.0, Abl.getView(), q, 1.0); // OPTIMIZE LATER
 
   dpgdh(0) += dcosThetadh*pl(0)-dsinThetadh*pl(1);
   dpgdh(1) += dsinThetadh*pl(0)+dcosThetadh*pl(1);
@@ -1273,7 +1272,7 @@ const XC::Vector &XC::CorotCrdTransf2d::getBasicTrialDispShapeSensitivity(void)
   if(nodeIid == 0 && nodeJid == 0)
     return dvdh;
 
-  static Matrix Abl(3,6);
+  static FixedMatrix<3,6> Abl;
 
   this->update();
   this->getTransfMatrixBasicLocal(Abl);
@@ -1334,7 +1333,7 @@ const XC::Vector &XC::CorotCrdTransf2d::getBasicTrialDispShapeSensitivity(void)
   dAdh_U(4)= -dsinThetadh*U(3) + dcosThetadh*U(4);
   dAdh_U(5)= 0.0;
 
-  dvdh += Abl*dAdh_U;
+  dvdh += Abl.getView()*dAdh_U;
 
   return dvdh;
 }
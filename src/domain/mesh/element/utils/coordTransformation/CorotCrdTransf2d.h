@@ -64,6 +64,7 @@
 
 #include "CrdTransf2d.h"
 #include "utility/matrix/Matrix.h"
+#include "utility/matrix/FixedMatrix.h"
 
 namespace XC {
 //! @brief Coordinate transformation corrotacional en 3d.
@@ -82,9 +83,9 @@ class CorotCrdTransf2d: public CrdTransf2d
     Vector ubpr;               // previous basic displacements
     
     bool nodeOffsets;
+    FixedMatrix<3,6> Tbl; //!< matrix that transforms from local to basic coordinates (computed in update).
 
     static Matrix Tlg;         // matrix that transforms from global to local coordinates
-    static Matrix Tbl;         // matrix that transforms from local  to basic coordinates
     static Matrix kg;     
     static Vector uxg;     
     static Vector pg;     
@@ -95,7 +96,7 @@ class CorotCrdTransf2d: public CrdTransf2d
     int compElemtLengthAndOrientWRTLocalSystem(const Vector &ul);
     void transfLocalDisplsToBasic(const Vector &ul);
     void getTransfMatrixLocalGlobal(Matrix &Tlg) const;
-    void getTransfMatrixBasicLocal(Matrix &Tbl) const;
+    void getTransfMatrixBasicLocal(FixedMatrix<3,6> &Tbl) const;
     const Matrix &getGeomStiffMatrix(const Vector &pb) const;
   protected:
     int sendData(Communicator &);
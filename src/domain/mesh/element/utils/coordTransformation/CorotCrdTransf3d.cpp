@@ -64,21 +64,14 @@
 #include <cmath>
 #include <utility/matrix/Vector.h>
 #include <utility/matrix/Matrix.h>
+#include "utility/matrix/FixedMatrix.h"
 #include "utility/matrix/ID.h"
 #include <domain/mesh/node/Node.h>
 #include "utility/actor/actor/MovableVector.h"
 
 
 // initialize static variables
-XC::Matrix XC::CorotCrdTransf3d::RI(3,3); 
-XC::Matrix XC::CorotCrdTransf3d::RJ(3,3); 
-XC::Matrix XC::CorotCrdTransf3d::Rbar(3,3); 
-XC::Matrix XC::CorotCrdTransf3d::e(3,3); 
 XC::Matrix XC::CorotCrdTransf3d::Tp(6,7); 
-XC::Matrix XC::CorotCrdTransf3d::A(3,3);
-XC::Matrix XC::CorotCrdTransf3d::Lr2(12,3);
-XC::Matrix XC::CorotCrdTransf3d::Lr3(12,3);
-XC::Matrix XC::CorotCrdTransf3d::T(7,12);
 XC::Matrix XC::CorotCrdTransf3d::Tlg(12,12);
 XC::Matrix XC::CorotCrdTransf3d::TlgInv(12, 12);
 XC::Matrix XC::CorotCrdTransf3d::Tbl(6,12);
@@ -90,7 +83,7 @@ XC::CorotCrdTransf3d::CorotCrdTransf3d(int tag, const Vector &vecInLocXZPlane,co
   : CrdTransf3d(tag, CRDTR_TAG_CorotCrdTransf3d), vAxis(3), xAxis(3),
     Ln(0.0),  alphaIq(4), alphaJq(4), 
     alphaIqcommit(4), alphaJqcommit(4), alphaI(3), alphaJ(3),
-    ul(7), ulcommit(7), ulpr(7)
+    ul(7), ulcommit(7), ulpr(7), updated(false)
   {
     // check vector that defines local xz plane
     if(vecInLocXZPlane.Size() != 3 )
@@ -170,7 +163,7 @@ XC::CorotCrdTransf3d::CorotCrdTransf3d(int tag, const Vector &vecInLocXZPlane,co
 XC::CorotCrdTransf3d::CorotCrdTransf3d(int tag)
   : CrdTransf3d(tag, CRDTR_TAG_CorotCrdTransf3d), vAxis(3), xAxis(3),
     Ln(0), alphaIq(4), alphaJq(4),alphaIqcommit(4), alphaJqcommit(4),
-    alphaI(3), alphaJ(3), ul(7), ulcommit(7), ulpr(7)
+    alphaI(3), alphaJ(3), ul(7), ulcommit(7), ulpr(7), updated(false)
   {
     // Permutation matrix (to renumber basic dof's)
     
@@ -319,6 +312,7 @@ int XC::CorotCrdTransf3d::initialize(Node *nodeIPointer, Node *nodeJPointer)
     
     alphaIq = this->getQuaternionFromRotMatrix(R); // pseudo-vector for node I
     alphaJq = this->getQuaternionFromRotMatrix(R); // pseudo-vector for node J
+    updated= false;
     
     //std::cerr << "alphaIq: " << alphaIq;
     //std::cerr << "alphaJq: " << alphaJq;
@@ -395,8 +389,8 @@ int XC::CorotCrdTransf3d::update(void)
     alphaIq = this->quaternionProduct(alphaIq, dAlphaIq);
     alphaJq = this->quaternionProduct(alphaJq, dAlphaJq);
     
-    RI = this->getRotationMatrixFromQuaternion (alphaIq);
-    RJ = this->getRotationMatrixFromQuaternion (alphaJq);
+    RI= FixedMatrix<3,3>(this->getRotationMatrixFromQuaternion(alphaIq));
+    RJ= FixedMatrix<3,3>(this->getRotationMatrixFromQuaternion(alphaJq));
     
     // compute the mean nodal triad
     static Matrix dRgamma(3,3); 
@@ -420,7 +414,7 @@ int XC::CorotCrdTransf3d::update(void)
             
             dRgamma = this->getRotMatrixFromTangScaledPseudoVector(gammaw/2);
             
-            Rbar.addMatrixProduct(0.0, dRgamma, RI, 1.0);
+            Rbar= FixedMatrix<3,3>(dRgamma)*RI;
             
             // compute the base vectors e1, e2, e3
             static Vector e1(3);
@@ -463,6 +457,7 @@ int XC::CorotCrdTransf3d::update(void)
             {
                 std::cerr << getClassName() << "::" << __FUNCTION__
 			  << "\n; 0 deformed length." << std::endl;
+                updated= false;
                 return -2;  
             }
             
@@ -535,10 +530,46 @@ int XC::CorotCrdTransf3d::update(void)
             
             // compute the transformation matrix
             this->compTransfMatrixBasicGlobal();
+
+            // store the displacements corresponding to the computed geometry.
+            updatedDispI= FixedVector<6>(nodeIPtr->getTrialDisp());
+            updatedDispJ= FixedVector<6>(nodeJPtr->getTrialDisp());
+            updated= true;
             
             return 0;
 }
 
+//! @brief Return true if the trial displacements of the nodes have
+//! not changed since the last call to update (so the nodal triads
+//! and the transformation matrices computed there are still valid).
+bool XC::CorotCrdTransf3d::is_up_to_date(void) const
+  {
+    bool retval= updated;
+    if(retval)
+      {
+        const Vector &dispI= nodeIPtr->getTrialDisp();
+        const Vector &dispJ= nodeJPtr->getTrialDisp();
+        for(int i= 0;i<6;i++)
+          if((dispI(i)!=updatedDispI(i)) || (dispJ(i)!=updatedDispJ(i)))
+            {
+              retval= false;
+              break;
+            }
+      }
+    return retval;
+  }
+
+//! @brief Call update only if the trial displacements of the nodes
+//! have changed since the last call, otherwise the quantities
+//! computed there are reused.
+int XC::CorotCrdTransf3d::update_if_needed(void) const
+  {
+    int retval= 0;
+    if(!is_up_to_date())
+      retval= const_cast<CorotCrdTransf3d *>(this)->update();
+    return retval;
+  }
+
 
 void XC::CorotCrdTransf3d::compTransfMatrixBasicGlobal(void)
 {
@@ -582,8 +613,8 @@ void XC::CorotCrdTransf3d::compTransfMatrixBasicGlobal(void)
         for(j = 0; j < 3; j++)
             A(i,j) = (I(i,j) - e1(i)*e1(j))/Ln;
         
-        Lr2 = this->getLMatrix (r2);
-        Lr3 = this->getLMatrix (r3);
+        Lr2= FixedMatrix<12,3>(this->getLMatrix(r2));
+        Lr3= FixedMatrix<12,3>(this->getLMatrix(r3));
         
         static Matrix Sr1(3,3), Sr2(3,3), Sr3(3,3);
         static Vector Se(3), At(3);
@@ -612,7 +643,7 @@ void XC::CorotCrdTransf3d::compTransfMatrixBasicGlobal(void)
         
         //   T2 = [(A*rI2)', (-S(rI2)*e1 + S(rI1)*e2)', -(A*rI2)', O']';
         
-        At.addMatrixVector(0.0, A, rI2, 1.0);   
+        At.addMatrixVector(0.0, A.getView(), rI2, 1.0);   
         
         Se.addMatrixVector(0.0, Sr2, e1, -1.0);     // (-S(rI2)*e1 + S(rI1)*e2)'
         Se.addMatrixVector(1.0, Sr1, e2,  1.0);
@@ -626,7 +657,7 @@ void XC::CorotCrdTransf3d::compTransfMatrixBasicGlobal(void)
         
         //   T3 = [(A*rI3)', (-S(rI3)*e1 + S(rI1)*e3)', -(A*rI3)', O']';
         
-        At.addMatrixVector(0.0, A, rI3, 1.0);   
+        At.addMatrixVector(0.0, A.getView(), rI3, 1.0);   
         
         Se.addMatrixVector(0.0, Sr3, e1, -1.0);     // (-S(rI3)*e1 + S(rI1)*e3)
         Se.addMatrixVector(1.0, Sr1, e3,  1.0);
@@ -652,7 +683,7 @@ void XC::CorotCrdTransf3d::compTransfMatrixBasicGlobal(void)
         
         //   T5 = [(A*rJ2)', O', -(A*rJ2)', (-S(rJ2)*e1 + S(rJ1)*e2)']';
         
-        At.addMatrixVector(0.0, A, rJ2, 1.0);   
+        At.addMatrixVector(0.0, A.getView(), rJ2, 1.0);   
         
         Se.addMatrixVector(0.0, Sr2, e1, -1.0);     // (-S(rJ2)*e1 + S(rJ1)*e2)
         Se.addMatrixVector(1.0, Sr1, e2,  1.0);
@@ -666,7 +697,7 @@ void XC::CorotCrdTransf3d::compTransfMatrixBasicGlobal(void)
         
         //   T6 = [(A*rJ3)', O', -(A*rJ3)', (-S(rJ3)*e1 + S(rJ1)*e3)']';
         
-        At.addMatrixVector(0.0, A, rJ3, 1.0);   
+        At.addMatrixVector(0.0, A.getView(), rJ3, 1.0);   
         
         Se.addMatrixVector(0.0, Sr3, e1, -1.0);     // (-S(rJ3)*e1 + S(rJ1)*e3)
         Se.addMatrixVector(1.0, Sr1, e3,  1.0);
@@ -689,34 +720,34 @@ void XC::CorotCrdTransf3d::compTransfMatrixBasicGlobal(void)
         // T(:,5) += Lr2*rJ1          ;      // ?????? check sign
         // T(:,6) += Lr3*rJ1          ;      // ?????? check sign
         
-        Lr.addMatrixVector(0.0, Lr3, rI2,  1.0);  //  T(:,1) += Lr3*rI2 - Lr2*rI3 
-        Lr.addMatrixVector(1.0, Lr2, rI3, -1.0);
+        Lr.addMatrixVector(0.0, Lr3.getView(), rI2,  1.0);  //  T(:,1) += Lr3*rI2 - Lr2*rI3 
+        Lr.addMatrixVector(1.0, Lr2.getView(), rI3, -1.0);
         
         for(i = 0; i < 12; i++)
             T(0,i) += Lr(i);
         
-        Lr.addMatrixVector(0.0, Lr2, rI1,  1.0);  //  T(:,2) +=           Lr2*rI1
+        Lr.addMatrixVector(0.0, Lr2.getView(), rI1,  1.0);  //  T(:,2) +=           Lr2*rI1
         
         for(i = 0; i < 12; i++)
             T(1,i) += Lr(i);
         
-        Lr.addMatrixVector(0.0, Lr3, rI1,  1.0);  //  T(:,3) += Lr3*rI1 
+        Lr.addMatrixVector(0.0, Lr3.getView(), rI1,  1.0);  //  T(:,3) += Lr3*rI1 
         
         for(i = 0; i < 12; i++)
             T(2,i) += Lr(i);
         
-        Lr.addMatrixVector(0.0, Lr3, rJ2,  1.0);  //  T(:,4) += Lr3*rJ2 - Lr2*rJ3;
-        Lr.addMatrixVector(1.0, Lr2, rJ3, -1.0);
+        Lr.addMatrixVector(0.0, Lr3.getView(), rJ2,  1.0);  //  T(:,4) += Lr3*rJ2 - Lr2*rJ3;
+        Lr.addMatrixVector(1.0, Lr2.getView(), rJ3, -1.0);
         
         for(i = 0; i < 12; i++)
             T(3,i) += Lr(i);
         
-        Lr.addMatrixVector(0.0, Lr2, rJ1,  1.0);  //  T(:,5) += Lr2*rJ1   
+        Lr.addMatrixVector(0.0, Lr2.getView(), rJ1,  1.0);  //  T(:,5) += Lr2*rJ1   
         
         for(i = 0; i < 12; i++)
             T(4,i) += Lr(i);
         
-        Lr.addMatrixVector(0.0, Lr3, rJ1,  1.0);  //   T(:,6) += Lr3*rJ1
+        Lr.addMatrixVector(0.0, Lr3.getView(), rJ1,  1.0);  //   T(:,6) += Lr3*rJ1
         
         for(i = 0; i < 12; i++)
             T(5,i) += Lr(i);
@@ -798,8 +829,8 @@ void XC::CorotCrdTransf3d::compTransfMatrixBasicGlobalNew(void)
             std::cerr << "A: " << A;
         */
         
-        Lr2 = this->getLMatrix (r2);
-        Lr3 = this->getLMatrix (r3);
+        Lr2= FixedMatrix<12,3>(this->getLMatrix(r2));
+        Lr3= FixedMatrix<12,3>(this->getLMatrix(r3));
         
         // std::cerr << "Lr2: " << Lr2;
         // std::cerr << "Lr3: " << Lr3;
@@ -834,7 +865,7 @@ void XC::CorotCrdTransf3d::compTransfMatrixBasicGlobalNew(void)
             hI1(i+3) = Se(i);
         
         // hI2 = [(A*rI3)', (-S(rI3)*e1 + S(rI1)*e3)', -(A*rI3)', O']';
-        At.addMatrixVector(0.0, A, rI3, 1.0);   
+        At.addMatrixVector(0.0, A.getView(), rI3, 1.0);   
         Se.addMatrixVector(0.0, Sr3, e1, -1.0);     // (-S(rI3)*e1 + S(rI1)*e3)
         Se.addMatrixVector(1.0, Sr1, e3,  1.0);
         
@@ -845,7 +876,7 @@ void XC::CorotCrdTransf3d::compTransfMatrixBasicGlobalNew(void)
         }
         
         // hI3 = [(A*rI2)', (-S(rI2)*e1 + S(rI1)*e2)', -(A*rI2)', O']';
-        At.addMatrixVector(0.0, A, rI2, 1.0);   
+        At.addMatrixVector(0.0, A.getView(), rI2, 1.0);   
         Se.addMatrixVector(0.0, Sr2, e1, -1.0);     // (-S(rI2)*e1 + S(rI1)*e2)'
         Se.addMatrixVector(1.0, Sr1, e2,  1.0);
         
@@ -867,7 +898,7 @@ void XC::CorotCrdTransf3d::compTransfMatrixBasicGlobalNew(void)
         
         
         // hJ2 = [(A*rJ3)', O', -(A*rJ3)', (-S(rJ3)*e1 + S(rJ1)*e3)']';
-        At.addMatrixVector(0.0, A, rJ3, 1.0);   
+        At.addMatrixVector(0.0, A.getView(), rJ3, 1.0);   
         Se.addMatrixVector(0.0, Sr3, e1, -1.0);     // (-S(rJ3)*e1 + S(rJ1)*e3)
         Se.addMatrixVector(1.0, Sr1, e3,  1.0);
         
@@ -878,7 +909,7 @@ void XC::CorotCrdTransf3d::compTransfMatrixBasicGlobalNew(void)
         }
         
         // hJ3 = [(A*rJ2)', O', -(A*rJ2)', (-S(rJ2)*e1 + S(rJ1)*e2)']';   
-        At.addMatrixVector(0.0, A, rJ2, 1.0);   
+        At.addMatrixVector(0.0, A.getView(), rJ2, 1.0);   
         Se.addMatrixVector(0.0, Sr2, e1, -1.0);     // (-S(rJ2)*e1 + S(rJ1)*e2)
         Se.addMatrixVector(1.0, Sr1, e2,  1.0);
         
@@ -941,44 +972,44 @@ void XC::CorotCrdTransf3d::compTransfMatrixBasicGlobalNew(void)
         double c;
         
         // f2  = ( Lr2*rI1 + hI3)'./(2*(cos(thetalI(3))));
-        Lr.addMatrixVector(0.0, Lr2, rI1,  1.0);  
+        Lr.addMatrixVector(0.0, Lr2.getView(), rI1,  1.0);  
         Lr += hI3;
         c = 1.0/(2.0*cos(thetaI(2)));
         for(i=0; i<12; i++)
             T(1,i) = Lr(i)*c;
         
         // f3  = ( Lr2*rJ1 + hJ3)'./(2*(cos(thetalJ(3))));
-        Lr.addMatrixVector(0.0, Lr2, rJ1,  1.0);  
+        Lr.addMatrixVector(0.0, Lr2.getView(), rJ1,  1.0);  
         Lr += hJ3;
         c = 1.0/(2.0*cos(thetaJ(2)));   
         for(i=0; i<12; i++)
             T(2,i) = Lr(i)*c;
         
         // f4  = (-Lr3*rI1 - hI2)'./(2*(cos(thetalI(2))));
-        Lr.addMatrixVector(0.0, Lr3, rI1,  -1.0);  
+        Lr.addMatrixVector(0.0, Lr3.getView(), rI1,  -1.0);  
         Lr -= hI2;
         c = 1.0/(2.0*cos(thetaI(1)));   
         for(i=0; i<12; i++)
             T(3,i) = Lr(i)*c;
         
         // f5  = (-Lr3*rJ1 - hJ2)'./(2*(cos(thetalJ(2))));
-        Lr.addMatrixVector(0.0, Lr3, rJ1,  -1.0);  
+        Lr.addMatrixVector(0.0, Lr3.getView(), rJ1,  -1.0);  
         Lr -= hJ2;
         c = 1.0/(2.0*cos(thetaJ(1)));   
         for(i=0; i<12; i++)
             T(4,i) = Lr(i)*c;
         
         // f6I = ( Lr3*rI2 - Lr2*rI3 + hI1)'./(2*(cos(thetalI(1))));
-        Lr.addMatrixVector(0.0, Lr3, rI2,  1.0);
-        Lr.addMatrixVector(1.0, Lr2, rI3, -1.0);
+        Lr.addMatrixVector(0.0, Lr3.getView(), rI2,  1.0);
+        Lr.addMatrixVector(1.0, Lr2.getView(), rI3, -1.0);
         Lr += hI1;
         c = 1.0/(2.0*cos(thetaI(0)));   
         for(i=0; i<12; i++)
             T(5,i) = Lr(i)*c;
         
         // f6J = ( Lr3*rJ2 - Lr2*rJ3 + hJ1)'./(2*(cos(thetalJ(1))));
-        Lr.addMatrixVector(0.0, Lr3, rJ2,  1.0);
-        Lr.addMatrixVector(1.0, Lr2, rJ3, -1.0);
+        Lr.addMatrixVector(0.0, Lr3.getView(), rJ2,  1.0);
+        Lr.addMatrixVector(1.0, Lr2.getView(), rJ3, -1.0);
         Lr += hJ1;
         c = 1.0/(2.0*cos(thetaI(0)));   
         for(i=0; i<12; i++)
@@ -1009,7 +1040,7 @@ void XC::CorotCrdTransf3d::compTransfMatrixBasicLocal(Matrix &Tbl) const
 
     // first get transformation matrix from basic to global 
     static Matrix Tbg(6, 12);
-    Tbg.addMatrixProduct(0.0, Tp, T, 1.0);
+    Tbg.addMatrixProduct(0.0, Tp, T.getView(), 1.0);
 
     // get inverse of transformation matrix from local to global
     this->compTransfMatrixLocalGlobal(Tlg);
@@ -1131,8 +1162,7 @@ const XC::Vector &XC::CorotCrdTransf3d::local_to_global_element_force(const Vect
 
 const XC::Vector &XC::CorotCrdTransf3d::getGlobalResistingForce(const Vector &pb, const Vector &p0) const
   {
-    CorotCrdTransf3d *this_no_const= const_cast<CorotCrdTransf3d *>(this);
-    this_no_const->update();
+    this->update_if_needed();
     
     static Vector pg(12);
     pg.Zero();
@@ -1145,7 +1175,7 @@ const XC::Vector &XC::CorotCrdTransf3d::getGlobalResistingForce(const Vector &pb
         pl.addMatrixTransposeVector(0.0, Tp, pb, 1.0);    // pl = Tp ^ pb;
 
         // transform resisting forces from local to global coordinates
-        pg.addMatrixTransposeVector(0.0, T, pl, 1.0);   // pg = T ^ pl; residual
+        pg.addMatrixTransposeVector(0.0, T.getView(), pl, 1.0);   // pg = T ^ pl; residual
       }
       else // element loads present
       {
@@ -1174,7 +1204,7 @@ const XC::Vector &XC::CorotCrdTransf3d::getGlobalResistingForce(const Vector &pb
         pl.addMatrixTransposeVector(0.0, Tp, pb, 1.0);    // pl = Tp ^ pb;
 
         // transform resisting forces from local to global coordinates
-        pg.addMatrixTransposeVector(0.0, T, pl, 1.0);   // pg = T ^ pl; residual
+        pg.addMatrixTransposeVector(0.0, T.getView(), pl, 1.0);   // pg = T ^ pl; residual
 
         // add end forces due to element p0 loads
         // assuming member loads are in local system
@@ -1193,34 +1223,50 @@ const XC::Vector &XC::CorotCrdTransf3d::getGlobalResistingForce(const Vector &pb
   }
 
 
+//! @brief Return the tangent stiffness matrix in global coordinates.
+//!
+//! The temporaries are fixed size matrices and vectors, but the method
+//! is not reentrant: it updates the transformation if needed (which
+//! modifies the object and uses static temporaries) and the result is
+//! returned in the static matrix kg, shared by all the objects of the
+//! class.
 const XC::Matrix &XC::CorotCrdTransf3d::getGlobalStiffMatrix(const Matrix &kb, const Vector &pb) const
   {
-    const_cast<CorotCrdTransf3d *>(this)->update();
-    
-    int i, j, k;   
+    this->update_if_needed();
+
+    // The computations are made with fixed size matrices and vectors
+    // (no heap allocation, loops with compile-time bounds); the result
+    // is copied into kg at the end.
+    const FixedMatrix<6,7> Tpf(Tp);
+    const FixedMatrix<7,12> &Tf= T;
+    const FixedMatrix<3,3> &Af= A;
+    const FixedMatrix<12,3> &Lr2f= Lr2;
+    const FixedMatrix<12,3> &Lr3f= Lr3;
+
     // transform tangent stiffness matrix from the basic system to local coordinates
-    static Matrix kl(7,7);
-    kl.addMatrixTripleProduct(0.0, Tp, kb, 1.0);      // kl = Tp ^ kb * Tp;
+    FixedMatrix<7,7> kl;
+    kl.addMatrixTripleProduct(0.0, Tpf, FixedMatrix<6,6>(kb), 1.0);      // kl = Tp ^ kb * Tp;
     
     // transform resisting forces from the basic system to local coordinates
-    static Vector pl(7);
-    pl.addMatrixTransposeVector(0.0, Tp, pb, 1.0);    // pl = Tp ^ pb;
+    FixedVector<7> pl;
+    pl.addMatrixTransposeVector(0.0, Tpf, FixedVector<6>(pb), 1.0);    // pl = Tp ^ pb;
         
     // compute the tangent stiffness matrix in global coordinates
-    kg.addMatrixTripleProduct(0.0, T, kl, 1.0);
+    FixedMatrix<12,12> kgf;
+    kgf.addMatrixTripleProduct(0.0, Tf, kl, 1.0);
     
-    static Vector m(6);
-    for(i = 0; i < 6; i++)
+    FixedVector<6> m;
+    for(int i = 0; i < 6; i++)
         m(i) = pl(i)/(2*cos(ul(i)));
     
     // compute the basic rotations
     
-    static Vector e1(3), e2(3), e3(3);
-    static Vector r1(3), r2(3), r3(3);
-    static Vector rI1(3), rI2(3), rI3(3);
-    static Vector rJ1(3), rJ2(3), rJ3(3);
+    FixedVector<3> e1, e2, e3;
+    FixedVector<3> r1, r2, r3;
+    FixedVector<3> rI1, rI2, rI3;
+    FixedVector<3> rJ1, rJ2, rJ3;
     
-    for(k = 0; k < 3; k ++)
+    for(int k = 0; k < 3; k ++)
     {
         e1(k) = e(k,0);
         e2(k) = e(k,1);
@@ -1245,22 +1291,17 @@ const XC::Matrix &XC::CorotCrdTransf3d::getGlobalStiffMatrix(const Matrix &kb, c
     //        m(5)*ks2r2u1 + m(6)*ks2r3u1 + ...
     //        ks3 + ks3' + ks4 + ks5;
     
-    static Matrix Se1(3,3), Se2(3,3), Se3(3,3);
-    static Matrix SrI1(3,3), SrI2(3,3), SrI3(3,3);
-    static Matrix SrJ1(3,3), SrJ2(3,3), SrJ3(3,3);
-    
-    Se1 = this->getSkewSymMatrix(e1);
-    Se2 = this->getSkewSymMatrix(e2);
-    Se3 = this->getSkewSymMatrix(e3);
+    const FixedMatrix<3,3> Se1= XC::getSkewSymMatrix(e1);
+    const FixedMatrix<3,3> Se2= XC::getSkewSymMatrix(e2);
+    const FixedMatrix<3,3> Se3= XC::getSkewSymMatrix(e3);
     
-    SrJ1 = this->getSkewSymMatrix(rJ1);
-    SrJ2 = this->getSkewSymMatrix(rJ2);
-    SrJ3 = this->getSkewSymMatrix(rJ3);
-    
-    SrI1 = this->getSkewSymMatrix(rI1);
-    SrI2 = this->getSkewSymMatrix(rI2);
-    SrI3 = this->getSkewSymMatrix(rI3);
+    const FixedMatrix<3,3> SrJ1= XC::getSkewSymMatrix(rJ1);
+    const FixedMatrix<3,3> SrJ2= XC::getSkewSymMatrix(rJ2);
+    const FixedMatrix<3,3> SrJ3= XC::getSkewSymMatrix(rJ3);
     
+    const FixedMatrix<3,3> SrI1= XC::getSkewSymMatrix(rI1);
+    const FixedMatrix<3,3> SrI2= XC::getSkewSymMatrix(rI2);
+    const FixedMatrix<3,3> SrI3= XC::getSkewSymMatrix(rI3);
     
     // ksigma1 -------------------------------
     //   ks1_11 =  a*pl(6);
@@ -1269,14 +1310,10 @@ const XC::Matrix &XC::CorotCrdTransf3d::getGlobalStiffMatrix(const Matrix &kb, c
     //          -ks1_11  o   ks1_11  o;
     //             o     o      o    o];
     
-    double factor;
-    
-    kg.Assemble(A, 0, 0,  pl(6));
-    kg.Assemble(A, 0, 6, -pl(6));
-    kg.Assemble(A, 6, 0, -pl(6));
-    kg.Assemble(A, 6, 6,  pl(6));
-    
-    //std::cerr << "kg += ksigma1: " << kg;
+    kgf.Assemble(Af, 0, 0,  pl(6));
+    kgf.Assemble(Af, 0, 6, -pl(6));
+    kgf.Assemble(Af, 6, 0, -pl(6));
+    kgf.Assemble(Af, 6, 6,  pl(6));
     
     // ksigma3 -------------------------------
     //  kbar2 = -Lr2*(m(3)*S(rI3) + m(1)*S(rI1)) + ...
@@ -1287,36 +1324,34 @@ const XC::Matrix &XC::CorotCrdTransf3d::getGlobalStiffMatrix(const Matrix &kb, c
     
     //     ks3 = [o kbar2 o kbar4];
     
-    static Matrix Sm(3,3);
-    static Matrix kbar(12,3);
+    FixedMatrix<3,3> Sm;
+    FixedMatrix<12,3> kbar;
     
     Sm.addMatrix(0.0, SrI3,  m(3));
     Sm.addMatrix(1.0, SrI1,  m(1));
     
-    kbar.addMatrixProduct(0.0, Lr2, Sm, -1.0);
+    kbar.addMatrixProduct(0.0, Lr2f, Sm, -1.0);
     
     Sm.addMatrix(0.0, SrI2,  m(3));
     Sm.addMatrix(1.0, SrI1, -m(2));
     
-    kbar.addMatrixProduct(1.0, Lr3, Sm,  1.0);
+    kbar.addMatrixProduct(1.0, Lr3f, Sm,  1.0);
     
-    kg.Assemble(kbar, 0, 3, 1.0);
-    kg.AssembleTranspose(kbar, 3, 0, 1.0);
+    kgf.Assemble(kbar, 0, 3, 1.0);
+    kgf.AssembleTranspose(kbar, 3, 0, 1.0);
     
     Sm.addMatrix(0.0, SrJ3,  m(3));
     Sm.addMatrix(1.0, SrJ1, -m(4));
     
-    kbar.addMatrixProduct(0.0, Lr2, Sm, 1.0);
+    kbar.addMatrixProduct(0.0, Lr2f, Sm, 1.0);
     
     Sm.addMatrix(0.0, SrJ2, m(3));
     Sm.addMatrix(1.0, SrJ1, m(5));
     
-    kbar.addMatrixProduct(1.0, Lr3, Sm,  -1.0);
-    
-    kg.Assemble(kbar, 0, 9, 1.0);
-    kg.AssembleTranspose(kbar, 9, 0, 1.0);
+    kbar.addMatrixProduct(1.0, Lr3f, Sm,  -1.0);
     
-    //std::cerr << "kg += ksigma3: " << kg;
+    kgf.Assemble(kbar, 0, 9, 1.0);
+    kgf.AssembleTranspose(kbar, 9, 0, 1.0);
     
     // Ksigma4 -------------------------------
     // Ks4_22 =  m(3)*( S(e2)*S(rI3) - S(e3)*S(rI2)) + ...
@@ -1332,7 +1367,7 @@ const XC::Matrix &XC::CorotCrdTransf3d::getGlobalStiffMatrix(const Matrix &kb, c
     //           O    O     O    O;
     //           O    O     O  Ks4_44];
     
-    static Matrix ks33(3,3);
+    FixedMatrix<3,3> ks33;
     
     ks33.addMatrixProduct(0.0, Se2, SrI3,  m(3));
     ks33.addMatrixProduct(1.0, Se3, SrI2, -m(3));
@@ -1343,7 +1378,7 @@ const XC::Matrix &XC::CorotCrdTransf3d::getGlobalStiffMatrix(const Matrix &kb, c
     ks33.addMatrixProduct(1.0, Se3, SrI1,  m(2));
     ks33.addMatrixProduct(1.0, Se1, SrI3, -m(2));
     
-    kg.Assemble(ks33, 3, 3, 1.0);
+    kgf.Assemble(ks33, 3, 3, 1.0);
     
     ks33.addMatrixProduct(0.0, Se2, SrJ3, -m(3));
     ks33.addMatrixProduct(1.0, Se3, SrJ2,  m(3));
@@ -1354,9 +1389,7 @@ const XC::Matrix &XC::CorotCrdTransf3d::getGlobalStiffMatrix(const Matrix &kb, c
     ks33.addMatrixProduct(1.0, Se3, SrJ1,  m(5));
     ks33.addMatrixProduct(1.0, Se1, SrJ3, -m(5));
     
-    kg.Assemble(ks33, 9, 9, 1.0);
-    
-    //std::cerr << "kg += ksigma4: " << kg;
+    kgf.Assemble(ks33, 9, 9, 1.0);
     
     // Ksigma5 -------------------------------
     //
@@ -1366,7 +1399,7 @@ const XC::Matrix &XC::CorotCrdTransf3d::getGlobalStiffMatrix(const Matrix &kb, c
     //          Ks5_14t     O   -Ks5_14t   O];
     
     // v = (1/Ln)*(m(2)*rI2 + m(3)*rI3 + m(5)*rJ2 + m(6)*rJ3);
-    static Vector v(3);
+    FixedVector<3> v;
     v.addVector (0.0, rI2, m(1));
     v.addVector (1.0, rI3, m(2));
     v.addVector (1.0, rJ2, m(4));
@@ -1375,91 +1408,76 @@ const XC::Matrix &XC::CorotCrdTransf3d::getGlobalStiffMatrix(const Matrix &kb, c
     v /= Ln;
     
     //Ks5_11 = A*v*e1' + e1*v'*A + (e1'*v)*A;
-    static Matrix m33(3,3);
-    double  e1tv = 0;   // dot product e1. v
-    
-    for(i = 0; i < 3; i++)
-        e1tv += e1(i) * v(i);
+    FixedMatrix<3,3> m33;
+    const double e1tv= e1.dot(v);   // dot product e1. v
     
-    ks33.addMatrix (0.0, A, e1tv);
+    ks33.addMatrix (0.0, Af, e1tv);
     
-    for(i = 0; i < 3; i++)
-        for(j = 0; j < 3; j++)
-            m33(i,j) = v(i)*e1(j);
+    for(int i = 0; i < 3; i++)
+      for(int j = 0; j < 3; j++)
+        m33(i,j) = v(i)*e1(j);
         
-        ks33.addMatrixProduct (1.0, A, m33, 1.0);
+    ks33.addMatrixProduct (1.0, Af, m33, 1.0);
         
-        for(i = 0; i < 3; i++)
-            for(j = 0; j < 3; j++)
-                m33(i,j) = e1(i)*v(j);
-            
-            ks33.addMatrixProduct (1.0, m33, A, 1.0);
-            
-            kg.Assemble(ks33, 0, 0,  1.0);
-            kg.Assemble(ks33, 0, 6, -1.0);
-            kg.Assemble(ks33, 6, 0, -1.0);
-            kg.Assemble(ks33, 6, 6,  1.0);
-            
-            //Ks5_12 = -(m(2)*A*S(rI2) + m(3)*A*S(rI3));
-            
-            ks33.addMatrixProduct(0.0, A, SrI2, -m(1));
-            ks33.addMatrixProduct(1.0, A, SrI3, -m(2));
+    for(int i = 0; i < 3; i++)
+      for(int j = 0; j < 3; j++)
+        m33(i,j) = e1(i)*v(j);
             
-            kg.Assemble(ks33, 0, 3,  1.0);
-            kg.Assemble(ks33, 6, 3, -1.0);
+    ks33.addMatrixProduct (1.0, m33, Af, 1.0);
             
-            kg.AssembleTranspose(ks33, 3, 0,  1.0);
-            kg.AssembleTranspose(ks33, 3, 6, -1.0);
+    kgf.Assemble(ks33, 0, 0,  1.0);
+    kgf.Assemble(ks33, 0, 6, -1.0);
+    kgf.Assemble(ks33, 6, 0, -1.0);
+    kgf.Assemble(ks33, 6, 6,  1.0);
             
-            //  Ks5_14 = -(m(5)*A*S(rJ2) + m(6)*A*S(rJ3));
+    //Ks5_12 = -(m(2)*A*S(rI2) + m(3)*A*S(rI3));
             
-            ks33.addMatrixProduct(0.0, A, SrJ2, -m(4));
-            ks33.addMatrixProduct(1.0, A, SrJ3, -m(5));
+    ks33.addMatrixProduct(0.0, Af, SrI2, -m(1));
+    ks33.addMatrixProduct(1.0, Af, SrI3, -m(2));
             
-            kg.Assemble(ks33, 0, 9,  1.0);
-            kg.Assemble(ks33, 6, 9, -1.0);
+    kgf.Assemble(ks33, 0, 3,  1.0);
+    kgf.Assemble(ks33, 6, 3, -1.0);
             
-            kg.AssembleTranspose(ks33, 9, 0,  1.0);
-            kg.AssembleTranspose(ks33, 9, 6, -1.0);
+    kgf.AssembleTranspose(ks33, 3, 0,  1.0);
+    kgf.AssembleTranspose(ks33, 3, 6, -1.0);
             
-            //std::cerr << "kg += ksigma5: " << kg;
+    //  Ks5_14 = -(m(5)*A*S(rJ2) + m(6)*A*S(rJ3));
             
-            // Ksigma -------------------------------
-            static Vector rm(3);
+    ks33.addMatrixProduct(0.0, Af, SrJ2, -m(4));
+    ks33.addMatrixProduct(1.0, Af, SrJ3, -m(5));
             
-            rm = rI3;
-            rm.addVector (1.0, rJ3, -1.0); 
-            //std::cerr << "ks2(r2,rI3-rJ3):\n "; 
-            kg.addMatrix (1.0, this->getKs2Matrix(r2, rm), m(3));
+    kgf.Assemble(ks33, 0, 9,  1.0);
+    kgf.Assemble(ks33, 6, 9, -1.0);
             
-            rm = rJ2;
-            rm.addVector (1.0, rI2, -1.0); 
-            //std::cerr << "ks2(r3,rJ2-rI2):\n "; 
-            kg.addMatrix (1.0, this->getKs2Matrix(r3, rm), m(3));
-            //std::cerr << "ks2(r2,rI1):\n "; 
-            kg.addMatrix (1.0, this->getKs2Matrix(r2, rI1), m(1));
-            //std::cerr << "ks2(r3,rI1):\n "; 
-            kg.addMatrix (1.0, this->getKs2Matrix(r3, rI1), m(2));
-            //std::cerr << "ks2(r2,rJ1):\n "; 
-            kg.addMatrix (1.0, this->getKs2Matrix(r2, rJ1), m(4));
-            //std::cerr << "ks2(r3,rJ1):\n "; 
-            kg.addMatrix (1.0, this->getKs2Matrix(r3, rJ1), m(5));
+    kgf.AssembleTranspose(ks33, 9, 0,  1.0);
+    kgf.AssembleTranspose(ks33, 9, 6, -1.0);
             
-            //std::cerr << "kg += ksigma2: " << kg;
+    // Ksigma -------------------------------
+    FixedVector<3> rm= rI3-rJ3;
+    kgf.addMatrix (1.0, this->getKs2Matrix(r2, rm), m(3));
             
-            //  T * diag (M .* tan(thetal))*T' 
+    rm= rJ2-rI2;
+    kgf.addMatrix (1.0, this->getKs2Matrix(r3, rm), m(3));
+    kgf.addMatrix (1.0, this->getKs2Matrix(r2, rI1), m(1));
+    kgf.addMatrix (1.0, this->getKs2Matrix(r3, rI1), m(2));
+    kgf.addMatrix (1.0, this->getKs2Matrix(r2, rJ1), m(4));
+    kgf.addMatrix (1.0, this->getKs2Matrix(r3, rJ1), m(5));
             
-            for(k = 0; k < 6; k++)
-            {
-                factor = pl(k) * tan(ul(k));
-                for(i = 0; i < 12; i++)
-                    for(j = 0; j < 12; j++)
-                        kg(i,j) += T(k,i) * factor * T(k,j);
-            }
+    //  T * diag (M .* tan(thetal))*T' 
             
-            //std::cerr << "kg final: " << kg;
+    for(int k = 0; k < 6; k++)
+      {
+        const double factor = pl(k) * tan(ul(k));
+        for(int j = 0; j < 12; j++)
+          {
+            const double fTkj= factor * Tf(k,j);
+            for(int i = 0; i < 12; i++)
+              kgf(i,j) += Tf(k,i) * fTkj;
+          }
+      }
             
-            return kg;
+    kgf.copyTo(kg);
+    return kg;
   }
 
 
@@ -1470,7 +1488,7 @@ const XC::Matrix &XC::CorotCrdTransf3d::getInitialGlobalStiffMatrix(const Matrix
     kl.addMatrixTripleProduct(0.0, Tp, kb, 1.0);      // kl = Tp ^ kb * Tp;
     
     // compute the tangent stiffness matrix in global coordinates
-    kg.addMatrixTripleProduct(0.0, T, kl, 1.0);
+    kg.addMatrixTripleProduct(0.0, T.getView(), kl, 1.0);
     
     return kg;
   }
@@ -1809,8 +1827,8 @@ const XC::Matrix &XC::CorotCrdTransf3d::getLMatrix (const Vector &ri) const
     
     //L1  = ri'*e1 * A/2 + A*ri*(e1 + r1)'/2;
     
-    L1.addMatrix (0.0, A, rie1*0.5);
-    L1.addMatrixProduct (1.0, A, rie1r1, 0.5);
+    L1.addMatrix (0.0, A.getView(), rie1*0.5);
+    L1.addMatrixProduct (1.0, A.getView(), rie1r1, 0.5);
     
     //std::cerr << "L1: " << L1;
     
@@ -1841,16 +1859,10 @@ const XC::Matrix &XC::CorotCrdTransf3d::getLMatrix (const Vector &ri) const
   }
 
 
-const XC::Matrix &XC::CorotCrdTransf3d::getKs2Matrix(const Vector &ri, const Vector &z) const
+//! @brief Return the Ksigma2 contribution to the geometric stiffness
+//! for the vectors argument (see getGlobalStiffMatrix).
+XC::FixedMatrix<12,12> XC::CorotCrdTransf3d::getKs2Matrix(const FixedVector<3> &ri, const FixedVector<3> &z) const
   {
-    static Matrix ks2(12,12);
-    static Vector e1(3), r1(3);
-    
-    //std::cerr << "\ngetKs2Matrix:." << std::endl;
-    //std::cerr << "ri: " << ri;
-    
-    //std::cerr << "z: " << z;
-    
     //  Ksigma2 = [ K11   K12 -K11   K12;
     //              K12t  K22 -K12t  K22;
     //             -K11  -K12  K11  -K12;
@@ -1859,87 +1871,61 @@ const XC::Matrix &XC::CorotCrdTransf3d::getKs2Matrix(const Vector &ri, const Vec
     // U = (-1/2)*A*z*ri'*A + ri'*e1*A*z*e1'/(2*Ln)+...
     //      z'*(e1+r1)*A*ri*e1'/(2*Ln);
     
-    int i, j;
-    double rite1 = 0;   // dot product ri . e1
-    double zte1  = 0;   // dot product z  . e1
-    double ztr1  = 0;   // dot product z  . r1
-    
-    for(i = 0; i < 3; i++)
+    FixedVector<3> e1, r1;
+    for(int i = 0; i < 3; i++)
       {
         e1(i) = e(i,0);
         r1(i) = Rbar(i,0);
-        rite1 += ri(i)*e1(i);
-        zte1  += z(i)*e1(i);
-        ztr1  += z(i)*r1(i);
       }
+    const double rite1= ri.dot(e1);   // dot product ri . e1
+    const double zte1= z.dot(e1);   // dot product z  . e1
+    const double ztr1= z.dot(r1);   // dot product z  . r1
     
-    static Matrix zrit(3,3), ze1t(3,3);
-    static Matrix rizt(3,3), r1e1t(3,3), rie1t(3,3);
-    static Matrix e1zt(3,3);
+    FixedMatrix<3,3> zrit, ze1t;
+    FixedMatrix<3,3> rizt, rie1t;
+    FixedMatrix<3,3> e1zt;
     
-    for(i = 0; i < 3; i++)
-      for(j = 0; j < 3; j++)
+    for(int i = 0; i < 3; i++)
+      for(int j = 0; j < 3; j++)
         {
           zrit(i,j) = z(i)*ri(j);
           rizt(i,j) = ri(i)*z(j);
           ze1t(i,j) = z(i)*e1(j);
           e1zt(i,j) = e1(i)*z(j);
-          r1e1t(i,j) = r1(i)*e1(j);
           rie1t(i,j) = ri(i)*e1(j);
         }
         
-    static Matrix U(3,3);
-    //std::cerr << " rite1: "<< rite1;
-    //std::cerr << " zte1: "<< zte1;
-    //std::cerr << " ztr1: "<< ztr1;
-    
-    //std::cerr << " A: "<< A;
-    //std::cerr << " zrit: "<< zrit;
-    //std::cerr << " ze1t: "<< ze1t;
-    //std::cerr << " rie1t: "<< rie1t;
-    
-    //std::cerr << " Ln: "<< Ln;
-    
+    FixedMatrix<3,3> U;
     U.addMatrixTripleProduct(0.0, A, zrit, -0.5);
-    
-    //std::cerr << "U: A*zrit*zrit " << U;
     U.addMatrixProduct (1.0, A, ze1t,   rite1/(2*Ln));
-    //std::cerr << "U: A*ze1t*rite1/(2*Ln) " << U;
     U.addMatrixProduct (1.0, A, rie1t, (zte1 + ztr1)/(2*Ln));
     
-    //std::cerr << "U: " << U;
-    static Matrix ks(3,3);
-    
     //K11 = U + U' + ri'*e1*(2*(e1'*z)+z'*r1)*A/(2*Ln);
     
-    ks.addMatrix (0.0, U, 1.0);
+    FixedMatrix<3,3> ks= U;
     
     // add matrix U transpose
-    for(i = 0; i < 3; i++)
-      for(j = 0; j < 3; j++)
+    for(int i = 0; i < 3; i++)
+      for(int j = 0; j < 3; j++)
         ks(i,j) += U(j,i);
         
     ks.addMatrix(1.0, A, rite1*(2*zte1 + ztr1)/(2*Ln));
     
-    //std::cerr << "Ks211: " << ks;
-    
-    ks2.Zero();
+    FixedMatrix<12,12> ks2;
     
     ks2.Assemble(ks, 0, 0,  1.0);
     ks2.Assemble(ks, 0, 6, -1.0);
     ks2.Assemble(ks, 6, 0, -1.0);
     ks2.Assemble(ks, 6, 6,  1.0);
     
-    static Matrix Sri(3,3), Sr1(3,3), Sz(3,3), Se1(3,3);
-    
-    Sri = this->getSkewSymMatrix(ri);  
-    Sr1 = this->getSkewSymMatrix(r1);
-    Sz  = this->getSkewSymMatrix(z); 
-    Se1 = this->getSkewSymMatrix(e1); 
+    const FixedMatrix<3,3> Sri= XC::getSkewSymMatrix(ri);  
+    const FixedMatrix<3,3> Sr1= XC::getSkewSymMatrix(r1);
+    const FixedMatrix<3,3> Sz= XC::getSkewSymMatrix(z); 
+    const FixedMatrix<3,3> Se1= XC::getSkewSymMatrix(e1); 
     
     //K12 = (1/4)*(-A*z*e1'*Sri - A*ri*z'*Sr1 - z'*(e1+r1)*A*Sri);
     
-    static Matrix m1(3,3);
+    FixedMatrix<3,3> m1;
     
     m1.addMatrixProduct(0.0, A, ze1t, -1.0);
     ks.addMatrixProduct(0.0, m1, Sri, 0.25);
@@ -1949,8 +1935,6 @@ const XC::Matrix &XC::CorotCrdTransf3d::getKs2Matrix(const Vector &ri, const Vec
     
     ks.addMatrixProduct(1.0, A, Sri, -0.25*(zte1+ztr1));
     
-    //std::cerr << "Ks2_12: " << ks;
-    
     ks2.Assemble(ks, 0, 3,  1.0);
     ks2.Assemble(ks, 0, 9,  1.0);
     ks2.Assemble(ks, 6, 3, -1.0);
@@ -1975,13 +1959,6 @@ const XC::Matrix &XC::CorotCrdTransf3d::getKs2Matrix(const Vector &ri, const Vec
     ks.addMatrixProduct (1.0, Se1, Sri, -0.125*(zte1 + ztr1));
     ks.addMatrixProduct (1.0, Sz, Sri, 0.25);
     
-    //std::cerr << "Ks2_22: " << ks;
-    
-    //  Ksigma2 = [ K11   K12 -K11   K12;
-    //              K12t  K22 -K12t  K22;
-    //             -K11  -K12  K11  -K12;
-    //              K12t  K22 -K12t  K22];
-    
     ks2.Assemble(ks, 3, 3, 1.0);
     ks2.Assemble(ks, 3, 9, 1.0);
     ks2.Assemble(ks, 9, 3, 1.0);
@@ -2033,6 +2010,7 @@ int XC::CorotCrdTransf3d::recvData(const Communicator &comm)
     res+= comm.receiveVector(ul,getDbTagData(),CommMetaData(19));
     res+= comm.receiveVector(ulcommit,getDbTagData(),CommMetaData(20));
     res+= comm.receiveVector(ulpr,getDbTagData(),CommMetaData(21));
+    updated= false;
     if(res<0)
       std::cerr << getClassName() << "::" << __FUNCTION__
 		<< "; failed to receive data." << std::endl;
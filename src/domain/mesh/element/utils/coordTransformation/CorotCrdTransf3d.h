@@ -66,6 +66,7 @@
 #include "CrdTransf3d.h"
 #include <utility/matrix/Vector.h>
 #include <utility/matrix/Matrix.h>
+#include "utility/matrix/FixedMatrix.h"
 
 namespace XC {
 //! @ingroup ElemCT
@@ -91,17 +92,24 @@ class CorotCrdTransf3d: public CrdTransf3d
     Vector ulcommit; //!< committed local displacements
     Vector ulpr; //!< previous local displacements
     
-    static Matrix RI; //!< nodal triad for node 1
-    static Matrix RJ; //!< nodal triad for node 2
-    static Matrix Rbar; //!< mean nodal triad 
-    static Matrix e; //!< base vectors
+    // Geometric quantities computed by update() and reused by
+    // the other methods.
+    mutable FixedMatrix<3,3> RI; //!< nodal triad for node 1
+    mutable FixedMatrix<3,3> RJ; //!< nodal triad for node 2
+    mutable FixedMatrix<3,3> Rbar; //!< mean nodal triad 
+    mutable FixedMatrix<3,3> e; //!< base vectors
+    mutable FixedMatrix<7,12> T; //!< transformation matrix from basic to global system
+    mutable FixedMatrix<12,3> Lr2, Lr3; //!< auxiliary matrices
+    mutable FixedMatrix<3,3> A; //!< auxiliary matrix
+    FixedVector<6> updatedDispI; //!< trial displacement of node I in the last update.
+    FixedVector<6> updatedDispJ; //!< trial displacement of node J in the last update.
+    bool updated; //!< true if the above quantities correspond to the last update.
+
     static Matrix Tp; //!< transformation matrix to renumber dofs
-    static Matrix T; //!< transformation matrix from basic to global system
     static Matrix Tlg; //!< transformation matrix from global to local system
     static Matrix TlgInv; //!< inverse of transformation matrix from global to local system
     static Matrix Tbl; //!< transformation matrix from local to basic system
     static Matrix kg;  //!< global stiffness matrix
-    static Matrix Lr2, Lr3, A; //!< auxiliary matrices	
 
     inline int computeElemtLengthAndOrient(void) const
       {
@@ -109,6 +117,8 @@ class CorotCrdTransf3d: public CrdTransf3d
                   << std::endl;
 	return 0;
       }
+    bool is_up_to_date(void) const;
+    int update_if_needed(void) const;
     void compTransfMatrixBasicGlobal(void);
     void compTransfMatrixBasicGlobalNew(void);
     void compTransfMatrixLocalGlobal(Matrix &Tlg) const;
@@ -121,7 +131,7 @@ class CorotCrdTransf3d: public CrdTransf3d
     const Matrix &getRotMatrixFromTangScaledPseudoVector(const Vector &w) const;
     const Matrix &getSkewSymMatrix(const Vector &theta) const;
     const Matrix &getLMatrix(const Vector &ri) const;
-    const Matrix &getKs2Matrix(const Vector &ri, const Vector &z) const;
+    FixedMatrix<12,12> getKs2Matrix(const FixedVector<3> &ri, const FixedVector<3> &z) const;
     
 
     
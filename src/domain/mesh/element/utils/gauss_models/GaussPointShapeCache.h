@@ -0,0 +1,252 @@
+// -*-c++-*-
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis C. Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//GaussPointShapeCache.h
+
+#ifndef GaussPointShapeCache_h
+#define GaussPointShapeCache_h
+
+#include "utility/matrix/nDarray/FixedTensor.h"
+#include <array>
+#include <map>
+#include <vector>
+#include <mutex>
+#include <atomic>
+#include <algorithm>
+
+namespace XC {
+
+//! @ingroup FEMisc
+//
+//! @brief Caching policy for the data computed at the Gauss points
+//! of the continuum elements.
+//!
+//! The derivatives of the shape functions with respect to the natural
+//! coordinates depend only on the element type and on the integration
+//! rule, so they are always computed once and shared by all the
+//! elements. The derivatives with respect to the global coordinates
+//! and the Jacobian determinants depend on the element geometry;
+//! storing them at element level saves the Jacobian inversions at
+//! the cost of some memory per element, so it can be disabled
+//! for big models.
+class GaussPointCachePolicy
+  {
+  private:
+    static bool &store_element_geometry(void)
+      {
+        static bool retval= true;
+        return retval;
+      }
+  public:
+    //! @brief Return true if the elements store the geometric data
+    //! at their Gauss points.
+    static bool getStoreElementGeometry(void)
+      { return store_element_geometry(); }
+    //! @brief Set the caching policy for the geometric data (if false
+    //! the data are recomputed each time they are needed).
+    static void setStoreElementGeometry(const bool &b)
+      { store_element_geometry()= b; }
+  };
+
+//! @ingroup FEMisc
+//
+//! @brief Shape function derivatives with respect to the natural
+//! coordinates at a Gauss point of an N node hexahedron.
+template <int N>
+struct NaturalGaussPointData
+  {
+    double weight; //!< product of the weights of the integration rule.
+    FixedTensor<N,3> dh; //!< derivatives of the shape functions (natural coordinates).
+  };
+
+//! @ingroup FEMisc
+//
+//! @brief Shape function derivatives at the Gauss points of an
+//! N node hexahedron for each integration rule, computed once
+//! and shared by all the elements of the same type.
+//!
+//! Once the data of a rule with orders not greater than maxOrder
+//! have been computed, their address is published in a table of
+//! atomic pointers, so the following lookups don't lock the mutex
+//! (the mutex protects only the computation of new rules).
+template <int N>
+class NaturalShapeFunctionCache
+  {
+  public:
+    typedef std::array<short,3> rule_key; //!< integration order in each direction.
+    typedef std::vector<NaturalGaussPointData<N> > gauss_point_data;
+    static const short maxOrder= 6; //!< maximum order of the rules stored in the lock-free table.
+  private:
+    std::map<rule_key, gauss_point_data> data;
+    std::array<std::atomic<const gauss_point_data *>, maxOrder*maxOrder*maxOrder> table; //!< already computed rules.
+    std::mutex mtx;
+
+    //! @brief Return the position of the rule in the table (or
+    //! the table size if the rule is not stored in the table).
+    size_t table_index(const rule_key &key) const
+      {
+        size_t retval= 0;
+        for(size_t i= 0;i<3;i++)
+          {
+            if((key[i]<1) || (key[i]>maxOrder))
+              return table.size();
+            retval= retval*maxOrder+(key[i]-1);
+          }
+        return retval;
+      }
+  public:
+    NaturalShapeFunctionCache(void)
+      : data(), table(), mtx()
+      {
+        for(size_t i= 0;i<table.size();i++)
+          table[i].store(nullptr, std::memory_order_relaxed);
+      }
+    //! @brief Return the data for the integration rule, calling
+    //! build(retval) to compute them if they are not yet stored.
+    //!
+    //! The references remain valid during the whole execution
+    //! (the elements of std::map are not moved by insertions
+    //! and the stored data are never removed).
+    template <class Builder>
+    const gauss_point_data &get(const rule_key &key, Builder build)
+      {
+        const size_t idx= table_index(key);
+        if(idx<table.size())
+          {
+            const gauss_point_data *tmp= table[idx].load(std::memory_order_acquire);
+            if(tmp)
+              return *tmp;
+          }
+        std::lock_guard<std::mutex> lock(mtx);
+        typename std::map<rule_key, gauss_point_data>::iterator i= data.find(key);
+        if(i==data.end())
+          {
+            gauss_point_data tmp;
+            build(tmp);
+            i= data.insert(std::make_pair(key,tmp)).first;
+          }
+        if(idx<table.size())
+          table[idx].store(&(i->second), std::memory_order_release);
+        return i->second;
+      }
+  };
+
+//! @ingroup FEMisc
+//
+//! @brief Shape function derivatives with respect to the global
+//! coordinates and integration weight (including the Jacobian
+//! determinant) at a Gauss point of an N node hexahedron.
+template <int N>
+struct GaussPointGeometry
+  {
+    double weight; //!< integration weight times the Jacobian determinant.
+    FixedTensor<N,3> dhGlobal; //!< derivatives of the shape functions (global coordinates).
+
+    //! @brief Compute the data from the natural derivatives and the
+    //! nodal coordinates (see Bathe p-202).
+    GaussPointGeometry(const NaturalGaussPointData<N> &gp, const FixedTensor<N,3> &N_C)
+      {
+        // Jacobian: dh("ij")*N_C("ik")
+        const FixedTensor<3,3> Jacobian= contract<0,0>(gp.dh, N_C);
+        // dhGlobal= dh("ij")*JacobianINV("kj")
+        dhGlobal= contract<1,1>(gp.dh, inverse(Jacobian));
+        weight= gp.weight*determinant(Jacobian);
+      }
+  };
+
+//! @ingroup FEMisc
+//
+//! @brief Element level cache of the geometric data at the
+//! Gauss points of an N node hexahedron.
+//!
+//! The data are rebuilt if the nodal coordinates or the
+//! integration rule change and are not stored at all
+//! if GaussPointCachePolicy::getStoreElementGeometry() is false.
+template <int N>
+class GaussPointGeometryCache
+  {
+  private:
+    FixedTensor<N,3> coordinates; //!< nodal coordinates used to compute the data.
+    const std::vector<NaturalGaussPointData<N> > *rule; //!< integration rule used to compute the data.
+    std::vector<GaussPointGeometry<N> > data;
+
+    bool is_valid(const FixedTensor<N,3> &N_C, const std::vector<NaturalGaussPointData<N> > &gps) const
+      {
+        return ((rule==&gps) && (data.size()==gps.size()) &&
+                std::equal(N_C.data(),N_C.data()+N_C.size(),coordinates.data()));
+      }
+  public:
+    GaussPointGeometryCache(void)
+      : coordinates(), rule(nullptr), data() {}
+    //! @brief Copy constructor (the data are recomputed on demand).
+    GaussPointGeometryCache(const GaussPointGeometryCache &)
+      : coordinates(), rule(nullptr), data() {}
+    //! @brief Assignment operator (the data are recomputed on demand).
+    GaussPointGeometryCache &operator=(const GaussPointGeometryCache &)
+      {
+        clear();
+        return *this;
+      }
+    //! @brief Remove the stored data.
+    void clear(void)
+      {
+        rule= nullptr;
+        std::vector<GaussPointGeometry<N> >().swap(data);
+      }
+    //! @brief Call f(where, geometry) for each Gauss point, where
+    //! is the index of the Gauss point in the integration rule.
+    template <class F>
+    void for_each(const FixedTensor<N,3> &N_C, const std::vector<NaturalGaussPointData<N> > &gps, F f)
+      {
+        const size_t sz= gps.size();
+        if(GaussPointCachePolicy::getStoreElementGeometry())
+          {
+            if(!is_valid(N_C, gps))
+              {
+                data.clear();
+                data.reserve(sz);
+                for(size_t where= 0;where<sz;where++)
+                  data.push_back(GaussPointGeometry<N>(gps[where], N_C));
+                coordinates= N_C;
+                rule= &gps;
+              }
+            for(size_t where= 0;where<sz;where++)
+              f(where, data[where]);
+          }
+        else
+          {
+            if(!data.empty())
+              clear();
+            for(size_t where= 0;where<sz;where++)
+              f(where, GaussPointGeometry<N>(gps[where], N_C));
+          }
+      }
+  };
+
+} // end of XC namespace
+
+#endif
@@ -34,3 +34,8 @@ class_<std::deque<XC::GaussPoint> >("GaussPointDq")
 class_<XC::GaussModel, boost::noncopyable >("GaussModel", no_init)
   .def("getGaussPoints", make_function(&XC::GaussModel::getGaussPoints,return_internal_reference<>() ), "Return Gauss points.")
   ;
+
+class_<XC::GaussPointCachePolicy, boost::noncopyable >("GaussPointCachePolicy", no_init)
+  .def("getStoreElementGeometry", &XC::GaussPointCachePolicy::getStoreElementGeometry, "Return true if the continuum elements store the shape function derivatives at their Gauss points.").staticmethod("getStoreElementGeometry")
+  .def("setStoreElementGeometry", &XC::GaussPointCachePolicy::setStoreElementGeometry, "setStoreElementGeometry(bool): if false the continuum elements recompute the shape function derivatives at their Gauss points each time they are needed (less memory).").staticmethod("setStoreElementGeometry")
+  ;
@@ -55,6 +55,7 @@
 
 #include <domain/mesh/element/ElementBase.h>
 #include "domain/mesh/element/utils/body_forces/BodyForces3D.h"
+#include "domain/mesh/element/utils/gauss_models/GaussPointShapeCache.h"
 
 
 
@@ -105,10 +106,12 @@ class TwentyNodeBrick: public ElementBase<20>
     // Now I want 3D array of Material points!
     // MatPoint3D[r_integration_order][s_integration_order][t_integration_order]
     // 3D array of Material points
-    MatPoint3D ** matpoint;  // pointer to array of Material Points
+    std::vector<MatPoint3D> matpoint;  //!< Material points.
+    mutable GaussPointGeometryCache<20> geometryCache; //!< global derivatives of the shape functions at the Gauss points.
     
     // this is LM array. This array holds DOFs for this element
     //int  LM[60]; // for 20noded x 3 = 60
+    void alloc_material_points(const NDMaterial *);
   public:
     
     void incremental_Update(void);
@@ -121,6 +124,7 @@ class TwentyNodeBrick: public ElementBase<20>
 
     TwentyNodeBrick & operator[](int subscript);
    
+    const NaturalShapeFunctionCache<20>::gauss_point_data &getNaturalGaussPointData(void) const;
     BJtensor getStiffnessTensor(void) const;
 
     void set_strain_stress_tensor(FILE *fp, double * u);
@@ -186,6 +190,7 @@ class TwentyNodeBrick: public ElementBase<20>
                    int node_numb_17, int node_numb_18, int node_numb_19, int node_numb_20,
 		    NDMaterial * Globalmmodel, const BodyForces3D &bForces, double r, double p);
 
+    TwentyNodeBrick(int tag,const NDMaterial *ptr_mat);
     TwentyNodeBrick(void);
     Element *getCopy(void) const;
     ~TwentyNodeBrick(void);
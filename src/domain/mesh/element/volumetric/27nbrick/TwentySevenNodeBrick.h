@@ -55,6 +55,7 @@
 
 #include <domain/mesh/element/ElementBase.h>
 #include "domain/mesh/element/utils/body_forces/BodyForces3D.h"
+#include "domain/mesh/element/utils/gauss_models/GaussPointShapeCache.h"
 
 
 
@@ -80,6 +81,7 @@ class TwentySevenNodeBrick: public ElementBase<27>
     // MatPoint3D[r_integration_order][s_integration_order][t_integration_order]
     // 3D array of Material points
     std::vector<MatPoint3D> matpoint; //!< Pointer to array of material Points
+    mutable GaussPointGeometryCache<27> geometryCache; //!< global derivatives of the shape functions at the Gauss points.
 
     // this is LM array. This array holds DOFs for this element
     //int  LM[60]; // for 20noded x 3 = 60
@@ -102,6 +104,7 @@ class TwentySevenNodeBrick: public ElementBase<27>
     //Matrix J; //!< Jacobian of transformation
     //Matrix L; //!< Inverse of J
     //Matrix B; //!< Strain interpolation matrix
+    void alloc_material_points(const NDMaterial *);
   public:
     TwentySevenNodeBrick(int element_number,
                    int node_numb_1,  int node_numb_2,  int node_numb_3,  int node_numb_4,
@@ -113,6 +116,7 @@ class TwentySevenNodeBrick: public ElementBase<27>
                    int node_numb_25,  int node_numb_26,  int node_numb_27,
                    NDMaterial * Globalmmodel,  const BodyForces3D &,
        double r, double p);
+    TwentySevenNodeBrick(int tag,const NDMaterial *ptr_mat);
     TwentySevenNodeBrick(void);
     Element *getCopy(void) const;
     ~TwentySevenNodeBrick();
@@ -167,6 +171,7 @@ class TwentySevenNodeBrick: public ElementBase<27>
 
     TwentySevenNodeBrick & operator[](int subscript);
 
+    const NaturalShapeFunctionCache<27>::gauss_point_data &getNaturalGaussPointData(void) const;
     BJtensor getStiffnessTensor(void) const;
 
     void set_strain_stress_tensor(FILE *fp, double * u);
@@ -78,6 +78,7 @@
 #include <domain/mesh/element/utils/Information.h>
 #include <utility/recorder/response/ElementResponse.h>
 #include "utility/matrix/nDarray/BJmatrix.h"
+#include "utility/matrix/nDarray/FixedTensor.h"
 
 
 #define FixedOrder 2
@@ -107,6 +108,16 @@ XC::EightNodeBrick::EightNodeBrick(int element_number,
   rho(r), pressure(p)
   {
     load.reset(24);
+    alloc_material_points(Globalmmodel);
+
+      // Set connected external node IDs
+      theNodes.set_id_nodes(node_numb_1,node_numb_2,node_numb_3,node_numb_4,node_numb_5,node_numb_6,node_numb_7,node_numb_8);
+  }
+
+//! @brief Create the material points (one copy of the material for each
+//! integration point).
+void XC::EightNodeBrick::alloc_material_points(const NDMaterial *ptr_mat)
+  {
     //BJ//BJ
     //BJ    std::cerr << "\n\n\n\n Print in XC::EightNodeBrick::EightNodeBrick" <<std::endl; this->Print(std::cerr);
     //BJ//BJ
@@ -194,7 +205,7 @@ XC::EightNodeBrick::EightNodeBrick(int element_number,
                 //std::cerr << "where= " << where << std::std::endl;
                 matpoint[where]= MatPoint3D(GP_c_r,GP_c_s,GP_c_t,r, s, t,rw, sw, tw,
                                          //InitEPS,
-                   Globalmmodel);
+                   ptr_mat);
                 //NMD);
                 //&( GPstress[where] ), //&( GPiterative_stress[where] ), //IN_q_ast_iterative[where] ,//&( GPstrain[where] ),  //&( GPtangent_E[where] ),
                                          //&( (matpoint)->operator[](where) )
@@ -202,9 +213,18 @@ XC::EightNodeBrick::EightNodeBrick(int element_number,
               }
           }
       }
+  }
 
-      // Set connected external node IDs
-      theNodes.set_id_nodes(node_numb_1,node_numb_2,node_numb_3,node_numb_4,node_numb_5,node_numb_6,node_numb_7,node_numb_8);
+
+//! @brief Constructor.
+//! @param tag: element identifier.
+//! @param ptr_mat: material for the integration points.
+XC::EightNodeBrick::EightNodeBrick(int tag,const NDMaterial *ptr_mat)
+  :ElementBase<8>(tag, ELE_TAG_EightNodeBrick), Ki(nullptr), bf(3),
+   rho(ptr_mat->getRho()), pressure(0.0), mmodel(nullptr)
+  {
+    load.reset(24);
+    alloc_material_points(ptr_mat);
   }
 
 //====================================================================
@@ -687,11 +707,25 @@ XC::BJtensor XC::EightNodeBrick::H_3D(double r1, double r2, double r3) const
 
 
 
- XC::BJtensor XC::EightNodeBrick::dh_drst_at(double r1, double r2, double r3) const
+//! @brief Return the nodal coordinates in a fixed size tensor.
+template <int N, class NodePtrs>
+static XC::FixedTensor<N,3> get_fixed_nodal_coordinates(const NodePtrs &theNodes)
   {
+    XC::FixedTensor<N,3> retval;
+    for(int i= 0;i<N;i++)
+      {
+        const XC::Vector &crds= theNodes[i]->getCrds();
+        for(int j= 0;j<3;j++)
+          retval(i+1,j+1)= crds(j);
+      }
+    return retval;
+  }
 
-    std::vector<int> dimensions({8,3});  // Changed from{20,3} to {8,3} Xiaoyan 07/12
-    BJtensor dh(dimensions, 0.0);
+//! @brief Derivatives of the shape functions with respect to the
+//! natural coordinates (fixed size tensor).
+static XC::FixedTensor<8,3> dh_drst_fixed(double r1, double r2, double r3)
+  {
+    XC::FixedTensor<8,3> dh;
 
 
     // influence of the node number 8
@@ -731,6 +765,46 @@ XC::BJtensor XC::EightNodeBrick::H_3D(double r1, double r2, double r3) const
     return dh;
   }
 
+//! @brief Shape function derivatives at the Gauss points for each
+//! integration rule (shared by all the elements).
+static XC::NaturalShapeFunctionCache<8> natural_shape_function_cache;
+
+//! @brief Return the derivatives of the shape functions with respect
+//! to the natural coordinates at the Gauss points, in the same order
+//! as the material points.
+const XC::NaturalShapeFunctionCache<8>::gauss_point_data &XC::EightNodeBrick::getNaturalGaussPointData(void) const
+  {
+    const NaturalShapeFunctionCache<8>::rule_key key= {{short(r_integration_order), short(s_integration_order), short(t_integration_order)}};
+    return natural_shape_function_cache.get(key, [this](NaturalShapeFunctionCache<8>::gauss_point_data &gps)
+      {
+        for( short GP_c_r= 1 ; GP_c_r <= r_integration_order ; GP_c_r++ )
+          {
+            const double r= get_Gauss_p_c( r_integration_order, GP_c_r );
+            const double rw= get_Gauss_p_w( r_integration_order, GP_c_r );
+            for( short GP_c_s= 1 ; GP_c_s <= s_integration_order ; GP_c_s++ )
+              {
+                const double s= get_Gauss_p_c( s_integration_order, GP_c_s );
+                const double sw= get_Gauss_p_w( s_integration_order, GP_c_s );
+                for( short GP_c_t= 1 ; GP_c_t <= t_integration_order ; GP_c_t++ )
+                  {
+                    const double t= get_Gauss_p_c( t_integration_order, GP_c_t );
+                    const double tw= get_Gauss_p_w( t_integration_order, GP_c_t );
+                    NaturalGaussPointData<8> gp;
+                    gp.weight= rw * sw * tw;
+                    gp.dh= dh_drst_fixed(r,s,t);
+                    gps.push_back(gp);
+                  }
+              }
+          }
+      });
+  }
+
+
+//! @brief Derivatives of the shape functions with respect to the
+//! natural coordinates.
+XC::BJtensor XC::EightNodeBrick::dh_drst_at(double r1, double r2, double r3) const
+  { return dh_drst_fixed(r1,r2,r3).getBJtensor(); }
+
 ////#############################################################################
  XC::EightNodeBrick & XC::EightNodeBrick::operator[](int subscript)
   {
@@ -749,234 +823,19 @@ XC::BJtensor XC::EightNodeBrick::H_3D(double r1, double r2, double r3) const
 
 
 ////#############################################################################
- XC::BJtensor XC::EightNodeBrick::getStiffnessTensor(void) const
+XC::BJtensor XC::EightNodeBrick::getStiffnessTensor(void) const
   {
-
-
-//BJ//BJ
-//BJ    std::cerr << "\n\n\n\n Print in XC::BJtensor XC::EightNodeBrick::getStiffnessTensor(void) " <<std::endl; this->Print(std::cerr);
-//BJ//BJ
-
-    std::vector<int> K_dim({8,3,3,8});  // Xiaoyan changed from {20,3,3,20} to {8,3,3,8}
-            // for 8 nodes      07/12
-    BJtensor Kk(K_dim,0.0);
-    BJtensor Kkt(K_dim,0.0);
-
-    //debugging
-    matrix Kmat;
-
-    double r= 0.0;
-    double rw= 0.0;
-    double s= 0.0;
-    double sw= 0.0;
-    double t= 0.0;
-    double tw= 0.0;
-
-    short where= 0;
-    double weight= 0.0;
-
-    std::vector<int> dh_dim({8,3});  // Xiaoyan changed from {20,3} to {8,3}
-    BJtensor dh(dh_dim, 0.0);
-
-    //    BJtensor Constitutive( def_dim_4, 0.0);
-    BJtensor Constitutive;
-
-    double det_of_Jacobian= 0.0;
-
-    static std::vector<int> disp_dim({8,3});   // Xiaoyan changed from {20,3} to {8,3}
-    BJtensor incremental_displacements(disp_dim,0.0); // \Delta u
-
-    straintensor incremental_strain;
-//    straintensor total_strain_at_GP;
-
-    BJtensor Jacobian;
-    BJtensor JacobianINV;
-    BJtensor JacobianINVtemp;
-    BJtensor dhGlobal;
-
-    //double tmp= 0;
-
-
-    // BJtensor of incremental displacements taken from node objects
-    //incremental_displacements= incr_disp();
-    //std::cerr << "\n=======" << getTag() << "===========\n";
-    //incremental_displacements.print("incr_disp");
-
-    for( short GP_c_r= 1 ; GP_c_r <= r_integration_order ; GP_c_r++ )
+    // Fixed size tensors avoid the heap allocations and the index
+    // string parsing of the BJtensor operators at each Gauss point.
+    FixedTensor<8,3,3,8> Kk;
+    const FixedTensor<8,3> N_C= get_fixed_nodal_coordinates<8>(theNodes);
+    geometryCache.for_each(N_C, getNaturalGaussPointData(), [&](size_t where, const GaussPointGeometry<8> &gp)
       {
-        r= get_Gauss_p_c( r_integration_order, GP_c_r );
-        rw= get_Gauss_p_w( r_integration_order, GP_c_r );
-        for( short GP_c_s= 1 ; GP_c_s <= s_integration_order ; GP_c_s++ )
-          {
-            s= get_Gauss_p_c( s_integration_order, GP_c_s );
-            sw= get_Gauss_p_w( s_integration_order, GP_c_s );
-            for( short GP_c_t= 1 ; GP_c_t <= t_integration_order ; GP_c_t++ )
-              {
-                t= get_Gauss_p_c( t_integration_order, GP_c_t );
-                tw= get_Gauss_p_w( t_integration_order, GP_c_t );
-                // this short routine is supposed to calculate position of
-                // Gauss point from 3D array of short's
-                where =
-                   ((GP_c_r-1)*s_integration_order+GP_c_s-1)*t_integration_order+GP_c_t-1;
-                // derivatives of local coordinates with respect to local coordinates
-                dh= dh_drst_at(r,s,t);
-    //dh.print("dh");
-                // Jacobian XC::BJtensor ( matrix )
-                Jacobian= Jacobian_3D(dh);
-                //Jacobian.print("J");
-
-    // Inverse of Jacobian XC::BJtensor ( matrix )
-                //JacobianINV= Jacobian_3Dinv(dh);
-                JacobianINV= Jacobian.inverse();
-    //JacobianINVtemp= JacobianINVtemp - JacobianINV;
-    //JacobianINV.print();
-       //JacobianINVtemp.print();
-
-                //JacobianINV= Jacobian.inverse(); //Zhaohui 08-31-2001
-
-
-                // determinant of Jacobian XC::BJtensor ( matrix )
-                det_of_Jacobian= Jacobian.determinant();
-                // Derivatives of local coordinates multiplied with inverse of Jacobian (see Bathe p-202)
-                dhGlobal= dh("ij") * JacobianINV("kj");
-                //        ::fprintf(stdout," # %d \n\n\n\n\n\n\n\n", El_count);
-    //dhGlobal.print("dhGlobal");
-                //weight
-                weight= rw * sw * tw * det_of_Jacobian;
-                //::::
-                //printf("\n\nIN THE STIFFNESS TENSOR INTEGRATOR ----**************** where= %d \n", where);
-                //printf("  Stifness_Tensor \n");
-                //printf("                    GP_c_r= %d,  GP_c_s= %d,  GP_c_t= %d\n",
-                //                            GP_c_r,GP_c_s,GP_c_t);
-                //printf("WEIGHT= %f", weight);
-                //Jacobian.print("J");
-                //JacobianINV.print("JINV");
-                //JacobianINVtemp.print("JINVtemp");
-                //BJtensor I= JacobianINV("ij")*Jacobian("jk");
-                //I.print("I");
-
-                //printf("determinant of Jacobian= %.6e", det_of_Jacobian);
-                //matpoint[where].report("Gauss Point\n");
-
-                // incremental strains at this Gauss point
-                //GPstress[where].reportshortpqtheta("\n stress at GAUSS point in stiffness_tensor1\n");
-
-    //incremental_strain =
-                //     (dhGlobal("ib")*incremental_displacements("ia")).symmetrize11();
-
-    //incremental_strain.null_indices();
-                //incremental_strain.report("\n incremental_strain XC::BJtensor at GAUSS point\n");
-
-    // incremental_strain.reportshort("\n incremental_strain XC::BJtensor at GAUSS point\n");
-                //----   GPstress[where].reportshortpqtheta("\n stress at GAUSS point in stiffness_tensor2\n");
-                // initialize total strain with the strain at this Gauss point before
-                // adding this increments strains!
-                //                total_strain_at_GP.Initialize(*(GPstrain+where));
-                //total_strain_at_GP.reportshort("\n total_strain XC::BJtensor at GAUSS point BEFORE\n");
-                // this is the addition of incremental strains to the previous strain state at
-                // this Gauss point
-                //                total_strain_at_GP= total_strain_at_GP + incremental_strain;
-                //total_strain_at_GP.reportshort("\n total_strain XC::BJtensor at GAUSS point AFTER\n");
-                //..   dakle ovde posalji strain_increment jer se stari stress cuva u okviru svake
-                //..   Gauss tacke a samo saljes strain_increment koji ce da se prenese
-                //..   u integracionu rutinu pa ce ta da vrati krajnji napon i onda moze da
-                //..   se pravi ConstitutiveStiffnessTensor.
-                // here comes the final_stress calculation
-                // this final stress after integration is used ONLY to obtain Constitutive XC::BJtensor
-                // at this Gauss point.
-
-                //final_stress_after_integration =
-                //    (matpoint)->operator[](where).FinalStress(*(GPstress+where),
-                //                                 incremental_strain,
-                //                                 (matpoint)->operator[](where),
-                //                                 number_of_subincrements,
-                //                                 this_one_PP);
-                //final_stress_after_integration.reportshortpqtheta("\n final_stress_after_integration in stiffness_tensor5\n");
-
-                //----   GPstress[where].reportshortpqtheta("\n stress at GAUSS point in stiffness_tensor3\n");
-                //final_stress_after_integration.reportshortpqtheta("\n final_stress_after_integration GAUSS \n");
-                //----   GPstress[where].reportshortpqtheta("\n stress at GAUSS point in stiffness_tensor4\n");
-
-                // this final stress after integration is used ONLY to obtain Constitutive XC::BJtensor
-                // at this Gauss point AND to set up the iterative_stress that is used in calculting
-                // internal forces during iterations!!
-
-                //GPiterative_stress[where].Initialize(final_stress_after_integration);
-                //GPiterative_stress[where].reportshortpqtheta("\n iterative_stress at GAUSS point in stiffness_tensor5\n");
-
-
-                // Stress state at Gauss point will be updated ( in the
-                // sense of updating stresses ( integrating them ) ) in function Update (...) ! ! ! ! !
-                // calculate the constitutive XC::BJtensor
-                //......         Constitutive=  GPtangent_E[where];
-
-    //Constitutive=  (matpoint)->operator[](where).ConstitutiveTensor(final_stress_after_integration,
-                //                                         *(GPstress+where),
-                //                                          incremental_strain,
-                //                                          (matpoint)->operator[](where),
-                //                                          this_one_PP);
-                //Constitutive.print("C","\n\n C XC::BJtensor \n");
-
-          //EPState *tmp_eps= (matpoint[where]).getEPS();
-          //NDMaterial *tmp_ndm= (matpoint[where]).getNDMat();
-
-    //if( tmp_eps ) {     //Elasto-plastic case
-    //    mmodel->setEPS( *tmp_eps );
-
-    //int err= ( matpoint[where].matmodel )->setTrialStrainIncr( incremental_strain);
-    //if( err)
-                 //   std::cerr << "XC::EightNodeBrick::getStiffnessTensor (tag: %d), not converged",
-    //         this->getTag());
-
-    Constitutive= (matpoint[where].matmodel)->getTangentTensor();
-                //Constitutive.print("C","\n\n C XC::BJtensor \n");
-
-    //    matpoint[where].setEPS( mmodel->getEPS() );
-    //}
-    //else if( tmp_ndm ) { //Elastic case
-    //    (matpoint[where].p_matmodel)->setTrialStrainIncr( incremental_strain );
-    //    Constitutive= (matpoint[where].p_matmodel)->getTangentTensor();
-    //}
-    //else {
-                 //   std::cerr << "XC::EightNodeBrick::incremental_Update (tag: %d), could not getTangentTensor", this->getTag();
-    //   exit(1);
-    //}
-
-    //printf("Constitutive.trace= %12.6e\n", Constitutive.trace());
-                //Kmat= this->stiffness_matrix(Constitutive);
-                //printf("Constitutive XC::BJtensor max:= %10.3e\n", Kmat.mmax());
-
-                //----   GPstress[where].reportshortpqtheta("\n stress at GAUSS point in stiffness_tensor5\n");
-                // this is update of constitutive XC::BJtensor at this Gauss point
-                //GPtangent_E[where].Initialize(Constitutive);
-                //....GPtangent_E[where].print(" tangent E at GAUSS point");
-
-                //GPstress[where].reportshortpqtheta("\n stress at GAUSS point in stiffness_tensor6\n");
-
-                //K= K + temp2;
-
-    Kkt= dhGlobal("ib")*Constitutive("abcd");
-    Kkt= Kkt("aicd")*dhGlobal("jd")*weight;
-       Kk= Kk + Kkt;
-
-    //Kk= Kk + dhGlobal("ib")*Constitutive("abcd")*dhGlobal("jd")*weight;
-                //....K.print("K","\n\n K XC::BJtensor \n");
-
-    //Kmat= this->stiffness_matrix(Kkt);
-                //Kmat.print("Kmat");
-
-    //printf("K XC::BJtensor max= %10.3e\n", Kmat.mmax());
-
-                //convert constitutive and K to matrix and find min and max and print!
-
-
-
-              }
-          }
-      }
-    //Kk.print("K","\n\n K XC::BJtensor \n");
-    //K= Kk;
-    return Kk;
+        const FixedTensor<3,3,3,3> Constitutive((matpoint[where].matmodel)->getTangentTensor());
+        // Kk+= (dhGlobal("ib")*Constitutive("abcd"))("aicd")*dhGlobal("jd")*weight
+        Kk.addTensor(contract<3,1>(contract<1,1>(gp.dhGlobal, Constitutive), gp.dhGlobal), gp.weight);
+      });
+    return Kk.getBJtensor();
   }
 
 
@@ -1484,202 +1343,15 @@ int * XC::EightNodeBrick::get_LM(void)
 // returns nodal forces for given stress field in an element
 XC::BJtensor XC::EightNodeBrick::nodal_forces(void) const
   {
-
-//BJ//BJ
-//BJ    std::cerr << "\n\n\n\n Print in XC::BJtensor XC::EightNodeBrick::nodal_forces(" <<std::endl; this->Print(std::cerr);
-//BJ//BJ
-
-    std::vector<int> force_dim({8,3});  // Xiaoyan changed from {20,3 to {8,3} for 8 nodes
-
-    BJtensor nodal_forces(force_dim,0.0);
-
-    double r= 0.0;
-    double rw= 0.0;
-    double s= 0.0;
-    double sw= 0.0;
-    double t= 0.0;
-    double tw= 0.0;
-
-    short where= 0;
-    double weight= 0.0;
-
-    std::vector<int> dh_dim({8,3});  // Xiaoyan changed from {20,3 to {8,3} for 8 nodes
-
-    BJtensor dh(dh_dim, 0.0);
-
-    stresstensor stress_at_GP(0.0);
-
-    double det_of_Jacobian= 0.0;
-
-    straintensor incremental_strain;
-
-    static std::vector<int> disp_dim({8,3});   // Xiaoyan changed from {20,3} to {8,3}
-    BJtensor incremental_displacements(disp_dim,0.0); // \Delta u
-
-    incremental_displacements= incr_disp();
-
-    BJtensor Jacobian;
-    BJtensor JacobianINV;
-    BJtensor dhGlobal;
-
-    for( short GP_c_r= 1 ; GP_c_r <= r_integration_order ; GP_c_r++ )
+    FixedTensor<8,3> nodal_forces;
+    const FixedTensor<8,3> N_C= get_fixed_nodal_coordinates<8>(theNodes);
+    geometryCache.for_each(N_C, getNaturalGaussPointData(), [&](size_t where, const GaussPointGeometry<8> &gp)
       {
-        r= get_Gauss_p_c( r_integration_order, GP_c_r );
-        rw= get_Gauss_p_w( r_integration_order, GP_c_r );
-
-        for( short GP_c_s= 1 ; GP_c_s <= s_integration_order ; GP_c_s++ )
-          {
-            s= get_Gauss_p_c( s_integration_order, GP_c_s );
-            sw= get_Gauss_p_w( s_integration_order, GP_c_s );
-
-            for( short GP_c_t= 1 ; GP_c_t <= t_integration_order ; GP_c_t++ )
-              {
-                t= get_Gauss_p_c( t_integration_order, GP_c_t );
-                tw= get_Gauss_p_w( t_integration_order, GP_c_t );
-
-                // this short routine is supposed to calculate position of
-                // Gauss point from 3D array of short's
-                where =
-                ((GP_c_r-1)*s_integration_order+GP_c_s-1)*t_integration_order+GP_c_t-1;
-
-                // derivatives of local coordiantes with respect to local coordiantes
-                dh= dh_drst_at(r,s,t);
-
-                // Jacobian XC::BJtensor ( matrix )
-                Jacobian= Jacobian_3D(dh);
-                //....                Jacobian.print("J");
-
-                // Inverse of Jacobian XC::BJtensor ( matrix )
-                JacobianINV= Jacobian_3Dinv(dh);
-                //....                JacobianINV.print("JINV");
-
-                // determinant of Jacobian XC::BJtensor ( matrix )
-                det_of_Jacobian= Jacobian.determinant();
-                //....  ::printf("determinant of Jacobian is %f\n",Jacobian_determinant );
-
-                // Derivatives of local coordinates multiplied with inverse of Jacobian (see Bathe p-202)
-                dhGlobal= dh("ij") * JacobianINV("kj");
-
-                //weight
-                weight= rw * sw * tw * det_of_Jacobian;
-    //std::cerr << " UCD det_of_Jacobian "<< det_of_Jacobian << std::endl;
-                //..::printf("\n\nIN THE nodal forces ----**************** where= %d \n", where);
-                //..::printf("                    GP_c_r= %d,  GP_c_s= %d,  GP_c_t= %d\n",
-                //..                           GP_c_r,GP_c_s,GP_c_t);
-                //..::printf("WEIGHT= %f", weight);
-                //..::printf("determinant of Jacobian= %f", det_of_Jacobian);
-                //..matpoint[where].report("Gauss Point\n");
-
-                //..    just determine this BJtensor E yet and for each gauss point different !!!!!!!!!!!!
-                //..    here should be based on incremental shifts somewhere
-                //..    find incremental deformation (strain_increment) and then with it:
-                //..
-                //// BJtensor of incremental displacements taken from node objects
-                //                incremental_displacements= incr_disp();
-                //
-                //// incremental strains at this Gauss point
-                //                incremental_strain =
-                //                  (dhGlobal("ib")*incremental_displacements("ia")).symmetrize11();
-                //
-                //                incremental_strain.null_indices();
-                ////incremental_strain.reportshort("\n incremental_strain XC::BJtensor at GAUSS point\n");
-                //
-                ////                integr_type= (matpoint)->operator[](where).integration_type();
-                ////                if( !strcmp(integr_type,"BakcwardEuler")
-
-                //..  so send stress_increment here because old stress is stored within each
-                //..  Gauss points and only send strain_increment to be transmitted
-                //..  into the integration routine so that it will return the final voltage and then it can
-                //..  that is, the ConstitutiveStiffnessTensor.
-                //..  Actually send everything you have (incremental_strain, start_stress,
-                //..  number_of_subincrements. . . into this Constitutive_tensor function
-                //..  so let it go, depending on the model used and let
-                //..  then there in each special model function return what it needs
-                //..  (say Elastic returns Eelastic immediately and let's say MRS_Lade first
-                //..  asks what method of integration to use and then depending on it
-                //..  call function which integrals for that algorithm (ForwardEuler, BakcwardEuler,
-                //..  SemiBackwardEuler ,. . . ) and then when the function returns voltage then
-                //..  one wonders again what type of integration was at stake so the right one
-                //..  ConstitutiveTensor and brings it back!
-
-                //                   stress_at_GP= (GPstress)->operator[](where);
-                //stress_at_GP= GPstress[where];
-
-          //EPState *tmp_eps= (matpoint[where].matmodel)->getEPS();
-    //stress_at_GP= tmp_eps->getStress();
-    //std::cerr << "tmp_eps" << (*tmp_eps);
-
-          //NDMaterial *tmp_ndm= (matpoint[where]).getNDMat();
-
-    //if( tmp_eps ) {     //Elasto-plastic case
-
-    //stress_at_GP= (matpoint[where].matmodel->getEPS())->getStress();
-
-    //   EPState *tmp_eps= (matpoint[where].matmodel)->getEPS();
-    //   stress_at_GP= tmp_eps->getStress();
-
-
-
-//Guanzhou out 5-6-2004    incremental_strain =
-//Guanzhou out 5-6-2004                     (dhGlobal("ib")*incremental_displacements("ia")).symmetrize11();
-//Guanzhou out 5-6-2004//    if(where == 0)
-//Guanzhou out 5-6-2004//       //std::cerr << " In nodal_force delta_incremental_strain tag "<< getTag() <<"  " <<incremental_strain << std::endl;
-//Guanzhou out 5-6-2004////    std::cerr << " el tag= "<< getTag();
-//Guanzhou out 5-6-2004//
-//Guanzhou out 5-6-2004    int err= ( matpoint[where].matmodel )->setTrialStrainIncr( incremental_strain);
-//Guanzhou out 5-6-2004    if( err)
-//Guanzhou out 5-6-2004      std::cerr << "XC::EightNodeBrick::getStiffnessTensor (tag: " << this->getTag() << "), not converged\n";
-
-
-    //char *test= matpoint[where].matmodel->getType();
-    // fmk - changing if so if into else block must be XC::Template3Dep
-//    if(strcmp(matpoint[where].matmodel->getType(),"Template3Dep") != 0)
-       stress_at_GP= matpoint[where].getStressTensor();
-
-//         stress_at_GP.report("PROBLEM");
-//         getchar();
-
-//    else
-//    {
-//             //Some thing funny happened when getting stress directly from matpoint[where], i have to do it this way!
-//       EPState *tmp_eps= ((Template3Dep *)(matpoint[where].matmodel))->getEPS();
-//       stress_at_GP= tmp_eps->getStress();
-//       //delete tmp_eps;
-//           }
-
-             //double  p= stress_at_GP.p_hydrostatic();
-                //if( p < 0.0 )
-          //{
-          //  std::cerr << getTag();
-          //  std::cerr << " ***p=    " << p << std::endl;
-          //}
-
-    //std::cerr << " nodal_force :: stress_at_GP " << stress_at_GP << std::endl;
-
-    //}
-    //else if( tmp_ndm ) { //Elastic case
-               //    stress_at_GP= (matpoint[where].getNDMat())->getStressTensor();
-    //}
-    //else {
-                 //   std::cerr << "XC::EightNodeBrick::nodal_forces (tag: %d), could not getStress", this->getTag();
-    //   exit(1);
-    //}
-
-                //stress_at_GP.report("\n stress_at_GPtensor at GAUSS point for nodal forces \n");
-
-                // nodal forces See Zienkievicz part 1 pp 108
-                nodal_forces =
-                     nodal_forces + dhGlobal("ib")*stress_at_GP("ab")*weight;
-                //nodal_forces.print("nf","\n\n Nodal Forces \n");
-
-              }
-          }
-      }
-
-    //std::cerr << "\n element no. " << getTag() << std::endl;
-    //nodal_forces.print("nf","\n Nodal Forces \n");
-    return nodal_forces;
-
+        const FixedTensor<3,3> stress_at_GP(matpoint[where].getStressTensor());
+        // nodal_forces+= dhGlobal("ib")*stress_at_GP("ab")*weight
+        nodal_forces.addTensor(contract<1,1>(gp.dhGlobal, stress_at_GP), gp.weight);
+      });
+    return nodal_forces.getBJtensor();
   }
 
 ////#############################################################################
@@ -67,6 +67,7 @@
 #include <utility/matrix/Matrix.h>
 #include <utility/matrix/Vector.h>
 #include "domain/mesh/element/utils/body_forces/BodyForces3D.h"
+#include "domain/mesh/element/utils/gauss_models/GaussPointShapeCache.h"
 
 namespace XC {
 class Node;
@@ -135,6 +136,7 @@ class EightNodeBrick: public ElementBase<8>
     // MatPoint3D[r_integration_order][s_integration_order][t_integration_order]
     // 3D array of Material points
     std::vector<MatPoint3D> matpoint;  //!< pointer to array of Material Points
+    mutable GaussPointGeometryCache<8> geometryCache; //!< global derivatives of the shape functions at the Gauss points.
 
     // 3D array of material models for each Material points
     // NDMaterial *GPmmodel; //!< pointer to array of material models for Material Points
@@ -144,6 +146,7 @@ class EightNodeBrick: public ElementBase<8>
 
 
     int  LM[24]; //!< for 8noded x 3 = 24
+    void alloc_material_points(const NDMaterial *);
   public:
     EightNodeBrick(int element_number,
                    int node_numb_1, int node_numb_2, int node_numb_3, int node_numb_4,
@@ -153,6 +156,7 @@ class EightNodeBrick: public ElementBase<8>
    // int dir, double surflevel);
    //, EPState *InitEPS);   const std::string &type,
 
+    EightNodeBrick(int tag,const NDMaterial *ptr_mat);
     EightNodeBrick(void);
     Element *getCopy(void) const;
     ~EightNodeBrick(void);
@@ -218,6 +222,7 @@ class EightNodeBrick: public ElementBase<8>
     //Finite_Element & operator[](int subscript);
     //Finite_Element & operator[](int subscript);
 
+    const NaturalShapeFunctionCache<8>::gauss_point_data &getNaturalGaussPointData(void) const;
     BJtensor getStiffnessTensor(void) const;
     //matrix stiffness_tensor(void);
 
@@ -50,18 +50,20 @@ XC::ZeroLengthContact::ZeroLengthContact(int tag, int classTag, int dim, int Nd1
 
 //! @brief Default constructor.
 XC::ZeroLengthContact::ZeroLengthContact(int tag,int classTag, int dim)
-  :Element0D(tag,classTag,0,0,dim),
-   N(dim*numNodes())
+  :Element0D(tag,classTag,0,0,dim), pressure(0.0), t1(0.0), t2(0.0),
+   gap(0.0), gap_n(0.0), Kn(0.0), Kt(0.0), fs(0.0),
+   N(dim*numNodes()), ContactFlag(0)
   {}
 
 //! @brief Reactivates the element.
+//!
+//! The contact state is restarted, so the element behaves
+//! as a new one (see ContactManager).
 void XC::ZeroLengthContact::alive(void)
   {
     if(isDead())
       {
-        std::cerr << getClassName() << "::" << __FUNCTION__ 
-                << "; not implemented yet."
-                << getTag() << std::endl;
+        revertToStart();
 	Element0D::alive(); // Not dead anymore.
       }
   }
@@ -69,6 +69,19 @@ class ZeroLengthContact: public Element0D
     ZeroLengthContact(int tag, int classTag, int dim, int Nd1, int Nd2,double Kn, double Kt, double fRatio);
 
     void alive(void);
+
+    inline double getKn(void) const
+      { return Kn; }
+    inline void setKn(const double &d)
+      { Kn= d; }
+    inline double getKt(void) const
+      { return Kt; }
+    inline void setKt(const double &d)
+      { Kt= d; }
+    inline double getFrictionRatio(void) const
+      { return fs; }
+    inline void setFrictionRatio(const double &d)
+      { fs= d; }
     
     int addLoad(ElementalLoad *theLoad, double loadFactor);
     int addInertiaLoadToUnbalance(const Vector &);
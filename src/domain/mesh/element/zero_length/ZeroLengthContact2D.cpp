@@ -87,6 +87,21 @@ XC::ZeroLengthContact2D::ZeroLengthContact2D(int tag)
 XC::Element* XC::ZeroLengthContact2D::getCopy(void) const
   { return new ZeroLengthContact2D(*this); }
 
+//! @brief Set the outward normal of the primary (retained) surface.
+void XC::ZeroLengthContact2D::setContactNormal(const Vector &normal)
+  {
+    const double norm= normal.Norm();
+    if((normal.Size()!=2) || (norm==0.0))
+      std::cerr << getClassName() << "::" << __FUNCTION__
+                << "; a non-zero vector of dimension 2 is needed, got: "
+                << normal << std::endl;
+    else
+      {
+        ContactNormal(0)= normal(0)/norm;
+        ContactNormal(1)= normal(1)/norm;
+      }
+  }
+
 //! @brief to set a link to the enclosing Domain and to set the node pointers.
 //!    also determines the number of dof associated
 //!    with the ZeroLengthContact2D element
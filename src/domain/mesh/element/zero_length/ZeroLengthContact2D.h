@@ -150,6 +150,10 @@ class ZeroLengthContact2D: public ZeroLengthContact
     ZeroLengthContact2D(int tag, int Nd1, int Nd2,double Kn, double Kt, double fRatio, const Vector& normal);
     Element *getCopy(void) const;
 
+    inline const Vector &getContactNormal(void) const
+      { return ContactNormal; }
+    void setContactNormal(const Vector &);
+
     void setDomain(Domain *theDomain);
 
   
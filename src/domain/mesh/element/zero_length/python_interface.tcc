@@ -40,9 +40,15 @@ class_<XC::ZeroLengthSection, bases<XC::Element0D>, boost::noncopyable >("ZeroLe
   .def("getVDirWeakAxisGlobalCoord",make_function(&XC::ZeroLengthSection::getVDirWeakAxisGlobalCoord, return_value_policy<copy_const_reference>()),"Returns the direction vector of element weak axis expressed in the global coordinate system.")
   ;
 
-class_<XC::ZeroLengthContact, bases<XC::Element0D>, boost::noncopyable >("ZeroLengthContact", no_init);
+class_<XC::ZeroLengthContact, bases<XC::Element0D>, boost::noncopyable >("ZeroLengthContact", no_init)
+  .add_property("Kn", &XC::ZeroLengthContact::getKn, &XC::ZeroLengthContact::setKn,"Get/set the normal penalty.")
+  .add_property("Kt", &XC::ZeroLengthContact::getKt, &XC::ZeroLengthContact::setKt,"Get/set the tangential penalty.")
+  .add_property("frictionRatio", &XC::ZeroLengthContact::getFrictionRatio, &XC::ZeroLengthContact::setFrictionRatio,"Get/set the friction ratio.")
+  ;
 
-class_<XC::ZeroLengthContact2D, bases<XC::ZeroLengthContact>, boost::noncopyable >("ZeroLengthContact2D", no_init);
+class_<XC::ZeroLengthContact2D, bases<XC::ZeroLengthContact>, boost::noncopyable >("ZeroLengthContact2D", no_init)
+  .add_property("contactNormal", make_function(&XC::ZeroLengthContact2D::getContactNormal, return_internal_reference<>() ), &XC::ZeroLengthContact2D::setContactNormal,"Get/set the outward normal of the primary surface.")
+  ;
 
 //class_<XC::ZeroLengthContact3D, bases<XC::ZeroLengthContact>, boost::noncopyable >("ZeroLengthContact3D", no_init);
 
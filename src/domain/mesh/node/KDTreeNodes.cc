@@ -34,6 +34,13 @@
 XC::NodePos::NodePos(const Node &n)
   : KDTreePos(n.getInitialPosition3d()), nodPtr(&n) {}
 
+//! @brief Constructor.
+//!
+//! @param n: node.
+//! @param p: position of the node (i.e. its current position).
+XC::NodePos::NodePos(const Node &n, const Pos3d &p)
+  : KDTreePos(p), nodPtr(&n) {}
+
 //! @brief Constructor.
 XC::NodePos::NodePos(const Pos3d &p)
   : KDTreePos(p), nodPtr(nullptr) {}
@@ -48,6 +55,13 @@ void XC::KDTreeNodes::insert(const Node &n)
     tree_type::insert(n);
   }
 
+//! @brief Insert the node using the position being passed as parameter
+//! instead of its initial position.
+void XC::KDTreeNodes::insert(const Node &n, const Pos3d &p)
+  {
+    tree_type::insert(NodePos(n,p));
+  }
+
 void XC::KDTreeNodes::erase(const Node &n)
   {
     tree_type::erase(n);
@@ -83,3 +97,18 @@ const XC::Node *XC::KDTreeNodes::getNearest(const Pos3d &pos, const double &r) c
       retval= found.first->getNodePtr();
     return retval;
   }
+
+//! @brief Returns the nodes whose distance to the position being passed
+//! as parameter is not greater than r.
+std::deque<const XC::Node *> XC::KDTreeNodes::getNodesWithinRange(const Pos3d &pos, const double &r) const
+  {
+    std::deque<const Node *> retval;
+    const NodePos target(pos);
+    std::deque<NodePos> found;
+    // Search in the box [pos-r,pos+r] and then filter by distance.
+    find_within_range(target, r, std::back_inserter(found));
+    for(std::deque<NodePos>::const_iterator i= found.begin();i!=found.end();i++)
+      if(i->distance_to(target)<=r)
+        retval.push_back(i->getNodePtr());
+    return retval;
+  }
@@ -31,6 +31,7 @@
 
 #include "utility/geom/pos_vec/KDTreePos.h"
 #include "utility/kdtree++/kdtree.hpp"
+#include <deque>
 
 class Pos3d;
 
@@ -45,6 +46,7 @@ class NodePos: public KDTreePos
     const Node *nodPtr;
   public:
     NodePos(const Node &);
+    NodePos(const Node &, const Pos3d &);
     explicit NodePos(const Pos3d &p);
     inline const Node *getNodePtr(void) const
       { return nodPtr; }
@@ -67,11 +69,13 @@ class KDTreeNodes: protected kd_tree::KDTree<3, NodePos, std::pointer_to_binary_
     KDTreeNodes(void);
 
     void insert(const Node &);
+    void insert(const Node &, const Pos3d &);
     void erase(const Node &);
     void clear(void);
 
     const Node *getNearest(const Pos3d &pos) const;
     const Node *getNearest(const Pos3d &pos, const double &r) const;
+    std::deque<const Node *> getNodesWithinRange(const Pos3d &pos, const double &r) const;
   };
 
 } // end of XC namespace 
@@ -95,6 +95,7 @@
 #include "utility/utils/misc_utils/colormod.h"
 
 std::deque<XC::Matrix> XC::Node::theMatrices;
+size_t XC::Node::massStamp= 0;
 XC::DefaultTag XC::Node::defaultTag;
 
 //! @brief Default constructor.
@@ -156,7 +157,7 @@ XC::Node::Node(int tag, int ndof, double Crd1)
   : MeshComponent(tag,NOD_TAG_Node),
     numberDOF(ndof), theDOF_GroupPtr(nullptr),
     Crd(1), disp(), vel(), accel(),
-    mass(ndof,ndof), unbalLoad(numberDOF), unbalLoadWithInertia(numberDOF),
+    mass(), unbalLoad(numberDOF), unbalLoadWithInertia(numberDOF),
     reaction(numberDOF), alphaM(0.0), tributary(0.0)
   {
     // tag= -1 is reserved for the seed node, don't modify the default tag
@@ -191,7 +192,7 @@ XC::Node::Node(int tag, int ndof, double Crd1)
 XC::Node::Node(int tag, int ndof, double Crd1, double Crd2)
   :MeshComponent(tag,NOD_TAG_Node),numberDOF(ndof), theDOF_GroupPtr(nullptr),
    Crd(2), disp(), vel(), accel(),
-   mass(ndof,ndof), unbalLoad(numberDOF), unbalLoadWithInertia(numberDOF),
+   mass(), unbalLoad(numberDOF), unbalLoadWithInertia(numberDOF),
    reaction(numberDOF), alphaM(0.0), tributary(0.0)
   {
     // tag= -1 is reserved for the seed node, don't modify the default tag
@@ -228,7 +229,7 @@ XC::Node::Node(int tag, int ndof, double Crd1, double Crd2)
 XC::Node::Node(int tag, int ndof, double Crd1, double Crd2, double Crd3)
   :MeshComponent(tag,NOD_TAG_Node), numberDOF(ndof), theDOF_GroupPtr(nullptr),
    Crd(3), disp(), vel(), accel(),
-   mass(ndof,ndof), unbalLoad(numberDOF), unbalLoadWithInertia(numberDOF),
+   mass(), unbalLoad(numberDOF), unbalLoadWithInertia(numberDOF),
    reaction(numberDOF), alphaM(0.0), tributary(0.0)
   {
     // tag= -1 is reserved for the seed node, don't modify the default tag
@@ -255,7 +256,7 @@ XC::Node::Node(int tag, int ndof, const Vector &crds)
   :MeshComponent(tag,NOD_TAG_Node),
    numberDOF(ndof), theDOF_GroupPtr(nullptr),
    Crd(crds), disp(), vel(), accel(),
-   mass(ndof,ndof), unbalLoad(numberDOF), unbalLoadWithInertia(numberDOF),
+   mass(), unbalLoad(numberDOF), unbalLoadWithInertia(numberDOF),
    reaction(numberDOF), alphaM(0.0), tributary(0.0)
   {
     // tag= -1 is reserved for the seed node, don't modify the default tag
@@ -291,12 +292,43 @@ XC::Node::Node(const Node &otherNode, bool copyMass)
     unbalLoad.Zero();
 
     if(copyMass == true)
-      mass= otherNode.mass;
+      {
+        mass= otherNode.mass;
+        massStamp++; // cached M*r products are no longer valid.
+      }
 
     index = -1;
     setup_matrices(theMatrices,numberDOF);
   }
 
+//! @brief Assignment operator.
+XC::Node &XC::Node::operator=(const Node &other)
+  {
+    MeshComponent::operator=(other);
+    numberDOF= other.numberDOF;
+    theDOF_GroupPtr= other.theDOF_GroupPtr;
+    Crd= other.Crd;
+    disp= other.disp;
+    vel= other.vel;
+    accel= other.accel;
+    R= other.R;
+    mass= other.mass;
+    massStamp++; // cached M*r products are no longer valid.
+    unbalLoad= other.unbalLoad;
+    unbalLoadWithInertia= other.unbalLoadWithInertia;
+    reaction= other.reaction;
+    alphaM= other.alphaM;
+    tributary= other.tributary;
+    theEigenvectors= other.theEigenvectors;
+    dispSensitivity= other.dispSensitivity;
+    velSensitivity= other.velSensitivity;
+    accSensitivity= other.accSensitivity;
+    parameterID= other.parameterID;
+    connected= other.connected;
+    freeze_constraints= other.freeze_constraints;
+    return *this;
+  }
+
 //! @brief Inserts a component (element, constraint,...) to the connected component list.
 void XC::Node::connect(ContinuaReprComponent *el) const
   { 
@@ -1146,7 +1178,7 @@ void XC::Node::createInertiaLoad(const Vector &accel)
     v.Zero();
     const size_t sz= accel.Size();
     for(size_t i= 0;i<sz;i++)
-      v[i]-= mass(i,i)*accel(i); //Like Ansys.
+      v[i]-= getMass()(i,i)*accel(i); //Like Ansys.
     newLoad(v); //Put the load in the current load pattern.
   }
 
@@ -1213,8 +1245,8 @@ int XC::Node::addInertiaLoadToUnbalance(const Vector &accelG, double fact)
 
     // form - fact * M*R*accelG and add it to the unbalanced load
     //unbalLoad-= ((mass) * R * accelG)*fact;
-    Matrix MR(mass.noRows(), R.noCols());
-    MR.addMatrixProduct(0.0, mass, R, 1.0);
+    Matrix MR(getMass().noRows(), R.noCols());
+    MR.addMatrixProduct(0.0, getMass(), R, 1.0);
     unbalLoad.addMatrixVector(1.0, MR, accelG, -fact);
     return 0;
   }
@@ -1239,14 +1271,14 @@ int XC::Node::addInertiaLoadSensitivityToUnbalance(const XC::Vector &accelG, dou
     // form - fact * M*R*accelG and add it to the unbalanced load
     //unbalLoad-= ((mass) * R * accelG)*fact;
 
-    Matrix massSens(mass.noRows(),mass.noCols());
+    Matrix massSens(getMass().noRows(),getMass().noCols());
     if(parameterID != 0)
       { massSens(parameterID-1,parameterID-1) = 1.0; }
 
-    Matrix MR(mass.noRows(), R.noCols());
+    Matrix MR(getMass().noRows(), R.noCols());
 
     if(somethingRandomInMotions)
-      { MR.addMatrixProduct(0.0,mass,R, 1.0); }
+      { MR.addMatrixProduct(0.0,getMass(),R, 1.0); }
     else
       { MR.addMatrixProduct(0.0, massSens, R, 1.0); }
     unbalLoad.addMatrixVector(1.0, MR, accelG, -fact);
@@ -1350,16 +1382,20 @@ int XC::Node::revertToStart(void)
 //! message is printed and the program terminated if no space is available
 //! on the heap for this matrix.
 const XC::Matrix &XC::Node::getMass(void) const
-  { return mass; }
+  {
+    if(mass.isEmpty()) // storage is allocated on first request.
+      mass= Matrix(numberDOF,numberDOF);
+    return mass;
+  }
 
 //! @brief Return the mass matrix component for the DOF argument.
 double XC::Node::getMassComponent(const int &dof) const
   {
-    const size_t sz= mass.noRows();
+    const size_t sz= getMass().noRows();
     Vector J(sz);
     J(dof)= 1.0;
     Vector tmp(sz);
-    tmp.addMatrixVector(1.0, mass, J, 1.0);
+    tmp.addMatrixVector(1.0, getMass(), J, 1.0);
     const double retval= dot(J,tmp);
     return retval;
   }
@@ -1384,7 +1420,7 @@ const XC::Matrix &XC::Node::getDamp(void) const
     else
       {
         Matrix &result= theMatrices[index];
-        result= mass;
+        result= getMass();
         result*= alphaM;
         return result;
       }
@@ -1441,9 +1477,17 @@ int XC::Node::setMass(const Matrix &newMass)
         return -1;
       }
     mass= newMass;
+    massStamp++; // cached M*r products are no longer valid.
     return 0;
   }
 
+//! @brief Return a counter that is incremented each time the mass
+//! of any node changes, so the objects that cache products of the
+//! nodal masses (i.e. UniformExcitation influence vectors) can check
+//! their validity.
+const size_t &XC::Node::getMassStamp(void)
+  { return massStamp; }
+
 //! Creates a Matrix to store the R matrix.
 //! 
 //! Creates a Matrix to store the R matrix. The matrix is of dimension
@@ -1669,19 +1713,19 @@ double XC::Node::getModalParticipationFactor(int mode,const std::set<int> &dofs)
         const Vector ev= getEigenvector(mode);
         const int sz= ev.Size();
         double num= 0;
-        if((mass.noRows()!=sz) || (mass.noCols()!=sz))
+        if((getMass().noRows()!=sz) || (getMass().noCols()!=sz))
           std::cerr << Color::red << getClassName() << "::" << __FUNCTION__
 		    << "; ERROR. The eigenvector has dimension " << sz
-                    << " and the mass matrix has dimension " << mass.noRows()
-                    << "x" << mass.noCols() << "."
+                    << " and the mass matrix has dimension " << getMass().noRows()
+                    << "x" << getMass().noCols() << "."
 	            << Color::def << std::endl;
         Vector J(sz,0.0);
         for(std::set<int>::const_iterator i= dofs.begin();i!=dofs.end();i++)
           J[*i]= 1;
-        num= dot(ev,(mass*J));
+        num= dot(ev,(getMass()*J));
         if(num!=0)
           {
-            const double denom= dot(ev,(mass*ev));
+            const double denom= dot(ev,(getMass()*ev));
             retval= num/denom;
           }
       }
@@ -1756,7 +1800,7 @@ double XC::Node::getEffectiveModalMass(int mode) const
     const int sz= ev.Size();
     const double tau= getModalParticipationFactor(mode);
     const Vector J(sz,1.0);
-    retval= tau*dot(ev,(mass*J));
+    retval= tau*dot(ev,(getMass()*J));
     return retval;
   }
 
@@ -1774,7 +1818,7 @@ XC::Vector XC::Node::getEffectiveModalMasses(void) const
 //! being passed as parameter and the acceleration corresponding to that mode.
 XC::Vector XC::Node::getEquivalentStaticLoad(int mode,const double &accel_mode) const
   {
-    Vector retval= mass*getDistributionFactor(mode);
+    Vector retval= getMass()*getDistributionFactor(mode);
     retval*=(accel_mode);
     return retval;
   }
@@ -1866,7 +1910,7 @@ int XC::Node::sendData(Communicator &comm)
   {
     int res= MeshComponent::sendData(comm);
     res+= comm.sendInt(numberDOF,getDbTagData(),CommMetaData(4));
-    res+= comm.sendMatrix(mass,getDbTagData(),CommMetaData(5));
+    res+= comm.sendMatrix(getMass(),getDbTagData(),CommMetaData(5));
     res+= comm.sendVector(reaction,getDbTagData(),CommMetaData(6));
     res+= comm.sendVector(unbalLoad,getDbTagData(),CommMetaData(7));
     res+= comm.sendVector(unbalLoadWithInertia,getDbTagData(),CommMetaData(8));
@@ -1890,6 +1934,7 @@ int XC::Node::recvData(const Communicator &comm)
     int res= MeshComponent::recvData(comm);
     res+= comm.receiveInt(numberDOF,getDbTagData(),CommMetaData(4));
     res+= comm.receiveMatrix(mass,getDbTagData(),CommMetaData(5));
+    massStamp++;
     res+= comm.receiveVector(reaction,getDbTagData(),CommMetaData(6));
     res+= comm.receiveVector(unbalLoad,getDbTagData(),CommMetaData(7));
     res+= comm.receiveVector(unbalLoadWithInertia,getDbTagData(),CommMetaData(8));
@@ -1915,7 +1960,7 @@ boost::python::dict XC::Node::getPyDict(void) const
   {
     boost::python::dict retval= DomainComponent::getPyDict();
     retval["numberDOF"]= numberDOF;
-    retval["mass"]= mass.getPyList();
+    retval["mass"]= getMass().getPyList();
     retval["reaction"]= reaction.getPyList();
     retval["unbalLoad"]= unbalLoad.getPyList();
     retval["unbalLoadWithInertia"]= unbalLoadWithInertia.getPyList();
@@ -1943,6 +1988,7 @@ void XC::Node::setPyDict(const boost::python::dict &d)
     DomainComponent::setPyDict(d);
     this->numberDOF= boost::python::extract<int>(d["numberDOF"]);
     mass= Matrix(boost::python::extract<boost::python::list>(d["mass"]));
+    massStamp++;
     reaction= Vector(boost::python::extract<boost::python::list>(d["reaction"]));
     unbalLoad= Vector(boost::python::extract<boost::python::list>(d["unbalLoad"]));
     unbalLoadWithInertia= Vector(boost::python::extract<boost::python::list>(d["unbalLoadWithInertia"]));
@@ -2074,7 +2120,7 @@ void XC::Node::Print(std::ostream &s, int flag) const
         accel.Print(s,flag);
         s << "\t unbalanced load: " << unbalLoad;
         s << "\t reaction: " << reaction;
-        s << "\tMass : " << mass;
+        s << "\tMass : " << getMass();
         s << "\t Eigenvectors: " << theEigenvectors;
         if(theDOF_GroupPtr != 0)
           s << "\tID : " << theDOF_GroupPtr->getID();
@@ -2087,7 +2133,7 @@ void XC::Node::Print(std::ostream &s, int flag) const
 
 XC::Matrix XC::Node::getMassSensitivity(void) const
   {
-    Matrix massSens(mass.noRows(),mass.noCols());
+    Matrix massSens(getMass().noRows(),getMass().noCols());
     if( (parameterID == 1) || (parameterID == 2) || (parameterID == 3) )
      { massSens(parameterID-1,parameterID-1) = 1.0; }
     return massSens;
@@ -2152,7 +2198,11 @@ int XC::Node::setParameter(const std::vector<std::string> &argv, Parameter &para
 int XC::Node::updateParameter(int pparameterID, Information &info)
   {
     if( (pparameterID == 1) || (pparameterID == 2) || (pparameterID == 3) )
-      { mass(pparameterID-1,pparameterID-1) = info.theDouble; }
+      {
+	getMass(); // make sure the mass matrix exists.
+	mass(pparameterID-1,pparameterID-1) = info.theDouble;
+	massStamp++;
+      }
     else
       if( (pparameterID == 4) || (pparameterID == 5) || (pparameterID == 6) )
         {
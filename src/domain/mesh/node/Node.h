@@ -125,7 +125,7 @@ class Node: public MeshComponent
     NodeAccelVectors accel; //! Acceleration vectors (committed,trial,...)
 
     Matrix R; //!< nodal (modal?) participation matrix
-    Matrix mass; //!< mass matrix
+    mutable Matrix mass; //!< mass matrix (allocated on first request, see getMass()).
     mutable Vector unbalLoad; //!< unbalanced load
     mutable Vector unbalLoadWithInertia; //!< unbalanced load with inertia
     mutable Vector reaction;
@@ -142,6 +142,7 @@ class Node: public MeshComponent
     // AddingSensitivity:END ///////////////////////////////////////////
 
     static std::deque<Matrix> theMatrices;
+    static size_t massStamp; //!< incremented each time a nodal mass changes.
 
     mutable std::set<ContinuaReprComponent *> connected; //!< Components (elements, constraints,...) that are connected with this node.
 
@@ -169,6 +170,7 @@ class Node: public MeshComponent
     Node(int tag, int ndof, double Crd1, double Crd2, double Crd3);
     Node(int tag, int ndof, const Vector &crds);
     Node(const Node &theCopy, bool copyMass = true);
+    Node &operator=(const Node &);
     Node *getCopy(void) const;
     
     // destructor
@@ -292,6 +294,7 @@ class Node: public MeshComponent
     virtual const Matrix &getMass(void) const;
     double getMassComponent(const int &) const;
     virtual int setMass(const Matrix &theMass);
+    static const size_t &getMassStamp(void);
     virtual int setNumColR(int numCol);
     virtual int setR(int row, int col, double Value);
     virtual const Vector &getRV(const Vector &V);
@@ -38,7 +38,7 @@ XC::NodeAccelVectors::NodeAccelVectors(void)
 
 void XC::NodeAccelVectors::Print(std::ostream &s,int flag) const
   {
-    if(commitData)
-      s << "\tcommitAccel: " << *trialData;
+    if(hasData())
+      s << "\tcommitAccel: " << trialData;
     s << "\n";
   }
@@ -35,26 +35,24 @@
 void XC::NodeDispVectors::free_mem(void)
   {
     NodeVectors::free_mem();
-    // delete anything that we created with new
-    if(incrDisp) delete incrDisp;
-    incrDisp= nullptr;
-    if(incrDeltaDisp) delete incrDeltaDisp;
-    incrDeltaDisp= nullptr;
+    incrDisp= Vector();
+    incrDeltaDisp= Vector();
   }
 
 //! @brief Constructor.
 XC::NodeDispVectors::NodeDispVectors(void)
-  :NodeVectors(4),incrDisp(nullptr),incrDeltaDisp(nullptr) {}
+  :NodeVectors(4),incrDisp(),incrDeltaDisp() {}
 
 
 //! @brief Copy constructor.
 XC::NodeDispVectors::NodeDispVectors(const NodeDispVectors &other)
-  : NodeVectors(other), incrDisp(nullptr), incrDeltaDisp(nullptr)
-  { copy(other); }
+  : NodeVectors(other), incrDisp(), incrDeltaDisp()
+  { setup_incr_views(); }
 
 XC::NodeDispVectors &XC::NodeDispVectors::operator=(const NodeDispVectors &other)
   {
     NodeVectors::operator=(other);
+    setup_incr_views();
     return *this;
   }
 
@@ -66,7 +64,7 @@ XC::NodeDispVectors::~NodeDispVectors(void)
 //! @param nDOF: number of degrees of freedom
 const XC::Vector &XC::NodeDispVectors::getIncrDisp(const size_t &nDOF) const
   {
-    if(!incrDisp)
+    if(incrDisp.isEmpty())
       {
         NodeDispVectors *this_no_const= const_cast<NodeDispVectors *>(this);
         if(this_no_const->createDisp(nDOF) < 0)
@@ -75,14 +73,14 @@ const XC::Vector &XC::NodeDispVectors::getIncrDisp(const size_t &nDOF) const
             exit(-1);
           }
       }
-    return *incrDisp;
+    return incrDisp;
   }
 
 //! @brief Returns delta displacement increment.
 //! @param nDOF: number of degrees of freedom
 const XC::Vector &XC::NodeDispVectors::getIncrDeltaDisp(const size_t &nDOF) const
   {
-    if(!incrDeltaDisp)
+    if(incrDeltaDisp.isEmpty())
       {
         NodeDispVectors *this_no_const= const_cast<NodeDispVectors *>(this);
         if(this_no_const->createDisp(nDOF) < 0)
@@ -91,7 +89,7 @@ const XC::Vector &XC::NodeDispVectors::getIncrDeltaDisp(const size_t &nDOF) cons
             exit(-1);
           }
       }
-    return *incrDeltaDisp;
+    return incrDeltaDisp;
   }
 
 //! @brief Sets trial values for the displacement components.
@@ -109,7 +107,7 @@ int XC::NodeDispVectors::setTrialDispComponent(const size_t &nDOF,const double &
     // construct memory and Vectors for trial and committed
     // accel on first call to this method, getTrialDisp(),
     // getDisp(), or incrTrialDisp()
-    if(!trialData)
+    if(!hasData())
       {
         if(this->createDisp(nDOF) < 0)
           {
@@ -143,7 +141,7 @@ int XC::NodeDispVectors::setTrialDisp(const size_t &nDOF,const Vector &newTrialD
     // construct memory and Vectors for trial and committed
     // accel on first call to this method, getTrialDisp(),
     // getDisp(), or incrTrialDisp()
-    if(!trialData)
+    if(!hasData())
       {
         if(this->createDisp(nDOF) < 0)
           {
@@ -178,7 +176,7 @@ int XC::NodeDispVectors::incrTrialDisp(const size_t &nDOF,const Vector &incrDisp
       }
 
     // create a copy if no trial exists and add committed
-    if(!trialData)
+    if(!hasData())
       {
         if(this->createDisp(nDOF) < 0)
           {
@@ -211,7 +209,7 @@ int XC::NodeDispVectors::incrTrialDisp(const size_t &nDOF,const Vector &incrDisp
 int XC::NodeDispVectors::commitState(const size_t &nDOF)
   {
     // check disp exists, if does set commit = trial, incr = 0.0
-    if(trialData)
+    if(hasData())
       {
         for(size_t i=0; i<nDOF; i++)
           {
@@ -244,8 +242,8 @@ int XC::NodeDispVectors::revertToLastCommit(const size_t &nDOF)
 //! @brief Printing.
 void XC::NodeDispVectors::Print(std::ostream &s,int flag) const
   {
-    if(commitData)
-      s << "\tcommitDisps: " << *trialData;
+    if(hasData())
+      s << "\tcommitDisps: " << trialData;
     s << "\n";
   }
 
@@ -255,16 +253,26 @@ void XC::NodeDispVectors::Print(std::ostream &s,int flag) const
 int XC::NodeDispVectors::createDisp(const size_t &nDOF)
   {
     // trial , committed, incr = (committed-trial)
-    NodeVectors::createData(nDOF);
+    if(!hasData() || (getVectorsSize()!=nDOF))
+      NodeVectors::createData(nDOF);
 
-    incrDisp = new Vector(&values[2*nDOF], nDOF);
-    incrDeltaDisp = new Vector(&values[3*nDOF], nDOF);
+    setup_incr_views();
+    return 0;
+  }
 
-    if(incrDisp == nullptr || incrDeltaDisp == nullptr)
+//! @brief Set the increment vectors as views of the data array (if
+//! it has been created).
+void XC::NodeDispVectors::setup_incr_views(void)
+  {
+    if(hasData())
       {
-        std::cerr << "WARNING - NodeDispVectors::createDisp() "
-                  << "ran out of memory creating Vectors(double *,int)";
-        return -2;
+        const size_t nDOF= getVectorsSize();
+        incrDisp.setData(&values[2*nDOF], nDOF);
+        incrDeltaDisp.setData(&values[3*nDOF], nDOF);
+      }
+    else
+      {
+        incrDisp= Vector();
+        incrDeltaDisp= Vector();
       }
-    return 0;
   }
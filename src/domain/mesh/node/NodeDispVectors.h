@@ -43,9 +43,10 @@ class NodeDispVectors: public NodeVectors
   {
   private:
     int createDisp(const size_t &);
+    void setup_incr_views(void);
 
-    Vector *incrDisp;
-    Vector *incrDeltaDisp;
+    Vector incrDisp; //!< displacement increment (view of values).
+    Vector incrDeltaDisp; //!< delta displacement increment (view of values).
   protected:
     void free_mem(void);
   public:
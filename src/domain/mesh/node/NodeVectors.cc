@@ -33,20 +33,19 @@
 
 #include <utility/actor/objectBroker/FEM_ObjectBroker.h>
 
+//! @brief Release the views of the data array (the data array
+//! itself is released or reused by createData).
 void XC::NodeVectors::free_mem(void)
   {
-    // delete anything that we created with new
-    if(commitData) delete commitData;
-    commitData= nullptr;
-    if(trialData) delete trialData;
-    trialData= nullptr;
+    commitData= Vector();
+    trialData= Vector();
   }
 
 void XC::NodeVectors::copy(const NodeVectors &other)
   {
     free_mem();
     numVectors= other.numVectors;
-    if(other.commitData)
+    if(other.hasData())
       {
         const size_t nDOF= other.getVectorsSize();
         const size_t sz= numVectors*nDOF;
@@ -62,12 +61,12 @@ void XC::NodeVectors::copy(const NodeVectors &other)
 
 //! @brief Constructor.
 XC::NodeVectors::NodeVectors(const size_t &nv)
-  :CommandEntity(),MovableObject(NOD_TAG_NodeVectors), numVectors(nv), commitData(nullptr),trialData(nullptr), values() {}
+  :CommandEntity(),MovableObject(NOD_TAG_NodeVectors), numVectors(nv), values(), commitData(), trialData() {}
 
 
 //! @brief Copy constructor.
 XC::NodeVectors::NodeVectors(const NodeVectors &other)
-  : CommandEntity(other),MovableObject(NOD_TAG_NodeVectors), numVectors(other.numVectors), commitData(nullptr), trialData(nullptr), values()
+  : CommandEntity(other),MovableObject(NOD_TAG_NodeVectors), numVectors(other.numVectors), values(), commitData(), trialData()
   { copy(other); }
 
 XC::NodeVectors &XC::NodeVectors::operator=(const NodeVectors &other)
@@ -85,8 +84,8 @@ XC::NodeVectors::~NodeVectors(void)
 //! @brief Return the number of node DOFs.
 size_t XC::NodeVectors::getVectorsSize(void) const
   {
-    if(commitData)
-      return commitData->Size();
+    if(hasData())
+      return commitData.Size();
     else
       return 0;
   }
@@ -94,7 +93,7 @@ size_t XC::NodeVectors::getVectorsSize(void) const
 //! @brief Returns the data vector.
 const XC::Vector &XC::NodeVectors::getData(const size_t &nDOF) const
   {
-    if(!commitData)
+    if(!hasData())
       {
         NodeVectors *this_no_const= const_cast<NodeVectors *>(this);
         if(this_no_const->createData(nDOF) < 0)
@@ -104,20 +103,20 @@ const XC::Vector &XC::NodeVectors::getData(const size_t &nDOF) const
           }
       }
     // return the committed data
-    return *commitData;
+    return commitData;
   }
   
 //! @brief Returns committed values.
 const XC::Vector &XC::NodeVectors::getCommitData(void) const
   {
-    assert(commitData);
-    return *commitData;
+    assert(hasData());
+    return commitData;
   }
 
 //! @brief Returns the data vector de prueba.
 const XC::Vector &XC::NodeVectors::getTrialData(const size_t &nDOF) const
   {
-    if(!trialData)
+    if(!hasData())
       {
         NodeVectors *this_no_const= const_cast<NodeVectors *>(this);
         if(this_no_const->createData(nDOF) < 0)
@@ -126,14 +125,14 @@ const XC::Vector &XC::NodeVectors::getTrialData(const size_t &nDOF) const
             exit(-1);
           }
       }
-    return *trialData;
+    return trialData;
   }
 
 //! @brief Returns trial values.
 const XC::Vector &XC::NodeVectors::getTrialData(void) const
   {
-    assert(trialData);
-    return *trialData;
+    assert(hasData());
+    return trialData;
   }
 
 int XC::NodeVectors::setTrialData(const size_t &nDOF,const double &value,const size_t &dof)
@@ -210,7 +209,7 @@ int XC::NodeVectors::incrTrialData(const size_t &nDOF,const Vector &incrData)
 int XC::NodeVectors::commitState(const size_t &nDOF)
   {
     // check data exists, if does set commit = trial, incr = 0.0
-    if(trialData)
+    if(hasData())
       {
         for( size_t i=0; i<nDOF; i++)
           values[i+nDOF] = values[i];
@@ -260,15 +259,9 @@ int XC::NodeVectors::createData(const size_t &nDOF)
         for(size_t i=0;i<sz;i++)
           values[i]= 0.0;
 
-        trialData= new Vector(&values[0], nDOF);
-        commitData= new Vector(&values[nDOF], nDOF);
-
-        if(!commitData || !trialData)
-          {
-            std::cerr << "WARNING - XC::NodeVectors::createData() "
-                  << "ran out of memory creating Vectors(double *,int)";
-            return -2;
-          }
+        // views of the data array (no additional heap objects).
+        trialData.setData(&values[0], nDOF);
+        commitData.setData(&values[nDOF], nDOF);
         return 0;
       }
     else
@@ -290,14 +283,14 @@ int XC::NodeVectors::sendData(Communicator &comm)
   {
     int res= 0;
     ID idData(3);
-    if(!commitData)
+    if(!hasData())
       idData(0) = 1;
     else
       {
         idData(0)= 0;
         idData(1)= comm.getDbTag();
-        idData(2)= commitData->Size();
-        res+= comm.sendVector(*commitData,idData(1));
+        idData(2)= commitData.Size();
+        res+= comm.sendVector(commitData,idData(1));
         if(res < 0)
           {
             std::cerr << "NodeVectors::sendSelf() - failed to send Disp data\n";
@@ -323,7 +316,7 @@ int XC::NodeVectors::recvData(const Communicator &comm)
         // create the disp vectors if node is a total blank
         createData(nDOF);
         // recv the data
-        if(comm.receiveVector(*commitData,dbTag1) < 0)
+        if(comm.receiveVector(commitData,dbTag1) < 0)
           {
             std::cerr << getClassName() << "::" << __FUNCTION__
                       << "; - failed to receive data\n";
@@ -334,11 +327,11 @@ int XC::NodeVectors::recvData(const Communicator &comm)
         for(int i=0; i<nDOF; i++)
           values[i]= values[i+nDOF]; // set trial equal committed
       }
-    else if(commitData)
+    else if(hasData())
       {
         // if going back to initial we will just zero the vectors
-        commitData->Zero();
-        trialData->Zero();
+        commitData.Zero();
+        trialData.Zero();
       }
     return res;
   }
@@ -49,15 +49,17 @@ class NodeVectors: public CommandEntity, public MovableObject
   {
   protected:
     size_t numVectors; //!< number of vectors.
-    Vector *commitData; //!< committed quantities
-    Vector *trialData; //!< trial quantities
-    
     Vector values; //!< double array holding the displacement/velocity/acceleration.
+    Vector commitData; //!< committed quantities (view of values).
+    Vector trialData; //!< trial quantities (view of values).
 
     DbTagData &getDbTagData(void) const;
     int sendData(Communicator &);
     int recvData(const Communicator &);
     int createData(const size_t &);
+    //! @brief Return true if the data vectors have been created.
+    inline bool hasData(void) const
+      { return !commitData.isEmpty(); }
     void free_mem(void);
     void copy(const NodeVectors &);
   public:
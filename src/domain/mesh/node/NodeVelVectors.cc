@@ -37,7 +37,7 @@ XC::NodeVelVectors::NodeVelVectors(void)
 
 void XC::NodeVelVectors::Print(std::ostream &s,int flag) const
   {
-    if(commitData)
-      s << "\tcommitVel: " << *trialData;
+    if(hasData())
+      s << "\tcommitVel: " << trialData;
     s << "\n";
   }
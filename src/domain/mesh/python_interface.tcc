@@ -38,7 +38,27 @@ XC::Element *(XC::Mesh::*getElementPtr)(int tag)= &XC::Mesh::getElement;
 XC::Element *(XC::Mesh::*getNearestElementPtrMesh)(const Pos3d &)= &XC::Mesh::getNearestElement;
 double (XC::Mesh::*normalizeEigenvectorsMode)(int mode)= &XC::Mesh::normalizeEigenvectors;
 boost::python::list (XC::Mesh::*normalizeAllEigenvectors)(void)= &XC::Mesh::normalizeEigenvectors;
+class_<XC::ContactManager, bases<CommandEntity>, boost::noncopyable >("ContactManager", no_init)
+  .def("setPrimaryNodeTags", &XC::ContactManager::setPrimaryNodeTags,"setPrimaryNodeTags(tags): set the nodes of the primary surface.")
+  .def("setSecondaryNodeTags", &XC::ContactManager::setSecondaryNodeTags,"setSecondaryNodeTags(tags): set the nodes of the secondary surface.")
+  .def("setPrototype", &XC::ContactManager::setPrototype,"setPrototype(element): set the contact element to copy for the new pairs (i.e. a ZeroLengthContact2D element).")
+  .add_property("activationGap", &XC::ContactManager::getActivationGap, &XC::ContactManager::setActivationGap,"Get/set the distance under which the pairs are activated.")
+  .add_property("releaseGap", &XC::ContactManager::getReleaseGap, &XC::ContactManager::setReleaseGap,"Get/set the distance over which the pairs are deactivated.")
+  .add_property("automaticUpdate", &XC::ContactManager::getAutomaticUpdate, &XC::ContactManager::setAutomaticUpdate,"If true, update the contact pairs each time the mesh is committed.")
+  .def("isDefined", &XC::ContactManager::isDefined,"Return true if the surfaces, the prototype element and the activation gap are defined.")
+  .def("update", &XC::ContactManager::update,"Create, activate or deactivate the contact pairs according to the current position of the nodes.")
+  .add_property("numPairs", &XC::ContactManager::getNumPairs,"Return the number of contact pairs created so far.")
+  .add_property("numActivePairs", &XC::ContactManager::getNumActivePairs,"Return the number of active contact pairs.")
+  .add_property("numCreated", &XC::ContactManager::getNumCreated,"Return the number of pairs created in the last update.")
+  .add_property("numActivated", &XC::ContactManager::getNumActivated,"Return the number of pairs activated in the last update.")
+  .add_property("numReleased", &XC::ContactManager::getNumReleased,"Return the number of pairs deactivated in the last update.")
+  .def("getPairElementTag", &XC::ContactManager::getPairElementTag,"getPairElementTag(secondaryNodeTag, primaryNodeTag): return the tag of the contact element of the pair (-1 if it doesn't exist).")
+  .def("clearAll", &XC::ContactManager::clearAll,"Clear the manager (the contact elements remain in the mesh).")
+  ;
+
+XC::ContactManager &(XC::Mesh::*getContactManagerRef)(void)= &XC::Mesh::getContactManager;
 class_<XC::Mesh, bases<XC::MeshComponentContainer>, boost::noncopyable >("Mesh", no_init)
+  .add_property("contactManager", make_function(getContactManagerRef, return_internal_reference<>() ),"Return the manager of the automatic contact pairs.")
   .add_property("getNodeIter", make_function( getNodeIter, return_internal_reference<>() ))
   .def("getDefaultNodeTag", &XC::Mesh::getDefaultNodeTag, "Return the default tag for the next node.")
   .def("getNumNodes", &XC::Mesh::getNumNodes,"Returns the number of nodes.")
@@ -0,0 +1,122 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis C. Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//MaterialStateArena.cc
+
+#include "MaterialStateArena.h"
+#include "material/uniaxial/UniaxialMaterial.h"
+#include <cstring>
+#include <set>
+
+//! @brief Constructor.
+XC::MaterialStateArena::MaterialStateArena(void)
+  : valid(false), stamp(0) {}
+
+//! @brief Move the state back to the bound materials that are still
+//! in use and forget all of them.
+//!
+//! The bound materials that are not in the list argument may have
+//! been deleted (i.e. replaced by another one), so they are dropped
+//! without calling any of its methods.
+//! @param materials: materials currently in use.
+void XC::MaterialStateArena::unbind(const std::vector<UniaxialMaterial *> &materials)
+  {
+    if(!boundMaterials.empty())
+      {
+        const std::set<const UniaxialMaterial *> current(materials.begin(), materials.end());
+        for(std::vector<UniaxialMaterial *>::iterator i= boundMaterials.begin();i!=boundMaterials.end();i++)
+          if(current.find(*i)!=current.end())
+            (*i)->unbindStateBlocks();
+        boundMaterials.clear();
+      }
+  }
+
+//! @brief Store the state of the materials that support it
+//! in the arena.
+//!
+//! @param materials: materials to store in the arena.
+//! @param s: stamp of the materials (see isValid).
+void XC::MaterialStateArena::setup(const std::vector<UniaxialMaterial *> &materials, const size_t &s)
+  {
+    clear(materials);
+    std::vector<size_t> offsets;
+    offsets.reserve(materials.size());
+    size_t sz= 0;
+    for(std::vector<UniaxialMaterial *>::const_iterator i= materials.begin();i!=materials.end();i++)
+      {
+        const size_t blockSize= (*i)->getStateBlockSize();
+        if(blockSize>0)
+          {
+            boundMaterials.push_back(*i);
+            offsets.push_back(sz);
+            sz+= blockSize;
+          }
+        else
+          otherMaterials.push_back(*i);
+      }
+    // The buffers are not resized again until the next call to
+    // setup (the materials keep pointers to them).
+    trialBuffer.assign(sz, 0.0);
+    committedBuffer.assign(sz, 0.0);
+    for(size_t i= 0;i<boundMaterials.size();i++)
+      boundMaterials[i]->bindStateBlocks(trialBuffer.data()+offsets[i], committedBuffer.data()+offsets[i]);
+    stamp= s;
+    valid= true;
+  }
+
+//! @brief Move the state back to the materials and release the buffers.
+//!
+//! @param materials: materials currently in use (see unbind).
+void XC::MaterialStateArena::clear(const std::vector<UniaxialMaterial *> &materials)
+  {
+    unbind(materials);
+    otherMaterials.clear();
+    trialBuffer.clear();
+    committedBuffer.clear();
+    valid= false;
+  }
+
+//! @brief Commit the state of the materials.
+int XC::MaterialStateArena::commitState(void)
+  {
+    int retval= 0;
+    if(!trialBuffer.empty())
+      std::memcpy(committedBuffer.data(), trialBuffer.data(), trialBuffer.size()*sizeof(double));
+    for(std::vector<UniaxialMaterial *>::iterator i= otherMaterials.begin();i!=otherMaterials.end();i++)
+      retval+= (*i)->commitState();
+    return retval;
+  }
+
+//! @brief Return the materials to its last committed state.
+int XC::MaterialStateArena::revertToLastCommit(void)
+  {
+    int retval= 0;
+    if(!trialBuffer.empty())
+      std::memcpy(trialBuffer.data(), committedBuffer.data(), trialBuffer.size()*sizeof(double));
+    for(std::vector<UniaxialMaterial *>::iterator i= otherMaterials.begin();i!=otherMaterials.end();i++)
+      retval+= (*i)->revertToLastCommit();
+    return retval;
+  }
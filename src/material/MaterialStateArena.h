@@ -0,0 +1,96 @@
+// -*-c++-*-
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis C. Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//MaterialStateArena.h
+
+#ifndef MaterialStateArena_h
+#define MaterialStateArena_h
+
+#include <vector>
+#include <cstddef>
+
+namespace XC {
+class UniaxialMaterial;
+
+//! @ingroup Mat
+//
+//! @brief Contiguous storage for the trial and committed state of
+//! a set of materials.
+//!
+//! The materials that support it (those whose getStateBlockSize
+//! returns a non-zero value) store their trial and committed state
+//! in two blocks of the same layout inside the trial and committed
+//! buffers of the arena. This way the commit of all those materials
+//! is a single copy of the trial buffer into the committed one (and
+//! the revert the opposite copy). The remaining materials are
+//! committed and reverted by calling its methods as usual.
+//!
+//! The arena doesn't own the materials: its owner must call clear
+//! before the materials are deleted, or set up the arena again
+//! (see setup) if some of them have been replaced. In both cases
+//! the owner passes the materials currently in use, so the ones
+//! that have been replaced (and maybe deleted) are not touched.
+class MaterialStateArena
+  {
+  private:
+    std::vector<double> trialBuffer; //!< trial states.
+    std::vector<double> committedBuffer; //!< committed states.
+    std::vector<UniaxialMaterial *> boundMaterials; //!< materials whose state is stored in the arena.
+    std::vector<UniaxialMaterial *> otherMaterials; //!< materials that don't support the arena.
+    bool valid; //!< true if the arena has been set up.
+    size_t stamp; //!< stamp of the materials when the arena was set up.
+
+    MaterialStateArena(const MaterialStateArena &);
+    MaterialStateArena &operator=(const MaterialStateArena &);
+    void unbind(const std::vector<UniaxialMaterial *> &);
+  public:
+    MaterialStateArena(void);
+
+    //! @brief Return the number of doubles needed to store an object
+    //! of the given size (in bytes).
+    static inline size_t getBlockSize(const size_t &numBytes)
+      { return (numBytes+sizeof(double)-1)/sizeof(double); }
+    //! @brief Return true if the arena has been set up for
+    //! numMaterials materials with the stamp argument (a counter
+    //! that the owner increments each time the materials change).
+    inline bool isValid(const size_t &numMaterials, const size_t &s) const
+      { return (valid && (stamp==s) && (boundMaterials.size()+otherMaterials.size()==numMaterials)); }
+    //! @brief Return the number of materials whose state is stored
+    //! in the arena.
+    inline size_t getNumBoundMaterials(void) const
+      { return boundMaterials.size(); }
+
+    void setup(const std::vector<UniaxialMaterial *> &, const size_t &);
+    void clear(const std::vector<UniaxialMaterial *> &);
+
+    int commitState(void);
+    int revertToLastCommit(void);
+  };
+
+} // end of XC namespace
+
+#endif
@@ -204,6 +204,56 @@ const XC::Vector &XC::NDMaterial::getStrain(void) const
     return errVector;    
   }
 
+//! @brief Copy the stress and the tangent of a material to the
+//! arrays of a batch update (see setTrialBatch).
+//!
+//! @param order: order of the material.
+//! @param stress: stress of the material.
+//! @param tangent: tangent of the material.
+//! @param stresses: position of the material stress in the batch.
+//! @param tangents: position of the material tangent in the batch.
+void XC::NDMaterial::copy_response(const int &order, const Vector &stress, const Matrix &tangent, double stresses[], double tangents[])
+  {
+    for(int j= 0;j<order;j++)
+      stresses[j]= stress(j);
+    for(int k= 0;k<order;k++)
+      for(int j= 0;j<order;j++)
+        tangents[k*order+j]= tangent(j,k);
+  }
+
+//! @brief Set the trial strains of a batch of materials of the same
+//! class that this one and return its stresses and tangents.
+//!
+//! This generic implementation calls setTrialStrain for each
+//! material; the derived classes can override it with implementations
+//! that avoid the virtual calls (see PlasticDamageConcretePlaneStress::setTrialBatch).
+//!
+//! @param n: number of materials.
+//! @param materials: materials to update.
+//! @param strains: trial strains (getOrder() values for each material).
+//! @param stresses: computed stresses (getOrder() values for each material).
+//! @param tangents: computed tangents (getOrder()^2 values for each
+//!                  material in column-major order).
+int XC::NDMaterial::setTrialBatch(const size_t &n, NDMaterial *const materials[], const double strains[], double stresses[], double tangents[]) const
+  {
+    int retval= 0;
+    if(n>0)
+      {
+        const int order= materials[0]->getOrder();
+        Vector strain(order);
+        for(size_t i= 0;i<n;i++)
+          {
+            NDMaterial *m= materials[i];
+            const double *e= strains+i*order;
+            for(int j= 0;j<order;j++)
+              strain(j)= e[j];
+            retval+= m->setTrialStrain(strain);
+            copy_response(order, m->getStress(), m->getTangent(), stresses+i*order, tangents+i*order*order);
+          }
+      }
+    return retval;
+  }
+
 //! @brief return the Von Mises equivalent stress.
 //!
 //! <a href="https://en.wikipedia.org/wiki/Von_Mises_yield_criterion"> Von Mises yield criterion.</a>
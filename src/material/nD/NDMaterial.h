@@ -106,6 +106,8 @@ class NDMaterial: public Material
   protected:
     int sendData(Communicator &);
     int recvData(const Communicator &);
+
+    static void copy_response(const int &, const Vector &, const Matrix &, double [], double []);
   public:
     NDMaterial();
     NDMaterial(int tag, int classTag);
@@ -140,12 +142,13 @@ class NDMaterial: public Material
     inline const Vector &getGeneralizedStrain(void) const
       { return getStrain(); }
     virtual double getVonMisesStress(void) const;
+    virtual int setTrialBatch(const size_t &, NDMaterial *const [], const double [], double [], double []) const;
 
     virtual int setTrialStrain(const Tensor &);
     virtual int setTrialStrain(const Tensor &, const Tensor &);
     virtual int setTrialStrainIncr(const Tensor &);
     virtual int setTrialStrainIncr(const Tensor &, const Tensor &);
-    const Tensor &getTangentTensor(void) const;
+    virtual const Tensor &getTangentTensor(void) const;
     virtual const stresstensor &getStressTensor(void) const;
     virtual const straintensor &getStrainTensor(void) const;
     virtual const straintensor &getPlasticStrainTensor(void) const; //Added Joey Aug. 13, 2001
@@ -0,0 +1,256 @@
+// -*-c++-*-
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis C. Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//RadialReturnMapping.h
+
+#ifndef RadialReturnMapping_h
+#define RadialReturnMapping_h
+
+#include <cmath>
+#include <iostream>
+#include "utility/matrix/FixedVector.h"
+#include "utility/matrix/FixedMatrix.h"
+
+namespace XC {
+
+//! @ingroup NDMat
+//
+//! @brief Backward Euler return mapping for the Drucker-Prager family
+//! of yield surfaces, written with fixed size Voigt arithmetic.
+//!
+//! Yield function and plastic potential:
+//! \f[
+//! f= ||s|| + \rho I_1 - R(\Delta\gamma),\qquad g= ||s|| + \bar\rho I_1
+//! \f]
+//! where \f$R\f$ is the radius of the yield surface (including the
+//! hardening and the viscous terms) as a function of the consistency
+//! parameter of the step. The von Mises (J2) criterion is the
+//! \f$\rho= \bar\rho= 0\f$ case.
+//!
+//! Trial states on the cone are returned radially: the consistency
+//! equation is scalar, and it has closed-form solution when \f$R\f$
+//! is linear (the Newton loop converges in one iteration). The
+//! returned tangent is the consistent (algorithmic) one:
+//! \f[
+//! C= K\, 1\otimes 1 + 2G\beta\, I_{dev}
+//!  + \frac{4G^2\Delta\gamma}{||s^{tr}||} n\otimes n
+//!  - \frac{1}{D} (2Gn + 3K\bar\rho 1) \otimes (2Gn + 3K\rho 1)
+//! \f]
+//! with \f$\beta= 1-2G\Delta\gamma/||s^{tr}||\f$ and
+//! \f$D= 2G + 9K\rho\bar\rho + R'\f$. Trial states beyond the
+//! apex of the cone (\f$\rho\bar\rho > 0\f$) are returned to the apex.
+//!
+//! Conventions: the strains are passed in engineering notation
+//! (\f$\gamma_{ij}= 2\epsilon_{ij}\f$) and ordered as
+//! [11, 22, 33, 12, 23, 31]; the plastic strains are stored as tensor
+//! components in the same order. The tangent relates the stress
+//! components with the engineering strains.
+class RadialReturnMapping
+  {
+  public:
+    typedef FixedVector<6> Vector6;
+    typedef FixedMatrix<6,6> Matrix6;
+  private:
+    double K; //!< bulk modulus.
+    double G; //!< shear modulus.
+    double rho; //!< volumetric term of the yield function.
+    double rhoBar; //!< volumetric term of the plastic potential.
+    
+    //! @brief Deviatoric and norm of a symmetric tensor (tensor components).
+    static inline double deviator(const Vector6 &t, Vector6 &dev)
+      {
+        const double m= (t(0)+t(1)+t(2))/3.0;
+        dev= t;
+        dev(0)-= m; dev(1)-= m; dev(2)-= m;
+        return std::sqrt(dev(0)*dev(0)+dev(1)*dev(1)+dev(2)*dev(2)+2.0*(dev(3)*dev(3)+dev(4)*dev(4)+dev(5)*dev(5)));
+      }
+  public:
+    //! @brief Constructor.
+    //!
+    //! @param bulk: bulk modulus.
+    //! @param shear: shear modulus.
+    //! @param r: volumetric term of the yield function.
+    //! @param rBar: volumetric term of the plastic potential.
+    RadialReturnMapping(const double &bulk, const double &shear, const double &r= 0.0, const double &rBar= 0.0)
+      : K(bulk), G(shear), rho(r), rhoBar(rBar) {}
+
+    void getElasticTangent(Matrix6 &) const;
+    template <class Hardening>
+    double compute(const Vector6 &, Vector6 &, const Hardening &, const double &, Vector6 &, Matrix6 &) const;
+  };
+
+//! @brief Compute the elastic tangent.
+inline void RadialReturnMapping::getElasticTangent(Matrix6 &C) const
+  {
+    C.Zero();
+    const double lambda= K-2.0*G/3.0;
+    for(int a= 0;a<3;a++)
+      {
+        for(int b= 0;b<3;b++)
+          C(a,b)= lambda;
+        C(a,a)+= 2.0*G;
+        C(a+3,a+3)= G;
+      }
+  }
+
+//! @brief Compute the stress and the consistent tangent for the strain
+//! argument and update the plastic strain.
+//!
+//! The hardening object must provide the methods radius(dgamma) and
+//! slope(dgamma) that return the radius of the yield surface and its
+//! derivative with respect to the consistency parameter dgamma.
+//!
+//! @param strain: total strain (engineering notation).
+//! @param epsP: plastic strain at the beginning of the step (input) and
+//!              at its end (output).
+//! @param hardening: radius of the yield surface.
+//! @param tolerance: tolerance for the consistency condition.
+//! @param stress: computed stress.
+//! @param C: computed consistent tangent.
+//! @return the consistency parameter of the step (zero if elastic).
+template <class Hardening>
+double RadialReturnMapping::compute(const Vector6 &strain, Vector6 &epsP, const Hardening &hardening, const double &tolerance, Vector6 &stress, Matrix6 &C) const
+  {
+    static const int max_iterations= 25;
+    // Elastic strain (tensor components).
+    Vector6 epsE;
+    for(int a= 0;a<3;a++)
+      {
+        epsE(a)= strain(a)-epsP(a);
+        epsE(a+3)= 0.5*strain(a+3)-epsP(a+3);
+      }
+    Vector6 devE;
+    const double normStr= 2.0*G*deviator(epsE, devE);
+    const double I1tr= 3.0*K*(epsE(0)+epsE(1)+epsE(2));
+    const Vector6 str= (2.0*G)*devE; // trial deviatoric stress.
+    const double ftr= normStr+rho*I1tr-hardening.radius(0.0);
+
+    getElasticTangent(C);
+    if(ftr<=tolerance) // elastic step.
+      {
+        stress= str;
+        const double p= I1tr/3.0;
+        stress(0)+= p; stress(1)+= p; stress(2)+= p;
+        return 0.0;
+      }
+    // Return to the cone.
+    const double k9rr= 9.0*K*rho*rhoBar;
+    double dgamma= 0.0;
+    double resid= ftr;
+    int iteration_counter= 0;
+    while(std::fabs(resid)>tolerance)
+      {
+        const double tang= 2.0*G+k9rr+hardening.slope(dgamma);
+        dgamma+= resid/tang;
+        resid= normStr-2.0*G*dgamma+rho*(I1tr-9.0*K*rhoBar*dgamma)-hardening.radius(dgamma);
+        iteration_counter++;
+        if(iteration_counter>max_iterations)
+          {
+            std::cerr << "RadialReturnMapping::" << __FUNCTION__
+                      << "; more than " << max_iterations
+                      << " iterations in the return mapping." << std::endl;
+            break;
+          }
+      }
+    if((2.0*G*dgamma<normStr) || (k9rr<=0.0)) // cone.
+      {
+        if(2.0*G*dgamma>=normStr)
+          std::cerr << "RadialReturnMapping::" << __FUNCTION__
+                    << "; trial state beyond the apex of the yield surface"
+                    << " and no volumetric plastic flow (rhoBar= 0)."
+                    << std::endl;
+        const Vector6 n= (1.0/normStr)*str;
+        const double beta= 1.0-2.0*G*dgamma/normStr;
+        const double I1= I1tr-9.0*K*rhoBar*dgamma;
+        stress= beta*str;
+        const double p= I1/3.0;
+        stress(0)+= p; stress(1)+= p; stress(2)+= p;
+        // Plastic flow: dgamma*(n + rhoBar*1).
+        epsP.addVector(1.0, n, dgamma);
+        for(int a= 0;a<3;a++)
+          epsP(a)+= dgamma*rhoBar;
+        // Consistent tangent.
+        const double D= 2.0*G+k9rr+hardening.slope(dgamma);
+        const double c1= 2.0*G*beta;
+        const double c2= 4.0*G*G*dgamma/normStr;
+        for(int a= 0;a<6;a++)
+          for(int b= 0;b<6;b++)
+            {
+              double Idev= 0.0;
+              double one_a= 0.0, one_b= 0.0;
+              if(a<3)
+                one_a= 1.0;
+              if(b<3)
+                one_b= 1.0;
+              if((a<3) && (b<3))
+                Idev= ((a==b)?1.0:0.0)-1.0/3.0;
+              else if(a==b)
+                Idev= 0.5;
+              const double u= 2.0*G*n(a)+3.0*K*rhoBar*one_a;
+              const double v= 2.0*G*n(b)+3.0*K*rho*one_b;
+              C(a,b)= K*one_a*one_b+c1*Idev+c2*n(a)*n(b)-u*v/D;
+            }
+      }
+    else // apex.
+      {
+        dgamma= 0.0;
+        resid= rho*I1tr-hardening.radius(0.0);
+        iteration_counter= 0;
+        while(std::fabs(resid)>tolerance)
+          {
+            const double tang= k9rr+hardening.slope(dgamma);
+            dgamma+= resid/tang;
+            resid= rho*(I1tr-9.0*K*rhoBar*dgamma)-hardening.radius(dgamma);
+            iteration_counter++;
+            if(iteration_counter>max_iterations)
+              {
+                std::cerr << "RadialReturnMapping::" << __FUNCTION__
+                          << "; more than " << max_iterations
+                          << " iterations in the return to the apex."
+                          << std::endl;
+                break;
+              }
+          }
+        const double p= (I1tr-9.0*K*rhoBar*dgamma)/3.0;
+        stress.Zero();
+        stress(0)= p; stress(1)= p; stress(2)= p;
+        // The deviatoric elastic strain vanishes.
+        epsP+= devE;
+        for(int a= 0;a<3;a++)
+          epsP(a)+= dgamma*rhoBar;
+        const double Kep= K*(1.0-k9rr/(k9rr+hardening.slope(dgamma)));
+        C.Zero();
+        for(int a= 0;a<3;a++)
+          for(int b= 0;b<3;b++)
+            C(a,b)= Kep;
+      }
+    return dgamma;
+  }
+
+} // end of XC namespace
+
+#endif
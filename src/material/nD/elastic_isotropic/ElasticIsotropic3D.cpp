@@ -55,9 +55,28 @@
 
 #include "utility/matrix/Matrix.h"
 #include "material/nD/NDMaterialType.h"
+#include "utility/matrix/nDarray/stresst.h"
+#include "utility/matrix/nDarray/straint.h"
 
 XC::Matrix XC::ElasticIsotropic3D::D(6,6); // global for ElasticIsotropic3D only
 XC::Vector XC::ElasticIsotropic3D::sigma(6); // global for ElasticIsotropic3D only
+XC::Tensor XC::ElasticIsotropic3D::Dt(def_dim_4, 0.0);
+XC::stresstensor XC::ElasticIsotropic3D::Stress;
+XC::straintensor XC::ElasticIsotropic3D::Strain;
+
+//! @brief Return the strain vector (xx, yy, zz, xy, yz, zx with engineering
+//! shear strains) that corresponds to the strain tensor argument.
+static XC::Vector strain_tensor_to_vector(const XC::Tensor &t)
+  {
+    XC::Vector retval(6);
+    retval(0)= t.cval(1,1);
+    retval(1)= t.cval(2,2);
+    retval(2)= t.cval(3,3);
+    retval(3)= t.cval(1,2)+t.cval(2,1);
+    retval(4)= t.cval(2,3)+t.cval(3,2);
+    retval(5)= t.cval(3,1)+t.cval(1,3);
+    return retval;
+  }
 
 //! @brief Constructor.
 XC::ElasticIsotropic3D::ElasticIsotropic3D(int tag)
@@ -122,6 +141,70 @@ const XC::Vector &XC::ElasticIsotropic3D::getStress(void) const
     return sigma;
   }
 
+//! @brief Set the trial strain from the strain tensor argument.
+int XC::ElasticIsotropic3D::setTrialStrain(const Tensor &v)
+  { return setTrialStrain(strain_tensor_to_vector(v)); }
+
+//! @brief Set the trial strain from the strain tensor argument.
+int XC::ElasticIsotropic3D::setTrialStrain(const Tensor &v, const Tensor &r)
+  { return setTrialStrain(strain_tensor_to_vector(v)); }
+
+//! @brief Increment the trial strain with the strain tensor argument.
+int XC::ElasticIsotropic3D::setTrialStrainIncr(const Tensor &v)
+  { return setTrialStrainIncr(strain_tensor_to_vector(v)); }
+
+//! @brief Increment the trial strain with the strain tensor argument.
+int XC::ElasticIsotropic3D::setTrialStrainIncr(const Tensor &v, const Tensor &r)
+  { return setTrialStrainIncr(strain_tensor_to_vector(v)); }
+
+//! @brief Return the fourth order elastic constants tensor.
+const XC::Tensor &XC::ElasticIsotropic3D::getTangentTensor(void) const
+  {
+    const double mu= 0.5*E/(1.0+v);
+    const double lam= 2.0*mu*v/(1.0-2.0*v);
+    for(int i= 1;i<=3;i++)
+      for(int j= 1;j<=3;j++)
+        for(int k= 1;k<=3;k++)
+          for(int l= 1;l<=3;l++)
+            {
+              double value= 0.0;
+              if((i==j) && (k==l))
+                value+= lam;
+              if((i==k) && (j==l))
+                value+= mu;
+              if((i==l) && (j==k))
+                value+= mu;
+              Dt.val(i,j,k,l)= value;
+            }
+    return Dt;
+  }
+
+//! @brief Return the stress tensor.
+const XC::stresstensor &XC::ElasticIsotropic3D::getStressTensor(void) const
+  {
+    const Vector &s= getStress();
+    Stress.val(1,1)= s(0);
+    Stress.val(2,2)= s(1);
+    Stress.val(3,3)= s(2);
+    Stress.val(1,2)= Stress.val(2,1)= s(3);
+    Stress.val(2,3)= Stress.val(3,2)= s(4);
+    Stress.val(3,1)= Stress.val(1,3)= s(5);
+    return Stress;
+  }
+
+//! @brief Return the strain tensor (tensorial shear strains).
+const XC::straintensor &XC::ElasticIsotropic3D::getStrainTensor(void) const
+  {
+    const Vector &e= getStrain();
+    Strain.val(1,1)= e(0);
+    Strain.val(2,2)= e(1);
+    Strain.val(3,3)= e(2);
+    Strain.val(1,2)= Strain.val(2,1)= 0.5*e(3);
+    Strain.val(2,3)= Strain.val(3,2)= 0.5*e(4);
+    Strain.val(3,1)= Strain.val(1,3)= 0.5*e(5);
+    return Strain;
+  }
+
 //! @brief Commit the material state.
 int XC::ElasticIsotropic3D::commitState(void)
   {
@@ -57,6 +57,7 @@
 #define ElasticIsotropic3D_h
 	 
 #include <material/nD/elastic_isotropic/ElasticIsotropicMaterial.h>
+#include <utility/matrix/nDarray/Tensor.h>
 
 namespace XC {
 //! @ingroup NDMat
@@ -67,10 +68,23 @@ class ElasticIsotropic3D: public ElasticIsotropicMaterial
   private:
     static Vector sigma; //!< Stress vector
     static Matrix D; //!< Elastic constantsVector sigma;
+    static Tensor Dt; //!< Elastic constants tensor.
+    static stresstensor Stress; //!< Stress tensor.
+    static straintensor Strain; //!< Strain tensor.
   public:
     ElasticIsotropic3D(int tag= 0);
     ElasticIsotropic3D(int tag, double E, double nu, double rho);
 
+    using ElasticIsotropicMaterial::setTrialStrain;
+    using ElasticIsotropicMaterial::setTrialStrainIncr;
+    int setTrialStrain(const Tensor &);
+    int setTrialStrain(const Tensor &, const Tensor &);
+    int setTrialStrainIncr(const Tensor &);
+    int setTrialStrainIncr(const Tensor &, const Tensor &);
+    const Tensor &getTangentTensor(void) const;
+    const stresstensor &getStressTensor(void) const;
+    const straintensor &getStrainTensor(void) const;
+
     const Matrix &getTangent(void) const;
     const Matrix &getInitialTangent(void) const;
 
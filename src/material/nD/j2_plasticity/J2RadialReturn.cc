@@ -0,0 +1,260 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis C. Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//J2RadialReturn.cc
+
+#include "J2RadialReturn.h"
+#include "FEProblem.h"
+#include "domain/domain/Domain.h"
+#include "material/nD/j2_plasticity/J2RadialReturn3D.h"
+#include "material/nD/j2_plasticity/J2RadialReturnPlaneStrain.h"
+#include "material/nD/j2_plasticity/J2RadialReturnPlaneStress.h"
+#include "material/nD/NDMaterialType.h"
+
+//! @brief Constructor.
+//!
+//! @param mat: material.
+//! @param dt: time step (used only if the material is viscous).
+XC::J2RadialReturn::Hardening::Hardening(const J2RadialReturn &m, const double &dt)
+  : mat(m), viscosity(0.0)
+  {
+    if(mat.eta > 0.0 && dt > 0.0)
+      viscosity= mat.eta/dt;
+  }
+
+//! @brief Return the radius of the yield surface for the consistency
+//! parameter argument: sqrt(2/3)*q(xi_n+sqrt(2/3)*dgamma)+eta/dt*dgamma.
+double XC::J2RadialReturn::Hardening::radius(const double &dgamma) const
+  {
+    static const double root23= sqrt(2.0/3.0);
+    return root23*mat.q(mat.xi_n+root23*dgamma)+viscosity*dgamma;
+  }
+
+//! @brief Return the derivative of the radius of the yield surface
+//! with respect to the consistency parameter.
+double XC::J2RadialReturn::Hardening::slope(const double &dgamma) const
+  {
+    static const double root23= sqrt(2.0/3.0);
+    return 2.0/3.0*mat.qprime(mat.xi_n+root23*dgamma)+viscosity;
+  }
+
+//! @brief Zero internal variables.
+void XC::J2RadialReturn::zero(void)
+  {
+    xi_n= 0.0;
+    xi_nplus1= 0.0;
+    epsilon_p_n.Zero();
+    epsilon_p_nplus1.Zero();
+    strain3d.Zero();
+    stress3d.Zero();
+    RadialReturnMapping(bulk, shear).getElasticTangent(tangent3d);
+  }
+
+//! @brief Set the values of the material parameters.
+void XC::J2RadialReturn::setup(const double &K, const double &G,
+                               const double &yield0, const double &yield_infty,
+                               const double &d, const double &H, const double &viscosity)
+  {
+    bulk= K;
+    shear= G;
+    sigma_0= yield0;
+    sigma_infty= yield_infty;
+    delta= d;
+    Hard= H;
+    eta= viscosity;
+    zero();
+  }
+
+//! @brief Constructor.
+XC::J2RadialReturn::J2RadialReturn(int tag, int classTag)
+  : NDMaterial(tag, classTag)
+  { setup(); }
+
+//! @brief Full constructor.
+XC::J2RadialReturn::J2RadialReturn(int tag, int classTag, double K, double G,
+                                   double yield0, double yield_infty, double d,
+                                   double H, double viscosity)
+  : NDMaterial(tag, classTag)
+  { setup(K, G, yield0, yield_infty, d, H, viscosity); }
+
+//! @brief Elastic constructor.
+XC::J2RadialReturn::J2RadialReturn(int tag, int classTag, double K, double G)
+  : NDMaterial(tag, classTag)
+  { setup(K, G, 1.0e16*G, 1.0e16*G, 0.0, 0.0, 0.0); }
+
+//! @brief Virtual constructor.
+XC::NDMaterial *XC::J2RadialReturn::getCopy(const std::string &type) const
+  {
+    NDMaterial *retval= nullptr;
+    if((type==strTypePlaneStress2D) || (type==strTypePlaneStress))
+      retval= new J2RadialReturnPlaneStress(this->getTag(), bulk, shear, sigma_0,
+                                            sigma_infty, delta, Hard, eta);
+    else if((type==strTypePlaneStrain2D) || (type==strTypePlaneStrain))
+      retval= new J2RadialReturnPlaneStrain(this->getTag(), bulk, shear, sigma_0,
+                                            sigma_infty, delta, Hard, eta);
+    else if((type==strTypeThreeDimensional) || (type==strType3D))
+      retval= new J2RadialReturn3D(this->getTag(), bulk, shear, sigma_0,
+                                   sigma_infty, delta, Hard, eta);
+    else
+      std::cerr << getClassName() << "::" << __FUNCTION__
+		<< "; failed to get model: " << type << std::endl;
+    return retval;
+  }
+
+//! @brief Hardening function.
+double XC::J2RadialReturn::q(const double &xi) const
+  { return sigma_infty + (sigma_0 - sigma_infty)*exp(-delta*xi) + Hard*xi; }
+
+//! @brief Hardening function derivative.
+double XC::J2RadialReturn::qprime(const double &xi) const
+  { return (sigma_0 - sigma_infty) * (-delta) * exp(-delta*xi) + Hard; }
+
+//! @brief Return the tolerance for the stress computations.
+//!
+//! Relative to the initial yield stress, but not zero when this
+//! stress vanishes (i.e. default constructor).
+double XC::J2RadialReturn::get_tolerance(void) const
+  { return 1.0e-8*std::max(sigma_0, 1.0e-6*shear); }
+
+//! @brief Compute the stress and the tangent for the current trial
+//! strain (strain3d) starting from the last committed state.
+int XC::J2RadialReturn::return_mapping(void)
+  {
+    double dt= 0.0;
+    if(eta > 0.0)
+      dt= FEProblem::theActiveDomain->getTimeTracker().getDt();
+    const Hardening hardening(*this, dt);
+    epsilon_p_nplus1= epsilon_p_n;
+    const RadialReturnMapping rr(bulk, shear);
+    const double dgamma= rr.compute(strain3d, epsilon_p_nplus1, hardening, get_tolerance(), stress3d, tangent3d);
+    xi_nplus1= xi_n + sqrt(2.0/3.0)*dgamma;
+    return 0;
+  }
+
+//! @brief Commit material state.
+int XC::J2RadialReturn::commitState(void)
+  {
+    epsilon_p_n= epsilon_p_nplus1;
+    xi_n= xi_nplus1;
+    return 0;
+  }
+
+//! @brief Revert to the last committed state.
+int XC::J2RadialReturn::revertToLastCommit(void)
+  {
+    epsilon_p_nplus1= epsilon_p_n;
+    xi_nplus1= xi_n;
+    return 0;
+  }
+
+//! @brief Revert to start.
+int XC::J2RadialReturn::revertToStart(void)
+  {
+    int retval= NDMaterial::revertToStart();
+    this->zero();
+    return retval;
+  }
+
+//! @brief Print stuff.
+void XC::J2RadialReturn::Print(std::ostream &s, int flag) const
+  {
+    s << std::endl;
+    s << getClassName() << " : ";
+    s << this->getType() << std::endl;
+    s << "Bulk Modulus=   " << bulk        << std::endl;
+    s << "Shear Modulus=  " << shear       << std::endl;
+    s << "Sigma_0=        " << sigma_0     << std::endl;
+    s << "Sigma_infty=    " << sigma_infty << std::endl;
+    s << "Delta=          " << delta       << std::endl;
+    s << "H=              " << Hard        << std::endl;
+    s << "Eta=            " << eta         << std::endl;
+    s << std::endl;
+  }
+
+//! @brief Send object members through the communicator argument.
+int XC::J2RadialReturn::sendData(Communicator &comm)
+  {
+    int res= NDMaterial::sendData(comm);
+    res+= comm.sendDoubles(bulk,shear,sigma_0,sigma_infty,delta,getDbTagData(),CommMetaData(1));
+    res+= comm.sendDoubles(Hard,eta,xi_n,xi_nplus1,getDbTagData(),CommMetaData(2));
+    res+= comm.sendVector(epsilon_p_n.getVector(),getDbTagData(),CommMetaData(3));
+    res+= comm.sendVector(epsilon_p_nplus1.getVector(),getDbTagData(),CommMetaData(4));
+    res+= comm.sendVector(strain3d.getVector(),getDbTagData(),CommMetaData(5));
+    return res;
+  }
+
+//! @brief Receives object members through the communicator argument.
+int XC::J2RadialReturn::recvData(const Communicator &comm)
+  {
+    int res= NDMaterial::recvData(comm);
+    res+= comm.receiveDoubles(bulk,shear,sigma_0,sigma_infty,delta,getDbTagData(),CommMetaData(1));
+    res+= comm.receiveDoubles(Hard,eta,xi_n,xi_nplus1,getDbTagData(),CommMetaData(2));
+    Vector tmp(6);
+    res+= comm.receiveVector(tmp,getDbTagData(),CommMetaData(3));
+    epsilon_p_n= Vector6(tmp);
+    res+= comm.receiveVector(tmp,getDbTagData(),CommMetaData(4));
+    epsilon_p_nplus1= Vector6(tmp);
+    res+= comm.receiveVector(tmp,getDbTagData(),CommMetaData(5));
+    strain3d= Vector6(tmp);
+    return_mapping(); // recompute the trial stress and tangent.
+    return res;
+  }
+
+//! @brief Sends object through the communicator argument.
+int XC::J2RadialReturn::sendSelf(Communicator &comm)
+  {
+    setDbTag(comm);
+    const int dataTag= getDbTag();
+    inicComm(6);
+    int res= sendData(comm);
+
+    res+= comm.sendIdData(getDbTagData(),dataTag);
+    if(res < 0)
+      std::cerr << getClassName() << "::" << __FUNCTION__
+		<< "; failed to send data.\n";
+    return res;
+  }
+
+//! @brief Receives object through the communicator argument.
+int XC::J2RadialReturn::recvSelf(const Communicator &comm)
+  {
+    inicComm(6);
+    const int dataTag= getDbTag();
+    int res= comm.receiveIdData(getDbTagData(),dataTag);
+
+    if(res<0)
+      std::cerr << getClassName() << "::" << __FUNCTION__
+		<< "; failed to receive ids.\n";
+    else
+      {
+        setTag(getDbTagDataPos(0));
+        res+= recvData(comm);
+        if(res<0)
+          std::cerr << getClassName() << "::" << __FUNCTION__
+		    << "; failed to receive data.\n";
+      }
+    return res;
+  }
@@ -0,0 +1,124 @@
+// -*-c++-*-
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis C. Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//J2RadialReturn.h
+
+#ifndef J2RadialReturn_h
+#define J2RadialReturn_h
+
+#include "material/nD/NDMaterial.h"
+#include "material/nD/RadialReturnMapping.h"
+
+namespace XC {
+
+//! @brief Base class for J2 isotropic hardening materials integrated
+//! with the radial return algorithm in fixed size Voigt notation.
+//! @ingroup J2NDMat
+//!
+//! Same model as J2Plasticity (saturation isotropic hardening with
+//! linear term and linear viscosity):
+//! \f[
+//! \phi(\sigma,q)= ||dev(\sigma)|| - \sqrt{2/3}\, q(\xi), \qquad
+//! q(\xi)= \sigma_\infty + (\sigma_0-\sigma_\infty)e^{-\delta\xi} + H\xi
+//! \f]
+//! but the state is stored in fixed size Voigt arrays and the return
+//! mapping (see RadialReturnMapping) computes the consistent tangent in
+//! closed form, so the state update does not allocate memory nor
+//! loop over rank four tensors. The consistency equation is solved in
+//! one step when the hardening is linear (delta= 0).
+class J2RadialReturn: public NDMaterial
+  {
+  public:
+    typedef RadialReturnMapping::Vector6 Vector6;
+    typedef RadialReturnMapping::Matrix6 Matrix6;
+  protected:
+    //material parameters
+    double bulk; //!< bulk modulus.
+    double shear; //!< shear modulus.
+    double sigma_0; //!< initial yield stress.
+    double sigma_infty; //!< final saturation yield stress.
+    double delta; //!< exponential hardening parameter.
+    double Hard; //!< linear hardening parameter.
+    double eta; //!< viscosity.
+
+    //internal variables
+    Vector6 epsilon_p_n; //!< plastic strain time n (tensor components).
+    Vector6 epsilon_p_nplus1; //!< plastic strain time n+1 (tensor components).
+    double xi_n; //!< xi time n.
+    double xi_nplus1; //!< xi time n+1.
+
+    //material response
+    Vector6 strain3d; //!< trial strain (engineering components).
+    Vector6 stress3d; //!< trial stress.
+    Matrix6 tangent3d; //!< consistent tangent.
+
+    //! @brief Radius of the yield surface as a function of the
+    //! consistency parameter of the step (see RadialReturnMapping).
+    class Hardening
+      {
+        const J2RadialReturn &mat;
+        double viscosity; //!< eta/dt.
+      public:
+        Hardening(const J2RadialReturn &, const double &);
+        double radius(const double &) const;
+        double slope(const double &) const;
+      };
+
+    void zero(void);
+    double get_tolerance(void) const;
+    int return_mapping(void);
+    double q(const double &) const;
+    double qprime(const double &) const;
+
+    int sendData(Communicator &);
+    int recvData(const Communicator &);
+  public:
+    J2RadialReturn(int tag, int classTag);
+    J2RadialReturn(int tag, int classTag, double K, double G, double yield0, double yield_infty, double d, double H, double viscosity= 0);
+    J2RadialReturn(int tag, int classTag, double K, double G);
+
+    virtual NDMaterial *getCopy(const std::string &) const;
+
+    void setup(const double &K= 0.0, const double &G= 0.0, const double &yield0= 0.0, const double &yield_infty= 0.0, const double &d= 0.0, const double &H= 0.0, const double &viscosity= 0.0);
+
+    //! @brief Return the equivalent plastic strain.
+    inline double getXi(void) const
+      { return xi_nplus1; }
+
+    virtual int commitState(void);
+    virtual int revertToLastCommit(void);
+    virtual int revertToStart(void);
+
+    virtual int sendSelf(Communicator &);
+    virtual int recvSelf(const Communicator &);
+
+    void Print(std::ostream &s, int flag = 0) const;
+  };
+
+} //end of XC namespace
+
+#endif
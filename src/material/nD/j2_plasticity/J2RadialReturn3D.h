@@ -0,0 +1,73 @@
+// -*-c++-*-
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis C. Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//J2RadialReturn3D.h
+
+#ifndef J2RadialReturn3D_h
+#define J2RadialReturn3D_h
+
+#include "J2RadialReturn.h"
+
+namespace XC {
+
+//! @brief Three-dimensional J2 isotropic hardening material
+//! integrated with the radial return algorithm (drop-in replacement
+//! for J2ThreeDimensional).
+//! @ingroup J2NDMat
+//!
+//! Strains in the following format:
+//! [eps_00, eps_11, eps_22, 2 eps_01, 2 eps_12, 2 eps_20].
+class J2RadialReturn3D: public J2RadialReturn
+  {
+  private:
+    static Vector strain_vec; //!< strain in vector notation.
+    static Vector stress_vec; //!< stress in vector notation.
+    static Matrix tangent_matrix; //!< material tangent in matrix notation.
+  public:
+    J2RadialReturn3D(int tag= 0);
+    J2RadialReturn3D(int tag, double K, double G, double yield0, double yield_infty, double d, double H, double viscosity= 0);
+    J2RadialReturn3D(int tag, double K, double G);
+
+    NDMaterial *getCopy(void) const;
+    const std::string &getType(void) const;
+    int getOrder(void) const;
+
+    int setTrialStrain(const Vector &);
+    int setTrialStrain(const Vector &v, const Vector &r);
+    int setTrialStrainIncr(const Vector &v);
+    int setTrialStrainIncr(const Vector &v, const Vector &r);
+    int setTrialBatch(const size_t &, NDMaterial *const [], const double [], double [], double []) const;
+
+    const Vector &getStrain(void) const;
+    const Vector &getStress(void) const;
+    const Matrix &getTangent(void) const;
+    const Matrix &getInitialTangent(void) const;
+  };
+
+} //end of XC namespace
+
+#endif
@@ -0,0 +1,124 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis C. Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//J2RadialReturnPlaneStrain.cc
+
+#include "J2RadialReturnPlaneStrain.h"
+#include "material/nD/NDMaterialType.h"
+
+//static vectors and matrices
+XC::Vector XC::J2RadialReturnPlaneStrain::strain_vec(3);
+XC::Vector XC::J2RadialReturnPlaneStrain::stress_vec(3);
+XC::Matrix XC::J2RadialReturnPlaneStrain::tangent_matrix(3,3);
+const int XC::J2RadialReturnPlaneStrain::voigt_index[3]= {0, 1, 3};
+
+//! @brief Default constructor.
+XC::J2RadialReturnPlaneStrain::J2RadialReturnPlaneStrain(int tag)
+  : J2RadialReturn(tag, ND_TAG_J2RadialReturnPlaneStrain) {}
+
+//! @brief Full constructor.
+XC::J2RadialReturnPlaneStrain::J2RadialReturnPlaneStrain(int tag, double K, double G,
+                                       double yield0, double yield_infty,
+                                       double d, double H, double viscosity)
+  : J2RadialReturn(tag, ND_TAG_J2RadialReturnPlaneStrain, K, G, yield0, yield_infty, d, H, viscosity) {}
+
+//! @brief Elastic constructor.
+XC::J2RadialReturnPlaneStrain::J2RadialReturnPlaneStrain(int tag, double K, double G)
+  : J2RadialReturn(tag, ND_TAG_J2RadialReturnPlaneStrain, K, G) {}
+
+//! @brief Virtual constructor.
+XC::NDMaterial *XC::J2RadialReturnPlaneStrain::getCopy(void) const
+  { return new J2RadialReturnPlaneStrain(*this); }
+
+//! @brief Return the type of material.
+const std::string &XC::J2RadialReturnPlaneStrain::getType(void) const
+  { return strTypePlaneStrain; }
+
+//! @brief Return the order of the strain vector.
+int XC::J2RadialReturnPlaneStrain::getOrder(void) const
+  { return 3; }
+
+//! @brief Copy the in-plane components of the 3D tangent argument
+//! into the tangent matrix.
+const XC::Matrix &XC::J2RadialReturnPlaneStrain::copy_tangent(const Matrix6 &C) const
+  {
+    for(int i= 0;i<3;i++)
+      for(int j= 0;j<3;j++)
+        tangent_matrix(i,j)= C(voigt_index[i],voigt_index[j]);
+    return tangent_matrix;
+  }
+
+//! @brief Set the trial strain and integrate the plasticity equations.
+int XC::J2RadialReturnPlaneStrain::setTrialStrain(const Vector &strain_from_element)
+  {
+    for(int i= 0;i<3;i++)
+      strain3d(voigt_index[i])= strain_from_element(i);
+    return return_mapping();
+  }
+
+//! @brief Set the trial strain (the rate is ignored).
+int XC::J2RadialReturnPlaneStrain::setTrialStrain(const Vector &v, const Vector &r)
+  { return this->setTrialStrain(v); }
+
+//! @brief Increment the trial strain.
+int XC::J2RadialReturnPlaneStrain::setTrialStrainIncr(const Vector &v)
+  {
+    for(int i= 0;i<3;i++)
+      strain3d(voigt_index[i])+= v(i);
+    return return_mapping();
+  }
+
+//! @brief Increment the trial strain (the rate is ignored).
+int XC::J2RadialReturnPlaneStrain::setTrialStrainIncr(const Vector &v, const Vector &r)
+  { return this->setTrialStrainIncr(v); }
+
+//! @brief Return the strain.
+const XC::Vector &XC::J2RadialReturnPlaneStrain::getStrain(void) const
+  {
+    for(int i= 0;i<3;i++)
+      strain_vec(i)= strain3d(voigt_index[i]);
+    return strain_vec;
+  }
+
+//! @brief Return the stress.
+const XC::Vector &XC::J2RadialReturnPlaneStrain::getStress(void) const
+  {
+    for(int i= 0;i<3;i++)
+      stress_vec(i)= stress3d(voigt_index[i]);
+    return stress_vec;
+  }
+
+//! @brief Return the consistent tangent.
+const XC::Matrix &XC::J2RadialReturnPlaneStrain::getTangent(void) const
+  { return copy_tangent(tangent3d); }
+
+//! @brief Return the elastic tangent.
+const XC::Matrix &XC::J2RadialReturnPlaneStrain::getInitialTangent(void) const
+  {
+    Matrix6 C;
+    RadialReturnMapping(bulk, shear).getElasticTangent(C);
+    return copy_tangent(C);
+  }
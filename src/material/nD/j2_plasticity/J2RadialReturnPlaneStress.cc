@@ -0,0 +1,229 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis C. Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//J2RadialReturnPlaneStress.cc
+
+#include "J2RadialReturnPlaneStress.h"
+#include "material/nD/NDMaterialType.h"
+
+//static vectors and matrices
+XC::Vector XC::J2RadialReturnPlaneStress::strain_vec(3);
+XC::Vector XC::J2RadialReturnPlaneStress::stress_vec(3);
+XC::Matrix XC::J2RadialReturnPlaneStress::tangent_matrix(3,3);
+const int XC::J2RadialReturnPlaneStress::voigt_index[3]= {0, 1, 3};
+
+//! @brief Default constructor.
+XC::J2RadialReturnPlaneStress::J2RadialReturnPlaneStress(int tag)
+  : J2RadialReturn(tag, ND_TAG_J2RadialReturnPlaneStress), commitEps22(0.0) {}
+
+//! @brief Full constructor.
+XC::J2RadialReturnPlaneStress::J2RadialReturnPlaneStress(int tag, double K, double G,
+                                       double yield0, double yield_infty,
+                                       double d, double H, double viscosity)
+  : J2RadialReturn(tag, ND_TAG_J2RadialReturnPlaneStress, K, G, yield0, yield_infty, d, H, viscosity), commitEps22(0.0) {}
+
+//! @brief Elastic constructor.
+XC::J2RadialReturnPlaneStress::J2RadialReturnPlaneStress(int tag, double K, double G)
+  : J2RadialReturn(tag, ND_TAG_J2RadialReturnPlaneStress, K, G), commitEps22(0.0) {}
+
+//! @brief Virtual constructor.
+XC::NDMaterial *XC::J2RadialReturnPlaneStress::getCopy(void) const
+  { return new J2RadialReturnPlaneStress(*this); }
+
+//! @brief Return the type of material.
+const std::string &XC::J2RadialReturnPlaneStress::getType(void) const
+  { return strTypePlaneStress; }
+
+//! @brief Return the order of the strain vector.
+int XC::J2RadialReturnPlaneStress::getOrder(void) const
+  { return 3; }
+
+//! @brief Condense the out of plane component of the 3D tangent
+//! argument and copy the in-plane components into the tangent matrix.
+const XC::Matrix &XC::J2RadialReturnPlaneStress::copy_tangent(const Matrix6 &C) const
+  {
+    const double C22= C(2,2);
+    for(int i= 0;i<3;i++)
+      {
+        const int ii= voigt_index[i];
+        for(int j= 0;j<3;j++)
+          {
+            const int jj= voigt_index[j];
+            tangent_matrix(i,j)= C(ii,jj)-C(ii,2)*C(2,jj)/C22;
+          }
+      }
+    return tangent_matrix;
+  }
+
+//! @brief Iterate on the out of plane strain until the out of plane
+//! stress vanishes.
+int XC::J2RadialReturnPlaneStress::plane_stress_return(void)
+  {
+    static const int maxIter= 25;
+    const double tol= get_tolerance();
+    strain3d(2)= commitEps22;
+    int retval= return_mapping();
+    int i= 0;
+    while((fabs(stress3d(2))>tol) && (i<maxIter))
+      {
+        strain3d(2)-= stress3d(2)/tangent3d(2,2);
+        retval= return_mapping();
+        i++;
+      }
+    if(i>=maxIter)
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+                  << "; more than " << maxIter
+                  << " iterations in the plane stress loop." << std::endl;
+        retval= -1;
+      }
+    return retval;
+  }
+
+//! @brief Set the trial strain and integrate the plasticity equations.
+int XC::J2RadialReturnPlaneStress::setTrialStrain(const Vector &strain_from_element)
+  {
+    for(int i= 0;i<3;i++)
+      strain3d(voigt_index[i])= strain_from_element(i);
+    return plane_stress_return();
+  }
+
+//! @brief Set the trial strain (the rate is ignored).
+int XC::J2RadialReturnPlaneStress::setTrialStrain(const Vector &v, const Vector &r)
+  { return this->setTrialStrain(v); }
+
+//! @brief Increment the trial strain.
+int XC::J2RadialReturnPlaneStress::setTrialStrainIncr(const Vector &v)
+  {
+    for(int i= 0;i<3;i++)
+      strain3d(voigt_index[i])+= v(i);
+    return plane_stress_return();
+  }
+
+//! @brief Increment the trial strain (the rate is ignored).
+int XC::J2RadialReturnPlaneStress::setTrialStrainIncr(const Vector &v, const Vector &r)
+  { return this->setTrialStrainIncr(v); }
+
+//! @brief Return the strain.
+const XC::Vector &XC::J2RadialReturnPlaneStress::getStrain(void) const
+  {
+    for(int i= 0;i<3;i++)
+      strain_vec(i)= strain3d(voigt_index[i]);
+    return strain_vec;
+  }
+
+//! @brief Return the stress.
+const XC::Vector &XC::J2RadialReturnPlaneStress::getStress(void) const
+  {
+    for(int i= 0;i<3;i++)
+      stress_vec(i)= stress3d(voigt_index[i]);
+    return stress_vec;
+  }
+
+//! @brief Return the consistent tangent.
+const XC::Matrix &XC::J2RadialReturnPlaneStress::getTangent(void) const
+  { return copy_tangent(tangent3d); }
+
+//! @brief Return the elastic tangent.
+const XC::Matrix &XC::J2RadialReturnPlaneStress::getInitialTangent(void) const
+  {
+    Matrix6 C;
+    RadialReturnMapping(bulk, shear).getElasticTangent(C);
+    return copy_tangent(C);
+  }
+
+//! @brief Commit material state.
+int XC::J2RadialReturnPlaneStress::commitState(void)
+  {
+    commitEps22= strain3d(2);
+    return J2RadialReturn::commitState();
+  }
+
+//! @brief Revert to the last committed state.
+int XC::J2RadialReturnPlaneStress::revertToLastCommit(void)
+  {
+    strain3d(2)= commitEps22;
+    return J2RadialReturn::revertToLastCommit();
+  }
+
+//! @brief Revert to start.
+int XC::J2RadialReturnPlaneStress::revertToStart(void)
+  {
+    commitEps22= 0.0;
+    return J2RadialReturn::revertToStart();
+  }
+
+//! @brief Send object members through the communicator argument.
+int XC::J2RadialReturnPlaneStress::sendData(Communicator &comm)
+  {
+    int res= J2RadialReturn::sendData(comm);
+    res+= comm.sendDouble(commitEps22,getDbTagData(),CommMetaData(6));
+    return res;
+  }
+
+//! @brief Receives object members through the communicator argument.
+int XC::J2RadialReturnPlaneStress::recvData(const Communicator &comm)
+  {
+    int res= J2RadialReturn::recvData(comm);
+    res+= comm.receiveDouble(commitEps22,getDbTagData(),CommMetaData(6));
+    return res;
+  }
+
+//! @brief Sends object through the communicator argument.
+int XC::J2RadialReturnPlaneStress::sendSelf(Communicator &comm)
+  {
+    setDbTag(comm);
+    const int dataTag= getDbTag();
+    inicComm(7);
+    int res= sendData(comm);
+
+    res+= comm.sendIdData(getDbTagData(),dataTag);
+    if(res < 0)
+      std::cerr << getClassName() << "::" << __FUNCTION__
+		<< "; failed to send data.\n";
+    return res;
+  }
+
+//! @brief Receives object through the communicator argument.
+int XC::J2RadialReturnPlaneStress::recvSelf(const Communicator &comm)
+  {
+    inicComm(7);
+    const int dataTag= getDbTag();
+    int res= comm.receiveIdData(getDbTagData(),dataTag);
+
+    if(res<0)
+      std::cerr << getClassName() << "::" << __FUNCTION__
+		<< "; failed to receive ids.\n";
+    else
+      {
+        setTag(getDbTagDataPos(0));
+        res+= recvData(comm);
+        if(res<0)
+          std::cerr << getClassName() << "::" << __FUNCTION__
+		    << "; failed to receive data.\n";
+      }
+    return res;
+  }
@@ -0,0 +1,88 @@
+// -*-c++-*-
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis C. Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//J2RadialReturnPlaneStress.h
+
+#ifndef J2RadialReturnPlaneStress_h
+#define J2RadialReturnPlaneStress_h
+
+#include "J2RadialReturn.h"
+
+namespace XC {
+
+//! @brief Plane stress J2 isotropic hardening material integrated
+//! with the radial return algorithm (drop-in replacement for
+//! J2PlaneStress).
+//!
+//! The out of plane strain is iterated until the out of plane stress
+//! vanishes and the 3D tangent is condensed accordingly.
+//! @ingroup J2NDMat
+//!
+//! Strains in the following format: [eps_00, eps_11, 2 eps_01].
+class J2RadialReturnPlaneStress: public J2RadialReturn
+  {
+  private:
+    double commitEps22; //!< committed out of plane strain.
+    static Vector strain_vec; //!< strain in vector notation.
+    static Vector stress_vec; //!< stress in vector notation.
+    static Matrix tangent_matrix; //!< material tangent in matrix notation.
+    static const int voigt_index[3]; //!< components of the 3D arrays.
+    const Matrix &copy_tangent(const Matrix6 &) const;
+    int plane_stress_return(void);
+  protected:
+    int sendData(Communicator &);
+    int recvData(const Communicator &);
+  public:
+    J2RadialReturnPlaneStress(int tag= 0);
+    J2RadialReturnPlaneStress(int tag, double K, double G, double yield0, double yield_infty, double d, double H, double viscosity= 0);
+    J2RadialReturnPlaneStress(int tag, double K, double G);
+
+    NDMaterial *getCopy(void) const;
+    const std::string &getType(void) const;
+    int getOrder(void) const;
+
+    int setTrialStrain(const Vector &);
+    int setTrialStrain(const Vector &v, const Vector &r);
+    int setTrialStrainIncr(const Vector &v);
+    int setTrialStrainIncr(const Vector &v, const Vector &r);
+
+    const Vector &getStrain(void) const;
+    const Vector &getStress(void) const;
+    const Matrix &getTangent(void) const;
+    const Matrix &getInitialTangent(void) const;
+
+    int commitState(void);
+    int revertToLastCommit(void);
+    int revertToStart(void);
+
+    int sendSelf(Communicator &);
+    int recvSelf(const Communicator &);
+  };
+
+} //end of XC namespace
+
+#endif
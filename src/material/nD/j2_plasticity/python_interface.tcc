@@ -47,3 +47,14 @@ class_<XC::J2PlateFibre , bases<XC::NDMaterial>, boost::noncopyable >("J2PlateFi
   ;
 
 class_<XC::J2ThreeDimensional , bases<XC::J2Plasticity>, boost::noncopyable >("J2ThreeDimensional", no_init);
+
+class_<XC::J2RadialReturn, bases<XC::NDMaterial>, boost::noncopyable >("J2RadialReturn", no_init)
+  .def("setup",&XC::J2RadialReturn::setup,"setup(K, G, initYield, finalYield, delta, linearHardening, viscosity) set paramater values")
+  .add_property("xi", &XC::J2RadialReturn::getXi, "Return the equivalent plastic strain.")
+  ;
+
+class_<XC::J2RadialReturnPlaneStrain , bases<XC::J2RadialReturn>, boost::noncopyable >("J2RadialReturnPlaneStrain", no_init);
+
+class_<XC::J2RadialReturnPlaneStress , bases<XC::J2RadialReturn>, boost::noncopyable >("J2RadialReturnPlaneStress", no_init);
+
+class_<XC::J2RadialReturn3D , bases<XC::J2RadialReturn>, boost::noncopyable >("J2RadialReturn3D", no_init);
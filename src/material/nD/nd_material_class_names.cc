@@ -29,7 +29,7 @@
 #include <string>
 #include "nd_material_class_names.h"
 
-const std::set<std::string> nd_material_class_names= {"XC::NDMaterial", "XC::ContactMaterialBase", "XC::ContactMaterial2D", "XC::ContactMaterial3D", "XC::DruckerPrager", "XC::DruckerPrager3D", "XC::DruckerPragerPlaneStrain", "XC::ElasticCrossAnisotropic", "XC::ElasticIsotropicMaterial", "XC::ElasticIsotropic2D", "XC::ElasticIsotropicPlaneStrain2D", "XC::ElasticIsotropicPlaneStress2D", "XC::ElasticIsotropic3D", "XC::ElasticIsotropicAxiSymm", "XC::ElasticIsotropicBeamFiber", "XC::ElasticIsotropicPlateFiber", "XC::PressureDependentElastic3D", "XC::FeapMaterial", "XC::FeapMaterial01", "XC::FeapMaterial02", "XC::FeapMaterial03", "XC::FiniteDeformationMaterial", "XC::FiniteDeformationEP3D", "XC::FiniteDeformationElastic3D", "XC::FDdecoupledElastic3D", "XC::NeoHookeanCompressible3D", "XC::InitialStateAnalysisWrapper", "XC::J2Plasticity", "XC::J2AxiSymm", "XC::J2PlaneStrain", "XC::J2PlaneStress", "XC::J2PlateFiber", "XC::J2ThreeDimensional", "XC::J2PlateFibre", "XC::MultiaxialCyclicPlasticity", "XC::MultiaxialCyclicPlasticity3D", "XC::MultiaxialCyclicPlasticityAxiSymm", "XC::MultiaxialCyclicPlasticityPlaneStrain", "XC::NDAdaptorMaterial", "XC::BeamFiberMaterial", "XC::PlaneStressMaterial", "XC::PlateFiberMaterial", "XC::PlasticDamageConcretePlaneStress", "XC::PlateAdaptorMaterial<>", "XC::PlateFromPlaneStressMaterial", "XC::PlateRebarMaterial", "XC::SoilMaterialBase", "XC::FluidSolidPorousMaterial", "XC::PressureMultiYieldBase", "XC::PressureDependMultiYieldBase", "XC::PressureDependMultiYield", "XC::PressureDependMultiYield02", "XC::PressureIndependMultiYield", "XC::Template3Dep"};
+const std::set<std::string> nd_material_class_names= {"XC::NDMaterial", "XC::ContactMaterialBase", "XC::ContactMaterial2D", "XC::ContactMaterial3D", "XC::DruckerPrager", "XC::DruckerPrager3D", "XC::DruckerPragerPlaneStrain", "XC::DruckerPragerRadialReturn", "XC::DruckerPragerRadialReturn3D", "XC::DruckerPragerRadialReturnPlaneStrain", "XC::ElasticCrossAnisotropic", "XC::ElasticIsotropicMaterial", "XC::ElasticIsotropic2D", "XC::ElasticIsotropicPlaneStrain2D", "XC::ElasticIsotropicPlaneStress2D", "XC::ElasticIsotropic3D", "XC::ElasticIsotropicAxiSymm", "XC::ElasticIsotropicBeamFiber", "XC::ElasticIsotropicPlateFiber", "XC::PressureDependentElastic3D", "XC::FeapMaterial", "XC::FeapMaterial01", "XC::FeapMaterial02", "XC::FeapMaterial03", "XC::FiniteDeformationMaterial", "XC::FiniteDeformationEP3D", "XC::FiniteDeformationElastic3D", "XC::FDdecoupledElastic3D", "XC::NeoHookeanCompressible3D", "XC::InitialStateAnalysisWrapper", "XC::J2Plasticity", "XC::J2AxiSymm", "XC::J2PlaneStrain", "XC::J2PlaneStress", "XC::J2PlateFiber", "XC::J2ThreeDimensional", "XC::J2RadialReturn", "XC::J2RadialReturn3D", "XC::J2RadialReturnPlaneStrain", "XC::J2RadialReturnPlaneStress", "XC::J2PlateFibre", "XC::MultiaxialCyclicPlasticity", "XC::MultiaxialCyclicPlasticity3D", "XC::MultiaxialCyclicPlasticityAxiSymm", "XC::MultiaxialCyclicPlasticityPlaneStrain", "XC::NDAdaptorMaterial", "XC::BeamFiberMaterial", "XC::PlaneStressMaterial", "XC::PlateFiberMaterial", "XC::PlasticDamageConcretePlaneStress", "XC::PlateAdaptorMaterial<>", "XC::PlateFromPlaneStressMaterial", "XC::PlateRebarMaterial", "XC::SoilMaterialBase", "XC::FluidSolidPorousMaterial", "XC::PressureMultiYieldBase", "XC::PressureDependMultiYieldBase", "XC::PressureDependMultiYield", "XC::PressureDependMultiYield02", "XC::PressureIndependMultiYield", "XC::Template3Dep"};
   
 //! @brief Return true if the given class name corresponds to a coordinate transformation.
 bool XC::is_nd_material(const std::string &className)
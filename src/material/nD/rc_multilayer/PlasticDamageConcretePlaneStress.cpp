@@ -48,6 +48,7 @@
  // Created: 07/16
 
 #include "PlasticDamageConcretePlaneStress.h"           
+#include <typeinfo>
 
 
 //#define _DEBUG_PDC_PlaneStress 1
@@ -1050,6 +1051,30 @@ int XC::PlasticDamageConcretePlaneStress::setTrialStrainIncr(const Vector &dStra
   return 0;
 }
 
+//! @brief Set the trial strains of a batch of materials of this
+//! class without virtual calls.
+//!
+//! If the dynamic type of this object is a derived class (which may
+//! override setTrialStrain) the generic implementation is used.
+int XC::PlasticDamageConcretePlaneStress::setTrialBatch(const size_t &n, NDMaterial *const materials[], const double strains[], double stresses[], double tangents[]) const
+  {
+    if(typeid(*this)!=typeid(PlasticDamageConcretePlaneStress)) // derived class.
+      return NDMaterial::setTrialBatch(n, materials, strains, stresses, tangents);
+    int retval= 0;
+    const int order= PlasticDamageConcretePlaneStress::getOrder();
+    Vector eps(order);
+    for(size_t i= 0;i<n;i++)
+      {
+        PlasticDamageConcretePlaneStress *m= static_cast<PlasticDamageConcretePlaneStress *>(materials[i]);
+        const double *e= strains+i*order;
+        for(int j= 0;j<order;j++)
+          eps(j)= e[j];
+        retval+= m->PlasticDamageConcretePlaneStress::setTrialStrain(eps);
+        copy_response(order, m->PlasticDamageConcretePlaneStress::getStress(), m->PlasticDamageConcretePlaneStress::getTangent(), stresses+i*order, tangents+i*order*order);
+      }
+    return retval;
+  }
+
 const XC::Matrix &XC::PlasticDamageConcretePlaneStress::getTangent(void) const
   { return Ce; }
 
@@ -188,6 +188,7 @@ class PlasticDamageConcretePlaneStress : public NDMaterial
     int setTrialStrain(const Vector &v, const Vector &r);
     int setTrialStrainIncr(const Vector &v);
     int setTrialStrainIncr(const Vector &v, const Vector &r);
+    int setTrialBatch(const size_t &, NDMaterial *const [], const double [], double [], double []) const;
     const Matrix &getTangent(void) const;
     const Matrix &getInitialTangent(void) const;
 
@@ -59,6 +59,8 @@ Earthquake Engineering & Structural Dynamics, 2013, 42(5): 705-723*/
 
 
 #include "PlateFromPlaneStressMaterial.h"
+#include <map>
+#include <typeindex>
 #include "utility/recorder/response/MaterialResponse.h"
 #include "material/ResponseId.h"
 
@@ -135,6 +137,75 @@ int XC::PlateFromPlaneStressMaterial::setTrialStrain(const Vector &strainFromEle
   }
 
 
+//! @brief Set the trial strains of a batch of plate fibers.
+//!
+//! The plane stress materials of the batch are grouped by class and
+//! each group is updated with one call to its setTrialBatch method,
+//! the out of plane shear response is computed here.
+//!
+//! @param n: number of materials.
+//! @param materials: materials to update.
+//! @param strains: trial strains (five values for each material).
+//! @param stresses: computed stresses (five values for each material).
+//! @param tangents: computed tangents (5x5 column-major for each material).
+int XC::PlateFromPlaneStressMaterial::setTrialBatch(const size_t &n, NDMaterial *const materials[], const double strains[], double stresses[], double tangents[]) const
+  {
+    if(typeid(*this)!=typeid(PlateFromPlaneStressMaterial)) // derived class.
+      return NDMaterial::setTrialBatch(n, materials, strains, stresses, tangents);
+    
+    // Group the plane stress materials by class.
+    typedef std::map<std::type_index, std::vector<size_t> > group_map;
+    group_map groups;
+    for(size_t i= 0;i<n;i++)
+      {
+        const PlateFromPlaneStressMaterial *m= static_cast<const PlateFromPlaneStressMaterial *>(materials[i]);
+        groups[std::type_index(typeid(*m->getMaterial()))].push_back(i);
+      }
+    int retval= 0;
+    std::vector<NDMaterial *> psMaterials;
+    std::vector<double> psStrains, psStresses, psTangents;
+    for(group_map::const_iterator g= groups.begin();g!=groups.end();g++)
+      {
+        const std::vector<size_t> &idx= g->second;
+        const size_t sz= idx.size();
+        psMaterials.resize(sz);
+        psStrains.resize(3*sz);
+        psStresses.resize(3*sz);
+        psTangents.resize(9*sz);
+        for(size_t k= 0;k<sz;k++)
+          {
+            PlateFromPlaneStressMaterial *m= static_cast<PlateFromPlaneStressMaterial *>(materials[idx[k]]);
+            const double *e= strains+5*idx[k];
+            for(int j= 0;j<5;j++)
+              m->strain(j)= e[j];
+            psMaterials[k]= m->getMaterial();
+            psStrains[3*k]= e[0];
+            psStrains[3*k+1]= e[1];
+            psStrains[3*k+2]= e[2];
+          }
+        retval+= psMaterials[0]->setTrialBatch(sz, psMaterials.data(), psStrains.data(), psStresses.data(), psTangents.data());
+        for(size_t k= 0;k<sz;k++)
+          {
+            const PlateFromPlaneStressMaterial *m= static_cast<const PlateFromPlaneStressMaterial *>(materials[idx[k]]);
+            const double *e= strains+5*idx[k];
+            double *s= stresses+5*idx[k];
+            double *t= tangents+25*idx[k];
+            s[0]= psStresses[3*k];
+            s[1]= psStresses[3*k+1];
+            s[2]= psStresses[3*k+2];
+            s[3]= m->gmod*e[3];
+            s[4]= m->gmod*e[4];
+            std::fill(t, t+25, 0.0);
+            for(int b= 0;b<3;b++) // column-major.
+              for(int a= 0;a<3;a++)
+                t[5*b+a]= psTangents[9*k+3*b+a];
+            t[18]= m->gmod; // (3,3)
+            t[24]= m->gmod; // (4,4)
+          }
+      }
+    return retval;
+  }
+
 //send back the strain
 const XC::Vector &XC::PlateFromPlaneStressMaterial::getStrain(void) const
   {
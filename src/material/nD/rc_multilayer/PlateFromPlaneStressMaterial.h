@@ -106,6 +106,8 @@ class PlateFromPlaneStressMaterial: public PlateAdaptorMaterial<NDMaterialWrappe
     //get the strain 
     int setTrialStrain(const Vector &strainFromElement );
 
+    int setTrialBatch(const size_t &, NDMaterial *const [], const double [], double [], double []) const;
+
     //send back the strain
     const Vector &getStrain(void) const;
 
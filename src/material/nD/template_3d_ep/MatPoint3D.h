@@ -100,7 +100,7 @@ class MatPoint3D: public GaussPoint
                double s_weight = 0,
                double t_weight = 0,
                //EPState *eps    = 0,
-               NDMaterial * p_mmodel = 0   
+               const NDMaterial * p_mmodel = 0   
 	       //stresstensor * p_INstress = 0,
                //stresstensor * p_INiterative_stress = 0,
                //double         IN_q_ast_iterative = 0.0,
@@ -108,7 +108,8 @@ class MatPoint3D: public GaussPoint
                //tensor * p_Tangent_E_tensor = 0,
                );
         
-    // Constructor 1
+    MatPoint3D(const MatPoint3D &);
+    MatPoint3D &operator=(const MatPoint3D &);
     ~MatPoint3D(void);
 
     void Initialize(short int INr_direction_point_number,
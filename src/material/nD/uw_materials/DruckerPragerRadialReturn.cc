@@ -0,0 +1,232 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis C. Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//DruckerPragerRadialReturn.cc
+
+#include "DruckerPragerRadialReturn.h"
+#include "material/nD/uw_materials/DruckerPragerRadialReturn3D.h"
+#include "material/nD/uw_materials/DruckerPragerRadialReturnPlaneStrain.h"
+#include "material/nD/NDMaterialType.h"
+
+//! @brief Constructor.
+XC::DruckerPragerRadialReturn::Hardening::Hardening(const DruckerPragerRadialReturn &m)
+  : mat(m) {}
+
+//! @brief Return the radius of the yield surface for the consistency
+//! parameter argument: sqrt(2/3)*K(alpha_n+sqrt(2/3)*dgamma).
+double XC::DruckerPragerRadialReturn::Hardening::radius(const double &dgamma) const
+  {
+    static const double root23= sqrt(2.0/3.0);
+    return root23*mat.Kiso(mat.mAlpha1_n+root23*dgamma);
+  }
+
+//! @brief Return the derivative of the radius of the yield surface
+//! with respect to the consistency parameter.
+double XC::DruckerPragerRadialReturn::Hardening::slope(const double &dgamma) const
+  {
+    static const double root23= sqrt(2.0/3.0);
+    return 2.0/3.0*mat.Kisoprime(mat.mAlpha1_n+root23*dgamma);
+  }
+
+//! @brief Zero internal variables.
+void XC::DruckerPragerRadialReturn::zero(void)
+  {
+    mAlpha1_n= 0.0;
+    mAlpha1_n1= 0.0;
+    mEpsilon_n_p.Zero();
+    mEpsilon_n1_p.Zero();
+    strain3d.Zero();
+    stress3d.Zero();
+    RadialReturnMapping(mK, mG).getElasticTangent(tangent3d);
+  }
+
+//! @brief Set the values of the material parameters.
+void XC::DruckerPragerRadialReturn::setup(const double &bulk, const double &shear, const double &s_y, const double &r, const double &r_bar, const double &Kinfinity, const double &Kinit, const double &d1, const double &H)
+  {
+    mK= bulk;
+    mG= shear;
+    msigma_y= s_y;
+    mrho= r;
+    mrho_bar= r_bar;
+    mKinf= Kinfinity;
+    mKo= Kinit;
+    mdelta1= d1;
+    mHard= H;
+    zero();
+  }
+
+//! @brief Constructor.
+XC::DruckerPragerRadialReturn::DruckerPragerRadialReturn(int tag, int classTag)
+  : NDMaterial(tag, classTag), massDen(0.0)
+  { setup(0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0); }
+
+//! @brief Full constructor.
+XC::DruckerPragerRadialReturn::DruckerPragerRadialReturn(int tag, int classTag, double bulk, double shear, double s_y, double r, double r_bar, double Kinfinity, double Kinit, double d1, double H, double mDen)
+  : NDMaterial(tag, classTag), massDen(mDen)
+  { setup(bulk, shear, s_y, r, r_bar, Kinfinity, Kinit, d1, H); }
+
+//! @brief Virtual constructor.
+XC::NDMaterial *XC::DruckerPragerRadialReturn::getCopy(const std::string &type) const
+  {
+    NDMaterial *retval= nullptr;
+    if((type==strTypePlaneStrain2D) || (type==strTypePlaneStrain))
+      retval= new DruckerPragerRadialReturnPlaneStrain(this->getTag(), mK, mG, msigma_y, mrho, mrho_bar, mKinf, mKo, mdelta1, mHard, massDen);
+    else if((type==strTypeThreeDimensional) || (type==strType3D))
+      retval= new DruckerPragerRadialReturn3D(this->getTag(), mK, mG, msigma_y, mrho, mrho_bar, mKinf, mKo, mdelta1, mHard, massDen);
+    else
+      std::cerr << getClassName() << "::" << __FUNCTION__
+		<< "; failed to get model: " << type << std::endl;
+    return retval;
+  }
+
+//! @brief Isotropic hardening function.
+double XC::DruckerPragerRadialReturn::Kiso(const double &alpha1) const
+  { return msigma_y + mHard*alpha1 + (mKinf - mKo)*(1.0 - exp(-mdelta1*alpha1)); }
+
+//! @brief Derivative of the isotropic hardening function.
+double XC::DruckerPragerRadialReturn::Kisoprime(const double &alpha1) const
+  { return mHard + (mKinf - mKo)*mdelta1*exp(-mdelta1*alpha1); }
+
+//! @brief Compute the stress and the tangent for the current trial
+//! strain (strain3d) starting from the last committed state.
+int XC::DruckerPragerRadialReturn::return_mapping(void)
+  {
+    const Hardening hardening(*this);
+    mEpsilon_n1_p= mEpsilon_n_p;
+    const RadialReturnMapping rr(mK, mG, mrho, mrho_bar);
+    // relative tolerance (the yield stress vanishes for cohesionless soils).
+    const double tol= 1.0e-8*std::max(msigma_y, 1.0e-6*mK);
+    const double dgamma= rr.compute(strain3d, mEpsilon_n1_p, hardening, tol, stress3d, tangent3d);
+    mAlpha1_n1= mAlpha1_n + sqrt(2.0/3.0)*dgamma;
+    return 0;
+  }
+
+//! @brief Commit material state.
+int XC::DruckerPragerRadialReturn::commitState(void)
+  {
+    mEpsilon_n_p= mEpsilon_n1_p;
+    mAlpha1_n= mAlpha1_n1;
+    return 0;
+  }
+
+//! @brief Revert to the last committed state.
+int XC::DruckerPragerRadialReturn::revertToLastCommit(void)
+  {
+    mEpsilon_n1_p= mEpsilon_n_p;
+    mAlpha1_n1= mAlpha1_n;
+    return 0;
+  }
+
+//! @brief Revert to start.
+int XC::DruckerPragerRadialReturn::revertToStart(void)
+  {
+    int retval= NDMaterial::revertToStart();
+    this->zero();
+    return retval;
+  }
+
+//! @brief Print stuff.
+void XC::DruckerPragerRadialReturn::Print(std::ostream &s, int flag) const
+  {
+    s << getClassName() << " : " << this->getType() << std::endl
+      << "  K = " << mK << std::endl
+      << "  G = " << mG << std::endl
+      << "  sigma_y = " << msigma_y << std::endl
+      << "  rho = " << mrho << std::endl
+      << "  rho_bar = " << mrho_bar << std::endl
+      << "  Kinf = " << mKinf << std::endl
+      << "  Ko = " << mKo << std::endl
+      << "  delta1 = " << mdelta1 << std::endl
+      << "  H = " << mHard << std::endl
+      << "  Mass Density = " << massDen << std::endl;
+  }
+
+//! @brief Send object members through the communicator argument.
+int XC::DruckerPragerRadialReturn::sendData(Communicator &comm)
+  {
+    int res= NDMaterial::sendData(comm);
+    res+= comm.sendDoubles(mK,mG,msigma_y,mrho,mrho_bar,getDbTagData(),CommMetaData(1));
+    res+= comm.sendDoubles(mKinf,mKo,mdelta1,mHard,massDen,getDbTagData(),CommMetaData(2));
+    res+= comm.sendDoubles(mAlpha1_n,mAlpha1_n1,getDbTagData(),CommMetaData(3));
+    res+= comm.sendVector(mEpsilon_n_p.getVector(),getDbTagData(),CommMetaData(4));
+    res+= comm.sendVector(mEpsilon_n1_p.getVector(),getDbTagData(),CommMetaData(5));
+    res+= comm.sendVector(strain3d.getVector(),getDbTagData(),CommMetaData(6));
+    return res;
+  }
+
+//! @brief Receives object members through the communicator argument.
+int XC::DruckerPragerRadialReturn::recvData(const Communicator &comm)
+  {
+    int res= NDMaterial::recvData(comm);
+    res+= comm.receiveDoubles(mK,mG,msigma_y,mrho,mrho_bar,getDbTagData(),CommMetaData(1));
+    res+= comm.receiveDoubles(mKinf,mKo,mdelta1,mHard,massDen,getDbTagData(),CommMetaData(2));
+    res+= comm.receiveDoubles(mAlpha1_n,mAlpha1_n1,getDbTagData(),CommMetaData(3));
+    Vector tmp(6);
+    res+= comm.receiveVector(tmp,getDbTagData(),CommMetaData(4));
+    mEpsilon_n_p= Vector6(tmp);
+    res+= comm.receiveVector(tmp,getDbTagData(),CommMetaData(5));
+    mEpsilon_n1_p= Vector6(tmp);
+    res+= comm.receiveVector(tmp,getDbTagData(),CommMetaData(6));
+    strain3d= Vector6(tmp);
+    return_mapping(); // recompute the trial stress and tangent.
+    return res;
+  }
+
+//! @brief Sends object through the communicator argument.
+int XC::DruckerPragerRadialReturn::sendSelf(Communicator &comm)
+  {
+    setDbTag(comm);
+    const int dataTag= getDbTag();
+    inicComm(7);
+    int res= sendData(comm);
+
+    res+= comm.sendIdData(getDbTagData(),dataTag);
+    if(res < 0)
+      std::cerr << getClassName() << "::" << __FUNCTION__
+		<< "; failed to send data.\n";
+    return res;
+  }
+
+//! @brief Receives object through the communicator argument.
+int XC::DruckerPragerRadialReturn::recvSelf(const Communicator &comm)
+  {
+    inicComm(7);
+    const int dataTag= getDbTag();
+    int res= comm.receiveIdData(getDbTagData(),dataTag);
+
+    if(res<0)
+      std::cerr << getClassName() << "::" << __FUNCTION__
+		<< "; failed to receive ids.\n";
+    else
+      {
+        setTag(getDbTagDataPos(0));
+        res+= recvData(comm);
+        if(res<0)
+          std::cerr << getClassName() << "::" << __FUNCTION__
+		    << "; failed to receive data.\n";
+      }
+    return res;
+  }
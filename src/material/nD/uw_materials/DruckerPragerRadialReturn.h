@@ -0,0 +1,147 @@
+// -*-c++-*-
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis C. Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//DruckerPragerRadialReturn.h
+
+#ifndef DruckerPragerRadialReturn_h
+#define DruckerPragerRadialReturn_h
+
+#include "material/nD/NDMaterial.h"
+#include "material/nD/RadialReturnMapping.h"
+
+namespace XC {
+
+//! @ingroup UWMat
+//
+//! @brief Base class for Drucker-Prager materials integrated with the
+//! radial return algorithm in fixed size Voigt notation.
+//!
+//! Yield surface and (non associative) flow potential:
+//! \f[
+//! f= ||s|| + \rho I_1 - \sqrt{2/3}\, K(\alpha), \qquad
+//! g= ||s|| + \bar{\rho} I_1
+//! \f]
+//! with \f$K(\alpha)= \sigma_y + H\alpha + (K_\infty-K_o)(1-e^{-\delta_1\alpha})\f$.
+//! The return to the cone and to its apex and the corresponding
+//! consistent tangents are computed by RadialReturnMapping, so the
+//! state update does not allocate memory. Unlike DruckerPrager, the
+//! elastic moduli do not depend on the pressure and there is neither
+//! kinematic hardening nor tension cutoff (the stress is returned
+//! to the apex of the cone instead).
+class DruckerPragerRadialReturn: public NDMaterial
+  {
+  public:
+    typedef RadialReturnMapping::Vector6 Vector6;
+    typedef RadialReturnMapping::Matrix6 Matrix6;
+  protected:
+    //material parameters
+    double mK; //!< bulk modulus.
+    double mG; //!< shear modulus.
+    double msigma_y; //!< yield stress.
+    double mrho; //!< volumetric term (failure surface).
+    double mrho_bar; //!< nonassociative flow term.
+    double mKinf; //!< nonlinear isotropic hardening term.
+    double mKo; //!< nonlinear isotropic hardening term.
+    double mdelta1; //!< exponential hardening term.
+    double mHard; //!< linear isotropic hardening constant.
+    double massDen; //!< density.
+
+    //internal variables
+    Vector6 mEpsilon_n_p; //!< plastic strain time n (tensor components).
+    Vector6 mEpsilon_n1_p; //!< plastic strain time n+1 (tensor components).
+    double mAlpha1_n; //!< equivalent plastic strain time n.
+    double mAlpha1_n1; //!< equivalent plastic strain time n+1.
+
+    //material response
+    Vector6 strain3d; //!< trial strain (engineering components).
+    Vector6 stress3d; //!< trial stress.
+    Matrix6 tangent3d; //!< consistent tangent.
+
+    //! @brief Radius of the yield surface as a function of the
+    //! consistency parameter of the step (see RadialReturnMapping).
+    class Hardening
+      {
+        const DruckerPragerRadialReturn &mat;
+      public:
+        Hardening(const DruckerPragerRadialReturn &);
+        double radius(const double &) const;
+        double slope(const double &) const;
+      };
+
+    void zero(void);
+    int return_mapping(void);
+    double Kiso(const double &) const;
+    double Kisoprime(const double &) const;
+
+    int sendData(Communicator &);
+    int recvData(const Communicator &);
+  public:
+    DruckerPragerRadialReturn(int tag, int classTag);
+    DruckerPragerRadialReturn(int tag, int classTag, double bulk, double shear, double s_y, double r, double r_bar, double Kinfinity, double Kinit, double d1, double H, double mDen= 0.0);
+
+    virtual NDMaterial *getCopy(const std::string &) const;
+
+    void setup(const double &bulk, const double &shear, const double &s_y, const double &r, const double &r_bar, const double &Kinfinity, const double &Kinit, const double &d1, const double &H);
+
+    //! @brief Return the density.
+    inline double getRho(void) const
+      { return massDen; }
+    //! @brief Set the density.
+    inline void setRho(const double &d)
+      { massDen= d; }
+    //! @brief Return the bulk modulus.
+    inline double getBulkModulus(void) const
+      { return mK; }
+    //! @brief Return the shear modulus.
+    inline double getShearModulus(void) const
+      { return mG; }
+    //! @brief Return the yield stress.
+    inline double getYieldStress(void) const
+      { return msigma_y; }
+    //! @brief Return the volumetric term of the failure surface.
+    inline double getFailureSurfaceRho(void) const
+      { return mrho; }
+    //! @brief Return the nonassociative flow term.
+    inline double getFailureSurfaceRhoBar(void) const
+      { return mrho_bar; }
+    //! @brief Return the equivalent plastic strain.
+    inline double getAlpha(void) const
+      { return mAlpha1_n1; }
+
+    virtual int commitState(void);
+    virtual int revertToLastCommit(void);
+    virtual int revertToStart(void);
+
+    virtual int sendSelf(Communicator &);
+    virtual int recvSelf(const Communicator &);
+
+    void Print(std::ostream &s, int flag = 0) const;
+  };
+
+} //end of XC namespace
+
+#endif
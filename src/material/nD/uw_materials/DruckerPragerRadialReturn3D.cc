@@ -0,0 +1,132 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis C. Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//DruckerPragerRadialReturn3D.cc
+
+#include "DruckerPragerRadialReturn3D.h"
+#include "material/nD/NDMaterialType.h"
+#include <typeinfo>
+
+//static vectors and matrices
+XC::Vector XC::DruckerPragerRadialReturn3D::strain_vec(6);
+XC::Vector XC::DruckerPragerRadialReturn3D::stress_vec(6);
+XC::Matrix XC::DruckerPragerRadialReturn3D::tangent_matrix(6,6);
+
+//! @brief Default constructor.
+XC::DruckerPragerRadialReturn3D::DruckerPragerRadialReturn3D(int tag)
+  : DruckerPragerRadialReturn(tag, ND_TAG_DruckerPragerRadialReturn3D) {}
+
+//! @brief Full constructor.
+XC::DruckerPragerRadialReturn3D::DruckerPragerRadialReturn3D(int tag, double bulk, double shear, double s_y, double r, double r_bar, double Kinfinity, double Kinit, double d1, double H, double mDen)
+  : DruckerPragerRadialReturn(tag, ND_TAG_DruckerPragerRadialReturn3D, bulk, shear, s_y, r, r_bar, Kinfinity, Kinit, d1, H, mDen) {}
+
+//! @brief Virtual constructor.
+XC::NDMaterial *XC::DruckerPragerRadialReturn3D::getCopy(void) const
+  { return new DruckerPragerRadialReturn3D(*this); }
+
+//! @brief Return the type of material.
+const std::string &XC::DruckerPragerRadialReturn3D::getType(void) const
+  { return strTypeThreeDimensional; }
+
+//! @brief Return the order of the strain vector.
+int XC::DruckerPragerRadialReturn3D::getOrder(void) const
+  { return 6; }
+
+//! @brief Set the trial strain and integrate the plasticity equations.
+int XC::DruckerPragerRadialReturn3D::setTrialStrain(const Vector &strain_from_element)
+  {
+    for(int i= 0;i<6;i++)
+      strain3d(i)= strain_from_element(i);
+    return return_mapping();
+  }
+
+//! @brief Set the trial strain (the rate is ignored).
+int XC::DruckerPragerRadialReturn3D::setTrialStrain(const Vector &v, const Vector &r)
+  { return this->setTrialStrain(v); }
+
+//! @brief Increment the trial strain.
+int XC::DruckerPragerRadialReturn3D::setTrialStrainIncr(const Vector &v)
+  {
+    for(int i= 0;i<6;i++)
+      strain3d(i)+= v(i);
+    return return_mapping();
+  }
+
+//! @brief Increment the trial strain (the rate is ignored).
+int XC::DruckerPragerRadialReturn3D::setTrialStrainIncr(const Vector &v, const Vector &r)
+  { return this->setTrialStrainIncr(v); }
+
+//! @brief Set the trial strains of a batch of materials of this
+//! class reading and writing directly the fixed size state arrays
+//! (see NDMaterial::setTrialBatch).
+int XC::DruckerPragerRadialReturn3D::setTrialBatch(const size_t &n, NDMaterial *const materials[], const double strains[], double stresses[], double tangents[]) const
+  {
+    if(typeid(*this)!=typeid(DruckerPragerRadialReturn3D)) // derived class.
+      return NDMaterial::setTrialBatch(n, materials, strains, stresses, tangents);
+    int retval= 0;
+    for(size_t i= 0;i<n;i++)
+      {
+        DruckerPragerRadialReturn3D *m= static_cast<DruckerPragerRadialReturn3D *>(materials[i]);
+        const double *e= strains+6*i;
+        std::copy(e, e+6, m->strain3d.getDataPtr());
+        retval+= m->return_mapping();
+        const double *s= m->stress3d.getDataPtr();
+        std::copy(s, s+6, stresses+6*i);
+        const double *t= m->tangent3d.getDataPtr(); // column-major.
+        std::copy(t, t+36, tangents+36*i);
+      }
+    return retval;
+  }
+
+//! @brief Return the strain.
+const XC::Vector &XC::DruckerPragerRadialReturn3D::getStrain(void) const
+  {
+    strain3d.copyTo(strain_vec);
+    return strain_vec;
+  }
+
+//! @brief Return the stress.
+const XC::Vector &XC::DruckerPragerRadialReturn3D::getStress(void) const
+  {
+    stress3d.copyTo(stress_vec);
+    return stress_vec;
+  }
+
+//! @brief Return the consistent tangent.
+const XC::Matrix &XC::DruckerPragerRadialReturn3D::getTangent(void) const
+  {
+    tangent3d.copyTo(tangent_matrix);
+    return tangent_matrix;
+  }
+
+//! @brief Return the elastic tangent.
+const XC::Matrix &XC::DruckerPragerRadialReturn3D::getInitialTangent(void) const
+  {
+    Matrix6 C;
+    RadialReturnMapping(mK, mG).getElasticTangent(C);
+    C.copyTo(tangent_matrix);
+    return tangent_matrix;
+  }
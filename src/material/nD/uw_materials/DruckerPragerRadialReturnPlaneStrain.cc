@@ -0,0 +1,118 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis C. Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//DruckerPragerRadialReturnPlaneStrain.cc
+
+#include "DruckerPragerRadialReturnPlaneStrain.h"
+#include "material/nD/NDMaterialType.h"
+
+//static vectors and matrices
+XC::Vector XC::DruckerPragerRadialReturnPlaneStrain::strain_vec(3);
+XC::Vector XC::DruckerPragerRadialReturnPlaneStrain::stress_vec(3);
+XC::Matrix XC::DruckerPragerRadialReturnPlaneStrain::tangent_matrix(3,3);
+const int XC::DruckerPragerRadialReturnPlaneStrain::voigt_index[3]= {0, 1, 3};
+
+//! @brief Default constructor.
+XC::DruckerPragerRadialReturnPlaneStrain::DruckerPragerRadialReturnPlaneStrain(int tag)
+  : DruckerPragerRadialReturn(tag, ND_TAG_DruckerPragerRadialReturnPlaneStrain) {}
+
+//! @brief Full constructor.
+XC::DruckerPragerRadialReturnPlaneStrain::DruckerPragerRadialReturnPlaneStrain(int tag, double bulk, double shear, double s_y, double r, double r_bar, double Kinfinity, double Kinit, double d1, double H, double mDen)
+  : DruckerPragerRadialReturn(tag, ND_TAG_DruckerPragerRadialReturnPlaneStrain, bulk, shear, s_y, r, r_bar, Kinfinity, Kinit, d1, H, mDen) {}
+
+//! @brief Virtual constructor.
+XC::NDMaterial *XC::DruckerPragerRadialReturnPlaneStrain::getCopy(void) const
+  { return new DruckerPragerRadialReturnPlaneStrain(*this); }
+
+//! @brief Return the type of material.
+const std::string &XC::DruckerPragerRadialReturnPlaneStrain::getType(void) const
+  { return strTypePlaneStrain; }
+
+//! @brief Return the order of the strain vector.
+int XC::DruckerPragerRadialReturnPlaneStrain::getOrder(void) const
+  { return 3; }
+
+//! @brief Copy the in-plane components of the 3D tangent argument
+//! into the tangent matrix.
+const XC::Matrix &XC::DruckerPragerRadialReturnPlaneStrain::copy_tangent(const Matrix6 &C) const
+  {
+    for(int i= 0;i<3;i++)
+      for(int j= 0;j<3;j++)
+        tangent_matrix(i,j)= C(voigt_index[i],voigt_index[j]);
+    return tangent_matrix;
+  }
+
+//! @brief Set the trial strain and integrate the plasticity equations.
+int XC::DruckerPragerRadialReturnPlaneStrain::setTrialStrain(const Vector &strain_from_element)
+  {
+    for(int i= 0;i<3;i++)
+      strain3d(voigt_index[i])= strain_from_element(i);
+    return return_mapping();
+  }
+
+//! @brief Set the trial strain (the rate is ignored).
+int XC::DruckerPragerRadialReturnPlaneStrain::setTrialStrain(const Vector &v, const Vector &r)
+  { return this->setTrialStrain(v); }
+
+//! @brief Increment the trial strain.
+int XC::DruckerPragerRadialReturnPlaneStrain::setTrialStrainIncr(const Vector &v)
+  {
+    for(int i= 0;i<3;i++)
+      strain3d(voigt_index[i])+= v(i);
+    return return_mapping();
+  }
+
+//! @brief Increment the trial strain (the rate is ignored).
+int XC::DruckerPragerRadialReturnPlaneStrain::setTrialStrainIncr(const Vector &v, const Vector &r)
+  { return this->setTrialStrainIncr(v); }
+
+//! @brief Return the strain.
+const XC::Vector &XC::DruckerPragerRadialReturnPlaneStrain::getStrain(void) const
+  {
+    for(int i= 0;i<3;i++)
+      strain_vec(i)= strain3d(voigt_index[i]);
+    return strain_vec;
+  }
+
+//! @brief Return the stress.
+const XC::Vector &XC::DruckerPragerRadialReturnPlaneStrain::getStress(void) const
+  {
+    for(int i= 0;i<3;i++)
+      stress_vec(i)= stress3d(voigt_index[i]);
+    return stress_vec;
+  }
+
+//! @brief Return the consistent tangent.
+const XC::Matrix &XC::DruckerPragerRadialReturnPlaneStrain::getTangent(void) const
+  { return copy_tangent(tangent3d); }
+
+//! @brief Return the elastic tangent.
+const XC::Matrix &XC::DruckerPragerRadialReturnPlaneStrain::getInitialTangent(void) const
+  {
+    Matrix6 C;
+    RadialReturnMapping(mK, mG).getElasticTangent(C);
+    return copy_tangent(C);
+  }
@@ -0,0 +1,72 @@
+// -*-c++-*-
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis C. Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//DruckerPragerRadialReturnPlaneStrain.h
+
+#ifndef DruckerPragerRadialReturnPlaneStrain_h
+#define DruckerPragerRadialReturnPlaneStrain_h
+
+#include "DruckerPragerRadialReturn.h"
+
+namespace XC {
+
+//! @brief Plane strain Drucker-Prager material integrated
+//! with the radial return algorithm (see
+//! DruckerPragerRadialReturn).
+//! @ingroup UWMat
+//!
+//! Strains in the following format: [eps_00, eps_11, 2 eps_01].
+class DruckerPragerRadialReturnPlaneStrain: public DruckerPragerRadialReturn
+  {
+  private:
+    static Vector strain_vec; //!< strain in vector notation.
+    static Vector stress_vec; //!< stress in vector notation.
+    static Matrix tangent_matrix; //!< material tangent in matrix notation.
+    static const int voigt_index[3]; //!< components of the 3D arrays.
+    const Matrix &copy_tangent(const Matrix6 &) const;
+  public:
+    DruckerPragerRadialReturnPlaneStrain(int tag= 0);
+    DruckerPragerRadialReturnPlaneStrain(int tag, double bulk, double shear, double s_y, double r, double r_bar, double Kinfinity, double Kinit, double d1, double H, double mDen= 0.0);
+
+    NDMaterial *getCopy(void) const;
+    const std::string &getType(void) const;
+    int getOrder(void) const;
+
+    int setTrialStrain(const Vector &);
+    int setTrialStrain(const Vector &v, const Vector &r);
+    int setTrialStrainIncr(const Vector &v);
+    int setTrialStrainIncr(const Vector &v, const Vector &r);
+
+    const Vector &getStrain(void) const;
+    const Vector &getStress(void) const;
+    const Matrix &getTangent(void) const;
+    const Matrix &getInitialTangent(void) const;
+  };
+
+} //end of XC namespace
+
+#endif
@@ -49,6 +49,23 @@ class_<XC::DruckerPragerPlaneStrain , bases<XC::DruckerPrager>, boost::noncopyab
 class_<XC::DruckerPrager3D , bases<XC::DruckerPrager>, boost::noncopyable >("DruckerPrager3D", no_init)
   ;
 
+class_<XC::DruckerPragerRadialReturn, bases<XC::NDMaterial>, boost::noncopyable >("DruckerPragerRadialReturn", no_init)
+  .add_property("rho", &XC::DruckerPragerRadialReturn::getRho,  &XC::DruckerPragerRadialReturn::setRho,"Get/Set density.")
+  .add_property("k", &XC::DruckerPragerRadialReturn::getBulkModulus,"Return the bulk modulus.")
+  .add_property("G", &XC::DruckerPragerRadialReturn::getShearModulus,"Return the shear modulus.")
+  .add_property("sigY", &XC::DruckerPragerRadialReturn::getYieldStress,"Return the yield stress.")
+  .add_property("mrho", &XC::DruckerPragerRadialReturn::getFailureSurfaceRho,"Return the volumetric term of the failure surface.")
+  .add_property("mrhoBar", &XC::DruckerPragerRadialReturn::getFailureSurfaceRhoBar,"Return the nonassociative flow term.")
+  .add_property("alpha", &XC::DruckerPragerRadialReturn::getAlpha,"Return the equivalent plastic strain.")
+  .def("setup", &XC::DruckerPragerRadialReturn::setup, "setup(K, G, sigY, mrho, mrhoBar, Kinf, Ko, delta1, H) set parameter values.")
+  ;
+
+class_<XC::DruckerPragerRadialReturnPlaneStrain , bases<XC::DruckerPragerRadialReturn>, boost::noncopyable >("DruckerPragerRadialReturnPlaneStrain", no_init)
+  ;
+
+class_<XC::DruckerPragerRadialReturn3D , bases<XC::DruckerPragerRadialReturn>, boost::noncopyable >("DruckerPragerRadialReturn3D", no_init)
+  ;
+
 XC::NDMaterial *(XC::InitialStateAnalysisWrapper::*get_nd_encapsulated_material)(void)= &XC::InitialStateAnalysisWrapper::getMaterial;
 class_<XC::InitialStateAnalysisWrapper, bases<XC::NDMaterial>, boost::noncopyable >("InitialStateAnalysisWrapper", no_init)
    .def("setup", &XC::InitialStateAnalysisWrapper::setup, "Set the dimension and wrapped material.")
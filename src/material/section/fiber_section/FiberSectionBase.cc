@@ -38,6 +38,7 @@
 #include "material/section/interaction_diagram/Pivots.h"
 #include "material/section/interaction_diagram/InteractionDiagram.h"
 #include "material/section/interaction_diagram/InteractionDiagram2d.h"
+#include "material/section/interaction_diagram/PolygonalSectionIntegrator.h"
 #include "material/section/interaction_diagram/NMPointCloud.h"
 #include "material/section/interaction_diagram/NMyMzPointCloud.h"
 #include "material/section/fiber_section/fiber/Fiber.h"
@@ -52,6 +53,8 @@
 #include "utility/recorder/response/MaterialResponse.h"
 #include "material/uniaxial/UniaxialMaterial.h"
 #include "utility/utils/misc_utils/colormod.h"
+#include <boost/functional/hash.hpp>
+#include <sstream>
 
 void XC::FiberSectionBase::free_section_repres(void)
   {
@@ -219,7 +222,7 @@ int XC::FiberSectionBase::setTrialSectionDeformation(const Vector &deforms)
 //! @brief Returns material's trial generalized strain.
 const XC::Vector &XC::FiberSectionBase::getSectionDeformation(void) const
   {
-    static Vector retval;
+    static thread_local Vector retval;
     retval= eTrial-eInic;
     return retval;
   }
@@ -629,15 +632,66 @@ Pos3d XC::FiberSectionBase::getNMyMz(const DeformationPlane &def)
     return Esf2Pos3d();
   }
 
+//! @brief Returns the section normal stresses resultants (N, My, Mz)
+//! for each of the deformation planes being passed as parameter.
+//!
+//! The planes are distributed between the available threads. Each
+//! thread works on its own copy of the section so the state of this
+//! section is not modified.
+std::vector<Pos3d> XC::FiberSectionBase::getNMyMzPoints(const std::vector<DeformationPlane> &planes) const
+  {
+    const int numPlanes= planes.size();
+    std::vector<Pos3d> retval(numPlanes);
+#pragma omp parallel if(numPlanes>1)
+    {
+      FiberSectionBase *tmp= nullptr;
+      // The copy and the destruction of the sections are serialized
+      // (they may manage Python objects).
+#pragma omp critical(fiber_section_copy)
+      tmp= dynamic_cast<FiberSectionBase *>(getCopy());
+#pragma omp for schedule(dynamic,8)
+      for(int i= 0;i<numPlanes;i++)
+        retval[i]= tmp->getNMyMz(planes[i]);
+#pragma omp critical(fiber_section_copy)
+      delete tmp;
+    }
+    return retval;
+  }
+
+//! @brief Returns the section normal stresses resultants (N, My, Mz)
+//! for each of the deformation planes being passed as parameter using
+//! the method specified in the interaction diagram parameters.
+//!
+//! If polygon integration is requested the stresses are integrated
+//! over the contours of the section regions (see PolygonalSectionIntegrator).
+//! If that is not possible (some of the materials is not supported)
+//! the fibers are used.
+std::vector<Pos3d> XC::FiberSectionBase::getNMyMzPoints(const std::vector<DeformationPlane> &planes,const InteractionDiagramData &diag_data) const
+  {
+    if(diag_data.getPolygonIntegration())
+      {
+        const SectionGeometry *geom= getSectionGeometry();
+        PolygonalSectionIntegrator integrator;
+        if(geom && integrator.setup(*geom))
+          return integrator.getNMyMzPoints(planes);
+        std::clog << Color::yellow << getClassName() << "::" << __FUNCTION__
+                  << "; WARNING: can't integrate over the section contours;"
+                  << " using the fibers instead."
+                  << Color::def << std::endl;
+      }
+    return getNMyMzPoints(planes);
+  }
+
 //    ^ z
 //    |   /
 //    |  /
 //    | / theta
 //    +------->y
 //
-//! @brief Returns the points that define the interaction diagram
-//! of the section for an angle \f$\theta\f$ with respect to the z axis.
-void XC::FiberSectionBase::getInteractionDiagramPointsForTheta(NMyMzPointCloud &lista_esfuerzos,const InteractionDiagramData &diag_data,const FiberPtrDeque &fsC,const FiberPtrDeque &fsS,const double &theta)
+//! @brief Appends to the container the deformation planes that define
+//! the interaction diagram of the section for an angle \f$\theta\f$
+//! with respect to the z axis.
+void XC::FiberSectionBase::getInteractionDiagramPlanesForTheta(std::vector<DeformationPlane> &planes,const InteractionDiagramData &diag_data,const FiberPtrDeque &fsC,const FiberPtrDeque &fsS,const double &theta) const
   {
     ComputePivots cp(diag_data.getPivotsUltimateStrains(),fibers,fsC,fsS,theta);
     Pivots pivots(cp);
@@ -647,14 +701,13 @@ void XC::FiberSectionBase::getInteractionDiagramPointsForTheta(NMyMzPointCloud &
         Pos3d P1= pivots.getAPivot(); //Pivot.
         Pos3d P2= P1+100.0*cp.getKVector(); //Bending around local z axis.
         Pos3d P3;
-        DeformationPlane def;
         const double inc_eps_B= diag_data.getIncEps();
         const double eps_agot_A= diag_data.getPivotsUltimateStrains().getUltimateStrainAPivot();
         const double eps_agot_B= diag_data.getPivotsUltimateStrains().getUltimateStrainBPivot();
         for(double e= eps_agot_A;e>=eps_agot_B;e-=inc_eps_B)
           {
             P3= pivots.getBPoint(e);
-            lista_esfuerzos.append(getNMyMz(DeformationPlane(P1,P2,P3)));
+            planes.push_back(DeformationPlane(P1,P2,P3));
           }
         //Domains 3 and 4
         P1= pivots.getBPivot(); //Pivot
@@ -663,7 +716,7 @@ void XC::FiberSectionBase::getInteractionDiagramPointsForTheta(NMyMzPointCloud &
         for(double e= eps_agot_A;e>=0.0;e-=inc_eps_A)
           {
             P3= pivots.getAPoint(e);
-            lista_esfuerzos.append(getNMyMz(DeformationPlane(P1,P2,P3)));
+            planes.push_back(DeformationPlane(P1,P2,P3));
           }
         //Domain 4a
         //Compute strain in D when the pivot point is B
@@ -679,7 +732,7 @@ void XC::FiberSectionBase::getInteractionDiagramPointsForTheta(NMyMzPointCloud &
             for(double e= eps_D4a;e>=0.0;e-=inc_eps_D4a)
               {
                 P3= pivots.getDPoint(e);
-                lista_esfuerzos.append(getNMyMz(DeformationPlane(P1,P2,P3)));
+                planes.push_back(DeformationPlane(P1,P2,P3));
               }
           }
         //Domain 5
@@ -690,12 +743,23 @@ void XC::FiberSectionBase::getInteractionDiagramPointsForTheta(NMyMzPointCloud &
         for(double e= 0.0;e>=eps_agot_C;e-=inc_eps_D)
           {
             P3= pivots.getDPoint(e);
-            lista_esfuerzos.append(getNMyMz(DeformationPlane(P1,P2,P3)));
+            planes.push_back(DeformationPlane(P1,P2,P3));
           }
       }
   }
 
 
+//! @brief Returns the points that define the interaction diagram
+//! of the section for an angle \f$\theta\f$ with respect to the z axis.
+void XC::FiberSectionBase::getInteractionDiagramPointsForTheta(NMyMzPointCloud &lista_esfuerzos,const InteractionDiagramData &diag_data,const FiberPtrDeque &fsC,const FiberPtrDeque &fsS,const double &theta)
+  {
+    std::vector<DeformationPlane> planes;
+    getInteractionDiagramPlanesForTheta(planes,diag_data,fsC,fsS,theta);
+    const std::vector<Pos3d> points= getNMyMzPoints(planes,diag_data);
+    for(std::vector<Pos3d>::const_iterator i= points.begin();i!=points.end();i++)
+      lista_esfuerzos.append(*i);
+  }
+
 //! @brief Return the material tags of the fibers.
 std::set<int> XC::FiberSectionBase::getMatTags(void)
   { return this->fibers.getMatTags(); }
@@ -706,10 +770,9 @@ boost::python::list XC::FiberSectionBase::getMatTagsPy(void)
 
 //! @brief Returns the points that define the interaction diagram
 //! on the plane defined by the \f$\theta\f$ angle being passed as parameter.
-const XC::NMPointCloud &XC::FiberSectionBase::getInteractionDiagramPointsForPlane(const InteractionDiagramData &diag_data, const double &theta)
+XC::NMPointCloud XC::FiberSectionBase::getInteractionDiagramPointsForPlane(const InteractionDiagramData &diag_data, const double &theta)
   {
-    static NMPointCloud retval;
-    retval.clear();
+    NMPointCloud retval;
     retval.setThreshold(diag_data.getThreshold());
     const FiberPtrDeque &fsC= sel_mat_tag(diag_data.getConcreteSetName(),diag_data.getConcreteTag())->second;
     if(fsC.empty())
@@ -757,13 +820,15 @@ const XC::NMPointCloud &XC::FiberSectionBase::getInteractionDiagramPointsForPlan
       }
     if(!fsC.empty() && !fsS.empty())
       {
-        static NMyMzPointCloud tmp;
-        tmp.clear();
+        std::vector<DeformationPlane> planes;
+        getInteractionDiagramPlanesForTheta(planes,diag_data,fsC,fsS,theta);
+        getInteractionDiagramPlanesForTheta(planes,diag_data,fsC,fsS,theta+M_PI); //theta+M_PI
+        const std::vector<Pos3d> points= getNMyMzPoints(planes,diag_data);
+        NMyMzPointCloud tmp;
         tmp.setThreshold(diag_data.getThreshold());
-        getInteractionDiagramPointsForTheta(tmp,diag_data,fsC,fsS,theta);
-        getInteractionDiagramPointsForTheta(tmp,diag_data,fsC,fsS,theta+M_PI); //theta+M_PI
+        for(std::vector<Pos3d>::const_iterator i= points.begin();i!=points.end();i++)
+          tmp.append(*i);
         retval= tmp.getNM(theta);
-        revertToStart();
       }
     else
       std::cerr << Color::red << getClassName() << "::" << __FUNCTION__
@@ -773,10 +838,13 @@ const XC::NMPointCloud &XC::FiberSectionBase::getInteractionDiagramPointsForPlan
   }
 
 //! @brief Returns the points that define the interaction diagram of the section.
-const XC::NMyMzPointCloud &XC::FiberSectionBase::getInteractionDiagramPoints(const InteractionDiagramData &diag_data)
+//!
+//! The deformation planes for all the \f$\theta\f$ angles and all the
+//! pivot domains are generated first, then its stress resultants are
+//! computed in parallel (see getNMyMzPoints).
+XC::NMyMzPointCloud XC::FiberSectionBase::getInteractionDiagramPoints(const InteractionDiagramData &diag_data)
   {
-    static NMyMzPointCloud lista_esfuerzos;
-    lista_esfuerzos.clear();
+    NMyMzPointCloud lista_esfuerzos;
     lista_esfuerzos.setThreshold(diag_data.getThreshold());
     const FiberPtrDeque &fsC= sel_mat_tag(diag_data.getConcreteSetName(),diag_data.getConcreteTag())->second;
     if(fsC.empty())
@@ -806,9 +874,12 @@ const XC::NMyMzPointCloud &XC::FiberSectionBase::getInteractionDiagramPoints(con
       }
     if(!fsC.empty() && !fsS.empty())
       {
+        std::vector<DeformationPlane> planes;
         for(double theta= 0.0;theta<2*M_PI;theta+=diag_data.getIncTheta())
-          getInteractionDiagramPointsForTheta(lista_esfuerzos,diag_data,fsC,fsS,theta);
-        revertToStart();
+          getInteractionDiagramPlanesForTheta(planes,diag_data,fsC,fsS,theta);
+        const std::vector<Pos3d> points= getNMyMzPoints(planes,diag_data);
+        for(std::vector<Pos3d>::const_iterator i= points.begin();i!=points.end();i++)
+          lista_esfuerzos.append(*i);
       }
     else
       std::cerr << Color::red << getClassName() << "::" << __FUNCTION__
@@ -817,11 +888,81 @@ const XC::NMyMzPointCloud &XC::FiberSectionBase::getInteractionDiagramPoints(con
     return lista_esfuerzos;
   }
 
+//! @brief Write the binary representation of the argument.
+template <class T>
+static void write_key(std::ostream &os, const T &value)
+  { os.write(reinterpret_cast<const char *>(&value), sizeof value); }
+
+//! @brief Write the size and the characters of the string argument.
+static void write_key(std::ostream &os, const std::string &value)
+  {
+    write_key(os, value.size());
+    os.write(value.data(), value.size());
+  }
+
+//! @brief Return the data that identify the interaction diagram
+//! of the section for the parameters being passed as argument.
+//!
+//! The key contains the diagram parameters and the position, area
+//! and material of each fiber. The materials are identified by its
+//! tag, its class and the stresses that correspond to a set of strains
+//! in the range of the pivot ultimate strains, so any change in its
+//! parameters changes the key. The key is stored in the cache files
+//! and compared when reading them (see InteractionDiagram::readFromCache).
+std::string XC::FiberSectionBase::getInteractionDiagramCacheKey(const InteractionDiagramData &diag_data) const
+  {
+    std::ostringstream os;
+    os << diag_data.getCacheKey();
+    write_key(os, getClassName());
+    write_key(os, fibers.size());
+    const PivotsUltimateStrains &pivots= diag_data.getPivotsUltimateStrains();
+    const double epsMin= 1.1*std::min(pivots.getUltimateStrainBPivot(),pivots.getUltimateStrainCPivot());
+    const double epsMax= 1.1*pivots.getUltimateStrainAPivot();
+    const size_t numSamples= 16;
+    const double incEps= (epsMax-epsMin)/numSamples;
+    for(FiberContainer::const_iterator i= fibers.begin();i!=fibers.end();i++)
+      {
+        const Fiber *f= *i;
+        write_key(os, f->getLocY());
+        write_key(os, f->getLocZ());
+        write_key(os, f->getArea());
+        const UniaxialMaterial *mat= f->getMaterial();
+        write_key(os, mat->getTag());
+        write_key(os, mat->getClassName());
+        UniaxialMaterial *tmp= mat->getCopy();
+        for(size_t j= 0;j<=numSamples;j++)
+          {
+            tmp->setTrialStrain(epsMin+j*incEps);
+            write_key(os, tmp->getStress());
+          }
+        delete tmp;
+      }
+    return os.str();
+  }
+
+//! @brief Return a hash value that identifies the interaction diagram
+//! of the section for the parameters being passed as argument (used
+//! to name the cache file, see getInteractionDiagramCacheKey).
+size_t XC::FiberSectionBase::getInteractionDiagramFingerprint(const InteractionDiagramData &diag_data) const
+  { return boost::hash_value(getInteractionDiagramCacheKey(diag_data)); }
+
 //! @brief Returns the interaction diagram.
+//!
+//! If the persistent cache is enabled (see InteractionDiagram::setCacheDirectory)
+//! the diagram is read from the cache when possible and stored in it
+//! otherwise.
 XC::InteractionDiagram XC::FiberSectionBase::GetInteractionDiagram(const InteractionDiagramData &diag_data)
   {
-    const NMyMzPointCloud lp= getInteractionDiagramPoints(diag_data);
     InteractionDiagram retval;
+    const bool useCache= !InteractionDiagram::getCacheDirectory().empty();
+    std::string cacheKey;
+    if(useCache)
+      {
+        cacheKey= getInteractionDiagramCacheKey(diag_data);
+        if(retval.readFromCache(cacheKey))
+          return retval;
+      }
+    const NMyMzPointCloud lp= getInteractionDiagramPoints(diag_data);
     if(!lp.empty())
       {
         retval= InteractionDiagram(Pos3d(0,0,0),Triang3dMesh(get_convex_hull(lp)));
@@ -831,6 +972,8 @@ XC::InteractionDiagram XC::FiberSectionBase::GetInteractionDiagram(const Interac
 	            << "; error in computation of interaction diagram ("
                     << error << ") seems too big."
 		    << Color::def << std::endl;
+        if(useCache)
+          retval.writeToCache(cacheKey);
       }
     return retval;
   }
@@ -35,6 +35,7 @@
 #include "material/section/fiber_section/fiber/FiberSets.h"
 #include "utility/geom/GeomObj.h"
 #include <material/section/CrossSectionKR.h>
+#include <vector>
 
 class Polygon2d;
 
@@ -87,9 +88,12 @@ class FiberSectionBase: public PrismaticBarCrossSection
     virtual double get_dist_to_neutral_axis(const double &,const double &) const;
     Pos3d Esf2Pos3d(void) const;
     Pos3d getNMyMz(const DeformationPlane &);
+    std::vector<Pos3d> getNMyMzPoints(const std::vector<DeformationPlane> &) const;
+    std::vector<Pos3d> getNMyMzPoints(const std::vector<DeformationPlane> &,const InteractionDiagramData &) const;
+    void getInteractionDiagramPlanesForTheta(std::vector<DeformationPlane> &,const InteractionDiagramData &,const FiberPtrDeque &,const FiberPtrDeque &,const double &) const;
     void getInteractionDiagramPointsForTheta(NMyMzPointCloud &lista_esfuerzos,const InteractionDiagramData &,const FiberPtrDeque &,const FiberPtrDeque &,const double &);
-    const NMyMzPointCloud &getInteractionDiagramPoints(const InteractionDiagramData &);
-    const NMPointCloud &getInteractionDiagramPointsForPlane(const InteractionDiagramData &, const double &);
+    NMyMzPointCloud getInteractionDiagramPoints(const InteractionDiagramData &);
+    NMPointCloud getInteractionDiagramPointsForPlane(const InteractionDiagramData &, const double &);
   public:
     FiberSectionBase(int classTag,int dim,MaterialHandler *mat_ldr= nullptr); 
     FiberSectionBase(int tag, int classTag,int dim,MaterialHandler *mat_ldr= nullptr);
@@ -103,8 +107,20 @@ class FiberSectionBase: public PrismaticBarCrossSection
     virtual void setupFibers(void) = 0;
     inline size_t getNumFibers(void) const
       { return fibers.getNumFibers(); }
+    //! @brief Return the fiber container (the fibers skipped by the
+    //! elastic range bypass are updated first).
     inline FiberContainer &getFibers(void)
-      { return fibers; }
+      {
+        fibers.update_bypassed_fibers();
+        return fibers;
+      }
+    //! @brief Enable or disable the bypass of the fiber updates while
+    //! the section remains elastic (see FiberElasticRange).
+    inline void setElasticRangeBypass(const bool &b)
+      { fibers.setElasticRangeBypass(b); }
+    //! @brief Return true if the bypass of the fiber updates is enabled.
+    inline bool getElasticRangeBypass(void) const
+      { return fibers.getElasticRangeBypass(); }
     virtual Fiber *addFiber(Fiber &)= 0;
     virtual Fiber *addFiber(int tag,const MaterialHandler &,const std::string &nmbMat,const double &, const Vector &position)= 0;
     Fiber *addFiber(const std::string &nmbMat,const double &area,const Vector &coo);
@@ -173,6 +189,8 @@ class FiberSectionBase: public PrismaticBarCrossSection
       { return fibers.getCenterOfMassY(); }
     double getArea(void) const;
 
+    std::string getInteractionDiagramCacheKey(const InteractionDiagramData &) const;
+    size_t getInteractionDiagramFingerprint(const InteractionDiagramData &) const;
     InteractionDiagram GetInteractionDiagram(const InteractionDiagramData &);
     InteractionDiagram2d GetInteractionDiagramForPlane(const InteractionDiagramData &,const double &);
     InteractionDiagram2d GetNMyInteractionDiagram(const InteractionDiagramData &);
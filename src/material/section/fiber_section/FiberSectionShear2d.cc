@@ -128,7 +128,7 @@ void XC::FiberSectionShear2d::clear(void)
 //! @brief Asigna la initial strain.
 int XC::FiberSectionShear2d::setInitialSectionDeformation(const Vector &def)
   {
-    static Vector v(2);
+    static thread_local Vector v(2);
     v(0)= def(0); v(1)= def(1);
     int ret= FiberSection2d::setInitialSectionDeformation(v);
     if(respVy) ret+= respVy->setInitialStrain(def(2));
@@ -138,7 +138,7 @@ int XC::FiberSectionShear2d::setInitialSectionDeformation(const Vector &def)
 //! @brief Asigna la trial strain.
 int XC::FiberSectionShear2d::setTrialSectionDeformation(const Vector &def)
   {
-    static Vector v(2);
+    static thread_local Vector v(2);
     v(0)= def(0); v(1)= def(1);
     int ret= FiberSection2d::setTrialSectionDeformation(v);
     if(respVy) ret+= respVy->setTrialStrain(def(2));
@@ -238,7 +238,7 @@ void XC::FiberSectionShear3d::clear(void)
 //! @brief Asigna la initial strain.
 int XC::FiberSectionShear3d::setInitialSectionDeformation(const Vector &def)
   {
-    static Vector v(3);
+    static thread_local Vector v(3);
     v(0)= def(0); v(1)= def(1); v(2)= def(2);
     int ret= FiberSection3d::setInitialSectionDeformation(v);
     if(respVy) ret+= respVy->setInitialStrain(def(3));
@@ -250,7 +250,7 @@ int XC::FiberSectionShear3d::setInitialSectionDeformation(const Vector &def)
 //! @brief Asigna la trial strain.
 int XC::FiberSectionShear3d::setTrialSectionDeformation(const Vector &def)
   {
-    static Vector v(3);
+    static thread_local Vector v(3);
     v(0)= def(0); v(1)= def(1); v(2)= def(2);
     int ret= FiberSection3d::setTrialSectionDeformation(v);
     if(respVy) ret+= respVy->setTrialStrain(def(3));
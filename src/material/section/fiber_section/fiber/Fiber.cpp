@@ -69,7 +69,32 @@
 
 //! @brief Constructor.
 XC::Fiber::Fiber(int tag, int classTag)
-  : TaggedObject(tag), MovableObject(classTag), dead(false) {}
+  : TaggedObject(tag), MovableObject(classTag), dead(false), ownerVersion(nullptr) {}
+
+//! @brief Copy constructor (the copy has no owner until it is
+//! inserted in a container).
+XC::Fiber::Fiber(const Fiber &other)
+  : TaggedObject(other), MovableObject(other), dead(other.dead), ownerVersion(nullptr) {}
+
+//! @brief Assignment operator (the fiber keeps its owner).
+XC::Fiber &XC::Fiber::operator=(const Fiber &other)
+  {
+    TaggedObject::operator=(other);
+    MovableObject::operator=(other);
+    dead= other.dead;
+    touch();
+    return *this;
+  }
+
+//! @brief Increment the version counter of the container that owns
+//! the fiber; called each time the material, the position or the area
+//! of the fiber changes (so the arrays built from the fibers of
+//! that container are set up again).
+void XC::Fiber::touch(void)
+  {
+    if(ownerVersion)
+      (*ownerVersion)++;
+  }
 
 XC::Response *XC::Fiber::setResponse(const std::vector<std::string> &argv, Information &info)
   { return nullptr; }
@@ -120,6 +145,7 @@ int XC::Fiber::sendData(Communicator &comm)
 //! @brief Receive data through the communicator argument.
 int XC::Fiber::recvData(const Communicator &comm)
   {    
+    touch(); // the material, position and area are replaced.
     setTag(getDbTagDataPos(0));
     dead= static_cast<bool>(getDbTagDataPos(1));
     return 0;
@@ -90,12 +90,20 @@ class Response;
 class Fiber: public TaggedObject, public MovableObject
   {
     bool dead; //!< True if fiber is inactive.
+    size_t *ownerVersion; //!< version counter of the container that owns the fiber (if any).
   protected:
+    void touch(void);
     int sendData(Communicator &);
     int recvData(const Communicator &);
 
   public:
     Fiber(int tag, int classTag);
+    Fiber(const Fiber &);
+    Fiber &operator=(const Fiber &);
+    //! @brief Set the version counter of the container that owns
+    //! the fiber (see FiberPtrDeque::adopt).
+    inline void setOwnerVersion(size_t *v)
+      { ownerVersion= v; }
 
     virtual int setTrialFiberStrain(const Vector &vs)=0;
     virtual Vector &getFiberStressResultants(void) =0;
@@ -30,6 +30,8 @@
 #include "material/section/fiber_section/fiber/Fiber.h"
 #include "material/section/fiber_section/FiberSection2d.h"
 #include "material/section/fiber_section/FiberSection3d.h"
+#include "material/section/fiber_section/FiberSectionGJ.h"
+#include "material/section/CrossSectionKR.h"
 #include "utility/geom/d2/2d_polygons/Polygon2d.h"
 
 //! @brief Allocates memory for each fiber material and for its data;
@@ -44,6 +46,7 @@ void XC::FiberContainer::allocFibers(int numOfFibers,const Fiber *sample)
           for(int i= 0;i<numOfFibers;i++)
 	    {
               (*this)[i]= sample->getCopy();
+              adopt((*this)[i]);
 	      if((*this)[i]==nullptr)
 		{
 		  std::cerr << getClassName() << "::" << __FUNCTION__
@@ -65,6 +68,7 @@ void XC::FiberContainer::copy_fibers(const FiberContainer &other)
         for( size_t i= 0;i<numFibers;i++)
 	  {
             (*this)[i]= other[i]->getCopy();
+            adopt((*this)[i]);
 	    if((*this)[i]==nullptr)
 	      {
 		std::cerr << getClassName() << "::" << __FUNCTION__
@@ -78,6 +82,7 @@ void XC::FiberContainer::copy_fibers(const FiberContainer &other)
 //! @brief frees memory
 void XC::FiberContainer::free_mem(void)
   {
+    stateArena.clear(get_materials()); // the materials are deleted next.
     const size_t numFibers= getNumFibers();
     for( size_t i= 0;i<numFibers;i++)
       if((*this)[i])
@@ -95,13 +100,17 @@ XC::FiberContainer::FiberContainer(const size_t &num)
 //! @brief Copy constructor.
 XC::FiberContainer::FiberContainer(const FiberContainer &other)
   : FiberPtrDeque() //Don't copy pointers
-  { copy_fibers(other); }
+  {
+    copy_fibers(other);
+    setElasticRangeBypass(other.getElasticRangeBypass());
+  }
 
 //! @brief Assignment operator.
 XC::FiberContainer &XC::FiberContainer::operator=(const FiberContainer &other)
   {
     CommandEntity::operator=(other); //Don't copy pointers
     copy_fibers(other); //They are copied here.
+    setElasticRangeBypass(other.getElasticRangeBypass());
     return *this;
   }
 
@@ -114,6 +123,7 @@ void XC::FiberContainer::copy_fibers(const fiber_list &fibers)
     for(fiber_list::const_iterator ifib=fibers.begin();ifib!=fibers.end(); ifib++,i++)
       {
         (*this)[i]= (*ifib)->getCopy();
+        adopt((*this)[i]);
         if(!(*this)[i])
           {
             std::cerr << getClassName() << "::" << __FUNCTION__
@@ -154,6 +164,7 @@ void XC::FiberContainer::setup(FiberSectionGJ &SectionGJ,const fiber_list &fiber
 XC::Fiber *XC::FiberContainer::insert(const Fiber &f)
   {
     Fiber *retval= f.getCopy();
+    adopt(retval);
     push_back(retval);
     return retval;
   }
@@ -183,6 +194,70 @@ XC::Fiber *XC::FiberContainer::addFiber(FiberSectionGJ &SectionGJ,Fiber &newFibe
     return retval;
   }
 
+//! @brief Return the materials of the fibers.
+std::vector<XC::UniaxialMaterial *> XC::FiberContainer::get_materials(void) const
+  {
+    const size_t numFibers= getNumFibers();
+    std::vector<UniaxialMaterial *> retval;
+    retval.reserve(numFibers);
+    for(size_t i= 0;i<numFibers;i++)
+      if((*this)[i])
+        retval.push_back((*this)[i]->getMaterial());
+    return retval;
+  }
+
+//! @brief Return the arena that stores the state of the fiber materials
+//! (set it up if the fibers or its materials have changed).
+XC::MaterialStateArena &XC::FiberContainer::getStateArena(void)
+  {
+    if(!stateArena.isValid(getNumFibers(), fiberVersion))
+      stateArena.setup(get_materials(), fiberVersion);
+    return stateArena;
+  }
+
+//! @brief Commit the state of the fiber materials.
+//!
+//! The fibers skipped by the elastic range bypass are updated first,
+//! then the state of the materials that support it is committed
+//! by copying the trial buffer of the state arena.
+int XC::FiberContainer::commitState(void)
+  {
+    int retval= update_bypassed_fibers();
+    elasticRange.invalidate();
+    retval+= getStateArena().commitState();
+    return retval;
+  }
+
+//! @brief Return the fibers to its last committed state.
+int XC::FiberContainer::revertToLastCommit(FiberSection2d &Section2d,CrossSectionKR &kr2)
+  {
+    kr2.zero();
+    elasticRange.invalidate();
+    int err= getStateArena().revertToLastCommit();
+    err+= updateKRCenterOfMass(Section2d,kr2);
+    return err;
+  }
+
+//! @brief Return the fibers to its last committed state.
+int XC::FiberContainer::revertToLastCommit(FiberSection3d &Section3d,CrossSectionKR &kr3)
+  {
+    kr3.zero();
+    elasticRange.invalidate();
+    int err= getStateArena().revertToLastCommit();
+    err+= updateKRCenterOfMass(Section3d,kr3);
+    return err;
+  }
+
+//! @brief Return the fibers to its last committed state.
+int XC::FiberContainer::revertToLastCommit(FiberSectionGJ &SectionGJ,CrossSectionKR &krGJ)
+  {
+    krGJ.zero();
+    elasticRange.invalidate();
+    int err= getStateArena().revertToLastCommit();
+    err+= updateKRCenterOfMass(SectionGJ,krGJ);
+    return err;
+  }
+
 //! @brief Destructor.
 XC::FiberContainer::~FiberContainer(void)
   { free_mem(); }
@@ -32,6 +32,7 @@
 
 #include "FiberPtrDeque.h"
 #include <material/section/repres/section/fiber_list.h>
+#include "material/MaterialStateArena.h"
 
 namespace XC {
 
@@ -40,7 +41,11 @@ namespace XC {
 //! @brief Fiber container.
 class FiberContainer: public FiberPtrDeque
   {
+    MaterialStateArena stateArena; //!< contiguous storage for the state of the fiber materials.
+
     void free_mem(void);
+    std::vector<UniaxialMaterial *> get_materials(void) const;
+    MaterialStateArena &getStateArena(void);
     void copy_fibers(const FiberContainer &);
     void copy_fibers(const fiber_list &);
 
@@ -59,6 +64,11 @@ class FiberContainer: public FiberPtrDeque
     void setup(FiberSection2d &,const fiber_list &,CrossSectionKR &);
     void setup(FiberSection3d &,const fiber_list &,CrossSectionKR &);
     void setup(FiberSectionGJ &,const fiber_list &,CrossSectionKR &);
+
+    int commitState(void);
+    int revertToLastCommit(FiberSection2d &,CrossSectionKR &);
+    int revertToLastCommit(FiberSection3d &,CrossSectionKR &);
+    int revertToLastCommit(FiberSectionGJ &,CrossSectionKR &);
     ~FiberContainer(void);
   };
 } // end of XC namespace
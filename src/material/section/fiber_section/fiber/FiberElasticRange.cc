@@ -0,0 +1,187 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis C. Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//FiberElasticRange.cc
+
+#include "FiberElasticRange.h"
+#include "FiberSoA.h"
+#include "material/uniaxial/UniaxialMaterial.h"
+#include <algorithm>
+#include <cfloat>
+
+//! @brief Constructor.
+XC::FiberElasticRange::FiberElasticRange(void)
+  : enabled(false), bounds(UNKNOWN), active(false), bypassed(false)
+  {
+    std::fill(defRef, defRef+3, 0.0);
+    std::fill(kRef, kRef+6, 0.0);
+    std::fill(rRef, rRef+3, 0.0);
+    std::fill(defLast, defLast+3, 0.0);
+  }
+
+//! @brief Copy constructor.
+//!
+//! The bounds correspond to the fibers of the copied container so
+//! they are not copied.
+XC::FiberElasticRange::FiberElasticRange(const FiberElasticRange &other)
+  : FiberElasticRange()
+  { enabled= other.enabled; }
+
+//! @brief Assignment operator (the bounds must be computed again).
+XC::FiberElasticRange &XC::FiberElasticRange::operator=(const FiberElasticRange &other)
+  {
+    clear();
+    enabled= other.enabled;
+    return *this;
+  }
+
+//! @brief Enable or disable the bypass of the fiber updates.
+void XC::FiberElasticRange::setEnabled(const bool &b)
+  {
+    enabled= b;
+    if(!enabled)
+      invalidate();
+  }
+
+//! @brief Invalidate the tracker and release the memory of the bounds.
+void XC::FiberElasticRange::clear(void)
+  {
+    invalidate();
+    strainMin.clear();
+    strainMax.clear();
+  }
+
+//! @brief Invalidate the bounds and the reference response (to call
+//! when the state of the fiber materials is committed or reverted).
+void XC::FiberElasticRange::invalidate(void)
+  {
+    bounds= UNKNOWN;
+    active= false;
+    bypassed= false;
+  }
+
+//! @brief Compute the strain bounds of the fibers from the committed
+//! state of its materials.
+//!
+//! The fibers with zero area don't contribute to the section response
+//! so they are not bounded.
+void XC::FiberElasticRange::compute_bounds(const FiberSoA &fibers)
+  {
+    const size_t numFibers= fibers.size();
+    const std::vector<UniaxialMaterial *> &materials= fibers.getMaterials();
+    const std::vector<double> &area= fibers.getArea();
+    strainMin.resize(numFibers);
+    strainMax.resize(numFibers);
+    bounds= AVAILABLE;
+    for(size_t i= 0;i<numFibers;i++)
+      {
+        if(area[i]==0.0)
+          {
+            strainMin[i]= -DBL_MAX;
+            strainMax[i]= DBL_MAX;
+          }
+        else if(!materials[i]->getLinearRange(strainMin[i], strainMax[i]))
+          {
+            bounds= NOT_AVAILABLE;
+            break;
+          }
+      }
+  }
+
+//! @brief Return true if the strains that correspond to the
+//! deformation argument are inside the bounds of all the fibers.
+//!
+//! @param def: section deformation (e0, ky, kz).
+bool XC::FiberElasticRange::in_bounds(const FiberSoA &fibers, const double def[3]) const
+  {
+    const size_t numFibers= fibers.size();
+    const double *py= fibers.getY().data();
+    const double *pz= fibers.getZ().data();
+    const double *pmin= strainMin.data();
+    const double *pmax= strainMax.data();
+    const double e0= def[0], ky= def[1], kz= def[2];
+    int numOutside= 0;
+#pragma omp simd reduction(+:numOutside)
+    for(size_t i= 0;i<numFibers;i++)
+      {
+        const double e= e0+py[i]*ky+pz[i]*kz;
+        numOutside+= ((e<pmin[i]) || (e>pmax[i]));
+      }
+    return (numOutside==0);
+  }
+
+//! @brief Return true if the reference response is available and
+//! the deformation argument is inside the elastic range.
+//!
+//! @param def: section deformation (e0, ky, kz).
+bool XC::FiberElasticRange::contains(const FiberSoA &fibers, const double def[3]) const
+  { return (active && in_bounds(fibers, def)); }
+
+//! @brief Store the response of the section computed by a full
+//! update of the fibers as reference, if all the fibers are inside
+//! its linear range.
+//!
+//! @param def: section deformation (e0, ky, kz).
+//! @param k: section stiffness (EA, EAy, EAz, EAyy, EAyz, EAzz).
+//! @param r: stress resultant (N, Mz, My).
+void XC::FiberElasticRange::setReference(const FiberSoA &fibers, const double def[3], const double k[6], const double r[3])
+  {
+    active= false;
+    bypassed= false;
+    if(!enabled)
+      return;
+    if(bounds==UNKNOWN)
+      compute_bounds(fibers);
+    if(bounds==AVAILABLE)
+      {
+        active= in_bounds(fibers, def);
+        if(active)
+          {
+            std::copy(def, def+3, defRef);
+            std::copy(k, k+6, kRef);
+            std::copy(r, r+3, rRef);
+          }
+      }
+  }
+
+//! @brief Compute the section response from the reference values
+//! (the deformation must be inside the range, see contains).
+//!
+//! @param def: section deformation (e0, ky, kz).
+//! @param k: section stiffness (EA, EAy, EAz, EAyy, EAyz, EAzz).
+//! @param r: stress resultant (N, Mz, My).
+void XC::FiberElasticRange::getLinearResponse(const double def[3], double k[6], double r[3])
+  {
+    const double d0= def[0]-defRef[0];
+    const double d1= def[1]-defRef[1];
+    const double d2= def[2]-defRef[2];
+    std::copy(kRef, kRef+6, k);
+    r[0]= rRef[0]+kRef[0]*d0+kRef[1]*d1+kRef[2]*d2;
+    r[1]= rRef[1]+kRef[1]*d0+kRef[3]*d1+kRef[4]*d2;
+    r[2]= rRef[2]+kRef[2]*d0+kRef[4]*d1+kRef[5]*d2;
+    std::copy(def, def+3, defLast);
+    bypassed= true;
+  }
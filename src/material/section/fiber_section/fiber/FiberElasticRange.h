@@ -0,0 +1,114 @@
+// -*-c++-*-
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis C. Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//FiberElasticRange.h
+
+#ifndef FiberElasticRange_h
+#define FiberElasticRange_h
+
+#include <vector>
+#include <cstddef>
+
+namespace XC {
+class FiberSoA;
+
+//! @ingroup MATSCCFibers
+//
+//! @brief Tracks the range of section deformations for which all the
+//! fibers of a section remain in the linear range of its materials.
+//!
+//! After each full update of the fibers, if all of them are inside
+//! the linear range of its materials (see
+//! UniaxialMaterial::getLinearRange) the section stiffness and stress
+//! resultant are stored as reference. While the following trial
+//! deformations keep all the fiber strains inside those bounds the
+//! section response is obtained from the reference values:
+//! \f[
+//! r= r_{ref}+K_{ref}(e-e_{ref})
+//! \f]
+//! without updating the fiber materials. The fibers are updated with
+//! the last trial deformation before committing its state
+//! (see FiberPtrDeque::update_bypassed_fibers).
+//!
+//! The bypass is disabled by default: while it's active the state of
+//! the fiber materials doesn't correspond to the trial deformation of
+//! the section (the fibers are updated before committing and when they
+//! are retrieved with FiberSectionBase::getFibers).
+//!
+//! The strain bounds depend on the committed state of the materials
+//! so they must be invalidated each time the state is committed or
+//! reverted. The deformation and stiffness terms are stored in the 3D
+//! layout: (e0, ky, kz) and (EA, EAy, EAz, EAyy, EAyz, EAzz); plane
+//! sections use kz= 0.
+class FiberElasticRange
+  {
+  private:
+    //! @brief State of the fiber strain bounds.
+    enum bounds_state {UNKNOWN, NOT_AVAILABLE, AVAILABLE};
+    bool enabled; //!< if true, skip the fiber updates while the section remains elastic.
+    bounds_state bounds; //!< state of the fiber strain bounds.
+    bool active; //!< true if the reference response is available.
+    bool bypassed; //!< true if the fibers were not updated with the last trial deformation.
+    std::vector<double> strainMin; //!< lower strain bound for each fiber.
+    std::vector<double> strainMax; //!< upper strain bound for each fiber.
+    double defRef[3]; //!< reference deformation.
+    double kRef[6]; //!< reference stiffness.
+    double rRef[3]; //!< reference stress resultant.
+    double defLast[3]; //!< last bypassed trial deformation.
+
+    void compute_bounds(const FiberSoA &);
+    bool in_bounds(const FiberSoA &, const double def[3]) const;
+  public:
+    FiberElasticRange(void);
+    FiberElasticRange(const FiberElasticRange &);
+    FiberElasticRange &operator=(const FiberElasticRange &);
+
+    //! @brief Return true if the bypass of the fiber updates is enabled.
+    inline bool isEnabled(void) const
+      { return enabled; }
+    void setEnabled(const bool &);
+    void clear(void);
+    void invalidate(void);
+    bool contains(const FiberSoA &, const double def[3]) const;
+    void setReference(const FiberSoA &, const double def[3], const double k[6], const double r[3]);
+    void getLinearResponse(const double def[3], double k[6], double r[3]);
+    //! @brief Return true if the fibers were not updated with the
+    //! last trial deformation.
+    inline bool isBypassed(void) const
+      { return bypassed; }
+    //! @brief Return the last trial deformation that was not
+    //! transmitted to the fibers.
+    inline const double *getLastDeformation(void) const
+      { return defLast; }
+    //! @brief Mark the fibers as updated.
+    inline void setUpdated(void)
+      { bypassed= false; }
+  };
+
+} // end of XC namespace
+
+#endif
@@ -56,12 +56,12 @@
 
 //! @brief Constructor.
 XC::FiberPtrDeque::FiberPtrDeque(const size_t &num)
-  : CommandEntity(), fiber_ptrs_dq(num,static_cast<Fiber *>(nullptr)), MovableObject(0), yCenterOfMass(0.0), zCenterOfMass(0.0)
+  : CommandEntity(), fiber_ptrs_dq(num,static_cast<Fiber *>(nullptr)), MovableObject(0), yCenterOfMass(0.0), zCenterOfMass(0.0), fiberVersion(0)
   {}
 
 //! @brief Copy constructor.
 XC::FiberPtrDeque::FiberPtrDeque(const FiberPtrDeque &other)
-  : CommandEntity(other), fiber_ptrs_dq(other), MovableObject(other), yCenterOfMass(other.yCenterOfMass), zCenterOfMass(other.zCenterOfMass)
+  : CommandEntity(other), fiber_ptrs_dq(other), MovableObject(other), yCenterOfMass(other.yCenterOfMass), zCenterOfMass(other.zCenterOfMass), fiberVersion(0), elasticRange(other.elasticRange)
   {}
 
 //! @brief Assignment operator.
@@ -72,12 +72,74 @@ XC::FiberPtrDeque &XC::FiberPtrDeque::operator=(const FiberPtrDeque &other)
     MovableObject::operator=(other);
     yCenterOfMass= other.yCenterOfMass;
     zCenterOfMass= other.zCenterOfMass;
+    soa.clear();
+    elasticRange= other.elasticRange;
     return *this;
   }
 
+//! @brief Make the fiber argument report its changes (material,
+//! position or area) to this container (see Fiber::touch).
+void XC::FiberPtrDeque::adopt(Fiber *f)
+  {
+    if(f)
+      f->setOwnerVersion(&fiberVersion);
+    fiberVersion++;
+  }
+
 //! @brief Adds the fiber to the container.
 void XC::FiberPtrDeque::push_back(Fiber *f)
-   { fiber_ptrs_dq::push_back(f); }
+   {
+     soa.clear();
+     fiber_ptrs_dq::push_back(f);
+   }
+
+//! @brief Removes all the fibers from the container.
+void XC::FiberPtrDeque::clear(void)
+   {
+     soa.clear();
+     fiber_ptrs_dq::clear();
+   }
+
+//! @brief Enable or disable the bypass of the fiber updates while
+//! the section remains in its elastic range (see FiberElasticRange).
+void XC::FiberPtrDeque::setElasticRangeBypass(const bool &b)
+  {
+    update_bypassed_fibers();
+    elasticRange.setEnabled(b);
+  }
+
+//! @brief Return true if the bypass of the fiber updates while
+//! the section remains in its elastic range is enabled.
+bool XC::FiberPtrDeque::getElasticRangeBypass(void) const
+  { return elasticRange.isEnabled(); }
+
+//! @brief Return the structure of arrays representation of the
+//! fibers, building it if needed.
+XC::FiberSoA &XC::FiberPtrDeque::getSoA(void)
+  {
+    if(!soa.isValid(size(), fiberVersion))
+      {
+        soa.setup(*this, fiberVersion);
+        elasticRange.clear();
+      }
+    return soa;
+  }
+
+//! @brief Update the fiber materials with the last trial deformation
+//! if they were skipped because the section was in its elastic range
+//! (see FiberElasticRange).
+int XC::FiberPtrDeque::update_bypassed_fibers(void)
+  {
+    int retval= 0;
+    if(elasticRange.isBypassed())
+      {
+        const double *def= elasticRange.getLastDeformation();
+        soa.computeStrains(def[0],def[1],def[2]);
+        retval= soa.setTrial(false);
+        elasticRange.setUpdated();
+      }
+    return retval;
+  }
 
 
 //! @brief Search for the fiber identified by the parameter.
@@ -1763,7 +1825,8 @@ int XC::FiberPtrDeque::updateKRCenterOfMass(FiberSection2d &Section2d,CrossSecti
 //! @brief Commit the state of the material.
 int XC::FiberPtrDeque::commitState(void)
   {
-    int err= 0;
+    int err= update_bypassed_fibers();
+    elasticRange.invalidate();
     std::deque<Fiber *>::iterator i= begin();
     for(;i!= end();i++)
       err+= (*i)->commitState();
@@ -1773,6 +1836,7 @@ int XC::FiberPtrDeque::commitState(void)
 //! @brief Sets initial strains values.
 int XC::FiberPtrDeque::setInitialSectionDeformation(const FiberSection2d &Section2d)
   {
+    elasticRange.invalidate();
     int retval= 0;
     UniaxialMaterial *theMat;
     double y; 
@@ -1790,30 +1854,29 @@ int XC::FiberPtrDeque::setInitialSectionDeformation(const FiberSection2d &Sectio
 //! @brief Sets trial strains values.
 int XC::FiberPtrDeque::setTrialSectionDeformation(const FiberSection2d &Section2d,CrossSectionKR &kr2)
   {
-    int retval= 0;
     kr2.zero();
-    UniaxialMaterial *theMat;
-    double y,fiberArea,strain,tangent,stress, fs0; 
-    std::deque<Fiber *>::iterator i= begin();
-    for(;i!= end();i++)
+    FiberSoA &fibers= getSoA();
+    const Vector &def= Section2d.getSectionDeformation();
+    const double d[3]= {def(0),def(1),0.0};
+    int retval= 0;
+    double k[6], r[3];
+    if(elasticRange.contains(fibers,d)) // all the fibers remain elastic.
+      elasticRange.getLinearResponse(d,k,r);
+    else
       {
-        theMat= (*i)->getMaterial();
-        y= (*i)->getLocY();
-        fiberArea= (*i)->getArea();
-        if(fiberArea!=0.0)
-          {
-            // determine material strain and set it
-            strain= Section2d.get_strain(y);
-            retval+= theMat->setTrial(strain, stress, tangent);
+        fibers.computeStrains(d[0],d[1],d[2]);
+        retval= fibers.setTrial(true);
 
-            //Updating stiffness matrix.
-            kr2.updateK2d(fiberArea,y,tangent);
-
-            //Updating stress resultant.
-            fs0= stress * fiberArea;
-            kr2.updateNMz(fs0,y);
-          }
+        // Update stiffness matrix and stress resultant.
+        double k2[3];
+        fibers.integrate2d(k2,r);
+        k[0]= k2[0]; k[1]= k2[1]; k[2]= 0.0;
+        k[3]= k2[2]; k[4]= 0.0; k[5]= 0.0;
+        r[2]= 0.0;
+        elasticRange.setReference(fibers,d,k,r);
       }
+    kr2.kData[0]= k[0]; kr2.kData[1]= k[1]; kr2.kData[3]= k[3];
+    kr2.rData[0]= r[0]; kr2.rData[1]= r[1];
     kr2.kData[2]= kr2.kData[1]; //Symmetry.
     return retval;
   }
@@ -1821,6 +1884,7 @@ int XC::FiberPtrDeque::setTrialSectionDeformation(const FiberSection2d &Section2
 //! @brief Return the fibers to its last committed state.
 int XC::FiberPtrDeque::revertToLastCommit(FiberSection2d &Section2d,CrossSectionKR &kr2)
   {
+    elasticRange.invalidate();
     int err= 0;
     kr2.zero();
     std::deque<Fiber *>::iterator i= begin();
@@ -1833,6 +1897,7 @@ int XC::FiberPtrDeque::revertToLastCommit(FiberSection2d &Section2d,CrossSection
 //! @brief Return the fibers to its initial state.
 int XC::FiberPtrDeque::revertToStart(FiberSection2d &Section2d,CrossSectionKR &kr2)
   {
+    elasticRange.invalidate();
     int err= 0;
     kr2.zero();
     std::deque<Fiber *>::iterator i= begin();
@@ -1955,6 +2020,7 @@ int XC::FiberPtrDeque::updateKRCenterOfMass(FiberSection3d &Section3d,CrossSecti
 //! @brief Set the initial strains.
 int XC::FiberPtrDeque::setInitialSectionDeformation(const FiberSection3d &Section3d)
   {
+    elasticRange.invalidate();
     int retval= 0;
     UniaxialMaterial *theMat;
     double y,z; 
@@ -1973,31 +2039,26 @@ int XC::FiberPtrDeque::setInitialSectionDeformation(const FiberSection3d &Sectio
 //! @brief Set the trial strains.
 int XC::FiberPtrDeque::setTrialSectionDeformation(FiberSection3d &Section3d,CrossSectionKR &kr3)
   {
-    int retval= 0;
     kr3.zero();
-    std::deque<Fiber *>::iterator i= begin();
-    UniaxialMaterial *theMat;
-    double y,z,fiberArea,tangent,stress, fs0; 
-    for(;i!= end();i++)
+    FiberSoA &fibers= getSoA();
+    const Vector &def= Section3d.getSectionDeformation();
+    const double d[3]= {def(0),def(1),def(2)};
+    int retval= 0;
+    double k[6], r[3];
+    if(elasticRange.contains(fibers,d)) // all the fibers remain elastic.
+      elasticRange.getLinearResponse(d,k,r);
+    else
       {
-        theMat= (*i)->getMaterial();
-        y= (*i)->getLocY();
-        z= (*i)->getLocZ();
+        fibers.computeStrains(d[0],d[1],d[2]);
+        retval= fibers.setTrial(false);
 
-        // determine material strain and set it
-        retval+= theMat->setTrial(Section3d.get_strain(y,z), stress, tangent);
-
-        //Updating stiffness matrix.
-        fiberArea= (*i)->getArea();
-        if(fiberArea!=0.0)
-          {
-            kr3.updateK3d(fiberArea,y,z,tangent);
-
-            //Updating stress resultant.
-            fs0= stress * fiberArea;
-            kr3.updateNMzMy(fs0,y,z);
-          }
+        // Update stiffness matrix and stress resultant.
+        fibers.integrate3d(k,r);
+        elasticRange.setReference(fibers,d,k,r);
       }
+    kr3.kData[0]= k[0]; kr3.kData[1]= k[1]; kr3.kData[2]= k[2];
+    kr3.kData[4]= k[3]; kr3.kData[5]= k[4]; kr3.kData[8]= k[5];
+    kr3.rData[0]= r[0]; kr3.rData[1]= r[1]; kr3.rData[2]= r[2];
     kr3.kData[3]= kr3.kData[1]; //Stiffness matrix symmetry.
     kr3.kData[6]= kr3.kData[2];
     kr3.kData[7]= kr3.kData[5];
@@ -2007,6 +2068,7 @@ int XC::FiberPtrDeque::setTrialSectionDeformation(FiberSection3d &Section3d,Cros
 //! @brief Returns to the last committed state.
 int XC::FiberPtrDeque::revertToLastCommit(FiberSection3d &Section3d,CrossSectionKR &kr3)
   {
+    elasticRange.invalidate();
     int err= 0;
     kr3.zero();
     std::deque<Fiber *>::iterator i= begin();
@@ -2020,6 +2082,7 @@ int XC::FiberPtrDeque::revertToLastCommit(FiberSection3d &Section3d,CrossSection
 int XC::FiberPtrDeque::revertToStart(FiberSection3d &Section3d,CrossSectionKR &kr3)
   {
     // revert the fibers to start
+    elasticRange.invalidate();
     int err= 0;
     kr3.zero();
     std::deque<Fiber *>::iterator i= begin();
@@ -2115,6 +2178,7 @@ int XC::FiberPtrDeque::updateKRCenterOfMass(FiberSectionGJ &SectionGJ,CrossSecti
 //! @brief Set the initial strains.
 int XC::FiberPtrDeque::setInitialSectionDeformation(const FiberSectionGJ &SectionGJ)
   {
+    elasticRange.invalidate();
     int retval= 0;
     UniaxialMaterial *theMat;
     double y,z; 
@@ -2133,43 +2197,43 @@ int XC::FiberPtrDeque::setInitialSectionDeformation(const FiberSectionGJ &Sectio
 //! @brief Sets generalized trial strains values.
 int XC::FiberPtrDeque::setTrialSectionDeformation(FiberSectionGJ &SectionGJ,CrossSectionKR &krGJ)
   {
-    int retval= 0;
     krGJ.zero();
-    UniaxialMaterial *theMat;
-    double y,z,fiberArea,tangent,stress, fs0; 
-    std::deque<Fiber *>::iterator i= begin();
-    for(;i!= end();i++)
+    FiberSoA &fibers= getSoA();
+    const Vector &def= SectionGJ.getSectionDeformation();
+    const double d[3]= {def(0),def(1),def(2)};
+    int retval= 0;
+    double k[6], r[3];
+    if(elasticRange.contains(fibers,d)) // all the fibers remain elastic.
+      elasticRange.getLinearResponse(d,k,r);
+    else
       {
-        theMat= (*i)->getMaterial();
-        y= (*i)->getLocY();
-        z= (*i)->getLocZ();
-        fiberArea= (*i)->getArea();
+        fibers.computeStrains(d[0],d[1],d[2]);
+        retval= fibers.setTrial(true);
 
-        if(fiberArea!=0.0)
-          {
-            // determine material strain and set it
-            retval= theMat->setTrial(SectionGJ.get_strain(y,z), stress, tangent);
-
-            //Updating stiffness matrix.
-            krGJ.updateKGJ(fiberArea,y,z,tangent);
-
-            //Updating stress resultant.
-            fs0= stress * fiberArea;
-            krGJ.updateNMzMy(fs0,y,z);
-	  }
+        // Update stiffness matrix and stress resultant.
+        fibers.integrate3d(k,r);
+        elasticRange.setReference(fibers,d,k,r);
       }
+    krGJ.kData[0]= k[0]; //(0,0)->0
+    krGJ.kData[1]= k[1]; //(0,1)->4 y (1,0)->1
+    krGJ.kData[2]= k[2]; //(0,2)->8 y (2,0)->2
+    krGJ.kData[5]= k[3]; //(1,1)->5
+    krGJ.kData[6]= k[4]; //(1,2)->9 y (2,1)->6
+    krGJ.kData[10]= k[5]; //(2,2)->10
+    krGJ.rData[0]= r[0]; krGJ.rData[1]= r[1]; krGJ.rData[2]= r[2];
     krGJ.kData[4]= krGJ.kData[1]; //Stiffness matrix symmetry.
     krGJ.kData[8]= krGJ.kData[2];
     krGJ.kData[9]= krGJ.kData[6];
     krGJ.kData[15]= SectionGJ.GJ(); //(3,3)->15 //The remaining six elements of krGJ.kData are zero.
 
-    krGJ.rData[3]= SectionGJ.GJ()*SectionGJ.getSectionDeformation()(3); //Torsion.
+    krGJ.rData[3]= SectionGJ.GJ()*def(3); //Torsion.
     return retval;
   }
 
 //! @brief Returns to the last committed state.
 int XC::FiberPtrDeque::revertToLastCommit(FiberSectionGJ &SectionGJ,CrossSectionKR &krGJ)
   {
+    elasticRange.invalidate();
     int err= 0;
     krGJ.zero();
     std::deque<Fiber *>::iterator i= begin();
@@ -2183,6 +2247,7 @@ int XC::FiberPtrDeque::revertToLastCommit(FiberSectionGJ &SectionGJ,CrossSection
 int XC::FiberPtrDeque::revertToStart(FiberSectionGJ &SectionGJ,CrossSectionKR &krGJ)
   {
     // revert the fibers to start
+    elasticRange.invalidate();
     int err= 0;
     krGJ.zero();
     std::deque<Fiber *>::iterator i= begin();
@@ -2583,6 +2648,7 @@ int XC::FiberPtrDeque::sendData(Communicator &comm)
 //! @brief Receives object through the communicator argument.
 int XC::FiberPtrDeque::recvData(const Communicator &comm)
   {
+    soa.clear(); // the fibers are replaced.
     int res= comm.receiveDoubles(yCenterOfMass,zCenterOfMass,getDbTagData(),CommMetaData(0));
     res+= receiveDeque(*this,comm,getDbTagData(),CommMetaData(1),&FEM_ObjectBroker::getNewFiber);
     std::clog << Color::yellow << getClassName() << "::" << __FUNCTION__
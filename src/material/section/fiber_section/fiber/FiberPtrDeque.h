@@ -33,6 +33,8 @@
 #include "utility/kernel/CommandEntity.h"
 #include "utility/geom/GeomObj.h"
 #include "utility/actor/actor/MovableObject.h"
+#include "FiberSoA.h"
+#include "FiberElasticRange.h"
 #include <deque>
 
 class Ref3d3d;
@@ -81,9 +83,19 @@ class FiberPtrDeque: public CommandEntity, public std::deque<Fiber *>, public Mo
     mutable std::deque<std::list<Polygon2d> > dq_ac_effective; //!< (Where appropriate) effective concrete areas for each fiber.
     mutable std::deque<double> recubs; //! Cover for each fiber.
     mutable std::deque<double> seps; //! Spacing for each fiber.
+    size_t fiberVersion; //!< incremented each time an owned fiber changes its material, position or area.
+    FiberSoA soa; //!< structure of arrays representation of the fibers.
+    FiberElasticRange elasticRange; //!< elastic range of the section.
+
+    void adopt(Fiber *);
+    FiberSoA &getSoA(void);
+    int update_bypassed_fibers(void);
 
     inline void resize(const size_t &nf)
-      { fiber_ptrs_dq::resize(nf,nullptr); }
+      {
+        soa.clear();
+        fiber_ptrs_dq::resize(nf,nullptr);
+      }
 
     inline reference operator[](const size_t &i)
       { return fiber_ptrs_dq::operator[](i); }
@@ -97,6 +109,9 @@ class FiberPtrDeque: public CommandEntity, public std::deque<Fiber *>, public Mo
     
   public:
     void push_back(Fiber *f);
+    void clear(void);
+    void setElasticRangeBypass(const bool &);
+    bool getElasticRangeBypass(void) const;
     inline size_t getNumFibers(void) const
       { return size(); }
     
@@ -0,0 +1,214 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis C. Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//FiberSoA.cc
+
+#include "FiberSoA.h"
+#include "material/section/fiber_section/fiber/Fiber.h"
+#include "material/uniaxial/UniaxialMaterial.h"
+#include <algorithm>
+#include <numeric>
+#include <typeindex>
+
+//! @brief Constructor.
+XC::FiberSoA::FiberSoA(void)
+  : valid(false), fiberVersion(0) {}
+
+//! @brief Copy constructor.
+//!
+//! The arrays point to the fibers of the copied container so they
+//! are not copied, the new object must be set up again.
+XC::FiberSoA::FiberSoA(const FiberSoA &)
+  : valid(false), fiberVersion(0) {}
+
+//! @brief Assignment operator (the arrays must be set up again).
+XC::FiberSoA &XC::FiberSoA::operator=(const FiberSoA &)
+  {
+    clear();
+    return *this;
+  }
+
+//! @brief Invalidate the arrays and release its memory.
+void XC::FiberSoA::clear(void)
+  {
+    valid= false;
+    fibers.clear();
+    materials.clear();
+    y.clear();
+    z.clear();
+    area.clear();
+    strain.clear();
+    stress.clear();
+    tangent.clear();
+    groups.clear();
+  }
+
+//! @brief Fill the arrays from the fiber container argument.
+//!
+//! @param fiberPtrs: fibers of the container.
+//! @param v: version of the container (see isValid).
+void XC::FiberSoA::setup(const std::deque<Fiber *> &fiberPtrs, const size_t &v)
+  {
+    const size_t numFibers= fiberPtrs.size();
+    // Sort the fibers by the type of its material, keeping its order
+    // inside each group. Fibers with zero area go last.
+    typedef std::pair<bool, std::type_index> group_key;
+    std::vector<group_key> keys;
+    keys.reserve(numFibers);
+    for(size_t i= 0;i<numFibers;i++)
+      {
+        const Fiber *f= fiberPtrs[i];
+        keys.push_back(group_key(f->getArea()==0.0, std::type_index(typeid(*f->getMaterial()))));
+      }
+    std::vector<size_t> order(numFibers);
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [&keys](const size_t &a, const size_t &b) { return keys[a]<keys[b]; });
+
+    fibers.resize(numFibers);
+    materials.resize(numFibers);
+    y.resize(numFibers);
+    z.resize(numFibers);
+    area.resize(numFibers);
+    strain.assign(numFibers, 0.0);
+    stress.assign(numFibers, 0.0);
+    tangent.assign(numFibers, 0.0);
+    groups.clear();
+    for(size_t i= 0;i<numFibers;i++)
+      {
+        Fiber *f= fiberPtrs[order[i]];
+        fibers[i]= f;
+        materials[i]= f->getMaterial();
+        f->getFiberLocation(y[i], z[i]);
+        area[i]= f->getArea();
+        if((i==0) || (keys[order[i]]!=keys[order[i-1]]))
+          groups.push_back(MaterialGroup{materials[i]->getClassTag(), keys[order[i]].first, i, i+1});
+        else
+          groups.back().end= i+1;
+      }
+    fiberVersion= v;
+    valid= true;
+  }
+
+//! @brief Compute the fiber strains from the deformation plane
+//! strain= e0 + y*ky + z*kz.
+void XC::FiberSoA::computeStrains(const double &e0, const double &ky, const double &kz)
+  {
+    const size_t numFibers= size();
+    const double *py= y.data();
+    const double *pz= z.data();
+    double *pe= strain.data();
+#pragma omp simd
+    for(size_t i= 0;i<numFibers;i++)
+      pe[i]= e0+py[i]*ky+pz[i]*kz;
+  }
+
+//! @brief Set the trial strains of the fiber materials and store the
+//! resulting stresses and tangents.
+//!
+//! @param skipZeroArea: if true, don't update the materials of the fibers
+//!                      with zero area (their contribution is zero).
+int XC::FiberSoA::setTrial(const bool &skipZeroArea)
+  {
+    int retval= 0;
+    for(std::vector<MaterialGroup>::const_iterator ig= groups.begin();ig!=groups.end();ig++)
+      {
+        const size_t b= ig->begin;
+        const size_t n= ig->end-b;
+        if(skipZeroArea && ig->zeroArea)
+          {
+            std::fill(stress.begin()+b, stress.begin()+ig->end, 0.0);
+            std::fill(tangent.begin()+b, tangent.begin()+ig->end, 0.0);
+          }
+        else
+          retval+= materials[b]->setTrialBatch(n, &materials[b], &strain[b], &stress[b], &tangent[b]);
+      }
+    return retval;
+  }
+
+//! @brief Integrate the stiffness and the stress resultant of a plane
+//! section.
+//!
+//! @param k: stiffness terms (EA, EAy, EAyy).
+//! @param r: stress resultant (N, Mz).
+void XC::FiberSoA::integrate2d(double k[3], double r[2]) const
+  {
+    const size_t numFibers= size();
+    const double *py= y.data();
+    const double *pa= area.data();
+    const double *ps= stress.data();
+    const double *pt= tangent.data();
+    double k0= 0.0, k1= 0.0, k2= 0.0, r0= 0.0, r1= 0.0;
+#pragma omp simd reduction(+:k0,k1,k2,r0,r1)
+    for(size_t i= 0;i<numFibers;i++)
+      {
+        const double ka= pt[i]*pa[i];
+        const double kay= ka*py[i];
+        const double f= ps[i]*pa[i];
+        k0+= ka;
+        k1+= kay;
+        k2+= kay*py[i];
+        r0+= f;
+        r1+= f*py[i];
+      }
+    k[0]= k0; k[1]= k1; k[2]= k2;
+    r[0]= r0; r[1]= r1;
+  }
+
+//! @brief Integrate the stiffness and the stress resultant of a 3D
+//! section.
+//!
+//! @param k: stiffness terms (EA, EAy, EAz, EAyy, EAyz, EAzz).
+//! @param r: stress resultant (N, Mz, My).
+void XC::FiberSoA::integrate3d(double k[6], double r[3]) const
+  {
+    const size_t numFibers= size();
+    const double *py= y.data();
+    const double *pz= z.data();
+    const double *pa= area.data();
+    const double *ps= stress.data();
+    const double *pt= tangent.data();
+    double k0= 0.0, k1= 0.0, k2= 0.0, k3= 0.0, k4= 0.0, k5= 0.0;
+    double r0= 0.0, r1= 0.0, r2= 0.0;
+#pragma omp simd reduction(+:k0,k1,k2,k3,k4,k5,r0,r1,r2)
+    for(size_t i= 0;i<numFibers;i++)
+      {
+        const double ka= pt[i]*pa[i];
+        const double kay= ka*py[i];
+        const double kaz= ka*pz[i];
+        const double f= ps[i]*pa[i];
+        k0+= ka;
+        k1+= kay;
+        k2+= kaz;
+        k3+= kay*py[i];
+        k4+= kay*pz[i];
+        k5+= kaz*pz[i];
+        r0+= f;
+        r1+= f*py[i];
+        r2+= f*pz[i];
+      }
+    k[0]= k0; k[1]= k1; k[2]= k2; k[3]= k3; k[4]= k4; k[5]= k5;
+    r[0]= r0; r[1]= r1; r[2]= r2;
+  }
@@ -0,0 +1,114 @@
+// -*-c++-*-
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis C. Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//FiberSoA.h
+
+#ifndef FiberSoA_h
+#define FiberSoA_h
+
+#include <deque>
+#include <vector>
+#include <cstddef>
+#include "material/section/fiber_section/fiber/Fiber.h"
+
+namespace XC {
+class UniaxialMaterial;
+
+//! @ingroup MATSCCFibers
+//
+//! @brief Structure of arrays representation of the fibers of a section.
+//!
+//! Stores the fiber positions, areas and materials in contiguous arrays
+//! with the fibers sorted so the ones whose materials share the same
+//! class are consecutive. This way the computation of the fiber strains
+//! and the integration of the stiffness matrix and the stress resultant
+//! can be vectorized and the materials of each group are updated with
+//! a single call to UniaxialMaterial::setTrialBatch. The fibers with
+//! zero area are placed in separate groups at the end of the arrays.
+class FiberSoA
+  {
+  public:
+    //! @brief Range of fibers whose materials share the same class.
+    struct MaterialGroup
+      {
+        int classTag; //!< class tag of the materials of the group.
+        bool zeroArea; //!< true if the fibers of the group have zero area.
+        size_t begin; //!< index of the first fiber of the group.
+        size_t end; //!< one past the index of the last fiber of the group.
+      };
+  private:
+    bool valid; //!< true if the arrays correspond to the current fibers.
+    size_t fiberVersion; //!< version of the fiber container when the arrays were built.
+    std::vector<Fiber *> fibers; //!< fibers (sorted by material class).
+    std::vector<UniaxialMaterial *> materials; //!< fiber materials.
+    std::vector<double> y; //!< fiber y coordinates.
+    std::vector<double> z; //!< fiber z coordinates.
+    std::vector<double> area; //!< fiber areas.
+    std::vector<double> strain; //!< fiber trial strains.
+    std::vector<double> stress; //!< fiber trial stresses.
+    std::vector<double> tangent; //!< fiber tangent moduli.
+    std::vector<MaterialGroup> groups; //!< material groups.
+  public:
+    FiberSoA(void);
+    FiberSoA(const FiberSoA &);
+    FiberSoA &operator=(const FiberSoA &);
+
+    void clear(void);
+    //! @brief Return true if the arrays are up to date with a
+    //! container of numFibers fibers whose version is v (no fiber
+    //! has changed its material, position or area since they were built).
+    inline bool isValid(const size_t &numFibers, const size_t &v) const
+      { return (valid && (fibers.size()==numFibers) && (fiberVersion==v)); }
+    void setup(const std::deque<Fiber *> &, const size_t &);
+    //! @brief Return the number of fibers.
+    inline size_t size(void) const
+      { return fibers.size(); }
+    //! @brief Return the fiber y coordinates.
+    inline const std::vector<double> &getY(void) const
+      { return y; }
+    //! @brief Return the fiber z coordinates.
+    inline const std::vector<double> &getZ(void) const
+      { return z; }
+    //! @brief Return the fiber areas.
+    inline const std::vector<double> &getArea(void) const
+      { return area; }
+    //! @brief Return the fiber materials.
+    inline const std::vector<UniaxialMaterial *> &getMaterials(void) const
+      { return materials; }
+    //! @brief Return the material groups.
+    inline const std::vector<MaterialGroup> &getMaterialGroups(void) const
+      { return groups; }
+
+    void computeStrains(const double &, const double &, const double &);
+    int setTrial(const bool &skipZeroArea);
+    void integrate2d(double k[3], double r[2]) const;
+    void integrate3d(double k[6], double r[3]) const;
+  };
+
+} // end of XC namespace
+
+#endif
@@ -74,6 +74,7 @@ void XC::UniaxialFiber::free_mem(void)
       {
         delete theMaterial;
         theMaterial= nullptr;
+        touch(); // pointers to the old material are no longer valid.
       }
   }
 
@@ -81,6 +82,7 @@ void XC::UniaxialFiber::alloc(const UniaxialMaterial &theMat)
   {
     free_mem();
     theMaterial = theMat.getCopy();// get a copy of the MaterialModel
+    touch(); // the fiber has a new material.
     if(!theMaterial)
       {
         std::cerr <<"XC::UniaxialFiber::UniaxialFiber  -- failed to get copy of XC::UniaxialMaterial\n";
@@ -116,6 +118,7 @@ XC::UniaxialFiber &XC::UniaxialFiber::operator=(const UniaxialFiber &other)
   {
     Fiber::operator=(other);
     area= other.area;
+    touch(); // the area of the fiber has changed.
     setMaterial(other.theMaterial);
     return *this;
   }
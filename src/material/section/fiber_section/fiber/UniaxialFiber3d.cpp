@@ -81,6 +81,7 @@ void XC::UniaxialFiber3d::set_position(const Vector &position)
   {
     as[0]= -position(0); //Sign of Y coordinate changed.
     as[1]=  position(1);
+    touch(); // the position of the fiber has changed.
   }
 
 //! @brief Constructor.
@@ -52,7 +52,9 @@ class_<XC::Fiber,XC::Fiber*, bases<XC::TaggedObject>, boost::noncopyable >("Fibe
   .def("getMy",&XC::Fiber::getMy)
   ;
 
+void (XC::UniaxialFiber::*setUniaxialFiberMaterial)(const XC::UniaxialMaterial *)= &XC::UniaxialFiber::setMaterial;
 class_<XC::UniaxialFiber, bases<XC::Fiber>, boost::noncopyable >("UniaxialFiber", no_init)
+  .def("setMaterial", setUniaxialFiberMaterial, "Assigns a copy of the material argument to the fiber.")
   ;
 
 class_<XC::UniaxialFiber2d, bases<XC::UniaxialFiber>, boost::noncopyable >("UniaxialFiber2d", no_init);
@@ -29,6 +29,8 @@ class_<XC::FiberSectionBase, bases<XC::PrismaticBarCrossSection>, boost::noncopy
   .def("addFiber",make_function(addFiberAdHoc,return_internal_reference<>()),"Adds a fiber to the section.")
   .def("getFibers",make_function(&XC::FiberSectionBase::getFibers,return_internal_reference<>()),"Return a fiber container with the fibers in the section.")
   .def("getFiberSets",make_function(&XC::FiberSectionBase::getFiberSets,return_internal_reference<>()),"Return the fiber sets in the fiber section.")
+  .def("getInteractionDiagramFingerprint",&XC::FiberSectionBase::getInteractionDiagramFingerprint,"getInteractionDiagramFingerprint(diagramParameters): return the hash value that identifies the interaction diagram of the section in the persistent cache.")
+  .add_property("elasticRangeBypass",&XC::FiberSectionBase::getElasticRangeBypass,&XC::FiberSectionBase::setElasticRangeBypass,"If true, the fiber materials are not updated while all the fibers remain in the linear range of its materials; the section response is computed from its elastic stiffness.")
   .def("setInitialSectionDeformation",&XC::FiberSectionBase::setInitialSectionDeformation,"Set generalized initial strains values in the section from the components of the vector passed as parameter")
   .def("setTrialSectionDeformation",&XC::FiberSectionBase::setTrialSectionDeformation,"Set generalized trial strains values in the section from the components of the vector passed as parameter")
   .def("getArea",&XC::FiberSectionBase::getArea,"Return the area of the fiber section")
@@ -120,7 +120,7 @@ double XC::DeformationPlane::Strain(const Pos2d &p) const
 //! @brief Returns the generalized strains vector (epsilon, zCurvature, yCurvature).
 const XC::Vector &XC::DeformationPlane::getDeformation(void) const
   {
-    static Vector retval(3);
+    static thread_local Vector retval(3);
     retval(0)= Strain(Pos2d(0,0)); // SECTION_RESPONSE_P
     retval(1)= Strain(Pos2d(1,0))-retval(0); // SECTION_RESPONSE_MZ
     retval(2)= Strain(Pos2d(0,1))-retval(0); // SECTION_RESPONSE_MY
@@ -148,7 +148,7 @@ void XC::DeformationPlane::setDeformation(const Vector &genStrains)
 //! @param rId: stiffness material contribution response identifiers.
 const XC::Vector &XC::DeformationPlane::getDeformation(const size_t &order, const ResponseId &rId) const
   {
-    static Vector retval;
+    static thread_local Vector retval;
     retval.resize(order);
     retval.Zero();
     const Vector &tmp= getDeformation();
@@ -34,24 +34,30 @@
 #include "utility/geom/d3/BND3d.h"
 #include "utility/geom/d1/Segment3d.h"
 #include "utility/matrix/Vector.h"
+#include "utility/matrix/Matrix.h"
 
 #include "material/section/fiber_section/FiberSectionBase.h"
 #include "material/section/interaction_diagram/InteractionDiagramData.h"
+#include <fstream>
+#include <sstream>
+#include <cstdio>
+#include <cstdint>
+#include <random>
+#include <boost/functional/hash.hpp>
 
 
-//! @brier We classify the trihedron by its quadrant.
-void XC::InteractionDiagram::classify_trihedron(const Trihedron &tdro)
-  {
-    for(int i= 0;i<8;i++)
-      if(tdro.TocaCuadrante(i+1)) quadrant_trihedrons[i].insert(&tdro);
-  }
+//! @brief Directory of the persistent cache of interaction diagrams.
+std::string XC::InteractionDiagram::cacheDirectory;
+
+//! @brief Identification of the cache files (magic number and version).
+static const char cacheFileMagic[4]= {'X','C','I','D'};
+static const int32_t cacheFileVersion= 2;
 
-//! @brier We classify the trihedrons by its quadrants.
+//! @brief Index the trihedrons by direction.
 void XC::InteractionDiagram::classify_trihedrons(void)
   {
-    //Clasificamos los trihedrons por cuadrantes.
-    for(XC::InteractionDiagram::const_iterator i= begin();i!=end();i++)
-      classify_trihedron(*i);
+    if(!direction_index.build(trihedrons))
+      direction_index.clear();
   }
 
 //! @brief Default constructor.
@@ -66,16 +72,13 @@ XC::InteractionDiagram::InteractionDiagram(const Pos3d &org,const Triang3dMesh &
 
 //! @brief Copy constructor.
 XC::InteractionDiagram::InteractionDiagram(const InteractionDiagram &other)
-  : ClosedTriangleMesh(other)
-  {
-    classify_trihedrons();
-  }
+  : ClosedTriangleMesh(other), direction_index(other.direction_index) {}
 
 //! @brief Assignment operator.
 XC::InteractionDiagram &XC::InteractionDiagram::operator=(const InteractionDiagram &other)
   {
     ClosedTriangleMesh::operator=(other);
-    classify_trihedrons();
+    direction_index= other.direction_index;
     return *this;
   }
 
@@ -94,15 +97,19 @@ const Trihedron *XC::InteractionDiagram::findTrihedronPtr(const Pos3d &p) const
                   << std::endl;
         return retval;
       }
-    const int cuadrante= p.Cuadrante();
-    const set_ptr_trihedrons &set_trihedrons= quadrant_trihedrons[cuadrante-1];
-    for(set_ptr_trihedrons::const_iterator i= set_trihedrons.begin();i!=set_trihedrons.end();i++)
-      if((*i)->In(p,tol))
-        {
-          retval= *i;
-          break;
-        }
-    if(!retval) //Not found, so brute-force search.
+    if(!direction_index.empty())
+      {
+        // Only the trihedrons whose cone can contain p are checked.
+        const TrihedronDirectionIndex::candidate_list &candidates= direction_index.getCandidates(p);
+        for(TrihedronDirectionIndex::candidate_list::const_iterator i= candidates.begin();i!=candidates.end();i++)
+          if(trihedrons[*i].In(p,tol))
+            {
+              retval= &trihedrons[*i];
+              break;
+            }
+      }
+    // The candidate list is exhaustive only if there is no tolerance.
+    if(!retval && (direction_index.empty() || (tol>0.0))) //Not found, so brute-force search.
       {
         for(XC::InteractionDiagram::const_iterator i= begin();i!=end();i++)
           {
@@ -289,15 +296,164 @@ double XC::InteractionDiagram::getCapacityFactor(const Pos3d &esf_d) const
     return retval;
   }
 
+//! @brief Return the capacity factors for the internal forces triplets
+//! being passed as parameters.
 XC::Vector XC::InteractionDiagram::getCapacityFactor(const GeomObj::list_Pos3d &lp) const
   {
-    Vector retval(lp.size());
-    int i= 0;
-    for(GeomObj::list_Pos3d::const_iterator j= lp.begin();j!=lp.end(); j++, i++)
-      retval[i]= getCapacityFactor(*j);
+    const int sz= lp.size();
+    Vector retval(sz);
+#pragma omp parallel for schedule(dynamic,16)
+    for(int i= 0;i<sz;i++)
+      retval[i]= getCapacityFactor(lp[i]);
     return retval;
   }
 
+//! @brief Return the capacity factors for the internal forces triplets
+//! being passed as parameters (one (N,My,Mz) triplet on each row).
+XC::Vector XC::InteractionDiagram::getCapacityFactor(const Matrix &m) const
+  {
+    const int sz= m.noRows();
+    Vector retval(sz);
+    if(m.noCols()<3)
+      {
+	std::cerr << getClassName() << "::" << __FUNCTION__
+		  << "; the matrix must have three columns (N,My,Mz)."
+		  << std::endl;
+        return retval;
+      }
+#pragma omp parallel for schedule(dynamic,16)
+    for(int i= 0;i<sz;i++)
+      retval[i]= getCapacityFactor(Pos3d(m(i,0),m(i,1),m(i,2)));
+    return retval;
+  }
+
+
+//! @brief Return the directory of the persistent cache of interaction
+//! diagrams (empty if the cache is disabled).
+const std::string &XC::InteractionDiagram::getCacheDirectory(void)
+  { return cacheDirectory; }
+
+//! @brief Set the directory of the persistent cache of interaction
+//! diagrams (an empty string disables the cache).
+//!
+//! The directory must exist. The diagrams are stored there, one file for
+//! each section key (see FiberSectionBase::getInteractionDiagramCacheKey),
+//! so any change in the section or in the diagram parameters results in
+//! a different file.
+void XC::InteractionDiagram::setCacheDirectory(const std::string &dir)
+  { cacheDirectory= dir; }
+
+//! @brief Return the name of the cache file for the key being
+//! passed as parameter (the name contains a hash of the key).
+std::string XC::InteractionDiagram::getCacheFileName(const std::string &key)
+  {
+    std::ostringstream os;
+    os << cacheDirectory << "/interaction_diagram_"
+       << std::hex << boost::hash_value(key) << ".bin";
+    return os.str();
+  }
+
+//! @brief Read the diagram from the cache file that corresponds
+//! to the key argument.
+//!
+//! The file stores the whole key, which is compared with the argument,
+//! so two sections whose keys have the same hash value never share
+//! a diagram.
+//! @return false if the cache is disabled or the file doesn't exist
+//! or doesn't correspond to the key.
+bool XC::InteractionDiagram::readFromCache(const std::string &key)
+  {
+    if(cacheDirectory.empty())
+      return false;
+    std::ifstream is(getCacheFileName(key).c_str(), std::ios::in | std::ios::binary | std::ios::ate);
+    if(!is)
+      return false;
+    const std::streamoff fileSize= is.tellg();
+    is.seekg(0);
+    char magic[4];
+    int32_t version= 0;
+    uint64_t keySize= 0;
+    uint64_t numTrihedrons= 0;
+    double header[3]; // tol, rMax, rMin.
+    is.read(magic,sizeof magic);
+    is.read(reinterpret_cast<char *>(&version),sizeof version);
+    is.read(reinterpret_cast<char *>(&keySize),sizeof keySize);
+    is.read(reinterpret_cast<char *>(&numTrihedrons),sizeof numTrihedrons);
+    is.read(reinterpret_cast<char *>(header),sizeof header);
+    const std::streamoff headerSize= sizeof magic+sizeof version+sizeof keySize+sizeof numTrihedrons+sizeof header+keySize;
+    if(!is || !std::equal(magic,magic+4,cacheFileMagic) || (version!=cacheFileVersion) || (keySize!=key.size()))
+      return false;
+    if((numTrihedrons==0) || (fileSize!=headerSize+std::streamoff(12*numTrihedrons*sizeof(double))))
+      return false;
+    std::string fileKey(keySize, '\0');
+    is.read(&fileKey[0], keySize);
+    if(!is || (fileKey!=key))
+      return false;
+    const int numRows= numTrihedrons;
+    std::vector<double> values(12*numTrihedrons);
+    is.read(reinterpret_cast<char *>(values.data()), values.size()*sizeof(double));
+    if(!is)
+      return false;
+    Matrix m(numRows,12);
+    for(int i= 0;i<numRows;i++)
+      for(int j= 0;j<12;j++)
+        m(i,j)= values[12*i+j];
+    tol= header[0];
+    rMax= header[1];
+    rMin= header[2];
+    setPositionsMatrix(m);
+    return true;
+  }
+
+//! @brief Write the diagram in the cache file that corresponds to
+//! the key argument.
+//!
+//! The file is written with a temporary name and then renamed so
+//! other processes never read a partially written file.
+bool XC::InteractionDiagram::writeToCache(const std::string &key)
+  {
+    if(cacheDirectory.empty() || trihedrons.empty())
+      return false;
+    const std::string fName= getCacheFileName(key);
+    std::ostringstream tmpName;
+    tmpName << fName << ".tmp" << std::hex << std::random_device()();
+    std::ofstream os(tmpName.str().c_str(), std::ios::out | std::ios::binary);
+    if(!os)
+      {
+	std::cerr << getClassName() << "::" << __FUNCTION__
+		  << "; can't open file: '"
+		  << tmpName.str() << "'\n";
+        return false;
+      }
+    Matrix m;
+    getPositionsMatrix(m);
+    const uint64_t keySize= key.size();
+    const uint64_t numTrihedrons= m.noRows();
+    const double header[3]= {tol, rMax, rMin};
+    os.write(cacheFileMagic,sizeof cacheFileMagic);
+    os.write(reinterpret_cast<const char *>(&cacheFileVersion),sizeof cacheFileVersion);
+    os.write(reinterpret_cast<const char *>(&keySize),sizeof keySize);
+    os.write(reinterpret_cast<const char *>(&numTrihedrons),sizeof numTrihedrons);
+    os.write(reinterpret_cast<const char *>(header),sizeof header);
+    os.write(key.data(), key.size());
+    std::vector<double> values(12*numTrihedrons);
+    for(size_t i= 0;i<numTrihedrons;i++)
+      for(size_t j= 0;j<12;j++)
+        values[12*i+j]= m(i,j);
+    os.write(reinterpret_cast<const char *>(values.data()), values.size()*sizeof(double));
+    os.close();
+    bool retval= bool(os);
+    if(retval)
+      retval= (std::rename(tmpName.str().c_str(), fName.c_str())==0);
+    if(!retval)
+      {
+	std::cerr << getClassName() << "::" << __FUNCTION__
+		  << "; can't write file: '"
+		  << fName << "'\n";
+        std::remove(tmpName.str().c_str());
+      }
+    return retval;
+  }
 
 void XC::InteractionDiagram::Print(std::ostream &os) const
   {
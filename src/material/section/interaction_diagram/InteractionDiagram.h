@@ -31,15 +31,16 @@
 #define INTERACTION_DIAGRAM_H
 
 #include "utility/geom/d2/Trihedron.h"
-#include <set>
 #include <deque>
 #include "ClosedTriangleMesh.h"
+#include "TrihedronDirectionIndex.h"
 
 class Triang3dMesh;
 
 namespace XC {
 
 class Vector;
+class Matrix;
 class FiberSectionBase;
 class InteractionDiagramData;
 
@@ -49,12 +50,9 @@ class InteractionDiagramData;
 class InteractionDiagram: public ClosedTriangleMesh
   {
   protected:
-    typedef std::set<const Trihedron *> set_ptr_trihedrons;
+    TrihedronDirectionIndex direction_index; //!< trihedrons indexed by direction.
+    static std::string cacheDirectory; //!< directory of the persistent diagram cache (empty: no cache).
 
-    
-    set_ptr_trihedrons quadrant_trihedrons[8];
-
-    void classify_trihedron(const Trihedron &tdro);
     void classify_trihedrons(void);
     void setPositionsMatrix(const Matrix &);
     GeomObj::list_Pos3d get_intersection(const Pos3d &p) const;
@@ -69,6 +67,13 @@ class InteractionDiagram: public ClosedTriangleMesh
     Pos3d getIntersection(const Pos3d &) const;
     double getCapacityFactor(const Pos3d &) const;
     Vector getCapacityFactor(const GeomObj::list_Pos3d &) const;
+    Vector getCapacityFactor(const Matrix &) const;
+
+    static const std::string &getCacheDirectory(void);
+    static void setCacheDirectory(const std::string &);
+    static std::string getCacheFileName(const std::string &);
+    bool readFromCache(const std::string &);
+    bool writeToCache(const std::string &);
 
     void Print(std::ostream &os) const;
   };
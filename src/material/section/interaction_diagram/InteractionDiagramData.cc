@@ -27,12 +27,14 @@
 //InteractionDiagramData.cc
 
 #include "InteractionDiagramData.h"
+#include <sstream>
 
 
 XC::InteractionDiagramData::InteractionDiagramData(void)
   : threshold(10), inc_eps(0.0), inc_t(M_PI/4), agot_pivots(),
     concrete_set_name("concrete"), concrete_tag(0),
-    reinforcement_set_name("reinforcement"), reinforcement_tag(0)
+    reinforcement_set_name("reinforcement"), reinforcement_tag(0),
+    polygon_integration(false)
   {
     inc_eps= agot_pivots.getIncEpsAB(); //Strain increment.
     if(inc_eps<=1e-6)
@@ -44,4 +46,37 @@ XC::InteractionDiagramData::InteractionDiagramData(void)
 XC::InteractionDiagramData::InteractionDiagramData(const double &u,const double &inc_e,const double &inc_theta,const PivotsUltimateStrains &agot)
   : threshold(u), inc_eps(inc_e), inc_t(inc_theta), agot_pivots(agot),
     concrete_set_name("concrete"), concrete_tag(0),
-    reinforcement_set_name("reinforcement"), reinforcement_tag(0) {}
+    reinforcement_set_name("reinforcement"), reinforcement_tag(0),
+    polygon_integration(false) {}
+
+//! @brief Write the binary representation of the argument.
+template <class T>
+static void write_key(std::ostream &os, const T &value)
+  { os.write(reinterpret_cast<const char *>(&value), sizeof value); }
+
+//! @brief Write the size and the characters of the string argument.
+static void write_key(std::ostream &os, const std::string &value)
+  {
+    write_key(os, value.size());
+    os.write(value.data(), value.size());
+  }
+
+//! @brief Return the binary representation of the parameters
+//! (used to identify the diagram in the persistent cache, see
+//! FiberSectionBase::getInteractionDiagramCacheKey).
+std::string XC::InteractionDiagramData::getCacheKey(void) const
+  {
+    std::ostringstream os;
+    write_key(os, threshold);
+    write_key(os, inc_eps);
+    write_key(os, inc_t);
+    write_key(os, agot_pivots.getUltimateStrainAPivot());
+    write_key(os, agot_pivots.getUltimateStrainBPivot());
+    write_key(os, agot_pivots.getUltimateStrainCPivot());
+    write_key(os, concrete_set_name);
+    write_key(os, concrete_tag);
+    write_key(os, reinforcement_set_name);
+    write_key(os, reinforcement_tag);
+    write_key(os, polygon_integration);
+    return os.str();
+  }
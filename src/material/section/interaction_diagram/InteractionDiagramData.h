@@ -49,6 +49,7 @@ class InteractionDiagramData: public CommandEntity
     int concrete_tag; //!< Concrete material tag.
     std::string reinforcement_set_name; //!< Steel fibers set name. 
     int reinforcement_tag; //!< Steel material tag.
+    bool polygon_integration; //!< If true integrate the stresses over the region contours instead of using the fibers.
   public:
     InteractionDiagramData(void);
     InteractionDiagramData(const double &u,const double &inc_e,const double &inc_t= M_PI/4,const PivotsUltimateStrains &agot= PivotsUltimateStrains());
@@ -85,6 +86,13 @@ class InteractionDiagramData: public CommandEntity
       { return reinforcement_tag; }
     inline void setReinforcementTag(const int &v)
       { reinforcement_tag= v; }
+    //! @brief Return true if the stresses are integrated over the
+    //! region contours (see PolygonalSectionIntegrator).
+    inline bool getPolygonIntegration(void) const
+      { return polygon_integration; }
+    inline void setPolygonIntegration(const bool &b)
+      { polygon_integration= b; }
+    std::string getCacheKey(void) const;
   };
 
 } // end of XC namespace
@@ -0,0 +1,322 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis C. Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//InteractionDiagram.cc
+//PolygonalSectionIntegrator.cc
+
+#include "PolygonalSectionIntegrator.h"
+#include "DeformationPlane.h"
+#include "material/section/repres/section_geometry/SectionGeometry.h"
+#include "material/section/repres/section_geometry/region/SectRegion.h"
+#include "material/section/repres/section_geometry/reinfLayer/ReinfLayer.h"
+#include "material/section/repres/section_geometry/reinfBar/ReinfBar.h"
+#include "material/uniaxial/concrete/Concrete01.h"
+#include "material/uniaxial/steel/Steel01.h"
+#include "material/uniaxial/ElasticMaterial.h"
+#include "utility/geom/d2/2d_polygons/Polygon2d.h"
+#include "utility/geom/pos_vec/Pos2d.h"
+#include "utility/geom/pos_vec/Pos3d.h"
+#include "utility/matrix/Vector.h"
+#include <classTags.h>
+#include <algorithm>
+#include <cmath>
+
+//! @brief Append an interval with the stress polynomial c0+c1*e+c2*e^2.
+void XC::PiecewiseStressStrainLaw::append(const double &c0, const double &c1, const double &c2)
+  {
+    coefficients.push_back(c0);
+    coefficients.push_back(c1);
+    coefficients.push_back(c2);
+  }
+
+//! @brief Set the law from the monotonic envelope of the material.
+//!
+//! @return false if the material is not supported.
+bool XC::PiecewiseStressStrainLaw::setup(const UniaxialMaterial &mat)
+  {
+    breakpoints.clear();
+    coefficients.clear();
+    bool retval= true;
+    switch(mat.getClassTag())
+      {
+      case MAT_TAG_Concrete01:
+        {
+          // Kent-Scott-Park envelope (compression values are negative).
+          const Concrete01 &c= static_cast<const Concrete01 &>(mat);
+          const double fpc= c.getFpc();
+          const double epsc0= c.getEpsc0();
+          const double fpcu= c.getFpcu();
+          const double epscu= c.getEpscu();
+          const double slope= (fpc-fpcu)/(epsc0-epscu);
+          breakpoints.push_back(epscu);
+          breakpoints.push_back(epsc0);
+          breakpoints.push_back(0.0);
+          append(fpcu, 0.0, 0.0); // crushed.
+          append(fpc-slope*epsc0, slope, 0.0); // descending branch.
+          append(0.0, 2.0*fpc/epsc0, -fpc/(epsc0*epsc0)); // parabola.
+          append(0.0, 0.0, 0.0); // no tensile strength.
+          break;
+        }
+      case MAT_TAG_Steel01:
+        {
+          const Steel01 &s= static_cast<const Steel01 &>(mat);
+          if(s.getInitialStrain()!=0.0)
+            retval= false;
+          else
+            {
+              const double E= s.getInitialTangent();
+              const double fy= s.getFy();
+              const double Esh= s.getHardeningRatio()*E;
+              const double epsy= fy/E;
+              breakpoints.push_back(-epsy);
+              breakpoints.push_back(epsy);
+              append(-fy+Esh*epsy, Esh, 0.0);
+              append(0.0, E, 0.0);
+              append(fy-Esh*epsy, Esh, 0.0);
+            }
+          break;
+        }
+      case MAT_TAG_ElasticMaterial:
+        {
+          const ElasticMaterial &e= static_cast<const ElasticMaterial &>(mat);
+          append(-e.getE()*e.getInitialStrain(), e.getE(), 0.0);
+          break;
+        }
+      default:
+        retval= false;
+      }
+    return retval;
+  }
+
+//! @brief Return the stress that corresponds to the strain argument.
+double XC::PiecewiseStressStrainLaw::getStress(const double &eps) const
+  {
+    const size_t i= std::upper_bound(breakpoints.begin(), breakpoints.end(), eps)-breakpoints.begin();
+    const double *c= &coefficients[3*i];
+    return c[0]+eps*(c[1]+eps*c[2]);
+  }
+
+//! @brief Default constructor.
+XC::PolygonalSectionIntegrator::PolygonalSectionIntegrator(void)
+  : CommandEntity() {}
+
+//! @brief Constructor.
+XC::PolygonalSectionIntegrator::PolygonalSectionIntegrator(const SectionGeometry &geom)
+  : CommandEntity()
+  { setup(geom); }
+
+//! @brief Remove the regions and the bars.
+void XC::PolygonalSectionIntegrator::clear(void)
+  {
+    regions.clear();
+    bars.clear();
+  }
+
+//! @brief Read the regions and the reinforcing bars from the section
+//! geometry.
+//!
+//! @return false if the stress-strain law of any of its materials
+//! can't be represented (see PiecewiseStressStrainLaw::setup).
+bool XC::PolygonalSectionIntegrator::setup(const SectionGeometry &geom)
+  {
+    clear();
+    bool retval= true;
+    const RegionContainer &rgs= geom.getRegions();
+    for(RegionContainer::const_iterator i= rgs.begin();i!=rgs.end();i++)
+      {
+        const UniaxialMaterial *mat= dynamic_cast<const UniaxialMaterial *>((*i)->getMaterialPtr());
+        Region r;
+        if(!mat || !r.law.setup(*mat))
+          {
+            std::cerr << getClassName() << "::" << __FUNCTION__
+                      << "; material of region: '" << (*i)->getName()
+                      << "' not supported." << std::endl;
+            retval= false;
+            continue;
+          }
+        const Polygon2d plg= (*i)->getPolygon();
+        const size_t nv= plg.getNumVertices();
+        r.y.resize(nv);
+        r.z.resize(nv);
+        double a2= 0.0, sy= 0.0, sz= 0.0;
+        for(size_t j= 0;j<nv;j++)
+          {
+            const Pos2d p= plg.Vertice0(j);
+            r.y[j]= p.x();
+            r.z[j]= p.y();
+          }
+        for(size_t j= 0;j<nv;j++)
+          {
+            const size_t k= (j+1)%nv;
+            const double cross= r.y[j]*r.z[k]-r.y[k]*r.z[j];
+            a2+= cross;
+            sy+= (r.y[j]+r.y[k])*cross;
+            sz+= (r.z[j]+r.z[k])*cross;
+          }
+        r.orientation= (a2<0.0) ? -1.0 : 1.0;
+        r.area= std::abs(a2)/2.0;
+        r.yCenter= (a2!=0.0) ? sy/(3.0*a2) : 0.0;
+        r.zCenter= (a2!=0.0) ? sz/(3.0*a2) : 0.0;
+        regions.push_back(r);
+      }
+    const ListReinfLayer &layers= geom.getReinforcementLayers();
+    for(ListReinfLayer::const_iterator i= layers.begin();i!=layers.end();i++)
+      {
+        const VectorReinfBar &layerBars= (*i)->getReinfBars();
+        for(VectorReinfBar::const_iterator j= layerBars.begin();j!=layerBars.end();j++)
+          {
+            const UniaxialMaterial *mat= dynamic_cast<const UniaxialMaterial *>((*j)->getMaterialPtr());
+            Bar b;
+            if(!mat || !b.law.setup(*mat))
+              {
+                std::cerr << getClassName() << "::" << __FUNCTION__
+                          << "; material of reinforcement layer: '"
+                          << (*i)->getName()
+                          << "' not supported." << std::endl;
+                retval= false;
+                break;
+              }
+            const Vector &pos= (*j)->getPosition();
+            b.y= pos(0);
+            b.z= pos(1);
+            b.area= (*j)->getArea();
+            bars.push_back(b);
+          }
+      }
+    if(!retval)
+      clear();
+    return retval;
+  }
+
+//! @brief Add to r the stress resultants (N, Mz, My) of the region for
+//! the strain field e0+ey*y+ez*z.
+void XC::PolygonalSectionIntegrator::integrate_region(const Region &rg, const double &e0, const double &ey, const double &ez, double r[3]) const
+  {
+    const size_t nv= rg.y.size();
+    if(nv<3)
+      return;
+    const double g= sqrt(ey*ey+ez*ez);
+    if(g*sqrt(rg.area)<=1e-14*(1.0+std::abs(e0)))
+      { // Uniform strain.
+        const double f= rg.law.getStress(e0+ey*rg.yCenter+ez*rg.zCenter)*rg.area;
+        r[0]+= f;
+        r[1]+= f*rg.yCenter;
+        r[2]+= f*rg.zCenter;
+        return;
+      }
+    // Local axes: u along the strain gradient, v along the neutral axis.
+    const double ny= ey/g, nz= ez/g;
+    std::vector<double> u(nv), v(nv);
+    for(size_t j= 0;j<nv;j++)
+      {
+        u[j]= ny*rg.y[j]+nz*rg.z[j];
+        v[j]= -nz*rg.y[j]+ny*rg.z[j];
+      }
+    // Strip limits.
+    std::vector<double> limits(u);
+    const double uMin= *std::min_element(u.begin(), u.end());
+    const double uMax= *std::max_element(u.begin(), u.end());
+    const std::vector<double> &epsLimits= rg.law.getBreakpoints();
+    for(std::vector<double>::const_iterator i= epsLimits.begin();i!=epsLimits.end();i++)
+      {
+        const double ui= (*i-e0)/g;
+        if((ui>uMin) && (ui<uMax))
+          limits.push_back(ui);
+      }
+    std::sort(limits.begin(), limits.end());
+
+    // Three point Gauss quadrature.
+    static const double xi[3]= {-sqrt(0.6), 0.0, sqrt(0.6)};
+    static const double wg[3]= {5.0/9.0, 8.0/9.0, 5.0/9.0};
+    const double minLength= 1e-12*(uMax-uMin);
+    double N= 0.0, Su= 0.0, Sv= 0.0;
+    for(size_t k= 1;k<limits.size();k++)
+      {
+        const double h= (limits[k]-limits[k-1])/2.0;
+        if(h<=minLength)
+          continue;
+        const double m= (limits[k]+limits[k-1])/2.0;
+        for(size_t l= 0;l<3;l++)
+          {
+            const double uq= m+h*xi[l];
+            // Width of the section and first moment of the chords
+            // (Green's theorem on the contour).
+            double w= 0.0, s= 0.0;
+            for(size_t j= 0;j<nv;j++)
+              {
+                const size_t jj= (j+1)%nv;
+                const double u1= u[j], u2= u[jj];
+                if((u1<uq)!=(u2<uq))
+                  {
+                    const double vq= v[j]+(uq-u1)/(u2-u1)*(v[jj]-v[j]);
+                    const double sign= (u2>u1) ? -1.0 : 1.0;
+                    w+= sign*vq;
+                    s+= sign*vq*vq/2.0;
+                  }
+              }
+            const double f= wg[l]*h*rg.law.getStress(e0+g*uq)*rg.orientation;
+            N+= f*w;
+            Su+= f*w*uq;
+            Sv+= f*s;
+          }
+      }
+    r[0]+= N;
+    r[1]+= ny*Su-nz*Sv;
+    r[2]+= nz*Su+ny*Sv;
+  }
+
+//! @brief Return the normal stress resultants (N, My, Mz) for the
+//! deformation plane being passed as parameter.
+Pos3d XC::PolygonalSectionIntegrator::getNMyMz(const DeformationPlane &def) const
+  {
+    const Vector &d= def.getDeformation();
+    const double e0= d(0);
+    const double ey= d(1); // strain gradient along y.
+    const double ez= d(2); // strain gradient along z.
+    double r[3]= {0.0, 0.0, 0.0}; // N, Mz, My.
+    for(std::vector<Region>::const_iterator i= regions.begin();i!=regions.end();i++)
+      integrate_region(*i, e0, ey, ez, r);
+    for(std::vector<Bar>::const_iterator i= bars.begin();i!=bars.end();i++)
+      {
+        const double f= i->law.getStress(e0+ey*i->y+ez*i->z)*i->area;
+        r[0]+= f;
+        r[1]+= f*i->y;
+        r[2]+= f*i->z;
+      }
+    return Pos3d(r[0], r[2], r[1]);
+  }
+
+//! @brief Return the normal stress resultants (N, My, Mz) for each
+//! of the deformation planes being passed as parameter.
+std::vector<Pos3d> XC::PolygonalSectionIntegrator::getNMyMzPoints(const std::vector<DeformationPlane> &planes) const
+  {
+    const int numPlanes= planes.size();
+    std::vector<Pos3d> retval(numPlanes);
+#pragma omp parallel for schedule(dynamic,16)
+    for(int i= 0;i<numPlanes;i++)
+      retval[i]= getNMyMz(planes[i]);
+    return retval;
+  }
@@ -0,0 +1,127 @@
+// -*-c++-*-
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis C. Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//PolygonalSectionIntegrator.h
+
+#ifndef POLYGONALSECTIONINTEGRATOR_H
+#define POLYGONALSECTIONINTEGRATOR_H
+
+#include "utility/kernel/CommandEntity.h"
+#include <vector>
+
+class Pos3d;
+
+namespace XC {
+
+class SectionGeometry;
+class UniaxialMaterial;
+class DeformationPlane;
+
+//! \@ingroup MATSCCDiagInt
+//
+//! @brief Stress-strain law defined by second degree polynomials
+//! between strain breakpoints.
+//!
+//! Used to represent the monotonic envelope of the uniaxial materials
+//! used in the ULS checks of reinforced concrete sections: the
+//! parabola-rectangle diagram of concrete (Concrete01), the
+//! bilinear diagram of steel (Steel01) and the linear elastic one
+//! (ElasticMaterial).
+class PiecewiseStressStrainLaw
+  {
+    std::vector<double> breakpoints; //!< strains where the polynomial changes (increasing order).
+    std::vector<double> coefficients; //!< coefficients (c0, c1, c2) of the polynomial c0+c1*e+c2*e^2 for each interval.
+
+    void append(const double &, const double &, const double &);
+  public:
+    bool setup(const UniaxialMaterial &);
+    double getStress(const double &) const;
+    //! @brief Return the strains where the polynomial changes.
+    inline const std::vector<double> &getBreakpoints(void) const
+      { return breakpoints; }
+  };
+
+//! \@ingroup MATSCCDiagInt
+//
+//! @brief Computes the normal stress resultants (N, My, Mz) of a
+//! reinforced concrete section without fibers.
+//!
+//! The stresses of each region are integrated over its contour: the
+//! integration domain is divided in strips parallel to the neutral
+//! axis, limited by the polygon vertices and the strains where the
+//! stress-strain law changes. Inside each strip the width of the
+//! polygon is linear and the stress is a polynomial on the distance to
+//! the neutral axis, so the three point Gauss quadrature is exact. The
+//! rebars are integrated as points.
+//!
+//! The materials are represented by its monotonic envelope (they are
+//! supposed to be in its initial state).
+class PolygonalSectionIntegrator: public CommandEntity
+  {
+    //! @brief Polygonal region filled with a material.
+    struct Region
+      {
+        std::vector<double> y; //!< y coordinates of the vertices.
+        std::vector<double> z; //!< z coordinates of the vertices.
+        double orientation; //!< 1 if the vertices are counterclockwise, -1 otherwise.
+        double area; //!< region area.
+        double yCenter; //!< y coordinate of the centroid.
+        double zCenter; //!< z coordinate of the centroid.
+        PiecewiseStressStrainLaw law; //!< stress-strain law.
+      };
+    //! @brief Reinforcing bar.
+    struct Bar
+      {
+        double y; //!< y coordinate.
+        double z; //!< z coordinate.
+        double area; //!< bar area.
+        PiecewiseStressStrainLaw law; //!< stress-strain law.
+      };
+    std::vector<Region> regions; //!< material regions.
+    std::vector<Bar> bars; //!< reinforcing bars.
+
+    void integrate_region(const Region &, const double &, const double &, const double &, double r[3]) const;
+  public:
+    PolygonalSectionIntegrator(void);
+    explicit PolygonalSectionIntegrator(const SectionGeometry &);
+
+    void clear(void);
+    bool setup(const SectionGeometry &);
+    //! @brief Return the number of regions.
+    inline size_t getNumRegions(void) const
+      { return regions.size(); }
+    //! @brief Return the number of reinforcing bars.
+    inline size_t getNumBars(void) const
+      { return bars.size(); }
+
+    Pos3d getNMyMz(const DeformationPlane &) const;
+    std::vector<Pos3d> getNMyMzPoints(const std::vector<DeformationPlane> &) const;
+  };
+
+} // end of XC namespace
+
+#endif
@@ -0,0 +1,203 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis C. Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//InteractionDiagram.cc
+//TrihedronDirectionIndex.cc
+
+#include "TrihedronDirectionIndex.h"
+#include "utility/geom/d2/Trihedron.h"
+#include "utility/geom/pos_vec/Pos3d.h"
+#include <cmath>
+#include <algorithm>
+
+//! @brief Angular tolerance used to enlarge the trihedron cones.
+static const double angTol= 1e-6;
+
+//! @brief Return the unit vector and the modulus of the vector d.
+static double normalize(double d[3])
+  {
+    const double retval= sqrt(d[0]*d[0]+d[1]*d[1]+d[2]*d[2]);
+    if(retval>0.0)
+      { d[0]/= retval; d[1]/= retval; d[2]/= retval; }
+    return retval;
+  }
+
+//! @brief Default constructor.
+XC::TrihedronDirectionIndex::TrihedronDirectionIndex(void)
+  : n(0), cells()
+  { origin[0]= 0.0; origin[1]= 0.0; origin[2]= 0.0; }
+
+//! @brief Remove the index contents.
+void XC::TrihedronDirectionIndex::clear(void)
+  {
+    n= 0;
+    cells.clear();
+  }
+
+//! @brief Compute the cube face that corresponds to the direction d
+//! and the coordinates (u,v) of the direction on that face.
+void XC::TrihedronDirectionIndex::get_face_coordinates(const double d[3], size_t &face, double &u, double &v)
+  {
+    size_t a= 0;
+    if(fabs(d[1])>fabs(d[a])) a= 1;
+    if(fabs(d[2])>fabs(d[a])) a= 2;
+    const double s= fabs(d[a]);
+    face= 2*a+((d[a]<0.0) ? 1 : 0);
+    u= d[(a+1)%3]/s;
+    v= d[(a+2)%3]/s;
+  }
+
+//! @brief Return in d the point (u,v) of the cube face.
+void XC::TrihedronDirectionIndex::get_face_point(const size_t &face, const double &u, const double &v, double d[3])
+  {
+    const size_t a= face/2;
+    d[a]= (face%2) ? -1.0 : 1.0;
+    d[(a+1)%3]= u;
+    d[(a+2)%3]= v;
+  }
+
+//! @brief Return the index of the cell that contains the direction d.
+size_t XC::TrihedronDirectionIndex::get_cell_index(const double d[3]) const
+  {
+    size_t face= 0;
+    double u= 0.0, v= 0.0;
+    get_face_coordinates(d, face, u, v);
+    const size_t i= std::min(n-1, size_t(std::max(0.0, (u+1.0)*0.5*n)));
+    const size_t j= std::min(n-1, size_t(std::max(0.0, (v+1.0)*0.5*n)));
+    return (face*n+i)*n+j;
+  }
+
+//! @brief Build the index for the trihedrons being passed as parameter.
+//!
+//! Each trihedron cone is enclosed in a spherical cap (axis: mean of
+//! the unit vectors that point to its vertices, radius: maximum angle
+//! between that axis and those unit vectors) and it is assigned to
+//! the cells whose enclosing cap intersects it.
+//!
+//! @return false if the index can't be built (the trihedrons don't
+//! share its cusp).
+bool XC::TrihedronDirectionIndex::build(const std::vector<Trihedron> &trihedrons)
+  {
+    clear();
+    const size_t numTrihedrons= trihedrons.size();
+    if(numTrihedrons==0)
+      return false;
+    const Pos3d &p0= trihedrons.front().Cuspide();
+    origin[0]= p0.x(); origin[1]= p0.y(); origin[2]= p0.z();
+
+    // Unit vectors from the cusp to the vertices.
+    std::vector<double> directions(9*numTrihedrons);
+    double scale= 0.0;
+    for(size_t k= 0;k<numTrihedrons;k++)
+      {
+        const Trihedron &t= trihedrons[k];
+        for(size_t l= 0;l<3;l++)
+          {
+            const Pos3d p= t.Vertice(l+1);
+            double *d= &directions[9*k+3*l];
+            d[0]= p.x()-origin[0]; d[1]= p.y()-origin[1]; d[2]= p.z()-origin[2];
+            scale= std::max(scale, normalize(d));
+          }
+      }
+    const double distTol= 1e-9*scale;
+    for(size_t k= 0;k<numTrihedrons;k++)
+      {
+        const Pos3d &c= trihedrons[k].Cuspide();
+        if((fabs(c.x()-origin[0])>distTol) || (fabs(c.y()-origin[1])>distTol) || (fabs(c.z()-origin[2])>distTol))
+          return false;
+      }
+
+    // One cell for each trihedron approximately.
+    n= std::max(size_t(1), std::min(size_t(64), size_t(ceil(sqrt(numTrihedrons/6.0)))));
+    const size_t numCells= 6*n*n;
+    cells.resize(numCells);
+    std::vector<double> cellAxes(3*numCells);
+    double cellRadius= 0.0; // Maximum radius of the cell caps.
+    const double h= 2.0/n;
+    for(size_t face= 0;face<6;face++)
+      for(size_t i= 0;i<n;i++)
+        for(size_t j= 0;j<n;j++)
+          {
+            double *c= &cellAxes[3*((face*n+i)*n+j)];
+            get_face_point(face, -1.0+(i+0.5)*h, -1.0+(j+0.5)*h, c);
+            normalize(c);
+            for(size_t corner= 0;corner<4;corner++)
+              {
+                double q[3];
+                get_face_point(face, -1.0+(i+corner%2)*h, -1.0+(j+corner/2)*h, q);
+                normalize(q);
+                const double cs= std::min(1.0, c[0]*q[0]+c[1]*q[1]+c[2]*q[2]);
+                cellRadius= std::max(cellRadius, acos(cs));
+              }
+          }
+
+    for(size_t k= 0;k<numTrihedrons;k++)
+      {
+        const double *w= &directions[9*k];
+        double m[3]= {w[0]+w[3]+w[6], w[1]+w[4]+w[7], w[2]+w[5]+w[8]};
+        double radius= M_PI;
+        if(normalize(m)>1e-6)
+          {
+            radius= 0.0;
+            for(size_t l= 0;l<3;l++)
+              {
+                const double *wl= w+3*l;
+                const double cs= std::max(-1.0, std::min(1.0, m[0]*wl[0]+m[1]*wl[1]+m[2]*wl[2]));
+                radius= std::max(radius, acos(cs));
+              }
+          }
+        // A cap wider than a hemisphere may not enclose the cone.
+        const double maxAngle= radius+cellRadius+angTol;
+        if((radius>=M_PI/2.0) || (maxAngle>=M_PI))
+          for(size_t c= 0;c<numCells;c++)
+            cells[c].push_back(k);
+        else
+          {
+            const double minCos= cos(maxAngle);
+            for(size_t c= 0;c<numCells;c++)
+              {
+                const double *a= &cellAxes[3*c];
+                if((m[0]*a[0]+m[1]*a[1]+m[2]*a[2])>=minCos)
+                  cells[c].push_back(k);
+              }
+          }
+      }
+    return true;
+  }
+
+//! @brief Return the indexes of the trihedrons that can contain the
+//! point being passed as parameter (empty if the index has not been
+//! built or the point is at the common cusp).
+const XC::TrihedronDirectionIndex::candidate_list &XC::TrihedronDirectionIndex::getCandidates(const Pos3d &p) const
+  {
+    static const candidate_list empty_list;
+    if(cells.empty())
+      return empty_list;
+    const double d[3]= {p.x()-origin[0], p.y()-origin[1], p.z()-origin[2]};
+    if((d[0]==0.0) && (d[1]==0.0) && (d[2]==0.0))
+      return empty_list;
+    return cells[get_cell_index(d)];
+  }
@@ -0,0 +1,81 @@
+// -*-c++-*-
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis C. Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//TrihedronDirectionIndex.h
+
+#ifndef TRIHEDRON_DIRECTION_INDEX_H
+#define TRIHEDRON_DIRECTION_INDEX_H
+
+#include <vector>
+#include <cstddef>
+
+class Pos3d;
+class Trihedron;
+
+namespace XC {
+
+//! \@ingroup MATSCCDiagInt
+//
+//! @brief Spatial index of the trihedrons of a closed triangle mesh
+//! by direction.
+//!
+//! When all the trihedrons share the same cusp, the direction of
+//! each point from that cusp determines which trihedrons can contain
+//! it. The unit sphere of directions is mapped on the six faces of a
+//! cube, each face is divided in n x n cells and each cell stores the
+//! indexes of the trihedrons whose cone can intersect the cell. The
+//! candidate list is conservative: any trihedron containing a point
+//! is among the candidates of the cell of the point direction.
+class TrihedronDirectionIndex
+  {
+  public:
+    typedef std::vector<size_t> candidate_list;
+  private:
+    size_t n; //!< number of cells in each direction of each cube face.
+    double origin[3]; //!< common cusp of the trihedrons.
+    std::vector<candidate_list> cells; //!< candidates for each cell.
+
+    static void get_face_coordinates(const double d[3], size_t &face, double &u, double &v);
+    static void get_face_point(const size_t &face, const double &u, const double &v, double d[3]);
+    size_t get_cell_index(const double d[3]) const;
+  public:
+    TrihedronDirectionIndex(void);
+    void clear(void);
+    bool build(const std::vector<Trihedron> &);
+    //! @brief Return true if the index has not been built.
+    inline bool empty(void) const
+      { return cells.empty(); }
+    //! @brief Return the number of cells in each direction of each
+    //! cube face.
+    inline size_t getNumDivisions(void) const
+      { return n; }
+    const candidate_list &getCandidates(const Pos3d &) const;
+  };
+
+} // end of XC namespace
+
+#endif
@@ -55,6 +55,15 @@ class_<XC::InteractionDiagramData, bases<CommandEntity>>("InteractionDiagramPara
   .add_property("concreteTag",make_function(&XC::InteractionDiagramData::getConcreteTag,return_value_policy<copy_const_reference>()),&XC::InteractionDiagramData::setConcreteTag)
   .add_property("rebarSetName",make_function(&XC::InteractionDiagramData::getRebarSetName,return_internal_reference<>()),&XC::InteractionDiagramData::setRebarSetName)
   .add_property("reinforcementTag",make_function(&XC::InteractionDiagramData::getReinforcementTag,return_value_policy<copy_const_reference>()),&XC::InteractionDiagramData::setReinforcementTag)
+  .add_property("polygonIntegration",&XC::InteractionDiagramData::getPolygonIntegration,&XC::InteractionDiagramData::setPolygonIntegration,"If true, the stresses are integrated over the contours of the section regions instead of using the fibers.")
+  ;
+
+class_<XC::PolygonalSectionIntegrator, bases<CommandEntity> >("PolygonalSectionIntegrator")
+  .def(init<const XC::SectionGeometry &>())
+  .def("setup",&XC::PolygonalSectionIntegrator::setup,"setup(sectionGeometry): read the regions and the reinforcing bars from the section geometry; return false if any of its materials is not supported.")
+  .add_property("numRegions",&XC::PolygonalSectionIntegrator::getNumRegions,"Return the number of regions.")
+  .add_property("numBars",&XC::PolygonalSectionIntegrator::getNumBars,"Return the number of reinforcing bars.")
+  .def("getNMyMz",&XC::PolygonalSectionIntegrator::getNMyMz,"getNMyMz(deformationPlane): return the normal stress resultants (N, My, Mz) for the deformation plane.")
   ;
 
 class_<XC::ClosedTriangleMesh, bases<GeomObj3d>, boost::noncopyable >("ClosedTriangleMesh", no_init)
@@ -71,13 +80,17 @@ class_<XC::ClosedTriangleMesh, bases<GeomObj3d>, boost::noncopyable >("ClosedTri
   ;
 
 double (XC::InteractionDiagram::*getCF)(const Pos3d &esf_d) const= &XC::InteractionDiagram::getCapacityFactor;
+XC::Vector (XC::InteractionDiagram::*getCFs)(const XC::Matrix &) const= &XC::InteractionDiagram::getCapacityFactor;
 class_<XC::InteractionDiagram, bases<XC::ClosedTriangleMesh>, boost::noncopyable >("InteractionDiagram", no_init)
   .def("centroid",&XC::InteractionDiagram::getCenterOfMass)
   .def("getLength",&XC::InteractionDiagram::getLength)
   .def("getIntersection",&XC::InteractionDiagram::getIntersection,"Returns the intersection of the ray O->point(N,My,Mz) with the interaction diagram.")
   .def("getCapacityFactor",getCF)
+  .def("getCapacityFactors",getCFs,"getCapacityFactors(m): return the capacity factors for the internal forces triplets (N,My,Mz) in the rows of the matrix m.")
   .def("writeTo",&XC::InteractionDiagram::writeTo)
   .def("readFrom",&XC::InteractionDiagram::readFrom)
+  .def("getCacheDirectory",&XC::InteractionDiagram::getCacheDirectory,return_value_policy<copy_const_reference>(),"Return the directory of the persistent cache of interaction diagrams (empty if disabled).").staticmethod("getCacheDirectory")
+  .def("setCacheDirectory",&XC::InteractionDiagram::setCacheDirectory,"setCacheDirectory(dirName): set the directory (must exist) of the persistent cache of interaction diagrams (an empty string disables the cache).").staticmethod("setCacheDirectory")
   ;
 
 double (XC::InteractionDiagram2d::*getCF2d)(const Pos2d &esf_d) const= &XC::InteractionDiagram2d::getCapacityFactor;
@@ -128,12 +128,12 @@ void XC::LayeredShellFiberSection::setupPy(const boost::python::list &materialTh
 //! @brief Default constructor
 XC::LayeredShellFiberSection::LayeredShellFiberSection(int tag)
   :MembranePlateFiberSectionBase(tag, SEC_TAG_LayeredShellFiberSection), 
-    sg(), wg()
+    sg(), wg(), zs(), ws()
   {}
 
 //! @brief Full constructor
 XC::LayeredShellFiberSection::LayeredShellFiberSection(int tag, const std::vector<double> &thicknesses, const std::vector<NDMaterial *> &fibers)
-  : MembranePlateFiberSectionBase( tag, SEC_TAG_LayeredShellFiberSection, 0.0, fibers), sg(fibers.size()), wg(fibers.size())
+  : MembranePlateFiberSectionBase( tag, SEC_TAG_LayeredShellFiberSection, 0.0, fibers), sg(fibers.size()), wg(fibers.size()), zs(), ws()
   {
     setHWgSg(thicknesses);
   }
@@ -174,6 +174,21 @@ std::vector<double> XC::LayeredShellFiberSection::getFiberZs(void) const
     return retval;
   }
 
+//! @brief Compute the z coordinates and the integration weights
+//! of the layers in contiguous arrays.
+void XC::LayeredShellFiberSection::compute_zs_ws(void) const
+  {
+    const size_t sz= theFibers.size();
+    zs.resize(sz);
+    ws.resize(sz);
+    const double h_2= 0.5*h;
+    for(size_t i= 0; i<sz; i++)
+      {
+        zs[i]= h_2*sg[i];
+        ws[i]= h_2*wg[i];
+      }
+  }
+
 //! @brief Mass per unit area
 double XC::LayeredShellFiberSection::getRho(void) const 
   {
@@ -205,6 +220,7 @@ int XC::LayeredShellFiberSection::setParameter(const  std::vector<std::string> &
 
 int XC::LayeredShellFiberSection::updateParameter(int parameterID, Information& info)
   {
+    layers.invalidate();
     // placeholder for future implementations: if we will have parameters for this class, update them here
     return MembranePlateFiberSectionBase::updateParameter(parameterID, info);
   }
@@ -213,6 +229,7 @@ int XC::LayeredShellFiberSection::updateParameter(int parameterID, Information&
 int XC::LayeredShellFiberSection::setInitialSectionDeformation(const Vector &initialStrain_from_element)
   {
     this->initialStrain = initialStrain_from_element;
+    layers.invalidate();
 
     const size_t sz= theFibers.size();
     static Vector strain(sz);
@@ -235,64 +252,16 @@ int XC::LayeredShellFiberSection::setInitialSectionDeformation(const Vector &ini
 int XC::LayeredShellFiberSection::setTrialSectionDeformation(const Vector &strainResultant_from_element)
   {
     this->strainResultant = strainResultant_from_element;
-
-    static Vector strain(5);
-
-    int success = 0;
-
-    double z;
-    const size_t sz= theFibers.size();
-    const double h_2= 0.5*h;
-    for(size_t i = 0; i < sz; i++ )
-      {
-	z = h_2*sg[i];
-
-	strain(0) =  strainResultant(0)  - z*strainResultant(3);
-	strain(1) =  strainResultant(1)  - z*strainResultant(4);
-	strain(2) =  strainResultant(2)  - z*strainResultant(5);
-	strain(3) =  strainResultant(6);
-	strain(4) =  strainResultant(7);
-	success += theFibers[i]->setTrialStrain( strain );
-
-      } //end for i
-    return success;
+    compute_zs_ws();
+    return set_trial_layers(zs.data(), 1.0); // No shear correction for this material.
   }
 
 
 //send back the stressResultant 
 const XC::Vector &XC::LayeredShellFiberSection::getStressResultant(void) const
   {
-    static Vector stress(5);
-
-    double z, weight;
-
-    stressResultant.Zero( );
-    const double h_2= 0.5*h;
-    const size_t sz= theFibers.size();
-    for(size_t i= 0; i < sz; i++ )
-      {
-
-	z = h_2 * sg[i];
-
-	weight = h_2 * wg[i];
-
-	stress = theFibers[i]->getStress( );
-
-	//membrane
-	stressResultant(0)  +=  stress(0)*weight;
-	stressResultant(1)  +=  stress(1)*weight;
-	stressResultant(2)  +=  stress(2)*weight;
-
-	//bending moments
-	stressResultant(3)  +=  ( z*stress(0) ) * weight;
-	stressResultant(4)  +=  ( z*stress(1) ) * weight;
-	stressResultant(5)  +=  ( z*stress(2) ) * weight;
-
-	//shear
-	stressResultant(6)  += stress(3)*weight;
-	stressResultant(7)  += stress(4)*weight;
-
-      } //end for i
+    compute_zs_ws();
+    integrate_stress(zs.data(), ws.data(), 1.0, stressResultant);
     return this->stressResultant;
   }
 
@@ -300,161 +269,18 @@ const XC::Vector &XC::LayeredShellFiberSection::getStressResultant(void) const
 //send back the tangent 
 const XC::Matrix &XC::LayeredShellFiberSection::getSectionTangent(void) const
   {
-    static Matrix dd(5,5);
-
-  //  static Matrix Aeps(5,8);
-
-  //  static Matrix Asig(8,5);
-
-    double z, weight;
-    tangent.Zero( );
-    const double h_2= 0.5*h;
-    const size_t sz= theFibers.size();
-    for(size_t i = 0; i < sz; i++ )
-      {
-	z= h_2 * sg[i];
-
-	weight= h_2 * wg[i];
-
-  /*      //compute Aeps
-
-	Aeps.Zero( );
-
-	Aeps(0,0) = 1.0;
-	Aeps(0,3) = -z;
-
-	Aeps(1,1) = 1.0;
-	Aeps(1,4) = -z;
-
-	Aeps(2,2) = 1.0;
-	Aeps(2,5) = -z;
-
-	Aeps(3,6) = root56;
-	Aeps(4,7) = root56;
-
-	//compute Asig
-
-	Asig.Zero( );
-
-	Asig(0,0) = 1.0;
-	Asig(3,0) = z;
-
-	Asig(1,1) = 1.0;
-	Asig(4,1) = z;
-
-	Asig(2,2) = 1.0;
-	Asig(5,2) = z;
-
-	Asig(6,3) = root56;
-	Asig(7,4) = root56;
-  */
-
-	//compute the tangent
-
-	dd= theFibers[i]->getTangent( );
-	dd*= weight;
-
-	//tangent +=  ( Asig * dd * Aeps );   
-
-  //from MATLAB : tangent = 
-  //[      d11,           d12,           d13,        -z*d11,        -z*d12,        -z*d13,    d14,    d15]
-  //[      d21,           d22,           d23,        -z*d21,        -z*d22,        -z*d23,    d24,    d25]
-  //[      d31,           d32,           d33,        -z*d31,        -z*d32,        -z*d33,    d34,    d35]
-  //[     z*d11,         z*d12,         z*d13,      -z^2*d11,      -z^2*d12,      -z^2*d13,  z*d14,  z*d15]
-  //[     z*d21,         z*d22,         z*d23,      -z^2*d21,      -z^2*d22,      -z^2*d23,  z*d24,  z*d25]
-  //[     z*d31,         z*d32,         z*d33,      -z^2*d31,      -z^2*d32,      -z^2*d33,  z*d34,  z*d35]
-  //[       d41,           d42,           d43,        -d41*z,        -d42*z,        -d43*z,    d44,    d45]
-  //[       d51,           d52,           d53,        -d51*z,        -d52*z,        -d53*z,    d54,    d55]
-
-	//row 1
-  //[      d11,           d12,           d13,        -z*d11,        -z*d12,        -z*d13,    d14,    d15]
-	tangent(0,0) +=     dd(0,0);
-	tangent(0,1) +=     dd(0,1);
-	tangent(0,2) +=     dd(0,2);      
-	tangent(0,3) +=  -z*dd(0,0);      
-	tangent(0,4) +=  -z*dd(0,1);
-	tangent(0,5) +=  -z*dd(0,2);
-	tangent(0,6) +=     dd(0,3);
-	tangent(0,7) +=     dd(0,4);
-
-	//row 2
-  //[      d21,           d22,           d23,        -z*d21,        -z*d22,        -z*d23,    d24,    d25]
-	tangent(1,0) +=     dd(1,0);
-	tangent(1,1) +=     dd(1,1);
-	tangent(1,2) +=     dd(1,2);      
-	tangent(1,3) +=  -z*dd(1,0);      
-	tangent(1,4) +=  -z*dd(1,1);
-	tangent(1,5) +=  -z*dd(1,2);
-	tangent(1,6) +=     dd(1,3);
-	tangent(1,7) +=     dd(1,4);
-
-	//row 3
-  //[      d31,           d32,           d33,        -z*d31,        -z*d32,        -z*d33,    d34,    d35]
-	tangent(2,0) +=     dd(2,0);
-	tangent(2,1) +=     dd(2,1);
-	tangent(2,2) +=     dd(2,2);      
-	tangent(2,3) +=  -z*dd(2,0);      
-	tangent(2,4) +=  -z*dd(2,1);
-	tangent(2,5) +=  -z*dd(2,2);
-	tangent(2,6) +=     dd(2,3);
-	tangent(2,7) +=     dd(2,4);
-
-	//row 4
-  //[     z*d11,         z*d12,         z*d13,      -z^2*d11,      -z^2*d12,      -z^2*d13,  z*d14,  z*d15]
-	tangent(3,0) +=     z*dd(0,0);
-	tangent(3,1) +=     z*dd(0,1);
-	tangent(3,2) +=     z*dd(0,2);      
-	tangent(3,3) +=  -z*z*dd(0,0);      
-	tangent(3,4) +=  -z*z*dd(0,1);
-	tangent(3,5) +=  -z*z*dd(0,2);
-	tangent(3,6) +=     z*dd(0,3);
-	tangent(3,7) +=     z*dd(0,4);
-
-	//row 5
-  //[     z*d21,         z*d22,         z*d23,      -z^2*d21,      -z^2*d22,      -z^2*d23,  z*d24,  z*d25]
-	tangent(4,0) +=     z*dd(1,0);
-	tangent(4,1) +=     z*dd(1,1);
-	tangent(4,2) +=     z*dd(1,2);      
-	tangent(4,3) +=  -z*z*dd(1,0);      
-	tangent(4,4) +=  -z*z*dd(1,1);
-	tangent(4,5) +=  -z*z*dd(1,2);
-	tangent(4,6) +=     z*dd(1,3);
-	tangent(4,7) +=     z*dd(1,4);
-
-	//row 6
-  //[     z*d31,         z*d32,         z*d33,      -z^2*d31,      -z^2*d32,      -z^2*d33,  z*d34,  z*d35]
-	tangent(5,0) +=     z*dd(2,0);
-	tangent(5,1) +=     z*dd(2,1);
-	tangent(5,2) +=     z*dd(2,2);      
-	tangent(5,3) +=  -z*z*dd(2,0);      
-	tangent(5,4) +=  -z*z*dd(2,1);
-	tangent(5,5) +=  -z*z*dd(2,2);
-	tangent(5,6) +=     z*dd(2,3);
-	tangent(5,7) +=     z*dd(2,4);
-
-	//row 7
-  //[  d41,    d42,    d43, -d41*z, -d42*z, -d43*z,  d44,  d45]
-	tangent(6,0) +=     dd(3,0);
-	tangent(6,1) +=     dd(3,1);
-	tangent(6,2) +=     dd(3,2);      
-	tangent(6,3) +=  -z*dd(3,0);      
-	tangent(6,4) +=  -z*dd(3,1);
-	tangent(6,5) +=  -z*dd(3,2);
-	tangent(6,6) +=     dd(3,3);
-	tangent(6,7) +=     dd(3,4);
-
-	//row 8 
-  //[  d51,    d52,    d53, -d51*z, -d52*z, -d53*z,  d54,  d55]
-	tangent(7,0) +=     dd(4,0);
-	tangent(7,1) +=     dd(4,1);
-	tangent(7,2) +=     dd(4,2);      
-	tangent(7,3) +=  -z*dd(4,0);      
-	tangent(7,4) +=  -z*dd(4,1);
-	tangent(7,5) +=  -z*dd(4,2);
-	tangent(7,6) +=     dd(4,3);
-	tangent(7,7) +=     dd(4,4);
-      } //end for i
-
+    //from MATLAB : tangent = 
+    //[      d11,           d12,           d13,        -z*d11,        -z*d12,        -z*d13,    d14,    d15]
+    //[      d21,           d22,           d23,        -z*d21,        -z*d22,        -z*d23,    d24,    d25]
+    //[      d31,           d32,           d33,        -z*d31,        -z*d32,        -z*d33,    d34,    d35]
+    //[     z*d11,         z*d12,         z*d13,      -z^2*d11,      -z^2*d12,      -z^2*d13,  z*d14,  z*d15]
+    //[     z*d21,         z*d22,         z*d23,      -z^2*d21,      -z^2*d22,      -z^2*d23,  z*d24,  z*d25]
+    //[     z*d31,         z*d32,         z*d33,      -z^2*d31,      -z^2*d32,      -z^2*d33,  z*d34,  z*d35]
+    //[       d41,           d42,           d43,        -d41*z,        -d42*z,        -d43*z,    d44,    d45]
+    //[       d51,           d52,           d53,        -d51*z,        -d52*z,        -d53*z,    d54,    d55]
+    // integrated over the thickness (see PlateFiberLayers::integrateTangent).
+    compute_zs_ws();
+    integrate_tangent(zs.data(), ws.data(), 1.0, tangent);
     return this->tangent;
   }
 
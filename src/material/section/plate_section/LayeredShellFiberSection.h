@@ -73,8 +73,11 @@ class LayeredShellFiberSection : public MembranePlateFiberSectionBase
     //quadrature data
     std::vector<double> sg; //Gauss integration.
     std::vector<double> wg;
+    mutable std::vector<double> zs; //!< z coordinates of the layers.
+    mutable std::vector<double> ws; //!< integration weights of the layers.
 
     static ResponseId array;
+    void compute_zs_ws(void) const;
   protected:
     void setHWgSg(const std::vector<double> &);
   public:
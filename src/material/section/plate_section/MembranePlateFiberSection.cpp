@@ -157,6 +157,19 @@ std::vector<std::pair<double, double> > XC::MembranePlateFiberSection::getFiberZ
     return retval;
   }
 
+//! @brief Compute the z coordinate and the weight of each fiber in
+//! the arrays argument.
+void XC::MembranePlateFiberSection::get_zs_ws(double z[numFibers], double w[numFibers]) const
+  {
+    const double *sg= (integrationType == 0) ? sgLobatto : sgGauss;
+    const double *wg= (integrationType == 0) ? wgLobatto : wgGauss;
+    const double h_2= 0.5*h;
+    for(int i = 0; i < numFibers; i++)
+      {
+	z[i]= h_2 * sg[i];
+	w[i]= h_2 * wg[i];
+      }
+  }
 
 void XC::MembranePlateFiberSection::setIntegrationType(const std::string &integrType)
   {
@@ -219,6 +232,7 @@ void XC::MembranePlateFiberSection::setArealRho(const double &r)
 int XC::MembranePlateFiberSection::setInitialSectionDeformation(const Vector &initialStrain_from_element)
   {
     this->initialStrain = initialStrain_from_element;
+    layers.invalidate();
 
     static Vector strain(numFibers);
     int success= 0;
@@ -247,50 +261,16 @@ void XC::MembranePlateFiberSection::zeroInitialSectionDeformation(void)
 int XC::MembranePlateFiberSection::setTrialSectionDeformation(const Vector &strainResultant_from_element)
   {
     this->strainResultant = strainResultant_from_element;
-
-    static Vector strain(numFibers);
-    int success= 0;
     const std::vector<double> fiberZ= getFiberZs();
-    for(int i = 0; i < numFibers; i++ )
-      {
-        const double &z= fiberZ[i];
-        strain(0)=  strainResultant(0)  - z*strainResultant(3);
-        strain(1)=  strainResultant(1)  - z*strainResultant(4);
-        strain(2)=  strainResultant(2)  - z*strainResultant(5);
-        strain(3)=  root56*strainResultant(6);
-        strain(4)=  root56*strainResultant(7);
-        success+= theFibers[i]->setTrialStrain(strain);
-      } //end for i
-    return success;
+    return set_trial_layers(fiberZ.data(), root56);
   }
 
 //! @brief Return stress resultant.
 const XC::Vector &XC::MembranePlateFiberSection::getStressResultant(void) const
   {
-    static Vector stress(numFibers);
-    stressResultant.Zero( );
-
-    const std::vector< std::pair<double, double> > zsAndWeights= getFiberZsAndWeights();
-    for(int i = 0; i < numFibers; i++ )
-      {
-        const double &z= zsAndWeights[i].first;
-        const double &weight= zsAndWeights[i].second;
-        stress= theFibers[i]->getStress();
-        //membrane
-        stressResultant(0)+= stress(0)*weight;
-        stressResultant(1)+= stress(1)*weight;
-        stressResultant(2)+= stress(2)*weight;
-        //bending moments
-        stressResultant(3)+= ( z*stress(0) ) * weight;
-        stressResultant(4)+= ( z*stress(1) ) * weight;
-        stressResultant(5)+= ( z*stress(2) ) * weight;
-        //shear
-        stressResultant(6)+= stress(3)*weight;
-        stressResultant(7)+= stress(4)*weight;
-      } //end for i
-    //modify shear 
-    stressResultant(6)*= root56;  
-    stressResultant(7)*= root56;
+    double z[numFibers], weight[numFibers];
+    get_zs_ws(z, weight);
+    integrate_stress(z, weight, root56, stressResultant);
     return this->stressResultant;
   }
 
@@ -298,55 +278,6 @@ const XC::Vector &XC::MembranePlateFiberSection::getStressResultant(void) const
 //! @brief Return the tangent stiffness matrix.
 const XC::Matrix &XC::MembranePlateFiberSection::getSectionTangent(void) const
   {
-    static Matrix dd(numFibers,numFibers);
-    static Matrix Aeps(numFibers,order);
-    static Matrix Asig(order,numFibers);
-
-    tangent.Zero( );
-
-    const std::vector< std::pair<double, double> > zsAndWeights= getFiberZsAndWeights();
-    for(int i = 0; i < numFibers; i++)
-      {
-        const double &z= zsAndWeights[i].first;
-        const double &weight= zsAndWeights[i].second;
-/*      //compute Aeps
-
-      Aeps.Zero( );
-
-      Aeps(0,0)= 1.0;
-      Aeps(0,3)= -z;
-
-      Aeps(1,1)= 1.0;
-      Aeps(1,4)= -z;
-
-      Aeps(2,2)= 1.0;
-      Aeps(2,5)= -z;
-
-      Aeps(3,6)= root56;
-      Aeps(4,7)= root56;
-
-      //compute Asig
-
-      Asig.Zero( );
-
-      Asig(0,0)= 1.0;
-      Asig(3,0)= z;
-
-      Asig(1,1)= 1.0;
-      Asig(4,1)= z;
-
-      Asig(2,2)= 1.0;
-      Asig(5,2)= z;
-
-      Asig(6,3)= root56;
-      Asig(7,4)= root56;
-*/
-      //compute the tangent
-      dd= theFibers[i]->getTangent( );
-      dd*= weight;
-
-      //tangent +=  ( Asig * dd * Aeps );   
-
 //from MATLAB : tangent = 
 //[      d11,           d12,           d13,        -z*d11,        -z*d12,        -z*d13,    d14*root56,    d15*root56]
 //[      d21,           d22,           d23,        -z*d21,        -z*d22,        -z*d23,    d24*root56,    d25*root56]
@@ -356,98 +287,11 @@ const XC::Matrix &XC::MembranePlateFiberSection::getSectionTangent(void) const
 //[     z*d31,         z*d32,         z*d33,      -z^2*d31,      -z^2*d32,      -z^2*d33,  z*d34*root56,  z*d35*root56]
 //[  root56*d41,    root56*d42,    root56*d43, -root56*d41*z, -root56*d42*z, -root56*d43*z,  root56^2*d44,  root56^2*d45]
 //[  root56*d51,    root56*d52,    root56*d53, -root56*d51*z, -root56*d52*z, -root56*d53*z,  root56^2*d54,  root56^2*d55]
- 
-      //row 1
-//[      d11,           d12,           d13,        -z*d11,        -z*d12,        -z*d13,    d14*root56,    d15*root56]
-      tangent(0,0) +=  dd(0,0);
-      tangent(0,1) +=  dd(0,1);
-      tangent(0,2) +=  dd(0,2);      
-      tangent(0,3) +=  -z*dd(0,0);      
-      tangent(0,3) +=  -z*dd(0,1);
-      tangent(0,5) +=  -z*dd(0,2);
-      tangent(0,6) +=  root56*dd(0,3);
-      tangent(0,7) +=  root56*dd(0,4);
-
-      //row 2
-//[      d21,           d22,           d23,        -z*d21,        -z*d22,        -z*d23,    d24*root56,    d25*root56]
-      tangent(1,0) +=  dd(1,0);
-      tangent(1,1) +=  dd(1,1);
-      tangent(1,2) +=  dd(1,2);      
-      tangent(1,3) +=  -z*dd(1,0);      
-      tangent(1,4) +=  -z*dd(1,1);
-      tangent(1,5) +=  -z*dd(1,2);
-      tangent(1,6) +=  root56*dd(1,3);
-      tangent(1,7) +=  root56*dd(1,4);
-
-      //row 3
-//[      d31,           d32,           d33,        -z*d31,        -z*d32,        -z*d33,    d34*root56,    d35*root56]
-      tangent(2,0) +=  dd(2,0);
-      tangent(2,1) +=  dd(2,1);
-      tangent(2,2) +=  dd(2,2);      
-      tangent(2,3) +=  -z*dd(2,0);      
-      tangent(2,4) +=  -z*dd(2,1);
-      tangent(2,5) +=  -z*dd(2,2);
-      tangent(2,6) +=  root56*dd(2,3);
-      tangent(2,7) +=  root56*dd(2,4);
-
-      //row 4
-//[     z*d11,         z*d12,         z*d13,      -z^2*d11,      -z^2*d12,      -z^2*d13,  z*d14*root56,  z*d15*root56]
-      tangent(3,0) +=  z*dd(0,0);
-      tangent(3,1) +=  z*dd(0,1);
-      tangent(3,2) +=  z*dd(0,2);      
-      tangent(3,3) +=  -z*z*dd(0,0);      
-      tangent(3,4) +=  -z*z*dd(0,1);
-      tangent(3,5) +=  -z*z*dd(0,2);
-      tangent(3,6) +=  z*root56*dd(0,3);
-      tangent(3,7) +=  z*root56*dd(0,4);
-
-      //row 5
-//[     z*d21,         z*d22,         z*d23,      -z^2*d21,      -z^2*d22,      -z^2*d23,  z*d24*root56,  z*d25*root56]
-      tangent(4,0) +=  z*dd(1,0);
-      tangent(4,1) +=  z*dd(1,1);
-      tangent(4,2) +=  z*dd(1,2);      
-      tangent(4,3) +=  -z*z*dd(1,0);      
-      tangent(4,4) +=  -z*z*dd(1,1);
-      tangent(4,5) +=  -z*z*dd(1,2);
-      tangent(4,6) +=  z*root56*dd(1,3);
-      tangent(4,7) +=  z*root56*dd(1,4);
-
-      //row 6
-//[     z*d31,         z*d32,         z*d33,      -z^2*d31,      -z^2*d32,      -z^2*d33,  z*d34*root56,  z*d35*root56]
-      tangent(5,0) +=  z*dd(2,0);
-      tangent(5,1) +=  z*dd(2,1);
-      tangent(5,2) +=  z*dd(2,2);      
-      tangent(5,3) +=  -z*z*dd(2,0);      
-      tangent(5,4) +=  -z*z*dd(2,1);
-      tangent(5,5) +=  -z*z*dd(2,2);
-      tangent(5,6) +=  z*root56*dd(2,3);
-      tangent(5,7) +=  z*root56*dd(2,4);
-
-      //row 7
-//[  root56*d41,    root56*d42,    root56*d43, -root56*d41*z, -root56*d42*z, -root56*d43*z,  root56^2*d44,  root56^2*d45]
-      tangent(6,0) +=  root56*dd(3,0);
-      tangent(6,1) +=  root56*dd(3,1);
-      tangent(6,2) +=  root56*dd(3,2);      
-      tangent(6,3) +=  -root56*z*dd(3,0);      
-      tangent(6,4) +=  -root56*z*dd(3,1);
-      tangent(6,5) +=  -root56*z*dd(3,2);
-      tangent(6,6) +=  root56*root56*dd(3,3);
-      tangent(6,7) +=  root56*root56*dd(3,4);
-
-      //row 8 
-//[  root56*d51,    root56*d52,    root56*d53, -root56*d51*z, -root56*d52*z, -root56*d53*z,  root56^2*d54,  root56^2*d55]
-      tangent(7,0) +=  root56*dd(4,0);
-      tangent(7,1) +=  root56*dd(4,1);
-      tangent(7,2) +=  root56*dd(4,2);      
-      tangent(7,3) +=  -root56*z*dd(4,0);      
-      tangent(7,4) +=  -root56*z*dd(4,1);
-      tangent(7,5) +=  -root56*z*dd(4,2);
-      tangent(7,6) +=  root56*root56*dd(4,3);
-      tangent(7,7) +=  root56*root56*dd(4,4);
-
-  } //end for i
-
-  return this->tangent;
+// integrated over the thickness (see PlateFiberLayers::integrateTangent).
+    double z[numFibers], weight[numFibers];
+    get_zs_ws(z, weight);
+    integrate_tangent(z, weight, root56, tangent);
+    return this->tangent;
   }
 
 //! @brief Print out data
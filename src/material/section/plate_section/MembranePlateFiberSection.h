@@ -89,6 +89,7 @@ class MembranePlateFiberSection: public MembranePlateFiberSectionBase
     
     int integrationType; // 0= Lobatto, 1= Gauss
 
+    void get_zs_ws(double z[numFibers], double w[numFibers]) const;
   protected:
     int sendData(Communicator &);
     int recvData(const Communicator &);
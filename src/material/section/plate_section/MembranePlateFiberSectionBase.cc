@@ -65,7 +65,10 @@ XC::Matrix XC::MembranePlateFiberSectionBase::tangent(XC::MembranePlateFiberSect
 
 //! @brief Initializes material pointers.
 void XC::MembranePlateFiberSectionBase::init(const size_t &sz)
-  { theFibers= MaterialVector<NDMaterial>(sz); }
+  {
+    layers.clear();
+    theFibers= MaterialVector<NDMaterial>(sz);
+  }
 
 //! @brief Allocates material pointers.
 void XC::MembranePlateFiberSectionBase::alloc(const size_t &sz, const NDMaterial &templ)
@@ -113,7 +116,57 @@ void XC::MembranePlateFiberSectionBase::copy_fibers(const MembranePlateFiberSect
 
 //! @brief Releases material pointers.
 void XC::MembranePlateFiberSectionBase::free(void)
-  { theFibers.clearMaterials(); }
+  {
+    layers.clear();
+    theFibers.clearMaterials();
+  }
+
+//! @brief Set the trial strains of the fibers from the section
+//! generalized strains (see PlateFiberLayers::computeStrains).
+//!
+//! @param z: z coordinate of each fiber.
+//! @param shearFactor: shear correction factor.
+int XC::MembranePlateFiberSectionBase::set_trial_layers(const double z[], const double &shearFactor)
+  {
+    if(!layers.isValid(theFibers))
+      layers.setup(theFibers);
+    layers.computeStrains(strainResultant, z, shearFactor);
+    return layers.setTrial();
+  }
+
+//! @brief Make the layer stresses and tangents correspond to the
+//! current state of the fibers.
+void XC::MembranePlateFiberSectionBase::update_layers(void) const
+  {
+    if(!layers.isValid(theFibers))
+      layers.setup(theFibers);
+    else if(!layers.isCurrent())
+      layers.refresh();
+  }
+
+//! @brief Integrate the stress resultant over the thickness.
+//!
+//! @param z: z coordinate of each fiber.
+//! @param w: weight of each fiber.
+//! @param shearFactor: shear correction factor.
+//! @param r: stress resultant (output).
+void XC::MembranePlateFiberSectionBase::integrate_stress(const double z[], const double w[], const double &shearFactor, Vector &r) const
+  {
+    update_layers();
+    layers.integrateStress(z, w, shearFactor, r);
+  }
+
+//! @brief Integrate the section tangent over the thickness.
+//!
+//! @param z: z coordinate of each fiber.
+//! @param w: weight of each fiber.
+//! @param shearFactor: shear correction factor.
+//! @param k: section tangent (output).
+void XC::MembranePlateFiberSectionBase::integrate_tangent(const double z[], const double w[], const double &shearFactor, Matrix &k) const
+  {
+    update_layers();
+    layers.integrateTangent(z, w, shearFactor, k);
+  }
 
 //! @brief Default constructor.
 XC::MembranePlateFiberSectionBase::MembranePlateFiberSectionBase(int tag, int classTag, const size_t &numFibers)
@@ -232,15 +285,24 @@ const XC::ResponseId &XC::MembranePlateFiberSectionBase::getResponseType(void) c
 
 //! @brief Swap history variables.
 int XC::MembranePlateFiberSectionBase::commitState(void) 
-  { return theFibers.commitState(); }
+  {
+    layers.invalidate();
+    return theFibers.commitState();
+  }
 
 //! @brief Revert to last committed state.
 int XC::MembranePlateFiberSectionBase::revertToLastCommit(void)
-  { return theFibers.revertToLastCommit(); }
+  {
+    layers.invalidate();
+    return theFibers.revertToLastCommit();
+  }
 
 //! @brief Revert to start.
 int XC::MembranePlateFiberSectionBase::revertToStart(void)
-  { return theFibers.revertToStart(); }
+  {
+    layers.invalidate();
+    return theFibers.revertToStart();
+  }
 
 
 //! @brief Return initial deformation.
@@ -372,6 +434,7 @@ int XC::MembranePlateFiberSectionBase::sendData(Communicator &comm)
 int XC::MembranePlateFiberSectionBase::recvData(const Communicator &comm)
   {
     int res= PlateBase::recvData(comm);
+    layers.clear();
     res+= comm.receiveMovable(theFibers,getDbTagData(),CommMetaData(7));
     res+= comm.receiveVector(strainResultant,getDbTagData(),CommMetaData(8));
     res+= comm.receiveVector(initialStrain,getDbTagData(),CommMetaData(9));
@@ -445,6 +508,7 @@ XC::Response *XC::MembranePlateFiberSectionBase::setResponse(const std::vector<s
 
 int XC::MembranePlateFiberSectionBase::setParameter(const std::vector<std::string> &argv, Parameter &param)
   {
+    layers.invalidate();
     // if the user explicitly wants to update a material in this section...
     const int argc= argv.size();
     if(argc > 1)
@@ -31,6 +31,7 @@
 
 #include "PlateBase.h"
 #include "material/MaterialVector.h"
+#include "PlateFiberLayers.h"
 
 
 namespace XC {
@@ -51,12 +52,17 @@ class MembranePlateFiberSectionBase: public PlateBase
     MaterialVector<NDMaterial> theFibers; //!< pointers to five materials (fibers)
     Vector strainResultant;
     Vector initialStrain;
+    mutable PlateFiberLayers layers; //!< contiguous layer data.
 
     void init(const size_t &);
     void alloc(const size_t &, const NDMaterial &);
     void alloc(const std::vector<NDMaterial *> &);
     void copy_fibers(const MembranePlateFiberSectionBase &);
     void free(void);
+    int set_trial_layers(const double z[], const double &);
+    void update_layers(void) const;
+    void integrate_stress(const double z[], const double w[], const double &, Vector &) const;
+    void integrate_tangent(const double z[], const double w[], const double &, Matrix &) const;
   protected:
     int sendData(Communicator &);
     int recvData(const Communicator &);
@@ -0,0 +1,263 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis C. Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//PlateFiberLayers.cc
+
+#include "PlateFiberLayers.h"
+#include "material/nD/NDMaterial.h"
+#include "utility/matrix/Vector.h"
+#include "utility/matrix/Matrix.h"
+#include "utility/matrix/FixedMatrix.h"
+#include <algorithm>
+#include <numeric>
+
+//! @brief Constructor.
+XC::PlateFiberLayers::PlateFiberLayers(void)
+  : valid(false), current(false) {}
+
+//! @brief Copy constructor.
+//!
+//! The arrays point to the materials of the copied section so they
+//! are not copied, the new object must be set up again.
+XC::PlateFiberLayers::PlateFiberLayers(const PlateFiberLayers &)
+  : valid(false), current(false) {}
+
+//! @brief Assignment operator (the arrays must be set up again).
+XC::PlateFiberLayers &XC::PlateFiberLayers::operator=(const PlateFiberLayers &)
+  {
+    clear();
+    return *this;
+  }
+
+//! @brief Invalidate the arrays and release its memory.
+void XC::PlateFiberLayers::clear(void)
+  {
+    valid= false;
+    current= false;
+    materials.clear();
+    types.clear();
+    layer.clear();
+    strain.clear();
+    stress.clear();
+    tangent.clear();
+    groups.clear();
+  }
+
+//! @brief Return true if the arrays correspond to the layer materials
+//! argument.
+//!
+//! Checks that each layer has still the same material object and
+//! that its class has not changed, so the arrays are rebuilt when a
+//! material is replaced even if the number of layers is the same.
+//!
+//! @param layerMaterials: layer materials (in the original layer order).
+bool XC::PlateFiberLayers::isValid(const std::vector<NDMaterial *> &layerMaterials) const
+  {
+    bool retval= (valid && (materials.size()==layerMaterials.size()));
+    const size_t numLayers= materials.size();
+    for(size_t i= 0;retval && (i<numLayers);i++)
+      {
+        const NDMaterial *m= layerMaterials[layer[i]];
+        retval= (m==materials[i]) && (m!=nullptr) && (std::type_index(typeid(*m))==types[i]);
+      }
+    return retval;
+  }
+
+//! @brief Fill the arrays from the layer materials argument.
+void XC::PlateFiberLayers::setup(const std::vector<NDMaterial *> &layerMaterials)
+  {
+    const size_t numLayers= layerMaterials.size();
+    // Sort the layers by the type of its material, keeping its order
+    // inside each group.
+    std::vector<std::type_index> keys;
+    keys.reserve(numLayers);
+    for(size_t i= 0;i<numLayers;i++)
+      keys.push_back(std::type_index(typeid(*layerMaterials[i])));
+    layer.resize(numLayers);
+    std::iota(layer.begin(), layer.end(), 0);
+    std::stable_sort(layer.begin(), layer.end(), [&keys](const size_t &a, const size_t &b) { return keys[a]<keys[b]; });
+
+    materials.resize(numLayers);
+    types.clear();
+    types.reserve(numLayers);
+    strain.assign(fiberOrder*numLayers, 0.0);
+    stress.assign(fiberOrder*numLayers, 0.0);
+    tangent.assign(fiberOrder*fiberOrder*numLayers, 0.0);
+    groups.clear();
+    for(size_t i= 0;i<numLayers;i++)
+      {
+        materials[i]= layerMaterials[layer[i]];
+        types.push_back(keys[layer[i]]);
+        if((i==0) || (keys[layer[i]]!=keys[layer[i-1]]))
+          groups.push_back(MaterialGroup{i, i+1});
+        else
+          groups.back().end= i+1;
+      }
+    valid= true;
+    refresh();
+  }
+
+//! @brief Compute the layer strains from the generalized strains
+//! of the section:
+//! \f$\epsilon_m= e_m - z \kappa\f$, \f$\gamma= s\, e_s\f$.
+//!
+//! @param e: section generalized strains (membrane, curvatures and shear).
+//! @param z: z coordinate of each layer (in the original layer order).
+//! @param shearFactor: shear correction factor.
+void XC::PlateFiberLayers::computeStrains(const Vector &e, const double z[], const double &shearFactor)
+  {
+    const size_t numLayers= size();
+    const double e0= e(0), e1= e(1), e2= e(2);
+    const double k0= e(3), k1= e(4), k2= e(5);
+    const double g0= shearFactor*e(6), g1= shearFactor*e(7);
+    const size_t *pl= layer.data();
+    double *pe= strain.data();
+    for(size_t i= 0;i<numLayers;i++)
+      {
+        const double zi= z[pl[i]];
+        double *ei= pe+fiberOrder*i;
+        ei[0]= e0-zi*k0;
+        ei[1]= e1-zi*k1;
+        ei[2]= e2-zi*k2;
+        ei[3]= g0;
+        ei[4]= g1;
+      }
+  }
+
+//! @brief Set the trial strains of the layer materials and store the
+//! resulting stresses and tangents.
+int XC::PlateFiberLayers::setTrial(void)
+  {
+    int retval= 0;
+    for(std::vector<MaterialGroup>::const_iterator ig= groups.begin();ig!=groups.end();ig++)
+      {
+        const size_t b= ig->begin;
+        const size_t n= ig->end-b;
+        retval+= materials[b]->setTrialBatch(n, &materials[b], &strain[fiberOrder*b], &stress[fiberOrder*b], &tangent[fiberOrder*fiberOrder*b]);
+      }
+    current= true;
+    return retval;
+  }
+
+//! @brief Read the stresses and tangents from the current state of
+//! the layer materials.
+void XC::PlateFiberLayers::refresh(void)
+  {
+    const size_t numLayers= size();
+    for(size_t i= 0;i<numLayers;i++)
+      {
+        const Vector &s= materials[i]->getStress();
+        const Matrix &t= materials[i]->getTangent();
+        double *si= &stress[fiberOrder*i];
+        double *ti= &tangent[fiberOrder*fiberOrder*i];
+        for(int a= 0;a<fiberOrder;a++)
+          si[a]= s(a);
+        for(int b= 0;b<fiberOrder;b++)
+          for(int a= 0;a<fiberOrder;a++)
+            ti[fiberOrder*b+a]= t(a,b);
+      }
+    current= true;
+  }
+
+//! @brief Integrate the stress resultant over the thickness.
+//!
+//! @param z: z coordinate of each layer (in the original layer order).
+//! @param w: weight of each layer (in the original layer order).
+//! @param shearFactor: shear correction factor.
+//! @param r: section stress resultant (output).
+void XC::PlateFiberLayers::integrateStress(const double z[], const double w[], const double &shearFactor, Vector &r) const
+  {
+    const size_t numLayers= size();
+    const size_t *pl= layer.data();
+    const double *ps= stress.data();
+    double r0= 0.0, r1= 0.0, r2= 0.0, r3= 0.0, r4= 0.0, r5= 0.0, r6= 0.0, r7= 0.0;
+    for(size_t i= 0;i<numLayers;i++)
+      {
+        const double zi= z[pl[i]];
+        const double wi= w[pl[i]];
+        const double *si= ps+fiberOrder*i;
+        const double f0= si[0]*wi, f1= si[1]*wi, f2= si[2]*wi;
+        //membrane
+        r0+= f0; r1+= f1; r2+= f2;
+        //bending moments
+        r3+= zi*f0; r4+= zi*f1; r5+= zi*f2;
+        //shear
+        r6+= si[3]*wi; r7+= si[4]*wi;
+      }
+    r(0)= r0; r(1)= r1; r(2)= r2;
+    r(3)= r3; r(4)= r4; r(5)= r5;
+    r(6)= shearFactor*r6; r(7)= shearFactor*r7;
+  }
+
+//! @brief Integrate the section tangent over the thickness.
+//!
+//! Accumulates the 5x5 blocks \f$A= \sum w D\f$, \f$B= \sum w z D\f$
+//! and \f$C= \sum w z^2 D\f$ and then assembles the 8x8 tangent:
+//! the row j of the section corresponds to the stress component
+//! c(j)= (0,1,2,0,1,2,3,4) multiplied by (1,1,1,z,z,z,s,s) and the
+//! column j to the strain component c(j) multiplied by
+//! (1,1,1,-z,-z,-z,s,s).
+//!
+//! @param z: z coordinate of each layer (in the original layer order).
+//! @param w: weight of each layer (in the original layer order).
+//! @param shearFactor: shear correction factor.
+//! @param k: section tangent (output).
+void XC::PlateFiberLayers::integrateTangent(const double z[], const double w[], const double &shearFactor, Matrix &k) const
+  {
+    static constexpr int nd= fiberOrder*fiberOrder;
+    FixedMatrix<fiberOrder,fiberOrder> A, B, C;
+    double *pa= A.getDataPtr();
+    double *pb= B.getDataPtr();
+    double *pc= C.getDataPtr();
+    const size_t numLayers= size();
+    const size_t *pl= layer.data();
+    const double *pt= tangent.data();
+    for(size_t i= 0;i<numLayers;i++)
+      {
+        const double zi= z[pl[i]];
+        const double wi= w[pl[i]];
+        const double *di= pt+nd*i;
+#pragma omp simd
+        for(int j= 0;j<nd;j++)
+          {
+            const double d= wi*di[j];
+            pa[j]+= d;
+            pb[j]+= zi*d;
+            pc[j]+= zi*zi*d;
+          }
+      }
+    const FixedMatrix<fiberOrder,fiberOrder> *blocks[3]= {&A, &B, &C};
+    static const int comp[sectionOrder]= {0, 1, 2, 0, 1, 2, 3, 4};
+    static const int power[sectionOrder]= {0, 0, 0, 1, 1, 1, 0, 0};
+    const double rowFactor[sectionOrder]= {1.0, 1.0, 1.0, 1.0, 1.0, 1.0, shearFactor, shearFactor};
+    const double colFactor[sectionOrder]= {1.0, 1.0, 1.0, -1.0, -1.0, -1.0, shearFactor, shearFactor};
+    for(int col= 0;col<sectionOrder;col++)
+      for(int row= 0;row<sectionOrder;row++)
+        {
+          const FixedMatrix<fiberOrder,fiberOrder> &M= *blocks[power[row]+power[col]];
+          k(row,col)= rowFactor[row]*colFactor[col]*M(comp[row],comp[col]);
+        }
+  }
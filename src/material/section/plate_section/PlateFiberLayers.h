@@ -0,0 +1,110 @@
+// -*-c++-*-
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis C. Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//PlateFiberLayers.h
+
+#ifndef PlateFiberLayers_h
+#define PlateFiberLayers_h
+
+#include <vector>
+#include <cstddef>
+#include <typeindex>
+
+namespace XC {
+class NDMaterial;
+class Vector;
+class Matrix;
+
+//! @ingroup MATPLAC
+//
+//! @brief Contiguous representation of the layers (fibers) of a
+//! plate/membrane fiber section.
+//!
+//! Stores the layer strains, stresses and tangents in contiguous
+//! arrays with the layers sorted so the ones whose materials share
+//! the same class are consecutive. This way each group of materials
+//! is updated with a single call to NDMaterial::setTrialBatch and the
+//! integration over the thickness accumulates fixed size (5x5) blocks
+//! instead of assembling the 8x8 section tangent layer by layer.
+//!
+//! The z coordinates and weights of the layers are passed as arguments
+//! (in the original layer order) so the owner section keeps the
+//! responsibility of defining its integration rule.
+class PlateFiberLayers
+  {
+  public:
+    static constexpr int fiberOrder= 5; //!< order of the layer materials.
+    static constexpr int sectionOrder= 8; //!< order of the section.
+    //! @brief Range of layers whose materials share the same class.
+    struct MaterialGroup
+      {
+        size_t begin; //!< index of the first layer of the group.
+        size_t end; //!< one past the index of the last layer of the group.
+      };
+  private:
+    bool valid; //!< true if the arrays correspond to the current materials.
+    bool current; //!< true if stress and tangent correspond to the current trial state.
+    std::vector<NDMaterial *> materials; //!< layer materials (sorted by class).
+    std::vector<std::type_index> types; //!< class of each (sorted) layer material when the arrays were set up.
+    std::vector<size_t> layer; //!< original index of each (sorted) layer.
+    std::vector<double> strain; //!< layer trial strains (5 values per layer).
+    std::vector<double> stress; //!< layer trial stresses (5 values per layer).
+    std::vector<double> tangent; //!< layer tangents (5x5 column-major per layer).
+    std::vector<MaterialGroup> groups; //!< material groups.
+  public:
+    PlateFiberLayers(void);
+    PlateFiberLayers(const PlateFiberLayers &);
+    PlateFiberLayers &operator=(const PlateFiberLayers &);
+
+    void clear(void);
+    bool isValid(const std::vector<NDMaterial *> &) const;
+    //! @brief Return true if the stored stresses and tangents
+    //! correspond to the current trial state of the materials.
+    inline bool isCurrent(void) const
+      { return current; }
+    //! @brief Mark the stored stresses and tangents as outdated
+    //! (the state of the materials has been changed from outside).
+    inline void invalidate(void)
+      { current= false; }
+    void setup(const std::vector<NDMaterial *> &);
+    //! @brief Return the number of layers.
+    inline size_t size(void) const
+      { return materials.size(); }
+    //! @brief Return the material groups.
+    inline const std::vector<MaterialGroup> &getMaterialGroups(void) const
+      { return groups; }
+
+    void computeStrains(const Vector &, const double z[], const double &);
+    int setTrial(void);
+    void refresh(void);
+    void integrateTangent(const double z[], const double w[], const double &, Matrix &) const;
+    void integrateStress(const double z[], const double w[], const double &, Vector &) const;
+  };
+
+} // end of XC namespace
+
+#endif
@@ -64,6 +64,7 @@
 #include "domain/component/Parameter.h"
 #include <utility/matrix/Vector.h>
 #include "domain/mesh/element/utils/Information.h"
+#include <cfloat>
 
 
 //! @brief Constructor.
@@ -104,6 +105,33 @@ int XC::ElasticMaterial::setTrial(double strain, double &stress, double &tangent
     return 0;
   }
 
+//! @brief Set the trial strains of a batch of elastic materials and
+//! return its stresses and tangents (zero strain rate is assumed).
+int XC::ElasticMaterial::setTrialBatch(const size_t &n, UniaxialMaterial *const materials[], const double strains[], double stresses[], double tangents[]) const
+  {
+    if(typeid(*this)!=typeid(ElasticMaterial)) // derived class.
+      return UniaxialMaterial::setTrialBatch(n, materials, strains, stresses, tangents);
+    for(size_t i= 0;i<n;i++)
+      {
+        ElasticMaterial *m= static_cast<ElasticMaterial *>(materials[i]);
+        const double strain= strains[i];
+        m->trialStrain= strain;
+        m->trialStrainRate= 0.0;
+        stresses[i]= m->E*(strain-m->getInitialStrain());
+        tangents[i]= m->E;
+      }
+    return 0;
+  }
+
+//! @brief The material is linear for any strain (see
+//! UniaxialMaterial::getLinearRange).
+bool XC::ElasticMaterial::getLinearRange(double &strainMin, double &strainMax) const
+  {
+    strainMin= -DBL_MAX;
+    strainMax= DBL_MAX;
+    return true;
+  }
+
 //! @brief Returns the product of \f$E * \epsilon\f$, where \f$\epsilon\f$ is
 //! the current trial strain.
 double XC::ElasticMaterial::getStress(void) const
@@ -118,3 +118,43 @@ XC::ElasticPPMaterial::ElasticPPMaterial(int tag)
 XC::UniaxialMaterial *XC::ElasticPPMaterial::getCopy(void) const
   { return new ElasticPPMaterial(*this); }
 
+//! @brief Set the trial strains of a batch of elastic perfectly plastic
+//! materials and return its stresses and tangents.
+//!
+//! Same algorithm that ElasticPPMaterialBase::setTrialStrain written
+//! without branches.
+int XC::ElasticPPMaterial::setTrialBatch(const size_t &n, UniaxialMaterial *const materials[], const double strains[], double stresses[], double tangents[]) const
+  {
+    if(typeid(*this)!=typeid(ElasticPPMaterial)) // derived class.
+      return UniaxialMaterial::setTrialBatch(n, materials, strains, stresses, tangents);
+    for(size_t i= 0;i<n;i++)
+      {
+        ElasticPPMaterial *m= static_cast<ElasticPPMaterial *>(materials[i]);
+        const double strain= strains[i];
+        const double E= m->E;
+        const double sigtrial= E*(strain-m->getInitialStrain()-m->ep); // trial stress
+        const double f= (sigtrial>=0.0) ? (sigtrial-m->fyp) : (m->fyn-sigtrial); //yield function
+        const bool elastic= (f<=-E*DBL_EPSILON);
+        const double fy= (sigtrial>0.0) ? m->fyp : m->fyn;
+        const double stress= elastic ? sigtrial : fy;
+        const double tangent= elastic ? E : 0.0;
+        m->trialStrain= strain;
+        m->trialStress= stress;
+        m->trialTangent= tangent;
+        stresses[i]= stress;
+        tangents[i]= tangent;
+      }
+    return 0;
+  }
+
+//! @brief Compute the strain interval in which the material remains
+//! elastic starting from its last committed state (see
+//! UniaxialMaterial::getLinearRange).
+bool XC::ElasticPPMaterial::getLinearRange(double &strainMin, double &strainMax) const
+  {
+    const double eRef= getInitialStrain()+ep;
+    strainMin= eRef+fyn/E+DBL_EPSILON;
+    strainMax= eRef+fyp/E-DBL_EPSILON;
+    return (strainMin<strainMax);
+  }
+
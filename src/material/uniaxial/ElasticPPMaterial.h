@@ -60,6 +60,8 @@ class ElasticPPMaterial: public ElasticPPMaterialBase
     ElasticPPMaterial(int tag, double E, double eyp);    
     ElasticPPMaterial(int tag, double E, double eyp, double eyn, double ezero);
     UniaxialMaterial *getCopy(void) const;    
+    int setTrialBatch(const size_t &, UniaxialMaterial *const [], const double [], double [], double []) const;
+    bool getLinearRange(double &, double &) const;
 
     void set_fyp(const double &);
     void set_fyn(const double &);
@@ -92,6 +92,67 @@ int XC::UniaxialMaterial::setTrial(double strain, double &stress, double &tangen
     return res;
   }
 
+//! @brief Set the trial strains of a batch of materials of the same
+//! class that this one and return its stresses and tangents.
+//!
+//! This generic implementation calls setTrial for each material;
+//! the derived classes can override it with implementations that
+//! avoid the virtual calls and vectorize the computation.
+//!
+//! @param n: number of materials.
+//! @param materials: materials to update.
+//! @param strains: trial strains.
+//! @param stresses: computed stresses.
+//! @param tangents: computed tangents.
+int XC::UniaxialMaterial::setTrialBatch(const size_t &n, UniaxialMaterial *const materials[], const double strains[], double stresses[], double tangents[]) const
+  {
+    int retval= 0;
+    for(size_t i= 0;i<n;i++)
+      retval+= materials[i]->setTrial(strains[i], stresses[i], tangents[i]);
+    return retval;
+  }
+
+//! @brief Return the number of doubles needed to store the trial
+//! (or the committed) state of the material in a MaterialStateArena.
+//!
+//! The materials that return a non-zero value must store all its
+//! state in those blocks and its commitState and revertToLastCommit
+//! methods must be equivalent to copying one block into the other.
+//! Zero (default) means that the material doesn't support the arena.
+size_t XC::UniaxialMaterial::getStateBlockSize(void) const
+  { return 0; }
+
+//! @brief Move the trial and committed state of the material to the
+//! blocks argument (see MaterialStateArena).
+void XC::UniaxialMaterial::bindStateBlocks(double *, double *)
+  {
+    std::cerr << getClassName() << "::" << __FUNCTION__
+              << "; this material doesn't support state arenas."
+              << std::endl;
+  }
+
+//! @brief Move the state of the material back from the
+//! blocks of the arena to the material itself.
+void XC::UniaxialMaterial::unbindStateBlocks(void)
+  {}
+
+//! @brief Compute the strain interval in which the response of the
+//! material is linear, starting from its last committed state.
+//!
+//! If it returns true, for any trial strain in [strainMin, strainMax]
+//! the tangent is constant and the stress is a linear function of the
+//! strain. This is used by the fiber sections to skip the fiber
+//! updates while the section remains elastic (see FiberElasticRange).
+//! The default implementation returns false (no linear range known).
+//! @param strainMin: lower bound of the interval.
+//! @param strainMax: upper bound of the interval.
+bool XC::UniaxialMaterial::getLinearRange(double &strainMin, double &strainMax) const
+  {
+    strainMin= 0.0;
+    strainMax= 0.0;
+    return false;
+  }
+
 //! @brief Return the initial strain.
 double XC::UniaxialMaterial::getInitialStrain(void) const
   { return 0.0; }
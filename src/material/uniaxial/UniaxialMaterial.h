@@ -70,6 +70,8 @@
 #define NEG_INF_STRAIN       -1.0e16
 
 #include <material/Material.h>
+#include <typeinfo>
+
 namespace XC {
 class ID;
 class Vector;
@@ -97,6 +99,9 @@ class UniaxialMaterial: public Material
   protected:
     int sendData(Communicator &);
     int recvData(const Communicator &);
+
+    template <class MaterialClass>
+    static int set_trial_batch(const UniaxialMaterial &, const size_t &, UniaxialMaterial *const [], const double [], double [], double []);
   public:
     UniaxialMaterial(int tag, int classTag);
         
@@ -114,6 +119,13 @@ class UniaxialMaterial: public Material
     //!return 0 if successful, a negative number if not.
     virtual int setTrialStrain(double strain, double strainRate = 0.0)= 0;
     virtual int setTrial(double strain, double &stress, double &tangent, double strainRate = 0.0);
+    virtual int setTrialBatch(const size_t &, UniaxialMaterial *const [], const double [], double [], double []) const;
+
+    virtual size_t getStateBlockSize(void) const;
+    virtual void bindStateBlocks(double *, double *);
+    virtual void unbindStateBlocks(void);
+
+    virtual bool getLinearRange(double &, double &) const;
 
     virtual double getInitialStrain(void) const;
     virtual double getStrain(void) const= 0;
@@ -157,6 +169,36 @@ class UniaxialMaterial: public Material
   };
 UniaxialMaterial *receiveUniaxialMaterialPtr(UniaxialMaterial *,DbTagData &,const Communicator &,const BrokedPtrCommMetaData &);
 
+//! @brief Batch update for the materials of the class MaterialClass.
+//!
+//! The calls to setTrialStrain, getStress and getTangent are qualified
+//! so they are not dispatched through the virtual table and can be
+//! inlined. If the dynamic type of the materials is a class derived
+//! from MaterialClass (which may override those methods) the generic
+//! implementation is used.
+//!
+//! @param mat: material used to check the dynamic type of the batch.
+//! @param n: number of materials.
+//! @param materials: materials to update (all of the same class as mat).
+//! @param strains: trial strains.
+//! @param stresses: computed stresses.
+//! @param tangents: computed tangents.
+template <class MaterialClass>
+int UniaxialMaterial::set_trial_batch(const UniaxialMaterial &mat, const size_t &n, UniaxialMaterial *const materials[], const double strains[], double stresses[], double tangents[])
+  {
+    if(typeid(mat)!=typeid(MaterialClass)) // derived class.
+      return mat.UniaxialMaterial::setTrialBatch(n, materials, strains, stresses, tangents);
+    int retval= 0;
+    for(size_t i= 0;i<n;i++)
+      {
+        MaterialClass *m= static_cast<MaterialClass *>(materials[i]);
+        retval+= m->MaterialClass::setTrialStrain(strains[i]);
+        stresses[i]= m->MaterialClass::getStress();
+        tangents[i]= m->MaterialClass::getTangent();
+      }
+    return retval;
+  }
+
 } // end of XC namespace
 
 
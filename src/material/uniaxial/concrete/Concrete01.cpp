@@ -374,6 +374,11 @@ int XC::Concrete01::revertToStart(void)
 XC::UniaxialMaterial* XC::Concrete01::getCopy(void) const
   { return new Concrete01(*this); }
 
+//! @brief Set the trial strains of a batch of Concrete01 materials and
+//! return its stresses and tangents (without virtual calls).
+int XC::Concrete01::setTrialBatch(const size_t &n, UniaxialMaterial *const materials[], const double strains[], double stresses[], double tangents[]) const
+  { return set_trial_batch<Concrete01>(*this, n, materials, strains, stresses, tangents); }
+
 //! @brief Send object members through the communicator argument.
 int XC::Concrete01::sendData(Communicator &comm)
   {
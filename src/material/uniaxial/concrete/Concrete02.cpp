@@ -87,14 +87,14 @@ void XC::Concrete02::setup_parameters(void)
 XC::Concrete02::Concrete02(int tag, double _fpc, double _epsc0, double _fpcu,
                        double _epscu, double _rat, double _ft, double _Ets)
   :  RawConcrete(tag, MAT_TAG_Concrete02,_fpc,_epsc0,_epscu),
-     fpcu(_fpcu), rat(_rat), ft(_ft), Ets(_Ets)
+     matpar(std::make_shared<Conc02Parameters>(_fpcu, _rat, _ft, _Ets))
   {
     setup_parameters();
   }
 
 XC::Concrete02::Concrete02(int tag):
   RawConcrete(tag, MAT_TAG_Concrete02),
-  fpcu(0.0), rat(0.0), ft(0.0), Ets(0.0)
+  matpar(std::make_shared<Conc02Parameters>())
   {
     setup_parameters();
   }
@@ -102,9 +102,25 @@ XC::Concrete02::Concrete02(int tag):
 XC::UniaxialMaterial* XC::Concrete02::getCopy(void) const
   { return new Concrete02(*this); }
 
+//! @brief Set the trial strains of a batch of Concrete02 materials and
+//! return its stresses and tangents (without virtual calls).
+int XC::Concrete02::setTrialBatch(const size_t &n, UniaxialMaterial *const materials[], const double strains[], double stresses[], double tangents[]) const
+  { return set_trial_batch<Concrete02>(*this, n, materials, strains, stresses, tangents); }
+
+//! @brief Return the fixed properties of the material ready to be
+//! modified (if they are shared with other materials they are copied
+//! first).
+XC::Conc02Parameters &XC::Concrete02::get_parameters_for_update(void)
+  {
+    if(matpar.use_count()>1)
+      matpar= std::make_shared<Conc02Parameters>(*matpar);
+    return *matpar;
+  }
+
 //! @brief Assigns concrete compressive strength.
 void XC::Concrete02::setFpcu(const double &d)
   {
+    double &fpcu= get_parameters_for_update().fpcu;
     fpcu= d;
     if(fpcu > 0.0)
       {
@@ -117,11 +133,12 @@ void XC::Concrete02::setFpcu(const double &d)
 
 //! @brief Returns concrete compressive strength.
 double XC::Concrete02::getFpcu(void) const
-  { return fpcu; }
+  { return matpar->fpcu; }
 
 //! @brief Assigns concrete tensile strength.
 void XC::Concrete02::setFt(const double &d)
   {
+    double &ft= get_parameters_for_update().ft;
     ft= d;
     if(ft < 0.0)
       {
@@ -134,12 +151,13 @@ void XC::Concrete02::setFt(const double &d)
 
 //! @brief Returns concrete tensile strength.
 double XC::Concrete02::getFt(void) const
-  { return ft; }
+  { return matpar->ft; }
 
 
 //! @brief tension softening stiffness (absolute value) (slope of the linear tension softening branch).
 void XC::Concrete02::setEts(const double &d)
   {
+    double &Ets= get_parameters_for_update().Ets;
     Ets= d;
     if(Ets < 0.0)
       {
@@ -152,15 +170,15 @@ void XC::Concrete02::setEts(const double &d)
 
 //! @brief Returns concrete tensile strength.
 double XC::Concrete02::getEts(void) const
-  { return Ets; }
+  { return matpar->Ets; }
 
 //! @brief ratio between unloading slope at epscu and initial slope
 void XC::Concrete02::setLambda(const double &d)
-  { rat= d; }
+  { get_parameters_for_update().rat= d; }
 
 //! @brief Returns concrete tensile strength.
 double XC::Concrete02::getLambda(void) const
-  { return rat; }
+  { return matpar->rat; }
 
 
 int XC::Concrete02::setTrialStrain(double trialStrain, double strainRate)
@@ -193,7 +211,8 @@ int XC::Concrete02::setTrialStrain(double trialStrain, double strainRate)
         // (corresponding equations are 2.31 and 2.32 
         // the strain of point R is epsR and the stress is sigmR 
     
-        const double epsr= (fpcu - rat * ec0 * epscu) / (ec0 * (1.0 - rat));
+        const double rat= matpar->rat;
+        const double epsr= (matpar->fpcu - rat * ec0 * epscu) / (ec0 * (1.0 - rat));
         const double sigmr= ec0 * epsr;
     
         // calculate the previous minimum stress sigmm from the minimum 
@@ -280,8 +299,8 @@ int XC::Concrete02::revertToStart(void)
 int XC::Concrete02::sendData(Communicator &comm)
   {
     int res= RawConcrete::sendData(comm);
-    res+= comm.sendDoubles(fpc,epsc0,fpcu,epscu,getDbTagData(),CommMetaData(2));
-    res+= comm.sendDoubles(rat,ft,Ets,hstvP.ecmin,hstvP.dept,getDbTagData(),CommMetaData(3));
+    res+= comm.sendDoubles(fpc,epsc0,matpar->fpcu,epscu,getDbTagData(),CommMetaData(2));
+    res+= comm.sendDoubles(matpar->rat,matpar->ft,matpar->Ets,hstvP.ecmin,hstvP.dept,getDbTagData(),CommMetaData(3));
     res+= comm.sendDoubles(hstvP.eps,hstvP.sig,hstvP.e,hstv.ecmin,hstv.dept,hstv.sig,getDbTagData(),CommMetaData(4));
     res+= comm.sendDoubles(hstv.e,hstv.eps,getDbTagData(),CommMetaData(5));
     return res;
@@ -291,8 +310,9 @@ int XC::Concrete02::sendData(Communicator &comm)
 int XC::Concrete02::recvData(const Communicator &comm)
   {
     int res= RawConcrete::recvData(comm);
-    res+= comm.receiveDoubles(fpc,epsc0,fpcu,epscu,getDbTagData(),CommMetaData(2));
-    res+= comm.receiveDoubles(rat,ft,Ets,hstvP.ecmin,hstvP.dept,getDbTagData(),CommMetaData(3));
+    Conc02Parameters &p= get_parameters_for_update();
+    res+= comm.receiveDoubles(fpc,epsc0,p.fpcu,epscu,getDbTagData(),CommMetaData(2));
+    res+= comm.receiveDoubles(p.rat,p.ft,p.Ets,hstvP.ecmin,hstvP.dept,getDbTagData(),CommMetaData(3));
     res+= comm.receiveDoubles(hstvP.eps,hstvP.sig,hstvP.e,hstv.ecmin,hstv.dept,hstv.sig,getDbTagData(),CommMetaData(4));
     res+= comm.receiveDoubles(hstv.e,hstv.eps,getDbTagData(),CommMetaData(5));
     return res;
@@ -354,6 +374,8 @@ void XC::Concrete02::Tens_Envlp(double epsc, double &sigc, double &Ect)
     !-----------------------------------------------------------------------*/
   
     const double Ec0= getInitialTangent();
+    const double ft= matpar->ft;
+    const double Ets= matpar->Ets;
 
     const double eps0= ft/Ec0;
     const double epsu= ft*(1.0/Ets+1.0/Ec0);
@@ -398,6 +420,7 @@ void XC::Concrete02::Compr_Envlp(double epsc, double &sigc, double &Ect)
     -----------------------------------------------------------------------*/
 
     const double Ec0= getInitialTangent();
+    const double fpcu= matpar->fpcu;
 
     const double ratLocal= epsc/epsc0;
     if(epsc>=epsc0)
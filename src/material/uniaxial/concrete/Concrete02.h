@@ -68,6 +68,7 @@
 #define Concrete02_h
 
 #include <material/uniaxial/concrete/RawConcrete.h>
+#include <memory>
 
 namespace XC {
 
@@ -115,6 +116,21 @@ struct Conc02HistoryVars
       }
   };
 
+//! @brief Concrete02 fixed properties.
+//!
+//! The copies of a material (i. e. the materials of the fibers of a
+//! section) share the same object; it is copied only when one of them
+//! modifies its values (copy on write).
+struct Conc02Parameters
+  {
+    double fpcu; //!< stress at ultimate (crushing) strain.
+    double rat; //!< ratio between unloading slope at epscu and original slope.
+    double ft; //!< concrete tensile strength.
+    double Ets; //!< tension stiffening slope.
+    inline Conc02Parameters(const double &_fpcu= 0.0, const double &_rat= 0.0, const double &_ft= 0.0, const double &_Ets= 0.0)
+      : fpcu(_fpcu), rat(_rat), ft(_ft), Ets(_Ets) {}
+  };
+
 //! @brief Printing stuff.
 inline std::ostream &operator<<(std::ostream &os,const Conc02HistoryVars &hv)
    {
@@ -131,16 +147,14 @@ class Concrete02: public RawConcrete
   private:
 
     // matpar : Concrete FIXED PROPERTIES
-    double fpcu; //!< stress at ultimate (crushing) strain.
-    double rat; //!< ratio between unloading slope at epscu and original slope.
-    double ft; //!< concrete tensile strength.
-    double Ets; //!< tension stiffening slope.
+    std::shared_ptr<Conc02Parameters> matpar; //!< fixed properties (shared between copies).
 
     // hstvP : Concrete HISTORY VARIABLES last committed step
     Conc02HistoryVars hstvP; //!< = values at previous converged step
     // hstv : Concrete HISTORY VARIABLES  current step
     Conc02HistoryVars hstv; //!< = values at current step (trial values)
 
+    Conc02Parameters &get_parameters_for_update(void);
     void Tens_Envlp(double epsc, double &sigc, double &Ect);
     void Compr_Envlp(double epsc, double &sigc, double &Ect);
   protected:
@@ -166,6 +180,7 @@ class Concrete02: public RawConcrete
     UniaxialMaterial *getCopy(void) const;
 
     int setTrialStrain(double strain, double strainRate = 0.0); 
+    int setTrialBatch(const size_t &, UniaxialMaterial *const [], const double [], double [], double []) const;
     inline double getStrain(void) const
       { return hstv.getStrain(); }
     inline double getStress(void) const
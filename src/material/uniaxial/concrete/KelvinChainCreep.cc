@@ -0,0 +1,205 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis C. Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//KelvinChainCreep.cc
+
+#include "material/uniaxial/concrete/KelvinChainCreep.h"
+#include <cmath>
+#include <algorithm>
+
+//! @brief Return the retardation times of the chain (in days, half a
+//! decade apart from 0.01 to 1e5 days).
+const std::vector<double> &XC::KelvinChainCreep::get_retardation_times(void)
+  {
+    static const std::vector<double> retval= []()
+      {
+	std::vector<double> tmp;
+	for(int k= -4;k<=10;k++)
+	  tmp.push_back(pow(10.0,k/2.0));
+	return tmp;
+      }();
+    return retval;
+  }
+
+//! @brief Return the elapsed times where the creep coefficient is sampled
+//! to fit the chain coefficients (four points per decade from 0.001 to
+//! 1e6 days).
+const std::vector<double> &XC::KelvinChainCreep::get_sample_times(void)
+  {
+    static const std::vector<double> retval= []()
+      {
+	std::vector<double> tmp;
+	for(int k= -12;k<=24;k++)
+	  tmp.push_back(pow(10.0,k/4.0));
+	return tmp;
+      }();
+    return retval;
+  }
+
+//! @brief Return the matrix that transforms the samples of the
+//! creep coefficient into the chain coefficients:
+//! \f$ P= (A^T A+\lambda I)^{-1} A^T \f$ where
+//! \f$A_{k\mu}= 1-e^{-s_k/\tau_{\mu}}\f$.
+//!
+//! The matrix depends only on the retardation and the sample times
+//! so it's computed once. The small regularization term avoids the
+//! oscillation of the coefficients.
+const std::vector<std::vector<double> > &XC::KelvinChainCreep::get_projection(void)
+  {
+    static const std::vector<std::vector<double> > retval= []()
+      {
+	const std::vector<double> &tau= get_retardation_times();
+	const std::vector<double> &s= get_sample_times();
+	const size_t n= tau.size();
+	const size_t m= s.size();
+	std::vector<std::vector<double> > A(m, std::vector<double>(n));
+	for(size_t k= 0;k<m;k++)
+	  for(size_t j= 0;j<n;j++)
+	    A[k][j]= 1.0-exp(-s[k]/tau[j]);
+	// Normal equations.
+	const double lambda= 1e-6;
+	std::vector<std::vector<double> > N(n, std::vector<double>(n, 0.0));
+	for(size_t i= 0;i<n;i++)
+	  {
+	    for(size_t j= 0;j<n;j++)
+	      for(size_t k= 0;k<m;k++)
+		N[i][j]+= A[k][i]*A[k][j];
+	    N[i][i]+= lambda;
+	  }
+	// Cholesky factorization N= L*L^T (L stored in N).
+	for(size_t j= 0;j<n;j++)
+	  {
+	    double d= N[j][j];
+	    for(size_t k= 0;k<j;k++)
+	      d-= N[j][k]*N[j][k];
+	    N[j][j]= sqrt(d);
+	    for(size_t i= j+1;i<n;i++)
+	      {
+		double v= N[i][j];
+		for(size_t k= 0;k<j;k++)
+		  v-= N[i][k]*N[j][k];
+		N[i][j]= v/N[j][j];
+	      }
+	  }
+	// Solve N*P= A^T column by column.
+	std::vector<std::vector<double> > tmp(n, std::vector<double>(m));
+	std::vector<double> x(n);
+	for(size_t k= 0;k<m;k++)
+	  {
+	    for(size_t i= 0;i<n;i++)
+	      {
+		double v= A[k][i];
+		for(size_t j= 0;j<i;j++)
+		  v-= N[i][j]*x[j];
+		x[i]= v/N[i][i];
+	      }
+	    for(size_t ii= n;ii>0;ii--)
+	      {
+		const size_t i= ii-1;
+		double v= x[i];
+		for(size_t j= i+1;j<n;j++)
+		  v-= N[j][i]*x[j];
+		x[i]= v/N[i][i];
+	      }
+	    for(size_t i= 0;i<n;i++)
+	      tmp[i][k]= x[i];
+	  }
+	return tmp;
+      }();
+    return retval;
+  }
+
+//! @brief Return the chain coefficients that fit the samples of the
+//! creep coefficient.
+std::vector<double> XC::KelvinChainCreep::fit_coefficients(const std::vector<double> &samples)
+  {
+    const std::vector<std::vector<double> > &P= get_projection();
+    const size_t n= P.size();
+    std::vector<double> retval(n, 0.0);
+    for(size_t i= 0;i<n;i++)
+      for(size_t k= 0;k<samples.size();k++)
+	retval[i]+= P[i][k]*samples[k];
+    return retval;
+  }
+
+//! @brief Constructor.
+XC::KelvinChainCreep::KelvinChainCreep(void)
+  : sum(get_retardation_times().size(), 0.0),
+    gamma(get_retardation_times().size(), 0.0),
+    tCommit(0.0), loaded(false)
+  {}
+
+//! @brief Remove the stress history.
+void XC::KelvinChainCreep::clear(void)
+  {
+    std::fill(sum.begin(), sum.end(), 0.0);
+    std::fill(gamma.begin(), gamma.end(), 0.0);
+    tCommit= 0.0;
+    loaded= false;
+  }
+
+//! @brief Update the internal variables with the increment of the
+//! elastic strain deps applied at the given time.
+//! @param time: time of the increment.
+//! @param deps: increment of the elastic strain.
+//! @param samples: values of the creep coefficient for this loading time
+//!                 at the sample times.
+void XC::KelvinChainCreep::add_increment(const double &time, const double &deps, const std::vector<double> &samples)
+  {
+    const std::vector<double> &tau= get_retardation_times();
+    if(loaded)
+      {
+	const double dt= std::max(time-tCommit, 0.0);
+	for(size_t j= 0;j<tau.size();j++)
+	  gamma[j]*= exp(-dt/tau[j]);
+      }
+    if(deps!=0.0)
+      {
+	const std::vector<double> a= fit_coefficients(samples);
+	for(size_t j= 0;j<tau.size();j++)
+	  {
+	    const double v= a[j]*deps;
+	    sum[j]+= v;
+	    gamma[j]+= v;
+	  }
+      }
+    tCommit= time;
+    loaded= true;
+  }
+
+//! @brief Return the creep strain at the given time.
+double XC::KelvinChainCreep::getCreepStrain(const double &time) const
+  {
+    double retval= 0.0;
+    if(loaded)
+      {
+	const std::vector<double> &tau= get_retardation_times();
+	const double dt= std::max(time-tCommit, 0.0);
+	for(size_t j= 0;j<tau.size();j++)
+	  retval+= sum[j]-gamma[j]*exp(-dt/tau[j]);
+      }
+    return retval;
+  }
@@ -0,0 +1,105 @@
+// -*-c++-*-
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis C. Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//KelvinChainCreep.h
+
+#ifndef KelvinChainCreep_h
+#define KelvinChainCreep_h
+
+#include <vector>
+#include <cstddef>
+
+namespace XC {
+
+//! @ingroup MatUnx
+//
+//! @brief Recursive computation of the creep strain using a
+//! Dirichlet series (Kelvin chain) approximation of the creep
+//! coefficient.
+//!
+//! The creep coefficient of each stress increment applied at time
+//! \f$t_i\f$ is approximated as:
+//! \f[
+//! \phi(t,t_i) \approx \sum_{\mu} a_{\mu}(t_i) (1-e^{-(t-t_i)/\tau_{\mu}})
+//! \f]
+//! where the retardation times \f$\tau_{\mu}\f$ are fixed (half a decade
+//! apart) and the coefficients \f$a_{\mu}(t_i)\f$ are obtained by least
+//! squares fitting of the creep coefficient for that loading age. This way
+//! the stress history is represented by two values for each
+//! retardation time, updated recursively when the state is committed,
+//! instead of by the whole list of the stress increments (see Bažant,
+//! Z.P., Wu, S.T. "Dirichlet series creep function for aging concrete",
+//! J. Eng. Mech. Div. ASCE 99, 1973).
+class KelvinChainCreep
+  {
+  private:
+    std::vector<double> sum; //!< sum of a_mu*deps of the increments.
+    std::vector<double> gamma; //!< sum of a_mu*deps*exp(-(tCommit-t_i)/tau_mu) of the increments.
+    double tCommit; //!< time of the last increment.
+    bool loaded; //!< true if some increment has been added.
+
+    static const std::vector<double> &get_retardation_times(void);
+    static const std::vector<double> &get_sample_times(void);
+    static const std::vector<std::vector<double> > &get_projection(void);
+    static std::vector<double> fit_coefficients(const std::vector<double> &);
+    void add_increment(const double &, const double &, const std::vector<double> &);
+  public:
+    KelvinChainCreep(void);
+    void clear(void);
+
+    //! @brief Return true if no increment has been added yet.
+    inline bool empty(void) const
+      { return !loaded; }
+    //! @brief Return the time of the last increment.
+    inline double getLastTime(void) const
+      { return tCommit; }
+    
+    //! @brief Add the increment of the elastic strain deps (stress
+    //! increment divided by the modulus used to normalize the creep
+    //! coefficient) applied at the given time.
+    //! @param time: time of the increment.
+    //! @param deps: increment of the elastic strain.
+    //! @param phi: creep coefficient phi(t, tp) as a function of the
+    //!             current time t and the loading time tp.
+    template <class CreepCoefficient>
+    void addIncrement(const double &time, const double &deps, const CreepCoefficient &phi)
+      {
+	const std::vector<double> &s= get_sample_times();
+	std::vector<double> samples(s.size(), 0.0);
+	if(deps!=0.0) // otherwise the creep coefficient is not needed.
+	  {
+	    for(size_t k= 0;k<s.size();k++)
+	      samples[k]= phi(time+s[k], time);
+	  }
+	add_increment(time, deps, samples);
+      }
+    double getCreepStrain(const double &) const;
+  };
+
+} // end of XC namespace
+
+#endif
@@ -102,6 +102,7 @@ void XC::TDConcrete::setup_parameters(void)
     epsP_cr = 0.0; //Added by AMK
     epsP_sh = 0.0; 
     epsP_m = 0.0; //Added by AMK
+    creepChain.clear();
 
     //Change inputs into the proper sign convention:
     epsshu = -fabs(epsshu);
@@ -151,6 +152,11 @@ XC::UniaxialMaterial *XC::TDConcrete::getCopy(void) const
 
 double XC::TDConcrete::setCreepStrain(double time, double stress)
   {
+    if(recursiveCreep) // stress history in the Kelvin chain.
+      {
+        phi_i= (count>0) ? setPhi(time,tCommit) : 0.0;
+        return creepChain.getCreepStrain(time);
+      }
     double creep;
     double runSum = 0.0;
     
@@ -230,7 +236,7 @@ int XC::TDConcrete::setTrialStrain(double trialStrain, double strainRate)
             // Calculate creep and mechanical strain, assuming stress remains constant in a time step:
             if(creepControl == 1)
 	      {
-                if(fabs(t-TIME_i[count]) <= 0.0001)
+                if(fabs(t-getLastCommitTime()) <= 0.0001)
 		  { //If t = t(i-1), use creep/shrinkage from last calculated time step
                     eps_cr = epsP_cr;
                     eps_sh = epsP_sh;
@@ -386,33 +392,41 @@ int XC::TDConcrete::commitState(void)
     ecmaxP = ecmax;
     deptP = dept;
 
-    dsig_i[count]=sig-sigP;
-    /* 5/8/2013: commented the following lines so that the DSIG_i[count+1]=sig-sigP;*/
-    //if(crack_flag == 1) {// DSIG_i will be different depending on how the fiber is cracked
-    //        if(sig < 0 && sigP > 0) { //if current step puts concrete from tension to compression, DSIG_i will be only the comp. stress
-    //                DSIG_i[count+1] = sig;
-    //        }
-    //        if(sig > 0) {// Concrete should not creep when crack is opened
-    //                DSIG_i[count+1] = 0.0;
-    //        }
-    //        if(sig > 0 && sigP < 0) {//if current step goes from compression to tension, DSIG_i will be the stress difference
-    //                DSIG_i[count+1] = sig-sigP;
-    //        }
-    //} else { //concrete is uncracked, DSIG = sig - sigP
-    //        DSIG_i[count+1] = sig-sigP;
-    //}
-    DSIG_i[count+1] = sig-sigP;
-
-    //Secant Stiffness for determination of creep strain:
-    if(fabs(eps_m/sig)>Ec)
-      { E_i[count+1] = Ec; }
+    if(recursiveCreep)
+      { // Update the Kelvin chain with the stress increment.
+        tCommit= getCurrentTime();
+        creepChain.addIncrement(tCommit, (sig-sigP)/Ec, [this](double time, double tp) { return setPhi(time, tp); });
+      }
     else
-      { E_i[count+1] = fabs(sig/eps_m); } //ADDED 7/22
-
-    if(isnan(E_i[count+1]))
-      { E_i[count+1] = Ec; }
-
-    TIME_i[count+1] = getCurrentTime();
+      {
+        dsig_i[count]=sig-sigP;
+        /* 5/8/2013: commented the following lines so that the DSIG_i[count+1]=sig-sigP;*/
+        //if(crack_flag == 1) {// DSIG_i will be different depending on how the fiber is cracked
+        //        if(sig < 0 && sigP > 0) { //if current step puts concrete from tension to compression, DSIG_i will be only the comp. stress
+        //                DSIG_i[count+1] = sig;
+        //        }
+        //        if(sig > 0) {// Concrete should not creep when crack is opened
+        //                DSIG_i[count+1] = 0.0;
+        //        }
+        //        if(sig > 0 && sigP < 0) {//if current step goes from compression to tension, DSIG_i will be the stress difference
+        //                DSIG_i[count+1] = sig-sigP;
+        //        }
+        //} else { //concrete is uncracked, DSIG = sig - sigP
+        //        DSIG_i[count+1] = sig-sigP;
+        //}
+        DSIG_i[count+1] = sig-sigP;
+
+        //Secant Stiffness for determination of creep strain:
+        if(fabs(eps_m/sig)>Ec)
+          { E_i[count+1] = Ec; }
+        else
+          { E_i[count+1] = fabs(sig/eps_m); } //ADDED 7/22
+
+        if(isnan(E_i[count+1]))
+          { E_i[count+1] = Ec; }
+
+        TIME_i[count+1] = getCurrentTime();
+      }
 
     eP = e;
     sigP = sig;
@@ -465,7 +479,8 @@ int XC::TDConcrete::commitState(void)
     //   resize();
     //}
     count++;
-    resize();
+    if(!recursiveCreep) // history vectors not used.
+      resize();
 
     return 0;
   }
@@ -499,6 +514,8 @@ int XC::TDConcrete::revertToStart(void)
     eps = 0.0;
     sig = 0.0;
     e = Ec;
+    creepChain.clear();
+    tCommit= 0.0;
 
     if(creepControl==0)
       { count= 0; }
@@ -88,6 +88,7 @@
 #define TDConcrete_h
 
 #include "material/uniaxial/concrete/TDConcreteBase.h"
+#include "material/uniaxial/concrete/KelvinChainCreep.h"
 
 namespace XC {
 
@@ -111,6 +112,7 @@ class TDConcrete : public TDConcreteBase
     double phi_i;
     
     std::vector<float> PHI_i;
+    KelvinChainCreep creepChain; //!< stress history for recursive creep computation.
 
     void Tens_Envlp (double epsc, double &sigc, double &Ect);
     void Compr_Envlp (double epsc, double &sigc, double &Ect);    
@@ -120,6 +120,7 @@ void XC::TDConcreteBase::setup_parameters(void)
     eps_m= 0.0; //Added by AMK
 
     t_load= -1.0; //Added by AMK
+    tCommit= 0.0;
     crack_flag= 0;
     iter= 0;
         
@@ -153,9 +154,18 @@ size_t XC::TDConcreteBase::resize(void)
     return newSize;
   }
 
+//! @brief Return the time of the last committed state.
+double XC::TDConcreteBase::getLastCommitTime(void) const
+  {
+    if(recursiveCreep)
+      return tCommit;
+    else
+      return TIME_i[count];
+  }
+
 //! @brief Constructor.
 XC::TDConcreteBase::TDConcreteBase(int tag, int classTag)
-  : RawConcrete(tag, classTag) {}
+  : RawConcrete(tag, classTag), recursiveCreep(false), tCommit(0.0) {}
 
 //! @brief Constructor.
 //! @param _fpc: cylinder compressive strength (this is a dummy parameter since compression behavior is linear).
@@ -166,7 +176,8 @@ XC::TDConcreteBase::TDConcreteBase(int tag, int classTag)
 //! @param _tcast: analysis time corresponding to concrete casting in days (note: concrete will not be able to take on loads until the age of 2 days).
 XC::TDConcreteBase::TDConcreteBase(int tag, int classTag, double _fpc, double _ft, double _Ec, double _beta, double _age, double _tcast): 
   RawConcrete(tag, classTag, _fpc, 0.0, 0.0),
-  ft(_ft), Ec(_Ec), age(_age), beta(_beta), tcast(_tcast)
+  ft(_ft), Ec(_Ec), age(_age), beta(_beta), tcast(_tcast),
+  recursiveCreep(false), tCommit(0.0)
   {
     // setup_parameters(); Called in the constructors of derived classes.
   }
@@ -264,6 +275,21 @@ void XC::TDConcreteBase::setTCast(const double &d)
 double XC::TDConcreteBase::getTCast(void) const
   { return tcast; }
 
+//! @brief If true, compute the creep strain using a Kelvin chain
+//! (Dirichlet series) approximation of the creep coefficient. The
+//! stress history is then represented by a fixed number of internal
+//! variables updated at each commit, so the cost of a time step doesn't
+//! depend on the number of previous steps. Otherwise, the creep strain
+//! is computed by summing the contributions of all the previous stress
+//! increments. Must be set before the analysis starts.
+void XC::TDConcreteBase::setRecursiveCreep(const bool &b)
+  { recursiveCreep= b; }
+
+//! @brief Return true if the creep strain is computed using a
+//! Kelvin chain approximation of the creep coefficient.
+bool XC::TDConcreteBase::getRecursiveCreep(void) const
+  { return recursiveCreep; }
+
 
 void XC::TDConcreteBase::setCreepOn(void)
   { creepControl= 1; }
@@ -107,6 +107,8 @@ class TDConcreteBase : public RawConcrete
     std::vector<float> dsig_i;
     std::vector<float> TIME_i; //Time from the previous time step
     std::vector<float> DTIME_i;
+    bool recursiveCreep; //!< if true compute creep using a Kelvin chain approximation instead of summing over the stress history.
+    double tCommit; //!< time of the last committed state (used with recursive creep).
 
     static int creepControl; //!< Controls creep calculation (see setTrialStrain).
     static double creepDt; 
@@ -116,6 +118,7 @@ class TDConcreteBase : public RawConcrete
     int sendData(Communicator &);
     int recvData(const Communicator &);
     size_t resize(void);
+    double getLastCommitTime(void) const;
     
   public:
     TDConcreteBase(int tag, int classTag);
@@ -141,6 +144,8 @@ class TDConcreteBase : public RawConcrete
     double getAge(void) const;
     void setTCast(const double &);
     double getTCast(void) const;
+    void setRecursiveCreep(const bool &);
+    bool getRecursiveCreep(void) const;
     
     int sendSelf(Communicator &);  
     int recvSelf(const Communicator &);
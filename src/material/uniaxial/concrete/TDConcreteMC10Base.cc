@@ -68,6 +68,8 @@ void XC::TDConcreteMC10Base::setup_parameters(void)
     epsP_shb = 0.0; //Added by ntosic
     epsP_shd = 0.0; //Added by ntosic
     epsP_m = 0.0; //Added by AMK
+    creepChainBasic.clear();
+    creepChainDrying.clear();
 	
     //Change inputs into the proper sign convention: ntosic: changed
     epsba = -fabs(epsba);
@@ -87,6 +89,16 @@ size_t XC::TDConcreteMC10Base::resize(void)
     return newSize;
   }
 
+//! @brief Update the Kelvin chains with the stress increment of the
+//! committed state (recursive creep computation).
+void XC::TDConcreteMC10Base::commit_creep_chains(void)
+  {
+    tCommit= getCurrentTime();
+    const double deps= (sig-sigP)/Ecm; // creep coefficients normalized with Ecm.
+    creepChainBasic.addIncrement(tCommit, deps, [this](double time, double tp) { return setPhiBasic(time, tp); });
+    creepChainDrying.addIncrement(tCommit, deps, [this](double time, double tp) { return setPhiDrying(time, tp); });
+  }
+
 //! @brief Constructor.
 XC::TDConcreteMC10Base::TDConcreteMC10Base(int tag, int classTag)
   : TDConcreteBase(tag, classTag)
@@ -291,6 +303,9 @@ int XC::TDConcreteMC10Base::revertToStart(void)
     eps = 0.0;
     sig = 0.0;
     e = Ec;
+    creepChainBasic.clear();
+    creepChainDrying.clear();
+    tCommit= 0.0;
 
     if(creepControl==0)
       { count= 0; }
@@ -49,6 +49,7 @@
 #define TDConcreteMC10Base_h
 
 #include "material/uniaxial/concrete/TDConcreteBase.h"
+#include "material/uniaxial/concrete/KelvinChainCreep.h"
 
 namespace XC {
   
@@ -85,11 +86,14 @@ class TDConcreteMC10Base : public TDConcreteBase
     
     std::vector<float> PHIB_i; //!< split into basic and drying creep (ntosic)
     std::vector<float> PHID_i; //!< split into basic and drying creep (ntosic)
+    KelvinChainCreep creepChainBasic; //!< stress history for recursive basic creep computation.
+    KelvinChainCreep creepChainDrying; //!< stress history for recursive drying creep computation.
 
   protected:
     int sendData(Communicator &);
     int recvData(const Communicator &);
     size_t resize(void);
+    void commit_creep_chains(void);
   public:
     TDConcreteMC10Base(int tag, int classTag);
     TDConcreteMC10Base(int tag, int classTag, double _fc, double _ft, double _Ec, double _Ecm, double _beta, double _age, double _epsba, double _epsbb, double _epsda, double _epsdb, double _phiba, double _phibb, double _phida, double _phidb, double _tcast, double _cem);
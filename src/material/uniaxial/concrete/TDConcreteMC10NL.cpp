@@ -128,6 +128,11 @@ void XC::TDConcreteMC10NL::setFcu(const double &d)
 //ntosic
 double XC::TDConcreteMC10NL::setCreepBasicStrain(double time, double stress)
   {
+    if(recursiveCreep) // stress history in the Kelvin chain.
+      {
+        phib_i= (count>0) ? setPhiBasic(time,tCommit) : 0.0;
+        return creepChainBasic.getCreepStrain(time);
+      }
     double creepBasic;
     double runSum = 0.0;
     
@@ -147,6 +152,11 @@ double XC::TDConcreteMC10NL::setCreepBasicStrain(double time, double stress)
 //ntosic
 double XC::TDConcreteMC10NL::setCreepDryingStrain(double time, double stress)
   {
+    if(recursiveCreep) // stress history in the Kelvin chain.
+      {
+        phid_i= (count>0) ? setPhiDrying(time,tCommit) : 0.0;
+        return creepChainDrying.getCreepStrain(time);
+      }
 	double creepDrying;
 	double runSum = 0.0;
 
@@ -203,7 +213,7 @@ int XC::TDConcreteMC10NL::setTrialStrain(double trialStrain, double strainRate)
 
     	// Calculate creep and mechanical strain, assuming stress remains constant in a time step:
     	if (creepControl == 1) {
-        	if (fabs(t-TIME_i[count]) <= 0.0001) { //If t = t(i-1), use creep/shrinkage from last calculated time step
+        	if (fabs(t-getLastCommitTime()) <= 0.0001) { //If t = t(i-1), use creep/shrinkage from last calculated time step
             	eps_crb = epsP_crb; //ntosic
 				eps_crd = epsP_crd; //ntosic
             	eps_shb = epsP_shb; //ntosic
@@ -299,36 +309,41 @@ int XC::TDConcreteMC10NL::commitState(void)
     ecmaxP = ecmax;
     deptP = dept;
 
-    dsig_i[count]=sig-sigP;
-    /* 5/8/2013: commented the following lines so that the DSIG_i[count+1]=sig-sigP;*/
-    //if (crack_flag == 1) {// DSIG_i will be different depending on how the fiber is cracked
-    //	if (sig < 0 && sigP > 0) { //if current step puts concrete from tension to compression, DSIG_i will be only the comp. stress
-    //		DSIG_i[count+1] = sig;
-    //	}
-    //	if (sig > 0) {// Concrete should not creep when crack is opened
-    //		DSIG_i[count+1] = 0.0;
-    //	}
-    //	if (sig > 0 && sigP < 0) {//if current step goes from compression to tension, DSIG_i will be the stress difference
-    //		DSIG_i[count+1] = sig-sigP;
-    //	}
-    //} else { //concrete is uncracked, DSIG = sig - sigP
-    //	DSIG_i[count+1] = sig-sigP;
-    //}
-    DSIG_i[count+1] = sig-sigP;
-
-    //Secant Stiffness for determination of creep strain:
-	if (fabs(eps_m/sig)>Ec) {  //ntosic: originally was eps_m/sig
-	    E_i[count+1] = Ec;
-	} else {
-	    E_i[count+1] = fabs(sig/eps_m); //ADDED 7/22
-	}
+    if(recursiveCreep)
+      { commit_creep_chains(); }
+    else
+      {
+        dsig_i[count]=sig-sigP;
+        /* 5/8/2013: commented the following lines so that the DSIG_i[count+1]=sig-sigP;*/
+        //if (crack_flag == 1) {// DSIG_i will be different depending on how the fiber is cracked
+        //	if (sig < 0 && sigP > 0) { //if current step puts concrete from tension to compression, DSIG_i will be only the comp. stress
+        //		DSIG_i[count+1] = sig;
+        //	}
+        //	if (sig > 0) {// Concrete should not creep when crack is opened
+        //		DSIG_i[count+1] = 0.0;
+        //	}
+        //	if (sig > 0 && sigP < 0) {//if current step goes from compression to tension, DSIG_i will be the stress difference
+        //		DSIG_i[count+1] = sig-sigP;
+        //	}
+        //} else { //concrete is uncracked, DSIG = sig - sigP
+        //	DSIG_i[count+1] = sig-sigP;
+        //}
+        DSIG_i[count+1] = sig-sigP;
+
+        //Secant Stiffness for determination of creep strain:
+    	if (fabs(eps_m/sig)>Ec) {  //ntosic: originally was eps_m/sig
+    	    E_i[count+1] = Ec;
+    	} else {
+    	    E_i[count+1] = fabs(sig/eps_m); //ADDED 7/22
+    	}
 
-	if (isnan(E_i[count+1])) {
-	    E_i[count+1] = Ec;
-	}
+    	if (isnan(E_i[count+1])) {
+    	    E_i[count+1] = Ec;
+    	}
 
 
-    TIME_i[count+1] = getCurrentTime();
+        TIME_i[count+1] = getCurrentTime();
+      }
 
     eP = e;
     sigP = sig;
@@ -379,7 +394,8 @@ int XC::TDConcreteMC10NL::commitState(void)
 	  //    resize()
 	  //}
 	  count++;
-	  resize();
+	  if(!recursiveCreep) // history vectors not used.
+	    resize();
 
     return 0;
   }
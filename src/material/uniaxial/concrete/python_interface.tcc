@@ -50,6 +50,7 @@ class_<XC::TDConcreteBase, bases<XC::RawConcrete>, boost::noncopyable >("TDConcr
   .add_property("age", &XC::TDConcreteBase::getAge,  &XC::TDConcreteBase::setAge, "concrete age.")
   .add_property("beta", &XC::TDConcreteBase::getBeta,  &XC::TDConcreteBase::setBeta,"concrete beta parameter.")
   .add_property("tcast", &XC::TDConcreteBase::getTCast,  &XC::TDConcreteBase::setTCast,"tcast.")
+  .add_property("recursiveCreep", &XC::TDConcreteBase::getRecursiveCreep,  &XC::TDConcreteBase::setRecursiveCreep,"if true, compute creep using a Kelvin chain approximation of the creep coefficient (constant cost per time step) instead of summing over the whole stress history.")
   .def("setCreepOn", &XC::TDConcreteBase::setCreepOn,"Activate creep.").staticmethod("setCreepOn")
   .def("setCreepOff", &XC::TDConcreteBase::setCreepOff,"Deactivate creep.").staticmethod("setCreepOff")
   .def("getCreepDt", &XC::TDConcreteBase::getCreepDt,"Get time increment for creep.").staticmethod("getCreepDt")
@@ -73,26 +73,26 @@
 int XC::Steel01::setup_parameters(void)
   {
     // History variables
-    CminStrain= 0.0;
-    CmaxStrain= 0.0;
-    CshiftP= 1.0;
-    CshiftN= 1.0;
-    Cloading= 0;
-
-    TminStrain= 0.0;
-    TmaxStrain= 0.0;
-    TshiftP= 1.0;
-    TshiftN= 1.0;
-    Tloading= 0;
+    committed->minStrain= 0.0;
+    committed->maxStrain= 0.0;
+    committed->shiftP= 1.0;
+    committed->shiftN= 1.0;
+    committed->loading= 0;
+
+    trial->minStrain= 0.0;
+    trial->maxStrain= 0.0;
+    trial->shiftP= 1.0;
+    trial->shiftN= 1.0;
+    trial->loading= 0;
 
     // State variables
-    Cstrain= 0.0;
-    Cstress= 0.0;
-    Ctangent= E0;
+    committed->strain= 0.0;
+    committed->stress= 0.0;
+    committed->tangent= E0;
 
-    Tstrain= 0.0;
-    Tstress= 0.0;
-    Ttangent= E0;
+    trial->strain= 0.0;
+    trial->stress= 0.0;
+    trial->tangent= E0;
     return 0;
   }
 
@@ -115,10 +115,10 @@ void XC::Steel01::determineTrialState(double dStrain)
     const double Esh= getEsh();
     const double epsy= getEpsy();
 
-    const double c1= Esh*Tstrain;
-    const double c2= TshiftN*fyOneMinusB;
-    const double c3= TshiftP*fyOneMinusB;
-    const double c= Cstress + E0*dStrain;
+    const double c1= Esh*trial->strain;
+    const double c2= trial->shiftN*fyOneMinusB;
+    const double c3= trial->shiftP*fyOneMinusB;
+    const double c= committed->stress + E0*dStrain;
 
 //     /**********************************************************
 //        removal of the following lines due to problems with
@@ -131,25 +131,25 @@ void XC::Steel01::determineTrialState(double dStrain)
 //     const double c1c3= c1 + c3;
 
 //     if(c1c3<c)
-//       Tstress = c1c3;
+//       trial->stress = c1c3;
 //     else
-//       Tstress = c;
+//       trial->stress = c;
 
 //     const double c1c2= c1-c2;
 
-//     if(c1c2 > Tstress)
-//       Tstress = c1c2;
+//     if(c1c2 > trial->stress)
+//       trial->stress = c1c2;
 
 //     /* ***********************************************************
 //     and replace them with:
-//     Tstress = fmax((c1-c2), fmin((c1+c3),c));
+//     trial->stress = fmax((c1-c2), fmin((c1+c3),c));
 //     **************************************************************/
-    Tstress= std::max((c1-c2), std::min((c1+c3),c));
+    trial->stress= std::max((c1-c2), std::min((c1+c3),c));
 
-    if(fabs(Tstress-c)<DBL_EPSILON)
-      Ttangent = E0;
+    if(fabs(trial->stress-c)<DBL_EPSILON)
+      trial->tangent = E0;
     else
-      Ttangent = Esh;
+      trial->tangent = Esh;
 
     //
     // Determine if a load reversal has occurred due to the trial strain
@@ -158,32 +158,32 @@ void XC::Steel01::determineTrialState(double dStrain)
     // Determine initial loading condition:  1 = loading (positive strain increment)
                                          // -1 = unloading (negative strain increment)
                                          // 0 initially
-    if(Tloading == 0 && dStrain != 0.0)
+    if(trial->loading == 0 && dStrain != 0.0)
       {
         if(dStrain > 0.0)
-          Tloading = 1;
+          trial->loading = 1;
         else
-          Tloading = -1;
+          trial->loading = -1;
       }
 
     // Transition from loading to unloading, i.e. positive strain increment
     // to negative strain increment
-    if(Tloading == 1 && dStrain < 0.0)
+    if(trial->loading == 1 && dStrain < 0.0)
       {
-        Tloading = -1;
-        if(Cstrain > TmaxStrain)
-          TmaxStrain = Cstrain;
-        TshiftN= 1 + a1*pow((TmaxStrain-TminStrain)/(2.0*a2*epsy),0.8);
+        trial->loading = -1;
+        if(committed->strain > trial->maxStrain)
+          trial->maxStrain = committed->strain;
+        trial->shiftN= 1 + a1*pow((trial->maxStrain-trial->minStrain)/(2.0*a2*epsy),0.8);
       }
 
     // Transition from unloading to loading, i.e. negative strain increment
     // to positive strain increment
-    if(Tloading == -1 && dStrain > 0.0)
+    if(trial->loading == -1 && dStrain > 0.0)
       {
-        Tloading = 1;
-        if(Cstrain < TminStrain)
-          TminStrain = Cstrain;
-        TshiftP = 1 + a3*pow((TmaxStrain-TminStrain)/(2.0*a4*epsy),0.8);
+        trial->loading = 1;
+        if(committed->strain < trial->minStrain)
+          trial->minStrain = committed->strain;
+        trial->shiftP = 1 + a3*pow((trial->maxStrain-trial->minStrain)/(2.0*a4*epsy),0.8);
       }
   }
 
@@ -191,34 +191,34 @@ void XC::Steel01::determineTrialState(double dStrain)
 void XC::Steel01::detectLoadReversal(double dStrain)
   {
     // Determine initial loading condition
-    if(Tloading == 0 && dStrain != 0.0)
+    if(trial->loading == 0 && dStrain != 0.0)
       {
         if(dStrain > 0.0)
-          Tloading = 1;
+          trial->loading = 1;
         else
-          Tloading = -1;
+          trial->loading = -1;
       }
 
    const double epsy= getEpsy();
 
    // Transition from loading to unloading, i.e. positive strain increment
    // to negative strain increment
-   if(Tloading == 1 && dStrain < 0.0)
+   if(trial->loading == 1 && dStrain < 0.0)
      {
-       Tloading = -1;
-       if(Cstrain > TmaxStrain)
-         TmaxStrain = Cstrain;
-       TshiftN= 1 + a1*pow((TmaxStrain-TminStrain)/(2.0*a2*epsy),0.8);
+       trial->loading = -1;
+       if(committed->strain > trial->maxStrain)
+         trial->maxStrain = committed->strain;
+       trial->shiftN= 1 + a1*pow((trial->maxStrain-trial->minStrain)/(2.0*a2*epsy),0.8);
      }
 
    // Transition from unloading to loading, i.e. negative strain increment
    // to positive strain increment
-   if(Tloading == -1 && dStrain > 0.0)
+   if(trial->loading == -1 && dStrain > 0.0)
      {
-       Tloading = 1;
-       if(Cstrain < TminStrain)
-         TminStrain = Cstrain;
-       TshiftP = 1 + a3*pow((TmaxStrain-TminStrain)/(2.0*a4*epsy),0.8);
+       trial->loading = 1;
+       if(committed->strain < trial->minStrain)
+         trial->minStrain = committed->strain;
+       trial->shiftP = 1 + a3*pow((trial->maxStrain-trial->minStrain)/(2.0*a4*epsy),0.8);
      }
   }
 
@@ -236,12 +236,47 @@ int XC::Steel01::revertToStart(void)
 XC::UniaxialMaterial* XC::Steel01::getCopy(void) const
   { return new Steel01(*this); }
 
+//! @brief Set the trial strains of a batch of Steel01 materials and
+//! return its stresses and tangents (without virtual calls).
+int XC::Steel01::setTrialBatch(const size_t &n, UniaxialMaterial *const materials[], const double strains[], double stresses[], double tangents[]) const
+  { return set_trial_batch<Steel01>(*this, n, materials, strains, stresses, tangents); }
+
+//! @brief Compute the strain interval in which the response is linear
+//! (slope E0) starting from the last committed state.
+//!
+//! The stress is the trial elastic stress clamped between the two
+//! bounding lines (see determineTrialState). The bounds are computed
+//! with the smallest shift values that a load reversal could produce,
+//! so the interval is conservative. If the material is yielding at the
+//! committed state no range is returned.
+bool XC::Steel01::getLinearRange(double &strainMin, double &strainMax) const
+  {
+    strainMin= 0.0;
+    strainMax= 0.0;
+    if(committed->tangent!=E0)
+      return false;
+    const double fyOneMinusB= fy * (1.0 - b);
+    const double epsy= getEpsy();
+    // Shift values after a load reversal from the committed state.
+    const double maxStrain= std::max(committed->maxStrain, committed->strain);
+    const double minStrain= std::min(committed->minStrain, committed->strain);
+    const double shiftN= std::min(committed->shiftN, 1 + a1*pow((maxStrain-committed->minStrain)/(2.0*a2*epsy),0.8));
+    const double shiftP= std::min(committed->shiftP, 1 + a3*pow((committed->maxStrain-minStrain)/(2.0*a4*epsy),0.8));
+    // Elastic if: -shiftN*fy*(1-b) < (E0-Esh)*strain+stress-E0*strain0 < shiftP*fy*(1-b)
+    const double c0= committed->stress-E0*committed->strain;
+    const double slope= E0-getEsh();
+    const double tol= 10.0*DBL_EPSILON/slope;
+    strainMin= (-shiftN*fyOneMinusB-c0)/slope+tol;
+    strainMax= (shiftP*fyOneMinusB-c0)/slope-tol;
+    return (strainMin<strainMax);
+  }
+
 //! @brief Send object members through the communicator argument.
 int XC::Steel01::sendData(Communicator &comm)
   {
     int res= SteelBase0103::sendData(comm);
     const double pid= parameterID;
-    res+= comm.sendDoubles(pid,Energy, getDbTagData(),CommMetaData(8));
+    res+= comm.sendDoubles(pid,committed->energy, getDbTagData(),CommMetaData(8));
     res+= comm.sendMatrix(SHVs,getDbTagData(),CommMetaData(9));
     return res;
   }
@@ -251,7 +286,7 @@ int XC::Steel01::recvData(const Communicator &comm)
   {
     int res= SteelBase0103::recvData(comm);
     double pid;
-    res+= comm.receiveDoubles(pid, Energy, getDbTagData(),CommMetaData(8));
+    res+= comm.receiveDoubles(pid, committed->energy, getDbTagData(),CommMetaData(8));
     parameterID= pid;
     res+= comm.receiveMatrix(SHVs,getDbTagData(),CommMetaData(9));
     return res;
@@ -318,7 +353,7 @@ int XC::Steel01::setParameter(const std::vector<std::string> &argv, Parameter &p
 int XC::Steel01::updateParameter(int parameterID, Information &info)
   {
     const int up= SteelBase::updateParameter(parameterID,info);
-    Ttangent = E0;          // Initial stiffness
+    trial->tangent = E0;          // Initial stiffness
     return up;
   }
 
@@ -360,13 +395,13 @@ double XC::Steel01::getStressSensitivity(int gradNumber, bool conditional)
 
     // Compute min and max stress
     double Tstress;
-    const double dStrain = Tstrain-Cstrain;
-    const double sigmaElastic = Cstress + E0*dStrain;
+    const double dStrain = trial->strain-committed->strain;
+    const double sigmaElastic = committed->stress + E0*dStrain;
     const double fyOneMinusB = fy * (1.0 - b);
     const double Esh = b*E0;
-    const double c1 = Esh*Tstrain;
-    const double c2 = TshiftN*fyOneMinusB;
-    const double c3 = TshiftP*fyOneMinusB;
+    const double c1 = Esh*trial->strain;
+    const double c2 = trial->shiftN*fyOneMinusB;
+    const double c3 = trial->shiftP*fyOneMinusB;
     const double sigmaMax = c1+c3;
     const double sigmaMin = c1-c2;
 
@@ -374,22 +409,22 @@ double XC::Steel01::getStressSensitivity(int gradNumber, bool conditional)
     if( (sigmaMax < sigmaElastic) && (fabs(sigmaMax-sigmaElastic)>1e-5) )
       {
         Tstress = sigmaMax;
-        gradient = E0Sensitivity*b*Tstrain
-                   + E0*bSensitivity*Tstrain
-                   + TshiftP*(fySensitivity*(1-b)-fy*bSensitivity);
+        gradient = E0Sensitivity*b*trial->strain
+                   + E0*bSensitivity*trial->strain
+                   + trial->shiftP*(fySensitivity*(1-b)-fy*bSensitivity);
       }
     else
       {
         Tstress = sigmaElastic;
         gradient = CstressSensitivity
-                   + E0Sensitivity*(Tstrain-Cstrain)
+                   + E0Sensitivity*(trial->strain-committed->strain)
                    - E0*CstrainSensitivity;
       }
     if(sigmaMin > Tstress)
       {
-        gradient = E0Sensitivity*b*Tstrain
-                   + E0*bSensitivity*Tstrain
-                   - TshiftN*(fySensitivity*(1-b)-fy*bSensitivity);
+        gradient = E0Sensitivity*b*trial->strain
+                   + E0*bSensitivity*trial->strain
+                   - trial->shiftN*(fySensitivity*(1-b)-fy*bSensitivity);
       }
     return gradient;
   }
@@ -435,13 +470,13 @@ int XC::Steel01::commitSensitivity(double TstrainSensitivity, int gradNumber, in
 
     // Compute min and max stress
     double Tstress;
-    const double dStrain = Tstrain-Cstrain;
-    const double sigmaElastic = Cstress + E0*dStrain;
+    const double dStrain = trial->strain-committed->strain;
+    const double sigmaElastic = committed->stress + E0*dStrain;
     const double fyOneMinusB = fy * (1.0 - b);
     const double Esh = b*E0;
-    const double c1 = Esh*Tstrain;
-    const double c2 = TshiftN*fyOneMinusB;
-    const double c3 = TshiftP*fyOneMinusB;
+    const double c1 = Esh*trial->strain;
+    const double c2 = trial->shiftN*fyOneMinusB;
+    const double c3 = trial->shiftP*fyOneMinusB;
     const double sigmaMax = c1+c3;
     const double sigmaMin = c1-c2;
 
@@ -449,24 +484,24 @@ int XC::Steel01::commitSensitivity(double TstrainSensitivity, int gradNumber, in
     if( (sigmaMax < sigmaElastic) && (fabs(sigmaMax-sigmaElastic)>1e-5) )
       {
         Tstress = sigmaMax;
-        gradient = E0Sensitivity*b*Tstrain
-                   + E0*bSensitivity*Tstrain
+        gradient = E0Sensitivity*b*trial->strain
+                   + E0*bSensitivity*trial->strain
                    + E0*b*TstrainSensitivity
-                   + TshiftP*(fySensitivity*(1-b)-fy*bSensitivity);
+                   + trial->shiftP*(fySensitivity*(1-b)-fy*bSensitivity);
       }
     else
       {
         Tstress = sigmaElastic;
         gradient = CstressSensitivity
-                   + E0Sensitivity*(Tstrain-Cstrain)
+                   + E0Sensitivity*(trial->strain-committed->strain)
                    + E0*(TstrainSensitivity-CstrainSensitivity);
       }
     if(sigmaMin > Tstress)
       {
-        gradient = E0Sensitivity*b*Tstrain
-                   + E0*bSensitivity*Tstrain
+        gradient = E0Sensitivity*b*trial->strain
+                   + E0*bSensitivity*trial->strain
                    + E0*b*TstrainSensitivity
-                   - TshiftN*(fySensitivity*(1-b)-fy*bSensitivity);
+                   - trial->shiftN*(fySensitivity*(1-b)-fy*bSensitivity);
       }
 
     // Commit history variables
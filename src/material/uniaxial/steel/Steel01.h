@@ -106,6 +106,8 @@ class Steel01: public SteelBase0103
     Steel01(int tag= 0);
 
     UniaxialMaterial *getCopy(void) const;
+    int setTrialBatch(const size_t &, UniaxialMaterial *const [], const double [], double [], double []) const;
+    bool getLinearRange(double &, double &) const;
 
     int revertToStart(void);
 
@@ -192,6 +192,11 @@ void XC::Steel02::setInitialStress(const double &d)
 XC::UniaxialMaterial *XC::Steel02::getCopy(void) const
   { return new Steel02(*this); }
 
+//! @brief Set the trial strains of a batch of Steel02 materials and
+//! return its stresses and tangents (without virtual calls).
+int XC::Steel02::setTrialBatch(const size_t &n, UniaxialMaterial *const materials[], const double strains[], double stresses[], double tangents[]) const
+  { return set_trial_batch<Steel02>(*this, n, materials, strains, stresses, tangents); }
+
 int XC::Steel02::setTrialStrain(double trialStrain, double strainRate)
   {
     const double Esh= b*E0;
@@ -125,6 +125,7 @@ class Steel02: public SteelBase
     UniaxialMaterial *getCopy(void) const;
 
     int setTrialStrain(double strain, double strainRate = 0.0);
+    int setTrialBatch(const size_t &, UniaxialMaterial *const [], const double [], double [], double []) const;
     double getStrain(void) const;
     double getStress(void) const;
     double getTangent(void) const;
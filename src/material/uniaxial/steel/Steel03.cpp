@@ -169,80 +169,85 @@ void XC::Steel03::determineTrialState (double dStrain)
       double Esh = b*E0;
       double epsy = fy/E0;
       
-      double c1 = Esh*Tstrain;
-      double c2 = TshiftN*fyOneMinusB;
-      double c3 = TshiftP*fyOneMinusB;
-      double c = Cstress + E0*dStrain;
+      double c1 = Esh*trial->strain;
+      double c2 = trial->shiftN*fyOneMinusB;
+      double c3 = trial->shiftP*fyOneMinusB;
+      double c = committed->stress + E0*dStrain;
       
       //
       // Determine if a load reversal has occurred due to the trial strain
       //
 
       // Determine initial loading condition
-      if (Tloading == 0 && dStrain != 0.0) {
-          TmaxStrain = epsy;
-          TminStrain = -epsy;
+      if (trial->loading == 0 && dStrain != 0.0) {
+          trial->maxStrain = epsy;
+          trial->minStrain = -epsy;
 	  if (dStrain > 0.0) {
-	    Tloading = 1;
-            TbStrain = TmaxStrain;
+	    trial->loading = 1;
+            TbStrain = trial->maxStrain;
             TbStress = fy;
-            Tplastic = TmaxStrain;
+            Tplastic = trial->maxStrain;
           }
 	  else {
-	    Tloading = -1;
-            TbStrain = TminStrain;
+	    trial->loading = -1;
+            TbStrain = trial->minStrain;
             TbStress = -fy;
-            Tplastic = TminStrain;
+            Tplastic = trial->minStrain;
           }
 
-          double intval = 1+pow(fabs(Tstrain/epsy),TcurR);
-          Tstress = c1+(1-b)*E0*Tstrain/pow(intval,1/TcurR);
-          Ttangent = Esh+E0*(1-b)/pow(intval,1+1/TcurR);
+          double intval = 1+pow(fabs(trial->strain/epsy),TcurR);
+          trial->stress = c1+(1-b)*E0*trial->strain/pow(intval,1/TcurR);
+          trial->tangent = Esh+E0*(1-b)/pow(intval,1+1/TcurR);
       }
           
       // Transition from loading to unloading, i.e. positive strain increment
       // to negative strain increment
-      if (Tloading == 1 && dStrain < 0.0) {
-	  Tloading = -1;
-	  if (Cstrain > TmaxStrain)
-	    TmaxStrain = Cstrain;
-          Tplastic = TminStrain;
-	  TshiftN = 1 + a1*pow((TmaxStrain-TminStrain)/(2.0*a2*epsy),0.8);
-          TrStrain = Cstrain;
-          TrStress = Cstress;
-          TbStrain = (c2+c)/E0/(b-1)+Tstrain/(1-b);
+      if (trial->loading == 1 && dStrain < 0.0) {
+	  trial->loading = -1;
+	  if (committed->strain > trial->maxStrain)
+	    trial->maxStrain = committed->strain;
+          Tplastic = trial->minStrain;
+	  trial->shiftN = 1 + a1*pow((trial->maxStrain-trial->minStrain)/(2.0*a2*epsy),0.8);
+          TrStrain = committed->strain;
+          TrStress = committed->stress;
+          TbStrain = (c2+c)/E0/(b-1)+trial->strain/(1-b);
           TbStress = 1/(b-1)*(b*c2+b*c-c1)-c2;
-          TcurR = getR((TbStrain-TminStrain)/epsy);
+          TcurR = getR((TbStrain-trial->minStrain)/epsy);
       }
 
       // Transition from unloading to loading, i.e. negative strain increment
       // to positive strain increment
-      if (Tloading == -1 && dStrain > 0.0) {
-	  Tloading = 1;
-	  if (Cstrain < TminStrain)
-	    TminStrain = Cstrain;
-          Tplastic = TmaxStrain;
-	  TshiftP = 1 + a3*pow((TmaxStrain-TminStrain)/(2.0*a4*epsy),0.8);
-          TrStrain = Cstrain;
-          TrStress = Cstress;
-          TbStrain = (c3-c)/E0/(1-b)+Tstrain/(1-b);
+      if (trial->loading == -1 && dStrain > 0.0) {
+	  trial->loading = 1;
+	  if (committed->strain < trial->minStrain)
+	    trial->minStrain = committed->strain;
+          Tplastic = trial->maxStrain;
+	  trial->shiftP = 1 + a3*pow((trial->maxStrain-trial->minStrain)/(2.0*a4*epsy),0.8);
+          TrStrain = committed->strain;
+          TrStress = committed->stress;
+          TbStrain = (c3-c)/E0/(1-b)+trial->strain/(1-b);
           TbStress = 1/(1-b)*(b*c3-b*c+c1)+c3;
-          TcurR = getR((TmaxStrain-TbStrain)/epsy);
+          TcurR = getR((trial->maxStrain-TbStrain)/epsy);
       }
       
-      if (Cloading != 0) {
+      if (committed->loading != 0) {
           double c4 = TbStrain - TrStrain;
           double c5 = TbStress - TrStress;
-          double c6 = Tstrain - TrStrain;
+          double c6 = trial->strain - TrStrain;
           double c4c5 = c5/c4;
           double intval = 1+pow(fabs(c6/c4),TcurR);
           
-          Tstress = TrStress+b*c4c5*c6+(1-b)*c4c5*c6/pow(intval,1/TcurR);
-          Ttangent = c4c5*b+c4c5*(1-b)/pow(intval,1+1/TcurR);
+          trial->stress = TrStress+b*c4c5*c6+(1-b)*c4c5*c6/pow(intval,1/TcurR);
+          trial->tangent = c4c5*b+c4c5*(1-b)/pow(intval,1+1/TcurR);
       }
 }
 
 
+//! @brief The state of this material is not stored in a state arena
+//! (the commit needs to update additional variables).
+size_t XC::Steel03::getStateBlockSize(void) const
+  { return 0; }
+
 //! @brief Commit the state of the material.
 int XC::Steel03::commitState(void)
   {  
@@ -126,6 +126,7 @@ class Steel03: public SteelBase0103
     int setTrialStrain(double strain, double strainRate = 0.0); 
     int setTrial(double strain, double &stress, double &tangent, double strainRate = 0.0);
 
+    size_t getStateBlockSize(void) const;
     int commitState(void);
     int revertToLastCommit(void);    
 
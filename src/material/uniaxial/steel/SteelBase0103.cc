@@ -34,45 +34,47 @@
 #include <cmath>
 #include <cfloat>
 #include "utility/actor/actor/MovableVector.h"
+#include "material/MaterialStateArena.h"
+#include <new>
 
 //! @brief Sets all history and state variables to initial values
 int XC::SteelBase0103::setup_parameters(void)
   {
     // History variables
-    CminStrain= 0.0;
-    CmaxStrain= 0.0;
-    CshiftP= 1.0;
-    CshiftN= 1.0;
-    Cloading= 0;
-
-    TminStrain= 0.0;
-    TmaxStrain= 0.0;
-    TshiftP= 1.0;
-    TshiftN= 1.0;
-    Tloading= 0;
+    committed->minStrain= 0.0;
+    committed->maxStrain= 0.0;
+    committed->shiftP= 1.0;
+    committed->shiftN= 1.0;
+    committed->loading= 0;
+
+    trial->minStrain= 0.0;
+    trial->maxStrain= 0.0;
+    trial->shiftP= 1.0;
+    trial->shiftN= 1.0;
+    trial->loading= 0;
 
     // State variables
-    Cstrain= 0.0;
-    Cstress= 0.0;
-    Ctangent= E0;
+    committed->strain= 0.0;
+    committed->stress= 0.0;
+    committed->tangent= E0;
 
-    Tstrain= 0.0;
-    Tstress= 0.0;
-    Ttangent= E0;
+    trial->strain= 0.0;
+    trial->stress= 0.0;
+    trial->tangent= E0;
     return 0;
   }
 
 //! @brief Constructor.
 XC::SteelBase0103::SteelBase0103(int tag, int classTag, double FY, double E, double B,double A1, double A2, double A3, double A4)
-  : SteelBase(tag,classTag,FY,E,B,A1,A2,A3,A4), Energy(0.0) {}
+  : SteelBase(tag,classTag,FY,E,B,A1,A2,A3,A4), trialStorage(), committedStorage(), trial(&trialStorage), committed(&committedStorage) {}
 
 //! @brief Constructor.
 XC::SteelBase0103::SteelBase0103(int tag, int classTag)
-  :SteelBase(tag,classTag,0.0,0.0,0.0,STEEL_0103_DEFAULT_A1,STEEL_0103_DEFAULT_A2,STEEL_0103_DEFAULT_A3,STEEL_0103_DEFAULT_A4), Energy(0.0) {}
+  :SteelBase(tag,classTag,0.0,0.0,0.0,STEEL_0103_DEFAULT_A1,STEEL_0103_DEFAULT_A2,STEEL_0103_DEFAULT_A3,STEEL_0103_DEFAULT_A4), trialStorage(), committedStorage(), trial(&trialStorage), committed(&committedStorage) {}
 
 //! @brief Constructor.
 XC::SteelBase0103::SteelBase0103(int classTag)
-  :SteelBase(0,classTag,0.0,0.0,0.0,STEEL_0103_DEFAULT_A1,STEEL_0103_DEFAULT_A2,STEEL_0103_DEFAULT_A3,STEEL_0103_DEFAULT_A4), Energy(0.0) {}
+  :SteelBase(0,classTag,0.0,0.0,0.0,STEEL_0103_DEFAULT_A1,STEEL_0103_DEFAULT_A2,STEEL_0103_DEFAULT_A3,STEEL_0103_DEFAULT_A4), trialStorage(), committedStorage(), trial(&trialStorage), committed(&committedStorage) {}
 
 int XC::SteelBase0103::setTrialStrain(double strain, double strainRate)
   {
@@ -85,81 +87,112 @@ int XC::SteelBase0103::setTrialStrain(double strain, double strainRate)
 	        << "; ERROR: initial strain not supported yet."
                 << " Initial strain: " << ezero << std::endl;
     // Reset history variables to last converged state
-    TminStrain= CminStrain;
-    TmaxStrain= CmaxStrain;
-    TshiftP= CshiftP;
-    TshiftN= CshiftN;
-    Tloading= Cloading;
+    trial->minStrain= committed->minStrain;
+    trial->maxStrain= committed->maxStrain;
+    trial->shiftP= committed->shiftP;
+    trial->shiftN= committed->shiftN;
+    trial->loading= committed->loading;
 
-    Tstrain= Cstrain;
-    Tstress= Cstress;
-    Ttangent= Ctangent;
+    trial->strain= committed->strain;
+    trial->stress= committed->stress;
+    trial->tangent= committed->tangent;
 
     // Determine change in strain from last converged state
-    const double dStrain= strain - Cstrain;
+    const double dStrain= strain - committed->strain;
 
     if(fabs(dStrain) > DBL_EPSILON)
       {
         // Set trial strain
-        Tstrain = strain;
+        trial->strain = strain;
         // Calculate the trial state given the trial strain
         determineTrialState(dStrain);
       }
+    update_trial_energy();
     return 0;
   }
 
 int XC::SteelBase0103::setTrial(double strain, double &stress, double &tangent, double strainRate)
   {
     setTrialStrain(strain,strainRate);
-    stress= Tstress;
-    tangent= Ttangent;
+    stress= trial->stress;
+    tangent= trial->tangent;
     return 0;
   }
 
 double XC::SteelBase0103::getStrain(void) const
-  { return Tstrain; }
+  { return trial->strain; }
 
 double XC::SteelBase0103::getStress(void) const
-  { return Tstress; }
+  { return trial->stress; }
 
 //! @brief Return the material tangent stiffness.
 double XC::SteelBase0103::getTangent(void) const
-  { return Ttangent; }
+  { return trial->tangent; }
 
-//! @brief Commit the state of the material.
-int XC::SteelBase0103::commitState(void)
+//! @brief Copy constructor.
+XC::SteelBase0103::SteelBase0103(const SteelBase0103 &other)
+  : SteelBase(other), trialStorage(*other.trial), committedStorage(*other.committed), trial(&trialStorage), committed(&committedStorage) {}
+
+//! @brief Assignment operator (the state is copied to the storage
+//! currently used by this object).
+XC::SteelBase0103 &XC::SteelBase0103::operator=(const SteelBase0103 &other)
   {
-    // History variables
-    CminStrain= TminStrain;
-    CmaxStrain= TmaxStrain;
-    CshiftP= TshiftP;
-    CshiftN= TshiftN;
-    Cloading= Tloading;
+    SteelBase::operator=(other);
+    *trial= *other.trial;
+    *committed= *other.committed;
+    return *this;
+  }
 
-    // State variables
+//! @brief Return the number of doubles needed to store the trial (or
+//! the committed) state in a MaterialStateArena.
+size_t XC::SteelBase0103::getStateBlockSize(void) const
+  { return MaterialStateArena::getBlockSize(sizeof(State)); }
+
+//! @brief Move the state variables to the blocks of a state arena.
+void XC::SteelBase0103::bindStateBlocks(double *trialBlock, double *committedBlock)
+  {
+    State *t= new(trialBlock) State(*trial);
+    State *c= new(committedBlock) State(*committed);
+    trial= t;
+    committed= c;
+  }
+
+//! @brief Move back the state variables from the state arena blocks.
+void XC::SteelBase0103::unbindStateBlocks(void)
+  {
+    if(trial!=&trialStorage)
+      {
+        trialStorage= *trial;
+        committedStorage= *committed;
+        trial= &trialStorage;
+        committed= &committedStorage;
+      }
+  }
+
+//! @brief Update the energy stored in the material for the trial state.
+void XC::SteelBase0103::update_trial_energy(void)
+  {
     //by SAJalali
-    Energy += 0.5*(Tstress + Cstress)*(Tstrain - Cstrain);
-    
-    Cstrain= Tstrain;
-    Cstress= Tstress;
-    Ctangent= Ttangent;
+    trial->energy= committed->energy+0.5*(trial->stress + committed->stress)*(trial->strain - committed->strain);
+  }
+
+//! @brief Commit the state of the material.
+//!
+//! All the state variables (including the energy) are copied, so
+//! this operation is equivalent to the copy of the trial block made
+//! by MaterialStateArena::commitState.
+int XC::SteelBase0103::commitState(void)
+  {
+    update_trial_energy();
+    *committed= *trial;
     return 0;
   }
 
 //! @brief Reset material to last committed state
 int XC::SteelBase0103::revertToLastCommit(void)
   {
-    // Reset trial history variables to last committed state
-    TminStrain= CminStrain;
-    TmaxStrain= CmaxStrain;
-    TshiftP= CshiftP;
-    TshiftN= CshiftN;
-    Tloading= Cloading;
-
-    // Reset trial state variables to last committed state
-    Tstrain = Cstrain;
-    Tstress = Cstress;
-    Ttangent = Ctangent;
+    // Reset trial history and state variables to last committed state
+    *trial= *committed;
     return 0;
   }
 
@@ -175,10 +208,10 @@ int XC::SteelBase0103::revertToStart(void)
 int XC::SteelBase0103::sendData(Communicator &comm)
   {
     int res= SteelBase::sendData(comm);
-    res+= comm.sendDoubles(Cstrain,Cstress,Ctangent,Tstrain,Tstress,Ttangent,getDbTagData(),CommMetaData(4));
-    res+= comm.sendDoubles(CminStrain,CmaxStrain,CshiftP,CshiftN,getDbTagData(),CommMetaData(5));
-    res+= comm.sendInts(Cloading,Tloading,getDbTagData(),CommMetaData(6));
-    res+= comm.sendDoubles(TminStrain,TmaxStrain,TshiftP,TshiftN,getDbTagData(),CommMetaData(7));
+    res+= comm.sendDoubles(committed->strain,committed->stress,committed->tangent,trial->strain,trial->stress,trial->tangent,getDbTagData(),CommMetaData(4));
+    res+= comm.sendDoubles(committed->minStrain,committed->maxStrain,committed->shiftP,committed->shiftN,getDbTagData(),CommMetaData(5));
+    res+= comm.sendInts(committed->loading,trial->loading,getDbTagData(),CommMetaData(6));
+    res+= comm.sendDoubles(trial->minStrain,trial->maxStrain,trial->shiftP,trial->shiftN,getDbTagData(),CommMetaData(7));
     return res;
   }
 
@@ -186,10 +219,10 @@ int XC::SteelBase0103::sendData(Communicator &comm)
 int XC::SteelBase0103::recvData(const Communicator &comm)
   {
     int res= SteelBase::recvData(comm);
-    res+= comm.receiveDoubles(Cstrain,Cstress,Ctangent,Tstrain,Tstress,Ttangent,getDbTagData(),CommMetaData(4));
-    res+= comm.receiveDoubles(CminStrain,CmaxStrain,CshiftP,CshiftN,getDbTagData(),CommMetaData(5));
-    res+= comm.receiveInts(Cloading,Tloading,getDbTagData(),CommMetaData(6));
-    res+= comm.receiveDoubles(TminStrain,TmaxStrain,TshiftP,TshiftN,getDbTagData(),CommMetaData(7));
+    res+= comm.receiveDoubles(committed->strain,committed->stress,committed->tangent,trial->strain,trial->stress,trial->tangent,getDbTagData(),CommMetaData(4));
+    res+= comm.receiveDoubles(committed->minStrain,committed->maxStrain,committed->shiftP,committed->shiftN,getDbTagData(),CommMetaData(5));
+    res+= comm.receiveInts(committed->loading,trial->loading,getDbTagData(),CommMetaData(6));
+    res+= comm.receiveDoubles(trial->minStrain,trial->maxStrain,trial->shiftP,trial->shiftN,getDbTagData(),CommMetaData(7));
     return res;
   }
 
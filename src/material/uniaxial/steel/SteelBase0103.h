@@ -45,52 +45,57 @@ const double STEEL_0103_DEFAULT_A4= 55.0;
 //! @brief Base class for Steel01 and Steel03.
 class SteelBase0103: public SteelBase
   {
+  public:
+    //! @brief State variables of the material.
+    //!
+    //! The trial and the committed values are stored in two objects
+    //! with the same layout (trivially copyable), so the commit and
+    //! the revert operations are just a copy. These objects are
+    //! stored in the material itself or, if the material is bound
+    //! to a MaterialStateArena, in the buffers of the arena.
+    struct State
+      {
+        /*** History Variables ***/
+        double minStrain;  //!< Minimum strain in compression
+        double maxStrain;  //!< Maximum strain in tension
+        double shiftP;     //!< Shift in hysteresis loop for positive loading
+        double shiftN;     //!< Shift in hysteresis loop for negative loading
+        int loading;       //!< Flag for loading/unloading
+                           // 1 = loading (positive strain increment)
+                           // -1 = unloading (negative strain increment)
+                           // 0 initially
+        /*** State Variables ***/
+        double strain;
+        double stress;
+        double tangent; // Not really a state variable (trial), but declared
+                        // here for convenience
+        double energy; //!< Energy stored in the material.
+      };
+  private:
+    State trialStorage; //!< trial state (when not bound to an arena).
+    State committedStorage; //!< committed state (when not bound to an arena).
   protected:
-    /*** CONVERGED History Variables ***/
-    double CminStrain;  //!< Minimum strain in compression
-    double CmaxStrain;  //!< Maximum strain in tension
-    double CshiftP;     //!< Shift in hysteresis loop for positive loading
-    double CshiftN;     //!< Shift in hysteresis loop for negative loading
-    int Cloading;       //!< Flag for loading/unloading
-                        // 1 = loading (positive strain increment)
-                        // -1 = unloading (negative strain increment)
-                        // 0 initially
-
-    /*** CONVERGED State Variables ***/
-    double Cstrain;
-    double Cstress;
-    double Ctangent;
-
-    /*** TRIAL State Variables ***/
-    double Tstrain;
-    double Tstress;
-    double Ttangent; // Not really a state variable, but declared here
-                     // for convenience
+    State *trial; //!< TRIAL state.
+    State *committed; //!< CONVERGED state.
 
-    /*** TRIAL History Variables ***/
-    double TminStrain;
-    double TmaxStrain;
-    double TshiftP;
-    double TshiftN;
-    int Tloading;
-
-    double Energy; //!< Energy stored in the material.
-    
     virtual void determineTrialState(double dStrain)= 0;
     virtual double get_total_strain(void) const
-      { return Tstrain-ezero; }
+      { return trial->strain-ezero; }
 
   protected:
     int sendData(Communicator &);
     int recvData(const Communicator &);
 
     virtual int setup_parameters(void);
+    void update_trial_energy(void);
   public:
     SteelBase0103(int tag, int classTag, double fy, double E0, double b,
        double a1 = STEEL_0103_DEFAULT_A1, double a2 = STEEL_0103_DEFAULT_A2,
        double a3 = STEEL_0103_DEFAULT_A3, double a4 = STEEL_0103_DEFAULT_A4);
     SteelBase0103(int tag, int classTag);
     SteelBase0103(int classTag);
+    SteelBase0103(const SteelBase0103 &);
+    SteelBase0103 &operator=(const SteelBase0103 &);
 
     int setTrialStrain(double strain, double strainRate = 0.0);
     int setTrial(double strain, double &stress, double &tangent, double strainRate = 0.0);
@@ -99,8 +104,12 @@ class SteelBase0103: public SteelBase
     double getTangent(void) const;
 
     inline virtual double getEnergy()
-      { return Energy; }
+      { return committed->energy; }
     
+    size_t getStateBlockSize(void) const;
+    void bindStateBlocks(double *, double *);
+    void unbindStateBlocks(void);
+
     int commitState(void);
     int revertToLastCommit(void);
     int revertToStart(void);
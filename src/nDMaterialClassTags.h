@@ -71,6 +71,11 @@
 #define ND_TAG_MultiaxialCyclicPlasticityAxiSymm        2037
 #define ND_TAG_MultiaxialCyclicPlasticityPlaneStrain    2038
 
+// J2 plasticity with radial return in fixed size Voigt notation.
+#define ND_TAG_J2RadialReturn3D                         2039
+#define ND_TAG_J2RadialReturnPlaneStrain                2040
+#define ND_TAG_J2RadialReturnPlaneStress                2041
+
 // Drucker-Prager - P.Arduino
 #define ND_TAG_ContactMaterial2D		14001
 #define ND_TAG_ContactMaterial3D		14002
@@ -80,6 +85,8 @@
 #define ND_TAG_DruckerPrager3D	                14006
 #define ND_TAG_DruckerPragerPlaneStrain         14007
 #define ND_TAG_InitialStateAnalysisWrapper      14011
+#define ND_TAG_DruckerPragerRadialReturn3D      14012
+#define ND_TAG_DruckerPragerRadialReturnPlaneStrain 14013
 
 // Multilayer reinforce concrete materials.
 #define ND_TAG_PlaneStressUserMaterial          28
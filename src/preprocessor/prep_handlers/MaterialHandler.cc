@@ -111,6 +111,9 @@
 #include "material/nD/j2_plasticity/J2PlateFiber.h"
 #include "material/nD/j2_plasticity/J2PlateFibre.h"
 #include "material/nD/j2_plasticity/J2ThreeDimensional.h"
+#include "material/nD/j2_plasticity/J2RadialReturnPlaneStrain.h"
+#include "material/nD/j2_plasticity/J2RadialReturnPlaneStress.h"
+#include "material/nD/j2_plasticity/J2RadialReturn3D.h"
 
 #include "material/nD/nd_adaptor/PlaneStressMaterial.h"
 #include "material/nD/nd_adaptor/PlateFiberMaterial.h"
@@ -160,6 +163,8 @@
 #include "material/nD/uw_materials/DruckerPrager.h"
 #include "material/nD/uw_materials/DruckerPragerPlaneStrain.h"
 #include "material/nD/uw_materials/DruckerPrager3D.h"
+#include "material/nD/uw_materials/DruckerPragerRadialReturnPlaneStrain.h"
+#include "material/nD/uw_materials/DruckerPragerRadialReturn3D.h"
 #include "material/nD/uw_materials/InitialStateAnalysisWrapper.h"
 #include "material/nD/uw_materials/ContactMaterial2D.h"
 #include "material/nD/uw_materials/ContactMaterial3D.h"
@@ -392,6 +397,12 @@ XC::Material *load_nD_material(int tag_mat,const std::string &cmd)
       retval= new XC::J2PlateFibre(tag_mat);
     else if(cmd == "J2_three_dimensional")
       retval= new XC::J2ThreeDimensional(tag_mat);
+    else if(cmd == "J2_radial_return_plane_strain")
+      retval= new XC::J2RadialReturnPlaneStrain(tag_mat);
+    else if(cmd == "J2_radial_return_plane_stress")
+      retval= new XC::J2RadialReturnPlaneStress(tag_mat);
+    else if(cmd == "J2_radial_return_3d")
+      retval= new XC::J2RadialReturn3D(tag_mat);
     else if(cmd == "plane_stress_material")
       retval= new XC::PlaneStressMaterial(tag_mat);
     else if(cmd == "plate_fiber_material")
@@ -404,6 +415,10 @@ XC::Material *load_nD_material(int tag_mat,const std::string &cmd)
       retval= new XC::DruckerPragerPlaneStrain(tag_mat);
     else if(cmd == "drucker-prager_3d")
       retval= new XC::DruckerPrager3D(tag_mat);
+    else if(cmd == "drucker-prager_radial_return_plane_strain")
+      retval= new XC::DruckerPragerRadialReturnPlaneStrain(tag_mat);
+    else if(cmd == "drucker-prager_radial_return_3d")
+      retval= new XC::DruckerPragerRadialReturn3D(tag_mat);
     else if(cmd == "initial_state_analysis_wrapper")
       retval= new XC::InitialStateAnalysisWrapper(tag_mat);
     else if(cmd == "contact_material_2d")
@@ -235,6 +235,9 @@ void materialNotSuitableMsg(const std::string &errHeader, const std::string &mat
 //!   for plane problems.
 //! - Brick: Defines an eight node hexahedron (Brick),
 //!   para solid analysis.
+//! - EightNodeBrick, TwentyNodeBrick, TwentySevenNodeBrick: Define 8, 20
+//!   and 27 node hexahedra whose material points use the tensor interface
+//!   of the material (getTangentTensor, getStressTensor,...).
 //! - ZeroLength: Defines a zero length element (ZeroLength).
 //! - ZeroLengthSection: Defines a zero length element with section type material (ZeroLengthSection).
 //! - BeamContact2D: Defines a two-dimensional beam-to-node contact element which defines a frictional contact interface between a beam element and a separate body.
@@ -467,6 +470,24 @@ XC::Element *XC::ProtoElementHandler::create_element(const std::string &elementT
         if(!retval)
 	  materialNotSuitableMsg(errHeader,material_name,elementType);
       }
+    else if(elementType == "EightNodeBrick")
+      {
+        retval= new_element_mat<EightNodeBrick,NDMaterial>(tag_elem, get_ptr_material());
+        if(!retval)
+	  materialNotSuitableMsg(errHeader,material_name,elementType);
+      }
+    else if(elementType == "TwentyNodeBrick")
+      {
+        retval= new_element_mat<TwentyNodeBrick,NDMaterial>(tag_elem, get_ptr_material());
+        if(!retval)
+	  materialNotSuitableMsg(errHeader,material_name,elementType);
+      }
+    else if(elementType == "TwentySevenNodeBrick")
+      {
+        retval= new_element_mat<TwentySevenNodeBrick,NDMaterial>(tag_elem, get_ptr_material());
+        if(!retval)
+	  materialNotSuitableMsg(errHeader,material_name,elementType);
+      }
     else if((elementType == "quad_surface_load")||(elementType == "QuadSurfaceLoad"))
       {
         retval= new_element<QuadSurfaceLoad>(tag_elem);
@@ -493,7 +514,7 @@ XC::Element *XC::ProtoElementHandler::create_element(const std::string &elementT
   }
 
 //! @brief Create a new element.
-//! @param type: type of element. Available types:'Truss','TrussSection','CorotTruss','CorotTrussSection','Spring', 'Beam2d02', 'Beam2d03',  'Beam2d04', 'Beam3d01', 'Beam3d02', 'ElasticBeam2d', 'ElasticTimoshenkoBeam2d', 'ElasticBeam3d', 'ElasticTimoshenkoBeam3d', 'BeamWithHinges2d', 'BeamWithHinges3d', 'NlBeamColumn2d', 'NlBeamColumn3d','ForceBeamColumn2d', 'ForceBeamColumn3d', 'ShellMitc4', ' shellNl', 'Quad4n', 'Tri31', 'Brick', 'ZeroLength', 'ZeroLengthContact2d', 'ZeroLengthContact3d', 'ZeroLengthSection', 'BeamContact2D', 'BeamContact3D'.
+//! @param type: type of element. Available types:'Truss','TrussSection','CorotTruss','CorotTrussSection','Spring', 'Beam2d02', 'Beam2d03',  'Beam2d04', 'Beam3d01', 'Beam3d02', 'ElasticBeam2d', 'ElasticTimoshenkoBeam2d', 'ElasticBeam3d', 'ElasticTimoshenkoBeam3d', 'BeamWithHinges2d', 'BeamWithHinges3d', 'NlBeamColumn2d', 'NlBeamColumn3d','ForceBeamColumn2d', 'ForceBeamColumn3d', 'ShellMitc4', ' shellNl', 'Quad4n', 'Tri31', 'Brick', 'EightNodeBrick', 'TwentyNodeBrick', 'TwentySevenNodeBrick', 'ZeroLength', 'ZeroLengthContact2d', 'ZeroLengthContact3d', 'ZeroLengthSection', 'BeamContact2D', 'BeamContact3D'.
 //! @param iNodes: nodes ID, e.g. xc.ID([1,2]) to create a linear element from node 1 to node 2.
 XC::Element *XC::ProtoElementHandler::newElement(const std::string &type,const ID &iNodes)
   {
@@ -39,6 +39,8 @@
 #include <solution/analysis/analysis/StaticAnalysis.h>
 #include <solution/analysis/analysis/DirectIntegrationAnalysis.h>
 #include <solution/analysis/analysis/VariableTimeStepDirectIntegrationAnalysis.h>
+#include <solution/analysis/analysis/HarmonicSteadyStateAnalysis.h>
+#include <solution/analysis/analysis/BatchedLinearBucklingAnalysis.h>
 
 
 #include "solution/analysis/ModelWrapper.h"
@@ -85,6 +87,8 @@ bool XC::SolutionProcedure::alloc_analysis(const std::string &cod,const std::str
 		            << cod_solu_eigenM << "' not found."
 		            << std::endl;
               }
+            else if(cod=="batched_linear_buckling_analysis")
+              theAnalysis= new BatchedLinearBucklingAnalysis(analysis_aggregation);
             else if(cod=="linear_buckling_eigen_analysis") //Used only inside LinearBucklingAnalysis.
               theAnalysis= new LinearBucklingEigenAnalysis(analysis_aggregation);
             else if(cod=="ill-conditioning_analysis")
@@ -93,6 +97,8 @@ bool XC::SolutionProcedure::alloc_analysis(const std::string &cod,const std::str
               theAnalysis= new StaticAnalysis(analysis_aggregation);
             else if(cod=="variable_time_step_direct_integration_analysis")
               theAnalysis= new VariableTimeStepDirectIntegrationAnalysis(analysis_aggregation);
+            else if(cod=="harmonic_steady_state_analysis")
+              theAnalysis= new HarmonicSteadyStateAnalysis(analysis_aggregation);
 	    else
 	      std::cerr << getClassName() << "::" << __FUNCTION__
 	            << "; analysis type: '"
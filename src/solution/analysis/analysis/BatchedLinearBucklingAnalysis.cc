@@ -0,0 +1,440 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis C. Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//BatchedLinearBucklingAnalysis.cc
+
+#include "BatchedLinearBucklingAnalysis.h"
+#include <solution/analysis/model/AnalysisModel.h>
+#include <solution/analysis/model/SparseModelAssembler.h>
+#include <solution/analysis/numberer/DOF_Numberer.h>
+#include <solution/analysis/handler/ConstraintHandler.h>
+#include <domain/domain/Domain.h>
+#include "domain/load/pattern/LoadPattern.h"
+#include "solution/SolutionStrategy.h"
+#include <Eigen/Eigenvalues>
+#include <set>
+#include <algorithm>
+
+//! @brief Constructor.
+XC::BatchedLinearBucklingAnalysis::BatchedLinearBucklingAnalysis(SolutionStrategy *analysis_aggregation)
+  :Analysis(analysis_aggregation), domainStamp(0), numModes(1),
+   maxNumIter(100), tol(1e-10) {}
+
+//! @brief Virtual constructor.
+XC::Analysis *XC::BatchedLinearBucklingAnalysis::getCopy(void) const
+  { return new BatchedLinearBucklingAnalysis(*this); }
+
+//! @brief Clears the computed results.
+void XC::BatchedLinearBucklingAnalysis::clearAll(void)
+  {
+    criticalLoadFactors.clear();
+    modes.clear();
+  }
+
+//! @brief Add a load combination.
+//!
+//! @param name: name of the combination.
+//! @param factors: factors for each (active) load pattern.
+void XC::BatchedLinearBucklingAnalysis::addCombination(const std::string &name, const combination_factors &factors)
+  {
+    combinationNames.push_back(name);
+    combinations.push_back(factors);
+    clearAll();
+  }
+
+//! @brief Add a load combination.
+//!
+//! @param name: name of the combination.
+//! @param d: Python dictionary containing the factors for each
+//!           (active) load pattern (i.e. {'G':1.35, 'Q':1.5}).
+void XC::BatchedLinearBucklingAnalysis::addCombinationPy(const std::string &name, const boost::python::dict &d)
+  {
+    combination_factors factors;
+    const boost::python::list keys= d.keys();
+    const size_t sz= boost::python::len(keys);
+    for(size_t i= 0;i<sz;i++)
+      {
+	const std::string lpName= boost::python::extract<std::string>(keys[i]);
+	factors[lpName]= boost::python::extract<double>(d[keys[i]]);
+      }
+    addCombination(name, factors);
+  }
+
+//! @brief Remove all the combinations.
+void XC::BatchedLinearBucklingAnalysis::clearCombinations(void)
+  {
+    combinationNames.clear();
+    combinations.clear();
+    clearAll();
+  }
+
+//! @brief Return the names of the combinations in a Python list.
+boost::python::list XC::BatchedLinearBucklingAnalysis::getCombinationNamesPy(void) const
+  {
+    boost::python::list retval;
+    for(std::vector<std::string>::const_iterator i= combinationNames.begin(); i!= combinationNames.end(); i++)
+      retval.append(*i);
+    return retval;
+  }
+
+//! @brief Return the index of the combination with the given name.
+size_t XC::BatchedLinearBucklingAnalysis::getCombinationIndex(const std::string &name) const
+  {
+    const size_t retval= std::find(combinationNames.begin(), combinationNames.end(), name)-combinationNames.begin();
+    if(retval>=combinationNames.size())
+      std::cerr << getClassName() << "::" << __FUNCTION__
+		<< "; combination: '" << name << "' not found."
+		<< std::endl;
+    return retval;
+  }
+
+//! @brief Return the active load pattern with the given name.
+XC::LoadPattern *XC::BatchedLinearBucklingAnalysis::findActiveLoadPattern(const std::string &name)
+  {
+    LoadPattern *retval= nullptr;
+    std::map<int,LoadPattern *> &lPatterns= getDomainPtr()->getConstraints().getLoadPatterns();
+    for(std::map<int,LoadPattern *>::iterator i= lPatterns.begin(); i!= lPatterns.end(); i++)
+      if(i->second->getName()==name)
+	{
+	  retval= i->second;
+	  break;
+	}
+    return retval;
+  }
+
+//! @brief Make the changes derived of a change in the domain.
+int XC::BatchedLinearBucklingAnalysis::domainChanged(void)
+  {
+    getAnalysisModelPtr()->clearAll();
+    getConstraintHandlerPtr()->clearAll();
+    int result= getConstraintHandlerPtr()->handle();
+    if(result < 0)
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+		  << "; ConstraintHandler::handle() failed." << std::endl;
+        return -1;
+      }
+
+    //Set equation numbers.
+    result= getDOF_NumbererPtr()->numberDOF();
+    if(result < 0)
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+		  << "; failed in equation numbering." << std::endl;
+        return -2;
+      }
+    result= getConstraintHandlerPtr()->doneNumberingDOF();
+    if(result < 0)
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+		  << "; failed in doneNumberingDOF()." << std::endl;
+        return -3;
+      }
+    return 0;
+  }
+
+//! @brief Compute the geometric stiffness matrix that corresponds
+//! to each of the load patterns used in the combinations.
+//!
+//! For each load pattern, its loads are applied alone, the linear
+//! displacements are obtained with the factorization of K0 and the
+//! geometric stiffness is computed as the difference between the
+//! tangent stiffness at that state and K0. At the end the model is
+//! brought back to rest and the loads of all the active load patterns
+//! are applied again.
+int XC::BatchedLinearBucklingAnalysis::formGeometricStiffness(const sparse_matrix &K0, const Eigen::SimplicialLDLT<sparse_matrix> &K0_factorization, std::map<std::string, sparse_matrix> &Kg)
+  {
+    int retval= 0;
+    Domain *dom= getDomainPtr();
+    AnalysisModel *mdl= getAnalysisModelPtr();
+    const SparseModelAssembler assembler(mdl);
+    const double t= dom->getCurrentTime();
+
+    std::set<std::string> lpNames;
+    for(std::vector<combination_factors>::const_iterator i= combinations.begin(); i!= combinations.end(); i++)
+      for(combination_factors::const_iterator j= i->begin(); j!= i->end(); j++)
+	lpNames.insert(j->first);
+
+    for(std::set<std::string>::const_iterator i= lpNames.begin(); i!= lpNames.end(); i++)
+      {
+	LoadPattern *lp= findActiveLoadPattern(*i);
+	if(!lp)
+	  {
+	    std::cerr << getClassName() << "::" << __FUNCTION__
+		      << "; load pattern: '" << *i
+		      << "' not found between the active ones." << std::endl;
+	    retval= -1;
+	    break;
+	  }
+	dom->getMesh().zeroLoads();
+	lp->applyLoad(t);
+	const Eigen::VectorXd P= assembler.formLoadVector();
+	const Eigen::VectorXd u= K0_factorization.solve(P);
+	assembler.setDisp(u);
+	dom->update();
+	Kg[*i]= assembler.formMatrix(SparseModelAssembler::stiffness)-K0;
+      }
+    // Back to rest.
+    assembler.setDisp(Eigen::VectorXd::Zero(K0.rows()));
+    dom->update();
+    dom->applyLoad(t);
+    return retval;
+  }
+
+//! @brief Solve the buckling eigenproblem for the i-th combination
+//! using subspace iteration.
+//!
+//! @param i: index of the combination.
+//! @param K0: elastic stiffness matrix.
+//! @param K0_factorization: factorization of the elastic stiffness matrix.
+//! @param Kg: geometric stiffness matrix of the combination.
+//! @param X0: starting iteration vectors.
+int XC::BatchedLinearBucklingAnalysis::solveCombination(const size_t &i, const sparse_matrix &K0, const Eigen::SimplicialLDLT<sparse_matrix> &K0_factorization, const sparse_matrix &Kg, const Eigen::MatrixXd &X0)
+  {
+    // Solve -Kg*phi= mu*K0*phi, mu= 1/lambda.
+    const sparse_matrix G= -Kg;
+    Eigen::MatrixXd X= X0;
+    Eigen::VectorXd mu;
+    bool converged= false;
+    for(int iter= 0;(iter<maxNumIter) && !converged;iter++)
+      {
+	const Eigen::MatrixXd Y= G*X;
+	if(Y.norm()==0.0) // no geometric stiffness, no buckling.
+	  {
+	    criticalLoadFactors[i]= Vector();
+	    modes[i].clear();
+	    return 0;
+	  }
+	const Eigen::MatrixXd Xb= K0_factorization.solve(Y);
+	// Projection of the problem on the subspace.
+	Eigen::MatrixXd Kr= Xb.transpose()*(K0*Xb);
+	Eigen::MatrixXd Gr= Xb.transpose()*(G*Xb);
+	Kr= 0.5*(Kr+Kr.transpose()).eval();
+	Gr= 0.5*(Gr+Gr.transpose()).eval();
+	// K0-orthonormal basis of the subspace. The iteration vectors
+	// can become linearly dependent when the rank of Kg is smaller
+	// than their number, so the dependent directions are dropped.
+	const Eigen::SelfAdjointEigenSolver<Eigen::MatrixXd> kes(Kr);
+	const Eigen::VectorXd &d= kes.eigenvalues();
+	const double dMax= d.maxCoeff();
+	std::vector<int> independent;
+	for(int j= 0;j<d.size();j++)
+	  if(d(j)>1e-12*dMax)
+	    independent.push_back(j);
+	const int k= independent.size();
+	Eigen::MatrixXd B(Kr.rows(),k);
+	for(int j= 0;j<k;j++)
+	  B.col(j)= kes.eigenvectors().col(independent[j])/sqrt(d(independent[j]));
+	const Eigen::MatrixXd Gb= B.transpose()*Gr*B;
+	const Eigen::SelfAdjointEigenSolver<Eigen::MatrixXd> ges(0.5*(Gb+Gb.transpose()));
+	if((dMax<=0.0) || (ges.info()!=Eigen::Success))
+	  {
+	    std::cerr << getClassName() << "::" << __FUNCTION__
+		      << "; reduced eigenproblem failed for combination: '"
+		      << combinationNames[i] << "'." << std::endl;
+	    return -1;
+	  }
+	const Eigen::VectorXd &ev= ges.eigenvalues();
+	// Sort by decreasing magnitude.
+	std::vector<int> order(k);
+	for(int j= 0;j<k;j++)
+	  order[j]= j;
+	std::sort(order.begin(), order.end(), [&ev](int a, int b) { return std::abs(ev(a))>std::abs(ev(b)); });
+	Eigen::MatrixXd W(k,k);
+	Eigen::VectorXd newMu(k);
+	for(int j= 0;j<k;j++)
+	  {
+	    W.col(j)= ges.eigenvectors().col(order[j]);
+	    newMu(j)= ev(order[j]);
+	  }
+	X= Xb*(B*W);
+	const int p= std::min(numModes,k);
+	const double muMax= std::abs(newMu(0));
+	if((mu.size()==k) && (muMax>0.0))
+	  converged= ((newMu.head(p)-mu.head(p)).cwiseAbs().maxCoeff()<=tol*muMax);
+	mu= newMu;
+      }
+    if(!converged)
+      std::cerr << getClassName() << "::" << __FUNCTION__
+		<< "; subspace iteration didn't converge for combination: '"
+		<< combinationNames[i] << "' after " << maxNumIter
+		<< " iterations." << std::endl;
+
+    // Smallest positive load factors: largest positive values of mu.
+    std::vector<int> positive;
+    const double muTol= (mu.size()>0) ? 1e-12*std::abs(mu(0)) : 0.0;
+    for(int j= 0;j<mu.size();j++)
+      if(mu(j)>muTol)
+	positive.push_back(j);
+    std::sort(positive.begin(), positive.end(), [&mu](int a, int b) { return mu(a)>mu(b); });
+    const size_t nm= std::min(size_t(numModes), positive.size());
+    Vector lambda(nm);
+    modes[i].resize(nm);
+    for(size_t j= 0;j<nm;j++)
+      {
+	const int k= positive[j];
+	lambda(j)= 1.0/mu(k);
+	const Eigen::VectorXd phi= X.col(k);
+	modes[i][j]= phi/phi.cwiseAbs().maxCoeff();
+      }
+    criticalLoadFactors[i]= lambda;
+    return 0;
+  }
+
+//! @brief Performs the analysis for all the combinations.
+int XC::BatchedLinearBucklingAnalysis::analyze(void)
+  {
+    assert(solution_strategy);
+    CommandEntity *old= solution_strategy->Owner();
+    solution_strategy->set_owner(this);
+
+    int result= 0;
+    const int stamp= getDomainPtr()->hasDomainChanged();
+    if(stamp != domainStamp)
+      {
+	domainStamp= stamp;
+	result= domainChanged();
+	if(result < 0)
+	  {
+	    std::cerr << getClassName() << "::" << __FUNCTION__
+		      << "; domainChanged failed\n";
+	    solution_strategy->set_owner(old);
+	    return -1;
+	  }
+      }
+    const SparseModelAssembler assembler(getAnalysisModelPtr());
+    const sparse_matrix K0= assembler.formMatrix(SparseModelAssembler::stiffness);
+    const Eigen::SimplicialLDLT<sparse_matrix> K0_factorization(K0);
+    if(K0_factorization.info()!=Eigen::Success)
+      {
+	std::cerr << getClassName() << "::" << __FUNCTION__
+		  << "; factorization of the elastic stiffness matrix failed.\n";
+	solution_strategy->set_owner(old);
+	return -2;
+      }
+    std::map<std::string, sparse_matrix> Kg;
+    result= formGeometricStiffness(K0, K0_factorization, Kg);
+    if(result<0)
+      {
+	solution_strategy->set_owner(old);
+	return -3;
+      }
+
+    // Deterministic starting vectors.
+    const int n= K0.rows();
+    const int q= std::min(std::max(2*numModes, numModes+8), n);
+    Eigen::MatrixXd X0(n,q);
+    for(int i= 0;i<n;i++)
+      for(int j= 0;j<q;j++)
+	X0(i,j)= (j==0) ? 1.0 : sin(0.7*(i+1)*(j+1)+j);
+
+    const int numComb= combinations.size();
+    criticalLoadFactors.assign(numComb, Vector());
+    modes.assign(numComb, std::vector<Eigen::VectorXd>());
+    int numErrors= 0;
+#pragma omp parallel for schedule(dynamic)
+    for(int i= 0;i<numComb;i++)
+      {
+	sparse_matrix KgComb(n,n);
+	const combination_factors &factors= combinations[i];
+	for(combination_factors::const_iterator j= factors.begin(); j!= factors.end(); j++)
+	  KgComb+= j->second*Kg.at(j->first);
+	if(solveCombination(i, K0, K0_factorization, KgComb, X0)<0)
+	  {
+#pragma omp atomic
+	    numErrors++;
+	  }
+      }
+    solution_strategy->set_owner(old);
+    if(numErrors>0)
+      return -4;
+    return 0;
+  }
+
+//! @brief Return the critical load factors computed for the combination.
+const XC::Vector &XC::BatchedLinearBucklingAnalysis::getCriticalLoadFactors(const std::string &name) const
+  {
+    static const Vector empty;
+    const size_t i= getCombinationIndex(name);
+    if(i<criticalLoadFactors.size())
+      return criticalLoadFactors[i];
+    return empty;
+  }
+
+//! @brief Return the critical load factor of the given mode
+//! for the combination.
+double XC::BatchedLinearBucklingAnalysis::getCriticalLoadFactor(const std::string &name, int mode) const
+  {
+    double retval= 0.0;
+    const Vector &lambda= getCriticalLoadFactors(name);
+    if((mode>0) && (mode<=lambda.Size()))
+      retval= lambda(mode-1);
+    else
+      std::cerr << getClassName() << "::" << __FUNCTION__
+		<< "; mode " << mode << " is out of range (1 - "
+		<< lambda.Size() << ")\n";
+    return retval;
+  }
+
+//! @brief Return the buckling mode for the combination (one component
+//! for each equation).
+XC::Vector XC::BatchedLinearBucklingAnalysis::getEigenvector(const std::string &name, int mode) const
+  {
+    Vector retval;
+    const size_t i= getCombinationIndex(name);
+    if(i<modes.size())
+      {
+	const std::vector<Eigen::VectorXd> &m= modes[i];
+	if((mode>0) && (mode<=int(m.size())))
+	  {
+	    const Eigen::VectorXd &phi= m[mode-1];
+	    retval.resize(phi.size());
+	    for(int j= 0;j<phi.size();j++)
+	      retval(j)= phi(j);
+	  }
+	else
+	  std::cerr << getClassName() << "::" << __FUNCTION__
+		    << "; mode " << mode << " is out of range (1 - "
+		    << m.size() << ")\n";
+      }
+    return retval;
+  }
+
+//! @brief Return the components of the buckling mode for the
+//! combination that correspond to the given node.
+XC::Vector XC::BatchedLinearBucklingAnalysis::getNodeEigenvector(const std::string &name, int mode, int nodeTag) const
+  {
+    const size_t i= getCombinationIndex(name);
+    if((i<modes.size()) && (mode>0) && (mode<=int(modes[i].size())))
+      {
+	const SparseModelAssembler assembler(getAnalysisModelPtr());
+	return assembler.getNodeVector(modes[i][mode-1], nodeTag);
+      }
+    std::cerr << getClassName() << "::" << __FUNCTION__
+	      << "; no mode " << mode << " for combination: '"
+	      << name << "'\n";
+    return Vector();
+  }
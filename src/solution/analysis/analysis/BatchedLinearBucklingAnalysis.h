@@ -0,0 +1,132 @@
+// -*-c++-*-
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis C. Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//BatchedLinearBucklingAnalysis.h
+
+
+#ifndef BatchedLinearBucklingAnalysis_h
+#define BatchedLinearBucklingAnalysis_h
+
+#include <solution/analysis/analysis/Analysis.h>
+#include "utility/matrix/Vector.h"
+#include <map>
+#include <vector>
+#include <Eigen/Core>
+#include <Eigen/SparseCore>
+#include <Eigen/SparseCholesky>
+
+namespace XC {
+class LoadPattern;
+
+//! @ingroup AnalysisType
+//
+//! @brief Linear buckling analysis of many load combinations sharing
+//! the factorization of the elastic stiffness matrix.
+//!
+//! The elastic stiffness matrix \f$K_0\f$ is assembled and factorized
+//! once. Then, for each load pattern involved in the combinations,
+//! the linear prestress state is computed using that factorization
+//! and the corresponding geometric stiffness matrix \f$K_{g,j}\f$ is
+//! obtained from the tangent stiffness at that state. The geometric
+//! stiffness of each combination is obtained by superposition
+//! \f$K_g= \sum f_j K_{g,j}\f$ and the eigenproblem:
+//! \f[
+//! (K_0+\lambda K_g)\, \phi= 0
+//! \f]
+//! is solved by subspace iteration (see Bathe, Finite Element
+//! Procedures, section 11.6) reusing the factorization of \f$K_0\f$.
+//! The combinations are processed in parallel.
+//!
+//! The matrices are computed starting from the current (trial) state
+//! of the model, so the model must be at rest when the analysis
+//! starts. The element geometric stiffness must be linear in the
+//! element forces (as in the P-Delta or corotational
+//! transformations for small displacements).
+class BatchedLinearBucklingAnalysis: public Analysis
+  {
+  public:
+    typedef Eigen::SparseMatrix<double> sparse_matrix;
+    typedef std::map<std::string, double> combination_factors;
+  private:
+    int domainStamp;
+    int numModes; //!< number of modes to compute for each combination.
+    int maxNumIter; //!< maximum number of subspace iterations.
+    double tol; //!< convergence tolerance for the subspace iteration.
+    std::vector<std::string> combinationNames; //!< combination names.
+    std::vector<combination_factors> combinations; //!< load pattern factors for each combination.
+    std::vector<Vector> criticalLoadFactors; //!< critical load factors for each combination.
+    std::vector<std::vector<Eigen::VectorXd> > modes; //!< buckling modes for each combination.
+
+    LoadPattern *findActiveLoadPattern(const std::string &);
+    int formGeometricStiffness(const sparse_matrix &, const Eigen::SimplicialLDLT<sparse_matrix> &, std::map<std::string, sparse_matrix> &);
+    int solveCombination(const size_t &, const sparse_matrix &, const Eigen::SimplicialLDLT<sparse_matrix> &, const sparse_matrix &, const Eigen::MatrixXd &);
+    size_t getCombinationIndex(const std::string &) const;
+  protected:
+    friend class SolutionProcedure;
+    BatchedLinearBucklingAnalysis(SolutionStrategy *analysis_aggregation);
+    Analysis *getCopy(void) const;
+  public:
+    virtual int analyze(void);
+    void clearAll(void);
+    virtual int domainChanged(void);
+
+    //! @brief Return the number of modes to compute.
+    inline int getNumModes(void) const
+      { return numModes; }
+    //! @brief Set the number of modes to compute.
+    inline void setNumModes(const int &nm)
+      { numModes= nm; }
+    //! @brief Return the maximum number of subspace iterations.
+    inline int getMaxNumIter(void) const
+      { return maxNumIter; }
+    //! @brief Set the maximum number of subspace iterations.
+    inline void setMaxNumIter(const int &n)
+      { maxNumIter= n; }
+    //! @brief Return the convergence tolerance.
+    inline double getTolerance(void) const
+      { return tol; }
+    //! @brief Set the convergence tolerance.
+    inline void setTolerance(const double &d)
+      { tol= d; }
+
+    void addCombination(const std::string &, const combination_factors &);
+    void addCombinationPy(const std::string &, const boost::python::dict &);
+    void clearCombinations(void);
+    //! @brief Return the number of combinations.
+    inline size_t getNumCombinations(void) const
+      { return combinationNames.size(); }
+    boost::python::list getCombinationNamesPy(void) const;
+
+    const Vector &getCriticalLoadFactors(const std::string &) const;
+    double getCriticalLoadFactor(const std::string &, int) const;
+    Vector getEigenvector(const std::string &, int) const;
+    Vector getNodeEigenvector(const std::string &, int, int) const;
+  };
+
+} // end of XC namespace
+
+#endif
@@ -0,0 +1,294 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis C. Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//HarmonicSteadyStateAnalysis.cc
+
+#include "HarmonicSteadyStateAnalysis.h"
+#include <solution/analysis/model/AnalysisModel.h>
+#include <solution/analysis/model/SparseModelAssembler.h>
+#include <solution/analysis/numberer/DOF_Numberer.h>
+#include <solution/analysis/handler/ConstraintHandler.h>
+#include <domain/domain/Domain.h>
+#include "solution/SolutionStrategy.h"
+#include <Eigen/SparseLU>
+
+//! @brief Constructor.
+XC::HarmonicSteadyStateAnalysis::HarmonicSteadyStateAnalysis(SolutionStrategy *analysis_aggregation)
+  :Analysis(analysis_aggregation), domainStamp(0), frequencies(), lossFactor(0.0) {}
+
+//! @brief Virtual constructor.
+XC::Analysis *XC::HarmonicSteadyStateAnalysis::getCopy(void) const
+  { return new HarmonicSteadyStateAnalysis(*this); }
+
+//! @brief Clears the assembled matrices and the computed response.
+void XC::HarmonicSteadyStateAnalysis::clearAll(void)
+  {
+    K.resize(0,0);
+    M.resize(0,0);
+    C.resize(0,0);
+    P.resize(0);
+    response.clear();
+  }
+
+//! @brief Set the frequencies (Hz) to compute the response for.
+void XC::HarmonicSteadyStateAnalysis::setFrequencies(const Vector &v)
+  {
+    frequencies= v;
+    response.clear();
+  }
+
+//! @brief Return the angular frequencies (rad/s) to compute the response for.
+XC::Vector XC::HarmonicSteadyStateAnalysis::getAngularFrequencies(void) const
+  { return 2.0*M_PI*frequencies; }
+
+//! @brief Make the changes derived of a change in the domain.
+int XC::HarmonicSteadyStateAnalysis::domainChanged(void)
+  {
+    getAnalysisModelPtr()->clearAll();
+    getConstraintHandlerPtr()->clearAll();
+    int result= getConstraintHandlerPtr()->handle();
+    if(result < 0)
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+		  << "; ConstraintHandler::handle() failed." << std::endl;
+        return -1;
+      }
+
+    //Set equation numbers.
+    result= getDOF_NumbererPtr()->numberDOF();
+    if(result < 0)
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+		  << "; failed in equation numbering." << std::endl;
+        return -2;
+      }
+    result= getConstraintHandlerPtr()->doneNumberingDOF();
+    if(result < 0)
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+		  << "; failed in doneNumberingDOF()." << std::endl;
+        return -3;
+      }
+    return 0;
+  }
+
+//! @brief Assemble the stiffness, mass and damping matrices.
+int XC::HarmonicSteadyStateAnalysis::formMatrices(void)
+  {
+    const SparseModelAssembler assembler(getAnalysisModelPtr());
+    K= assembler.formMatrix(SparseModelAssembler::stiffness);
+    M= assembler.formMatrix(SparseModelAssembler::mass);
+    C= assembler.formMatrix(SparseModelAssembler::damping);
+    return 0;
+  }
+
+//! @brief Assemble the load vector from the loads currently
+//! applied to the domain (nodal loads and element loads).
+int XC::HarmonicSteadyStateAnalysis::formLoadVector(void)
+  {
+    Domain *dom= getDomainPtr();
+    dom->applyLoad(dom->getCurrentTime());
+    const SparseModelAssembler assembler(getAnalysisModelPtr());
+    P= assembler.formLoadVector();
+    return 0;
+  }
+
+//! @brief Solve the system for each frequency.
+//!
+//! All the dynamic stiffness matrices share the sparsity pattern of
+//! K+M+C, so each thread analyzes the pattern once and only performs
+//! the numerical factorization for its frequencies.
+int XC::HarmonicSteadyStateAnalysis::solveFrequencies(void)
+  {
+    const int numFreq= frequencies.Size();
+    response.assign(numFreq, complex_vector());
+
+    const complex_sparse_matrix Kc= K.cast<complex>()*complex(1.0,lossFactor);
+    const complex_sparse_matrix Mc= M.cast<complex>();
+    const complex_sparse_matrix Cc= C.cast<complex>();
+    const complex_vector Pc= P.cast<complex>();
+    const complex_sparse_matrix pattern= Kc+Mc+Cc;
+
+    int numErrors= 0;
+#pragma omp parallel
+    {
+      Eigen::SparseLU<complex_sparse_matrix, Eigen::COLAMDOrdering<int> > solver;
+      solver.analyzePattern(pattern);
+#pragma omp for schedule(dynamic)
+      for(int i= 0;i<numFreq;i++)
+	{
+	  const double w= 2.0*M_PI*frequencies(i);
+	  const complex_sparse_matrix Z= Kc+Mc*complex(-w*w,0.0)+Cc*complex(0.0,w);
+	  solver.factorize(Z);
+	  if(solver.info()==Eigen::Success)
+	    response[i]= solver.solve(Pc);
+	  else
+	    {
+#pragma omp atomic
+	      numErrors++;
+	      response[i]= complex_vector::Zero(Pc.size());
+	    }
+	}
+    }
+    if(numErrors>0)
+      {
+	std::cerr << getClassName() << "::" << __FUNCTION__
+		  << "; factorization failed for " << numErrors
+		  << " frequencies (singular dynamic stiffness matrix)."
+		  << std::endl;
+	return -1;
+      }
+    return 0;
+  }
+
+//! @brief Performs the analysis.
+int XC::HarmonicSteadyStateAnalysis::analyze(void)
+  {
+    assert(solution_strategy);
+    CommandEntity *old= solution_strategy->Owner();
+    solution_strategy->set_owner(this);
+
+    int result= 0;
+    const int stamp= getDomainPtr()->hasDomainChanged();
+    if(stamp != domainStamp)
+      {
+	domainStamp= stamp;
+	result= domainChanged();
+	if(result < 0)
+	  {
+	    std::cerr << getClassName() << "::" << __FUNCTION__
+		      << "; domainChanged failed\n";
+	    solution_strategy->set_owner(old);
+	    return -1;
+	  }
+      }
+    result= formMatrices();
+    if(result==0)
+      result= formLoadVector();
+    if(result<0)
+      {
+	std::cerr << getClassName() << "::" << __FUNCTION__
+		  << "; failed to assemble the system.\n";
+	solution_strategy->set_owner(old);
+	return -2;
+      }
+    result= solveFrequencies();
+    solution_strategy->set_owner(old);
+    if(result<0)
+      return -3;
+    return 0;
+  }
+
+//! @brief Return the complex amplitudes of the equations for the i-th
+//! frequency.
+const XC::HarmonicSteadyStateAnalysis::complex_vector &XC::HarmonicSteadyStateAnalysis::getResponse(int i) const
+  {
+    static const complex_vector empty;
+    if((i<0) || (i>=int(response.size())))
+      {
+	std::cerr << getClassName() << "::" << __FUNCTION__
+		  << "; frequency index: " << i
+		  << " out of range (the analysis has been run?)."
+		  << std::endl;
+	return empty;
+      }
+    return response[i];
+  }
+
+//! @brief Return the real (if real is true) or imaginary part
+//! of the response of the node for the i-th frequency.
+XC::Vector XC::HarmonicSteadyStateAnalysis::getNodeResponseComponent(int i, int nodeTag, bool real) const
+  {
+    const complex_vector &x= getResponse(i);
+    const SparseModelAssembler assembler(getAnalysisModelPtr());
+    if(real)
+      return assembler.getNodeVector(x.real(), nodeTag);
+    else
+      return assembler.getNodeVector(x.imag(), nodeTag);
+  }
+
+//! @brief Return the real part of the response of the node for the
+//! i-th frequency.
+XC::Vector XC::HarmonicSteadyStateAnalysis::getNodeResponseRealPart(int i, int nodeTag) const
+  { return getNodeResponseComponent(i, nodeTag, true); }
+
+//! @brief Return the imaginary part of the response of the node for the
+//! i-th frequency.
+XC::Vector XC::HarmonicSteadyStateAnalysis::getNodeResponseImagPart(int i, int nodeTag) const
+  { return getNodeResponseComponent(i, nodeTag, false); }
+
+//! @brief Return the amplitudes of the node DOFs for the i-th frequency.
+XC::Vector XC::HarmonicSteadyStateAnalysis::getNodeAmplitudes(int i, int nodeTag) const
+  {
+    const Vector re= getNodeResponseRealPart(i, nodeTag);
+    const Vector im= getNodeResponseImagPart(i, nodeTag);
+    Vector retval(re.Size());
+    for(int j= 0;j<re.Size();j++)
+      retval(j)= std::abs(complex(re(j),im(j)));
+    return retval;
+  }
+
+//! @brief Return the phase angles (radians) of the node DOFs for
+//! the i-th frequency.
+XC::Vector XC::HarmonicSteadyStateAnalysis::getNodePhases(int i, int nodeTag) const
+  {
+    const Vector re= getNodeResponseRealPart(i, nodeTag);
+    const Vector im= getNodeResponseImagPart(i, nodeTag);
+    Vector retval(re.Size());
+    for(int j= 0;j<re.Size();j++)
+      retval(j)= std::arg(complex(re(j),im(j)));
+    return retval;
+  }
+
+//! @brief Return the amplitudes of the given node DOF for all
+//! the frequencies (frequency response function).
+XC::Vector XC::HarmonicSteadyStateAnalysis::getNodeDOFAmplitudes(int nodeTag, int dof) const
+  {
+    const int numFreq= response.size();
+    Vector retval(numFreq);
+    for(int i= 0;i<numFreq;i++)
+      {
+	const Vector tmp= getNodeAmplitudes(i, nodeTag);
+	if(dof<tmp.Size())
+	  retval(i)= tmp(dof);
+      }
+    return retval;
+  }
+
+//! @brief Return the phase angles (radians) of the given node DOF
+//! for all the frequencies.
+XC::Vector XC::HarmonicSteadyStateAnalysis::getNodeDOFPhases(int nodeTag, int dof) const
+  {
+    const int numFreq= response.size();
+    Vector retval(numFreq);
+    for(int i= 0;i<numFreq;i++)
+      {
+	const Vector tmp= getNodePhases(i, nodeTag);
+	if(dof<tmp.Size())
+	  retval(i)= tmp(dof);
+      }
+    return retval;
+  }
@@ -0,0 +1,120 @@
+// -*-c++-*-
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis C. Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//HarmonicSteadyStateAnalysis.h
+
+
+#ifndef HarmonicSteadyStateAnalysis_h
+#define HarmonicSteadyStateAnalysis_h
+
+#include <solution/analysis/analysis/Analysis.h>
+#include "utility/matrix/Vector.h"
+#include <complex>
+#include <vector>
+#include <Eigen/Core>
+#include <Eigen/SparseCore>
+
+namespace XC {
+class Node;
+
+//! @ingroup AnalysisType
+//
+//! @brief Steady-state harmonic (frequency-domain) analysis.
+//!
+//! Computes the steady-state response of the linear model to
+//! the loads currently applied to the domain, considered as
+//! harmonic loads \f$P e^{i \omega t}\f$. The stiffness, mass and damping
+//! matrices are assembled once from the analysis model and, for each
+//! frequency, the system:
+//! \f[
+//! (K (1+i\eta) - \omega^2 M + i \omega C)\, X = P
+//! \f]
+//! is solved using a complex sparse LU factorization, where
+//! \f$\eta\f$ is the (optional) hysteretic loss factor and C is the
+//! viscous damping matrix obtained from the Rayleigh damping factors
+//! of elements and nodes. The frequencies are processed in parallel.
+//!
+//! The matrices are computed at the current (trial) state of the
+//! model, so the analysis is meaningful when the model is at rest
+//! (typically before any other analysis or after revertToStart).
+class HarmonicSteadyStateAnalysis: public Analysis
+  {
+  public:
+    typedef std::complex<double> complex;
+    typedef Eigen::SparseMatrix<double> sparse_matrix;
+    typedef Eigen::SparseMatrix<complex> complex_sparse_matrix;
+    typedef Eigen::VectorXcd complex_vector;
+  private:
+    int domainStamp;
+    Vector frequencies; //!< frequencies to compute the response for (Hz).
+    double lossFactor; //!< hysteretic (structural) damping loss factor.
+    sparse_matrix K; //!< stiffness matrix.
+    sparse_matrix M; //!< mass matrix.
+    sparse_matrix C; //!< damping matrix.
+    Eigen::VectorXd P; //!< load vector.
+    std::vector<complex_vector> response; //!< complex amplitudes for each frequency.
+
+    int formMatrices(void);
+    int formLoadVector(void);
+    int solveFrequencies(void);
+    Vector getNodeResponseComponent(int, int, bool) const;
+  protected:
+    friend class SolutionProcedure;
+    HarmonicSteadyStateAnalysis(SolutionStrategy *analysis_aggregation);
+    Analysis *getCopy(void) const;
+  public:
+    virtual int analyze(void);
+    void clearAll(void);
+    virtual int domainChanged(void);
+
+    void setFrequencies(const Vector &);
+    //! @brief Return the frequencies (Hz) to compute the response for.
+    inline const Vector &getFrequencies(void) const
+      { return frequencies; }
+    Vector getAngularFrequencies(void) const;
+    //! @brief Return the number of frequencies.
+    inline size_t getNumFrequencies(void) const
+      { return frequencies.Size(); }
+    //! @brief Set the hysteretic loss factor.
+    inline void setLossFactor(const double &eta)
+      { lossFactor= eta; }
+    //! @brief Return the hysteretic loss factor.
+    inline const double &getLossFactor(void) const
+      { return lossFactor; }
+
+    const complex_vector &getResponse(int) const;
+    Vector getNodeResponseRealPart(int, int) const;
+    Vector getNodeResponseImagPart(int, int) const;
+    Vector getNodeAmplitudes(int, int) const;
+    Vector getNodePhases(int, int) const;
+    Vector getNodeDOFAmplitudes(int, int) const;
+    Vector getNodeDOFPhases(int, int) const;
+  };
+
+} // end of XC namespace
+
+#endif
@@ -31,9 +31,11 @@
 #include "solution/analysis/analysis/DomainDecompositionAnalysis.h"
 #include "solution/analysis/analysis/DirectIntegrationAnalysis.h"
 #include "solution/analysis/analysis/LinearBucklingAnalysis.h"
+#include "solution/analysis/analysis/BatchedLinearBucklingAnalysis.h"
 #include "solution/analysis/analysis/IllConditioningAnalysis.h"
 #include "solution/analysis/analysis/EigenAnalysis.h"
 #include "solution/analysis/analysis/ModalAnalysis.h"
+#include "solution/analysis/analysis/HarmonicSteadyStateAnalysis.h"
 //#include "solution/analysis/analysis/SubdomainAnalysis.h"
 //#include "solution/analysis/analysis/SubstructuringAnalysis.h"
 #include "solution/analysis/analysis/TransientAnalysis.h"
@@ -94,6 +94,21 @@ class_<XC::LinearBucklingAnalysis, bases<XC::StaticAnalysis>, boost::noncopyable
   .add_property("eigenAnalysis", make_function( getLinearBucklingEigenAnalysis, return_internal_reference<>() ),"return a reference to the internal eigenanalysis object.")
   ;
 
+class_<XC::BatchedLinearBucklingAnalysis, bases<XC::Analysis>, boost::noncopyable >("BatchedLinearBucklingAnalysis", no_init)
+  .add_property("numModes",&XC::BatchedLinearBucklingAnalysis::getNumModes,&XC::BatchedLinearBucklingAnalysis::setNumModes, "Get/set the number of modes to compute for each combination.")
+  .add_property("maxNumIter",&XC::BatchedLinearBucklingAnalysis::getMaxNumIter,&XC::BatchedLinearBucklingAnalysis::setMaxNumIter, "Get/set the maximum number of subspace iterations.")
+  .add_property("tol",&XC::BatchedLinearBucklingAnalysis::getTolerance,&XC::BatchedLinearBucklingAnalysis::setTolerance, "Get/set the convergence tolerance of the subspace iteration.")
+  .def("addCombination",&XC::BatchedLinearBucklingAnalysis::addCombinationPy, "addCombination(name, factors): add a load combination; factors is a dictionary containing the factor for each active load pattern (i.e. {'G':1.35, 'Q':1.5}).")
+  .def("clearCombinations",&XC::BatchedLinearBucklingAnalysis::clearCombinations, "Remove all the combinations.")
+  .def("getNumCombinations",&XC::BatchedLinearBucklingAnalysis::getNumCombinations, "Return the number of combinations.")
+  .def("getCombinationNames",&XC::BatchedLinearBucklingAnalysis::getCombinationNamesPy, "Return the names of the combinations.")
+  .def("getCriticalLoadFactors",&XC::BatchedLinearBucklingAnalysis::getCriticalLoadFactors, return_internal_reference<>(), "getCriticalLoadFactors(combName): return the critical load factors computed for the combination.")
+  .def("getCriticalLoadFactor",&XC::BatchedLinearBucklingAnalysis::getCriticalLoadFactor, "getCriticalLoadFactor(combName, mode): return the critical load factor of the given mode for the combination.")
+  .def("getEigenvector",&XC::BatchedLinearBucklingAnalysis::getEigenvector, "getEigenvector(combName, mode): return the buckling mode for the combination.")
+  .def("getNodeEigenvector",&XC::BatchedLinearBucklingAnalysis::getNodeEigenvector, "getNodeEigenvector(combName, mode, nodeTag): return the components of the buckling mode that correspond to the node.")
+  .def("analyze", &XC::BatchedLinearBucklingAnalysis::analyze,"Performs the analysis for all the combinations.")
+  ;
+
 class_<XC::IllConditioningAnalysis, bases<XC::EigenAnalysis>, boost::noncopyable >("IllConditioningAnalysis", no_init)
   .def("getEigenvalue", make_function(&XC::IllConditioningAnalysis::getEigenvalue, return_value_policy<copy_const_reference>()) )
   ;
@@ -104,6 +119,20 @@ class_<XC::ModalAnalysis , bases<XC::EigenAnalysis>, boost::noncopyable >("Modal
   ;
 
 
+class_<XC::HarmonicSteadyStateAnalysis , bases<XC::Analysis>, boost::noncopyable >("HarmonicSteadyStateAnalysis", no_init)
+  .add_property("frequencies", make_function(&XC::HarmonicSteadyStateAnalysis::getFrequencies, return_internal_reference<>()), &XC::HarmonicSteadyStateAnalysis::setFrequencies, "Get/set the frequencies (Hz) to compute the response for.")
+  .add_property("lossFactor", make_function(&XC::HarmonicSteadyStateAnalysis::getLossFactor, return_value_policy<copy_const_reference>()), &XC::HarmonicSteadyStateAnalysis::setLossFactor, "Get/set the hysteretic damping loss factor.")
+  .def("getAngularFrequencies",&XC::HarmonicSteadyStateAnalysis::getAngularFrequencies, "Return the angular frequencies (rad/s) to compute the response for.")
+  .def("getNumFrequencies",&XC::HarmonicSteadyStateAnalysis::getNumFrequencies, "Return the number of frequencies.")
+  .def("getNodeResponseRealPart",&XC::HarmonicSteadyStateAnalysis::getNodeResponseRealPart, "getNodeResponseRealPart(iFreq, nodeTag): return the real part of the node response for the iFreq-th frequency.")
+  .def("getNodeResponseImagPart",&XC::HarmonicSteadyStateAnalysis::getNodeResponseImagPart, "getNodeResponseImagPart(iFreq, nodeTag): return the imaginary part of the node response for the iFreq-th frequency.")
+  .def("getNodeAmplitudes",&XC::HarmonicSteadyStateAnalysis::getNodeAmplitudes, "getNodeAmplitudes(iFreq, nodeTag): return the amplitudes of the node DOFs for the iFreq-th frequency.")
+  .def("getNodePhases",&XC::HarmonicSteadyStateAnalysis::getNodePhases, "getNodePhases(iFreq, nodeTag): return the phase angles (radians) of the node DOFs for the iFreq-th frequency.")
+  .def("getNodeDOFAmplitudes",&XC::HarmonicSteadyStateAnalysis::getNodeDOFAmplitudes, "getNodeDOFAmplitudes(nodeTag, dof): return the amplitudes of the node DOF for all the frequencies.")
+  .def("getNodeDOFPhases",&XC::HarmonicSteadyStateAnalysis::getNodeDOFPhases, "getNodeDOFPhases(nodeTag, dof): return the phase angles (radians) of the node DOF for all the frequencies.")
+  .def("analyze", &XC::HarmonicSteadyStateAnalysis::analyze,"Performs the analysis for all the frequencies.")
+  ;
+
 //class_<XC::SubdomainAnalysis, bases<XC::Analysis, XC::MovableObject>, boost::noncopyable >("SubdomainAnalysis", no_init);
 
 class_<XC::TransientAnalysis, bases<XC::Analysis>, boost::noncopyable >("TransientAnalysis", no_init)
@@ -116,6 +116,8 @@ int XC::IncrementalIntegrator::formTangent(int statFlag)
       }
 
     theSOE->zeroA(); //Zeroes the matrix elements.
+    if(theSOE->hasLowRankUpdate()) // left by a previous transient analysis.
+      theSOE->clearLowRankUpdate();
     
     // the loops to form and add the tangents are broken into two for 
     // efficiency when performing parallel computations - CHANGE
@@ -373,6 +375,7 @@ int XC::IncrementalIntegrator::formElementResidual(void)
     return res;	    
   }
 
-//! @brief Function related to modal damping (not implemented yet).
+//! @brief Return the factor of the damping matrix in the tangent
+//! (used to compute the contribution of the modal damping to the tangent).
 double XC::IncrementalIntegrator::getCFactor(void)
   { return 0; }
@@ -70,6 +70,8 @@
 #include <solution/analysis/model/dof_grp/DOF_Group.h>
 #include <solution/analysis/model/FE_EleIter.h>
 #include <solution/analysis/model/DOF_GrpIter.h>
+#include "utility/actor/actor/CommMetaData.h"
+#include "utility/actor/actor/Communicator.h"
 
 
 //! @brief Constructor.
@@ -149,6 +151,15 @@ int XC::TransientIntegrator::formTangent(int statFlag)
 	    result = -2;
 	  }
       }
+
+    // modal damping contribution (low-rank update of the matrix).
+    if(modalDamping.isActive())
+      {
+	modalDamping.setup(theModel);
+	modalDamping.setTangent(theLinSOE, getCFactor());
+      }
+    else if(theLinSOE->hasLowRankUpdate())
+      theLinSOE->clearLowRankUpdate();
     return result;
   }
 
@@ -159,6 +170,20 @@ int XC::TransientIntegrator::formTangent(int statFlag, const double &iFact, cons
     return this->formTangent(statFlag);
   }
 
+//! @brief Builds the unbalanced load vector (right hand side of the
+//! equation), including the modal damping forces if any.
+int XC::TransientIntegrator::formUnbalance(void)
+  {
+    int result= IncrementalIntegrator::formUnbalance();
+    if((result==0) && modalDamping.isActive())
+      {
+	AnalysisModel *theModel= getAnalysisModelPtr();
+	modalDamping.setup(theModel);
+	result= modalDamping.addDampingForces(theModel, getLinearSOEPtr());
+      }
+    return result;
+  }
+
 //! @brief Assembles the unbalanced vector of the element
 //! being passed as parameter.
 //!
@@ -195,3 +220,20 @@ int XC::TransientIntegrator::formNodUnbalance(DOF_Group *theDof)
     return 0;
   }
 
+//! @brief Send object members through the communicator argument.
+int XC::TransientIntegrator::sendData(Communicator &comm)
+  {
+    int res= IncrementalIntegrator::sendData(comm);
+    res+= comm.sendVector(modalDamping.getDampingRatios(),getDbTagData(),CommMetaData(1));
+    return res;
+  }
+
+//! @brief Receives object members through the communicator argument.
+int XC::TransientIntegrator::recvData(const Communicator &comm)
+  {
+    int res= IncrementalIntegrator::recvData(comm);
+    Vector ratios;
+    res+= comm.receiveVector(ratios,getDbTagData(),CommMetaData(1));
+    modalDamping.setDampingRatios(ratios);
+    return res;
+  }
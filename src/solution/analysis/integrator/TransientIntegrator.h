@@ -67,6 +67,7 @@
 #define TransientIntegrator_h
 
 #include <solution/analysis/integrator/IncrementalIntegrator.h>
+#include <solution/analysis/integrator/transient/ModalDamping.h>
 namespace XC {
 class Information;
 class LinearSOE;
@@ -176,16 +177,32 @@ class Vector;
 //! method for updating the response quantities at the DOFs with
 //! appropriate values; these values being some function of the solution
 //! to the linear system of equations. 
+//!
+//! Besides the damping defined in the elements and nodes, modal damping
+//! can be defined by means of a damping ratio for each mode (see
+//! ModalDamping).
 class TransientIntegrator: public IncrementalIntegrator
   {
   protected:
+    ModalDamping modalDamping; //!< modal damping.
+
+    int sendData(Communicator &);
+    int recvData(const Communicator &);
     TransientIntegrator(SolutionStrategy *,int classTag);
   public:
+    //! @brief Return the modal damping ratios.
+    inline const Vector &getModalDampingRatios(void) const
+      { return modalDamping.getDampingRatios(); }
+    //! @brief Set the modal damping ratios (the eigenvectors
+    //! must be computed before running the analysis).
+    inline void setModalDampingRatios(const Vector &v)
+      { modalDamping.setDampingRatios(v); }
     virtual int formTangent(int statFlag);
     virtual int formTangent(int statusFlag, 
 			    const double &iFactor,
 			    const double &cFactor);
     
+    virtual int formUnbalance(void);
     virtual int formEleResidual(FE_Element *theEle);
     virtual int formNodUnbalance(DOF_Group *theDof);    
     virtual int initialize(void) {return 0;};    
@@ -33,7 +33,9 @@ class_<XC::IncrementalIntegrator, bases<XC::Integrator>, boost::noncopyable >("I
 
 class_<XC::StaticIntegrator, bases<XC::IncrementalIntegrator>, boost::noncopyable >("StaticIntegrator", no_init);
 
-class_<XC::TransientIntegrator, bases<XC::IncrementalIntegrator>, boost::noncopyable >("TransientIntegrator", no_init);
+class_<XC::TransientIntegrator, bases<XC::IncrementalIntegrator>, boost::noncopyable >("TransientIntegrator", no_init)
+  .add_property("modalDampingRatios", make_function(&XC::TransientIntegrator::getModalDampingRatios, return_internal_reference<>()), &XC::TransientIntegrator::setModalDampingRatios, "Get/set the modal damping ratios (one for each mode; the eigenvectors must be computed before the analysis).")
+  ;
 
 #include "eigen/python_interface.tcc"
 #include "static/python_interface.tcc"
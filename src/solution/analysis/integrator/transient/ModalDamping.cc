@@ -0,0 +1,141 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis C. Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//DampingFactors.cpp
+//ModalDamping.cc
+
+#include "ModalDamping.h"
+#include <solution/analysis/model/AnalysisModel.h>
+#include <solution/analysis/model/SparseModelAssembler.h>
+#include <solution/system_of_eqn/linearSOE/LinearSOE.h>
+#include <domain/domain/Domain.h>
+#include <cmath>
+
+//! @brief Constructor.
+//!
+//! @param ratios: damping ratio for each mode.
+XC::ModalDamping::ModalDamping(const Vector &ratios)
+  : dampingRatios(ratios), geoTag(-1), numEqn(-1) {}
+
+//! @brief Set the damping ratios.
+void XC::ModalDamping::setDampingRatios(const Vector &ratios)
+  {
+    dampingRatios= ratios;
+    geoTag= -1; // force recomputation.
+  }
+
+//! @brief Compute the modal forces and the modal damping factors from
+//! the eigenvectors stored in the nodes.
+int XC::ModalDamping::compute(AnalysisModel *model)
+  {
+    const Domain *dom= model->getDomainPtr();
+    eigenvalues= dom->getEigenvalues();
+    const int numModes= std::min(dampingRatios.Size(), eigenvalues.Size());
+    if(numModes<dampingRatios.Size())
+      std::cerr << "ModalDamping::" << __FUNCTION__
+		<< "; " << dampingRatios.Size()
+		<< " damping ratios defined but only "
+		<< eigenvalues.Size()
+		<< " modes available (run a modal analysis before)."
+		<< std::endl;
+    const SparseModelAssembler assembler(model);
+    const SparseModelAssembler::sparse_matrix M= assembler.formMatrix(SparseModelAssembler::mass);
+    const int n= model->getNumEqn();
+    modalForces.clear();
+    modalForces.reserve(numModes);
+    modalFactors.resize(numModes);
+    for(int i= 0;i<numModes;i++)
+      {
+	const Eigen::VectorXd phi= assembler.getEigenvector(i+1);
+	const Eigen::VectorXd Mphi= M*phi;
+	const double mi= phi.dot(Mphi);
+	Vector u(n);
+	for(int j= 0;j<n;j++)
+	  u(j)= Mphi(j);
+	modalForces.push_back(u);
+	const double w= sqrt(std::abs(eigenvalues(i)));
+	modalFactors(i)= (mi>0.0 ? 2.0*dampingRatios(i)*w/mi : 0.0);
+      }
+    geoTag= dom->getCurrentGeoTag();
+    numEqn= n;
+    return 0;
+  }
+
+//! @brief Compute the modal forces if the model (or the eigenvalues)
+//! has changed since the last call.
+int XC::ModalDamping::setup(AnalysisModel *model)
+  {
+    int retval= 0;
+    if(isActive() && model)
+      {
+	const Domain *dom= model->getDomainPtr();
+	const Vector &ev= dom->getEigenvalues();
+	bool changed= (geoTag!=dom->getCurrentGeoTag()) || (numEqn!=model->getNumEqn()) || (ev.Size()!=eigenvalues.Size());
+	for(int i= 0;(!changed) && (i<ev.Size());i++)
+	  changed= (ev(i)!=eigenvalues(i));
+	if(changed)
+	  retval= compute(model);
+      }
+    return retval;
+  }
+
+//! @brief Subtract the modal damping forces \f$C \dot{U}\f$ from the right
+//! hand side of the system of equations.
+int XC::ModalDamping::addDampingForces(AnalysisModel *model, LinearSOE *theSOE) const
+  {
+    const size_t numModes= modalForces.size();
+    if(numModes==0)
+      return 0;
+    const SparseModelAssembler assembler(model);
+    const Eigen::VectorXd vel= assembler.getTrialVel();
+    const int n= vel.size();
+    Vector f(n);
+    for(size_t i= 0;i<numModes;i++)
+      {
+	const Vector &u= modalForces[i];
+	double q= 0.0;
+	for(int j= 0;j<n;j++)
+	  q+= u(j)*vel(j);
+	f.addVector(1.0, u, modalFactors(i)*q);
+      }
+    Vector b(theSOE->getB());
+    b.addVector(1.0, f, -1.0);
+    return theSOE->setB(b);
+  }
+
+//! @brief Pass the contribution of the modal damping to the tangent
+//! (cFactor*C) to the system of equations as a low-rank update.
+//!
+//! @param theSOE: system of equations.
+//! @param cFactor: factor of the damping matrix in the tangent
+//! (see IncrementalIntegrator::getCFactor).
+void XC::ModalDamping::setTangent(LinearSOE *theSOE, const double &cFactor) const
+  {
+    if(modalForces.empty() || (cFactor==0.0))
+      theSOE->clearLowRankUpdate();
+    else
+      theSOE->setLowRankUpdate(modalForces, cFactor*modalFactors);
+  }
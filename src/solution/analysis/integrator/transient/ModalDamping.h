@@ -0,0 +1,82 @@
+// -*-c++-*-
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis C. Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//ModalDamping.h
+
+#ifndef ModalDamping_h
+#define ModalDamping_h
+
+#include "utility/matrix/Vector.h"
+#include <vector>
+
+namespace XC {
+class AnalysisModel;
+class LinearSOE;
+
+//! @ingroup TransientIntegrator
+//
+//! @brief Modal damping defined by a damping ratio for each mode.
+//!
+//! The damping matrix is expressed as a low-rank matrix computed from
+//! the eigenvectors and eigenvalues stored in the domain (so a modal
+//! analysis must be run before):
+//! \f[
+//! C= \sum_n \frac{2 \xi_n \omega_n}{\phi_n^T M \phi_n} (M\phi_n)(M\phi_n)^T
+//! \f]
+//! The matrix is never assembled: the damping forces are computed as
+//! \f$\sum_n c_n (M\phi_n) ((M\phi_n)^T \dot{U})\f$ (O(n·modes)) and its
+//! contribution to the tangent is passed to the system of equations as
+//! a low-rank update (see LinearSOE::setLowRankUpdate), so the factorized
+//! effective stiffness keeps its sparsity.
+class ModalDamping
+  {
+  private:
+    Vector dampingRatios; //!< damping ratio for each mode.
+    std::vector<Vector> modalForces; //!< M*phi_n (one value for each equation).
+    Vector modalFactors; //!< 2*xi_n*w_n/(phi_n^T M phi_n).
+    Vector eigenvalues; //!< eigenvalues used to compute the modal factors.
+    int geoTag; //!< domain stamp when the modal forces were computed.
+    int numEqn; //!< number of equations when the modal forces were computed.
+
+    int compute(AnalysisModel *);
+  public:
+    ModalDamping(const Vector &ratios= Vector());
+
+    void setDampingRatios(const Vector &);
+    //! @brief Return the damping ratios.
+    inline const Vector &getDampingRatios(void) const
+      { return dampingRatios; }
+    //! @brief Return true if modal damping is defined.
+    inline bool isActive(void) const
+      { return (dampingRatios.Size()>0); }
+    int setup(AnalysisModel *);
+    int addDampingForces(AnalysisModel *, LinearSOE *) const;
+    void setTangent(LinearSOE *, const double &) const;
+  };
+} // end of XC namespace
+
+#endif
@@ -526,6 +526,6 @@ int XC::Newmark::revertToStart(void)
   }
 // AddingSensitivity:END ////////////////////////////////
 
-//! @brief Function related to modal damping (not implemented yet).
+//! @brief Return the factor of the damping matrix in the tangent.
 double XC::Newmark::getCFactor(void)
   { return c2; }
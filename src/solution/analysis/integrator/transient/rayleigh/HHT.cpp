@@ -468,6 +468,10 @@ int XC::HHT::commit(void)
     return commitModel();
   }
 
+//! @brief Return the factor of the damping matrix in the tangent.
+double XC::HHT::getCFactor(void)
+  { return alpha*c2; }
+
 //! @brief Send object members through the communicator argument.
 int XC::HHT::sendData(Communicator &comm)
   {
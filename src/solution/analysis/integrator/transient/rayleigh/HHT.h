@@ -128,6 +128,7 @@ class HHT: public HHTBase
     int revertToLastStep(void);        
     int update(const Vector &deltaU);
     int commit(void);
+    double getCFactor(void);
     
     virtual int sendSelf(Communicator &);
     virtual int recvSelf(const Communicator &);
@@ -0,0 +1,253 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis C. Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//SparseModelAssembler.cc
+
+#include "SparseModelAssembler.h"
+#include <solution/analysis/model/AnalysisModel.h>
+#include <solution/analysis/model/fe_ele/FE_Element.h>
+#include <solution/analysis/model/dof_grp/DOF_Group.h>
+#include <domain/domain/Domain.h>
+#include "domain/mesh/node/Node.h"
+#include "utility/matrix/Matrix.h"
+#include "utility/matrix/Vector.h"
+#include "utility/matrix/ID.h"
+
+namespace
+  {
+    typedef Eigen::Triplet<double> Triplet;
+
+    //! @brief Append the entries of the matrix argument to the triplet
+    //! list using the equation numbers in id.
+    void append_triplets(std::vector<Triplet> &triplets, const XC::Matrix &m, const XC::ID &id)
+      {
+	const int sz= id.Size();
+	for(int i= 0;i<sz;i++)
+	  {
+	    const int row= id(i);
+	    if(row>=0)
+	      for(int j= 0;j<sz;j++)
+		{
+		  const int col= id(j);
+		  if(col>=0)
+		    {
+		      const double value= m(i,j);
+		      if(value!=0.0)
+			triplets.push_back(Triplet(row,col,value));
+		    }
+		}
+	  }
+      }
+
+    //! @brief Add the entries of the vector argument to v
+    //! using the equation numbers in id.
+    void assemble_vector(Eigen::VectorXd &v, const XC::Vector &p, const XC::ID &id)
+      {
+	const int sz= id.Size();
+	for(int i= 0;i<sz;i++)
+	  {
+	    const int loc= id(i);
+	    if(loc>=0)
+	      v(loc)+= p(i);
+	  }
+      }
+
+    //! @brief Gather the values returned by getNodeValues for each
+    //! node into a vector with one value for each equation.
+    //!
+    //! The DOF groups of the constrained nodes (transformation handler)
+    //! are skipped, their equations are those of the retained nodes.
+    template <class NodeValues>
+    Eigen::VectorXd gather_node_values(XC::AnalysisModel *model, NodeValues getNodeValues)
+      {
+	Eigen::VectorXd retval= Eigen::VectorXd::Zero(model->getNumEqn());
+	const XC::Domain *dom= model->getDomainPtr();
+	XC::DOF_Group *dofGroupPtr= nullptr;
+	XC::DOF_GrpIter &theDofs= model->getDOFGroups();
+	while((dofGroupPtr = theDofs()) != nullptr)
+	  {
+	    const int nodeTag= dofGroupPtr->getNodeTag();
+	    const XC::Node *nodePtr= (nodeTag>=0 ? dom->getNode(nodeTag) : nullptr);
+	    if(nodePtr && !dofGroupPtr->getT())
+	      {
+		const XC::Vector values= getNodeValues(*dofGroupPtr, *nodePtr);
+		const XC::ID &id= dofGroupPtr->getID();
+		const int sz= std::min(id.Size(), values.Size());
+		for(int i= 0;i<sz;i++)
+		  {
+		    const int loc= id(i);
+		    if(loc>=0)
+		      retval(loc)= values(i);
+		  }
+	      }
+	  }
+	return retval;
+      }
+  }
+
+//! @brief Constructor.
+XC::SparseModelAssembler::SparseModelAssembler(AnalysisModel *mdl)
+  : model(mdl) {}
+
+//! @brief Assemble the matrix of the given type from the
+//! current state of the model.
+//!
+//! The mass and damping contributions are taken only from the
+//! finite elements that wrap an element (constraint FE_Elements
+//! return their penalty or Lagrange matrix as tangent whatever the
+//! requested contribution is).
+XC::SparseModelAssembler::sparse_matrix XC::SparseModelAssembler::formMatrix(const matrix_type &t) const
+  {
+    const int numEqn= model->getNumEqn();
+    std::vector<Triplet> triplets;
+
+    FE_Element *elePtr= nullptr;
+    FE_EleIter &theEles= model->getFEs();
+    while((elePtr = theEles()) != nullptr)
+      {
+	if(t==stiffness)
+	  {
+	    elePtr->zeroTangent();
+	    elePtr->addKtToTang(1.0);
+	  }
+	else if(elePtr->getElement())
+	  {
+	    elePtr->zeroTangent();
+	    if(t==mass)
+	      elePtr->addMtoTang(1.0);
+	    else
+	      elePtr->addCtoTang(1.0);
+	  }
+	else
+	  continue;
+	append_triplets(triplets, elePtr->getTangent(nullptr), elePtr->getID());
+      }
+
+    if(t!=stiffness)
+      {
+	DOF_Group *dofGroupPtr= nullptr;
+	DOF_GrpIter &theDofs= model->getDOFGroups();
+	while((dofGroupPtr = theDofs()) != nullptr)
+	  {
+	    dofGroupPtr->zeroTangent();
+	    if(t==mass)
+	      dofGroupPtr->addMtoTang(1.0);
+	    else
+	      dofGroupPtr->addCtoTang(1.0);
+	    append_triplets(triplets, dofGroupPtr->getTangent(nullptr), dofGroupPtr->getID());
+	  }
+      }
+    sparse_matrix retval(numEqn,numEqn);
+    retval.setFromTriplets(triplets.begin(), triplets.end());
+    return retval;
+  }
+
+//! @brief Assemble the load vector from the loads currently applied
+//! to the nodes and elements of the domain (the caller is responsible
+//! of calling applyLoad).
+Eigen::VectorXd XC::SparseModelAssembler::formLoadVector(void) const
+  {
+    const int numEqn= model->getNumEqn();
+    Eigen::VectorXd retval= Eigen::VectorXd::Zero(numEqn);
+
+    DOF_Group *dofGroupPtr= nullptr;
+    DOF_GrpIter &theDofs= model->getDOFGroups();
+    while((dofGroupPtr = theDofs()) != nullptr)
+      {
+	dofGroupPtr->zeroUnbalance();
+	dofGroupPtr->addPtoUnbalance(1.0);
+	assemble_vector(retval, dofGroupPtr->getUnbalance(nullptr), dofGroupPtr->getID());
+      }
+
+    FE_Element *elePtr= nullptr;
+    FE_EleIter &theEles= model->getFEs();
+    while((elePtr = theEles()) != nullptr)
+      {
+	elePtr->zeroResidual();
+	elePtr->addRtoResidual(1.0);
+	assemble_vector(retval, elePtr->getResidual(nullptr), elePtr->getID());
+      }
+    return retval;
+  }
+
+//! @brief Set the trial displacements of the nodes from the values
+//! of the argument (one value for each equation).
+void XC::SparseModelAssembler::setDisp(const Eigen::VectorXd &u) const
+  {
+    const int sz= u.size();
+    Vector disp(sz);
+    for(int i= 0;i<sz;i++)
+      disp(i)= u(i);
+    model->setDisp(disp);
+  }
+
+//! @brief Return the values of the argument (one value for each equation)
+//! that correspond to the DOFs of the node.
+XC::Vector XC::SparseModelAssembler::getNodeVector(const Eigen::VectorXd &x, int nodeTag) const
+  {
+    Vector retval;
+    Node *nodePtr= model->getDomainPtr()->getNode(nodeTag);
+    if(!nodePtr)
+      {
+	std::cerr << "SparseModelAssembler::" << __FUNCTION__
+		  << "; node: " << nodeTag << " not found." << std::endl;
+	return retval;
+      }
+    retval.resize(nodePtr->getNumberDOF());
+    DOF_Group *dofGroupPtr= nodePtr->getDOF_GroupPtr();
+    if(!dofGroupPtr || (x.size()==0))
+      return retval;
+    const ID &id= dofGroupPtr->getID();
+    Vector u(id.Size());
+    for(int j= 0;j<id.Size();j++)
+      {
+	const int loc= id(j);
+	if(loc>=0)
+	  u(j)= x(loc);
+      }
+    const Matrix *T= dofGroupPtr->getT();
+    if(T) // constrained node (transformation handler).
+      retval.addMatrixVector(0.0, *T, u, 1.0);
+    else
+      retval= u;
+    return retval;
+  }
+
+//! @brief Return the i-th eigenvector stored in the nodes (see
+//! Node::getEigenvector) with one value for each equation.
+Eigen::VectorXd XC::SparseModelAssembler::getEigenvector(int mode) const
+  {
+    return gather_node_values(model, [mode](const DOF_Group &, const Node &n)
+      { return n.getEigenvector(mode); });
+  }
+
+//! @brief Return the trial velocities of the nodes with one value
+//! for each equation.
+Eigen::VectorXd XC::SparseModelAssembler::getTrialVel(void) const
+  {
+    return gather_node_values(model, [](const DOF_Group &dg, const Node &)
+      { return dg.getTrialVel(); });
+  }
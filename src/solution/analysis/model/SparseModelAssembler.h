@@ -0,0 +1,69 @@
+// -*-c++-*-
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis C. Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//SparseModelAssembler.h
+
+#ifndef SparseModelAssembler_h
+#define SparseModelAssembler_h
+
+#include <Eigen/Core>
+#include <Eigen/SparseCore>
+
+namespace XC {
+class AnalysisModel;
+class Vector;
+
+//! @ingroup AnalysisModel
+//
+//! @brief Assembles the matrices (stiffness, mass, damping) and the
+//! load vector of an analysis model as Eigen sparse objects.
+//!
+//! Used by the analyses that work directly with the assembled
+//! matrices (instead of going through an integrator and a
+//! system of equations), i.e. frequency-domain or batched
+//! eigenvalue analyses.
+class SparseModelAssembler
+  {
+  public:
+    typedef Eigen::SparseMatrix<double> sparse_matrix;
+    enum matrix_type {stiffness, mass, damping};
+  private:
+    AnalysisModel *model;
+  public:
+    SparseModelAssembler(AnalysisModel *);
+
+    sparse_matrix formMatrix(const matrix_type &) const;
+    Eigen::VectorXd formLoadVector(void) const;
+    void setDisp(const Eigen::VectorXd &) const;
+    Vector getNodeVector(const Eigen::VectorXd &, int) const;
+    Eigen::VectorXd getEigenvector(int) const;
+    Eigen::VectorXd getTrialVel(void) const;
+  };
+
+} // end of XC namespace
+
+#endif
@@ -97,6 +97,7 @@
 #include <solution/system_of_eqn/linearSOE/sparseSYM/SymSparseLinSolver.h>
 
 #include "utility/matrix/Vector.h"
+#include "utility/matrix/Matrix.h"
 
 #include "solution/system_of_eqn/linearSOE/umfGEN/UmfpackGenLinSolver.h"
 #include "solution/system_of_eqn/linearSOE/mumps/MumpsSolver.h"
@@ -222,7 +223,112 @@ XC::LinearSOE::~LinearSOE(void)
 //! LinearSOESolver. To solve a linear system of equations means to find
 //! $x$ such that the equation $Ax=b$ is satisfied. 
 int XC::LinearSOE::solve(void)
-  { return (getSolver()->solve()); }
+  {
+    if(hasLowRankUpdate())
+      return solve_low_rank();
+    else
+      return (getSolver()->solve());
+  }
+
+//! @brief Set the low-rank update of the matrix:
+//! \f$A+\sum d_k u_k u_k^T\f$.
+//!
+//! @param u: vectors of the update (one value for each equation).
+//! @param d: factors of the update.
+void XC::LinearSOE::setLowRankUpdate(const std::vector<Vector> &u, const Vector &d)
+  {
+    if(static_cast<int>(u.size())!=d.Size())
+      {
+	std::cerr << getClassName() << "::" << __FUNCTION__
+		  << "; the number of vectors: " << u.size()
+		  << " doesn't match the number of factors: "
+		  << d.Size() << ". Update ignored." << std::endl;
+	clearLowRankUpdate();
+      }
+    else
+      {
+	lowRankVectors= u;
+	lowRankFactors= d;
+      }
+  }
+
+//! @brief Remove the low-rank update of the matrix.
+void XC::LinearSOE::clearLowRankUpdate(void)
+  {
+    lowRankVectors.clear();
+    lowRankFactors.resize(0);
+  }
+
+//! @brief Solve \f$(A+U D U^T) x= b\f$ using the
+//! Sherman-Morrison-Woodbury formula:
+//! \f[
+//! x= y - Z (D^{-1}+U^T Z)^{-1} U^T y
+//! \f]
+//! where \f$y= A^{-1} b\f$ and \f$Z= A^{-1} U\f$. The columns of Z are
+//! obtained by the solver reusing the factorization of A (the solvers
+//! that keep track of the factorization only perform the
+//! back substitution), so only a small dense system (one equation for
+//! each vector of the update) is added to the cost of the solution.
+int XC::LinearSOE::solve_low_rank(void)
+  {
+    LinearSOESolver *solver= getSolver();
+    const Vector b= getB();
+    int result= solver->solve();
+    if(result<0)
+      return result;
+    const Vector y= getX();
+
+    // Z= A^{-1} U
+    const size_t m= lowRankVectors.size();
+    std::vector<Vector> Z(m);
+    for(size_t k= 0;k<m;k++)
+      {
+	setB(lowRankVectors[k]);
+	result= solver->solve();
+	if(result<0)
+	  {
+	    std::cerr << getClassName() << "::" << __FUNCTION__
+		      << "; failed to solve for the vector: "
+		      << k << " of the low-rank update." << std::endl;
+	    setB(b);
+	    return result;
+	  }
+	Z[k]= getX();
+      }
+    setB(b); // restore the right hand side.
+
+    // S= D^{-1}+U^T Z, r= U^T y
+    Matrix S(m,m);
+    Vector r(m);
+    for(size_t i= 0;i<m;i++)
+      {
+	const Vector &ui= lowRankVectors[i];
+	r(i)= ui^y;
+	for(size_t j= 0;j<m;j++)
+	  S(i,j)= ui^Z[j];
+	if(lowRankFactors(i)!=0.0)
+	  S(i,i)+= 1.0/lowRankFactors(i);
+	else // null factor: remove the vector from the update.
+	  {
+	    for(size_t j= 0;j<m;j++)
+	      S(i,j)= 0.0;
+	    S(i,i)= 1.0;
+	    r(i)= 0.0;
+	  }
+      }
+    Vector w(m);
+    if(S.Solve(r, w)<0)
+      {
+	std::cerr << getClassName() << "::" << __FUNCTION__
+		  << "; singular capacitance matrix." << std::endl;
+	return -1;
+      }
+    Vector x(y);
+    for(size_t k= 0;k<m;k++)
+      x.addVector(1.0, Z[k], -w(k));
+    setX(x);
+    return result;
+  }
 
 //! @brief Returns the determinant of the system matrix.
 double XC::LinearSOE::getDeterminant(void)
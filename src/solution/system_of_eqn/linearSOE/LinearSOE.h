@@ -63,6 +63,8 @@
 // What: "@(#) LinearSOE.h, revA"
 
 #include <solution/system_of_eqn/SystemOfEqn.h>
+#include <vector>
+#include "utility/matrix/Vector.h"
 
 namespace XC {
 class LinearSOESolver;
@@ -89,12 +91,21 @@ class ID;
 //! equations. Each LinearSOE object will be associated with a
 //! LinearSOESolver object. It is the LinearSOESolver objects that is
 //! responsible for solving the linear system of equations.
+//!
+//! A symmetric low-rank update \f$\sum d_k u_k u_k^T\f$ can be added
+//! to the matrix \f$A\f$ without assembling it (which would destroy its
+//! sparsity). In that case the system is solved using the
+//! Sherman-Morrison-Woodbury formula, reusing the factorization of
+//! \f$A\f$ (see solve_low_rank).
 class LinearSOE: public SystemOfEqn
   {
   private:
     LinearSOESolver *theSolver;
+    std::vector<Vector> lowRankVectors; //!< vectors u_k of the low-rank update.
+    Vector lowRankFactors; //!< factors d_k of the low-rank update.
     void free_memory(void);
     void copy(const LinearSOESolver *);
+    int solve_low_rank(void);
   protected:
     friend class FEM_ObjectBroker;
     virtual bool setSolver(LinearSOESolver *);
@@ -165,6 +176,12 @@ class LinearSOE: public SystemOfEqn
     
     LinearSOESolver *getSolver(void);
     LinearSOESolver &newSolver(const std::string &);
+
+    void setLowRankUpdate(const std::vector<Vector> &, const Vector &);
+    void clearLowRankUpdate(void);
+    //! @brief Return true if a low-rank update of the matrix is defined.
+    inline bool hasLowRankUpdate(void) const
+      { return !lowRankVectors.empty(); }
   };
 } // end of XC namespace
 
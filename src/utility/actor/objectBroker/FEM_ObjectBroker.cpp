@@ -773,6 +773,16 @@ XC::NDMaterial *XC::FEM_ObjectBroker::getNewNDMaterial(int classTag)
       return new J2PlateFibre();
     case ND_TAG_J2ThreeDimensional:
       return new J2ThreeDimensional();
+    case ND_TAG_J2RadialReturnPlaneStrain:
+      return new J2RadialReturnPlaneStrain();
+    case ND_TAG_J2RadialReturnPlaneStress:
+      return new J2RadialReturnPlaneStress();
+    case ND_TAG_J2RadialReturn3D:
+      return new J2RadialReturn3D();
+    case ND_TAG_DruckerPragerRadialReturnPlaneStrain:
+      return new DruckerPragerRadialReturnPlaneStrain();
+    case ND_TAG_DruckerPragerRadialReturn3D:
+      return new DruckerPragerRadialReturn3D();
     case ND_TAG_PlaneStressMaterial:
       return new PlaneStressMaterial();
     case ND_TAG_PlateFiberMaterial:
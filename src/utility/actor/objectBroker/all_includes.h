@@ -125,6 +125,7 @@
 #include "material/section/interaction_diagram/InteractionDiagramData.h"
 #include "material/section/interaction_diagram/InteractionDiagram.h"
 #include "material/section/interaction_diagram/InteractionDiagram2d.h"
+#include "material/section/interaction_diagram/PolygonalSectionIntegrator.h"
 #include "material/section/interaction_diagram/ComputePivots.h"
 
 // NDMaterials
@@ -143,6 +144,9 @@
 #include "material/nD/j2_plasticity/J2PlateFibre.h"
 #include "material/nD/j2_plasticity/J2AxiSymm.h"
 #include "material/nD/j2_plasticity/J2ThreeDimensional.h"
+#include "material/nD/j2_plasticity/J2RadialReturnPlaneStrain.h"
+#include "material/nD/j2_plasticity/J2RadialReturnPlaneStress.h"
+#include "material/nD/j2_plasticity/J2RadialReturn3D.h"
 //#include "material/nD/feap/FeapMaterial03.h"
 
 // RC multilayer.
@@ -186,6 +190,8 @@
 #include "material/nD/uw_materials/DruckerPrager.h"
 #include "material/nD/uw_materials/DruckerPragerPlaneStrain.h"
 #include "material/nD/uw_materials/DruckerPrager3D.h"
+#include "material/nD/uw_materials/DruckerPragerRadialReturnPlaneStrain.h"
+#include "material/nD/uw_materials/DruckerPragerRadialReturn3D.h"
 #include "material/nD/uw_materials/InitialStateAnalysisWrapper.h"
 #include "material/nD/uw_materials/ContactMaterial2D.h"
 #include "material/nD/uw_materials/ContactMaterial3D.h"
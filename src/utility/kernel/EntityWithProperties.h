@@ -25,6 +25,7 @@
 
 #include "EntityWithOwner.h"
 #include <map>
+#include <memory>
 
 //! @ingroup NUCLEO
 //
@@ -38,9 +39,12 @@ class EntityWithProperties: public EntityWithOwner
   private:
     static inline const std::string py_prop_prefix= "py_prop";
     
-    PythonDict python_dict; //!< Python variables.
+    std::unique_ptr<PythonDict> python_dict; //!< Python variables (allocated only when needed).
+    PythonDict &get_python_dict(void);
   public:
     EntityWithProperties(EntityWithProperties *owr= nullptr);
+    EntityWithProperties(const EntityWithProperties &);
+    EntityWithProperties &operator=(const EntityWithProperties &);
     
     void clearPyProps(void);
     bool hasPyProp(const std::string &);
@@ -0,0 +1,359 @@
+// -*-c++-*-
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis C. Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//FixedMatrix.h
+
+#ifndef FixedMatrix_h
+#define FixedMatrix_h
+
+#include "FixedVector.h"
+#include "Matrix.h"
+
+namespace XC {
+
+//! @ingroup Matrix
+//
+//! @brief Matrix of fixed size R x C stored by value.
+//!
+//! Lightweight alternative to Matrix for the small temporaries (3x3,
+//! 6x6, 12x12...) of the element and coordinate transformation
+//! kernels: the components are stored in the object itself (no heap
+//! allocation) in column-major order (the same as Matrix, so the
+//! data can be exchanged with a plain copy) and all the loops have
+//! compile-time bounds. The method names mimic the Matrix ones.
+template <int R, int C>
+class FixedMatrix
+  {
+  private:
+    double theData[R*C];
+    //! @brief this= f*this (avoids propagating NaN values when f is zero).
+    inline void scale(const double &f)
+      {
+        if(f==0.0)
+          Zero();
+        else if(f!=1.0)
+          (*this)*= f;
+      }
+  public:
+    //! @brief Constructor (all components set to the argument).
+    explicit FixedMatrix(const double &value= 0.0)
+      { std::fill(theData, theData+R*C, value); }
+    explicit FixedMatrix(const Matrix &);
+
+    //! @brief Return the number of rows.
+    static constexpr int noRows(void)
+      { return R; }
+    //! @brief Return the number of columns.
+    static constexpr int noCols(void)
+      { return C; }
+    //! @brief Return a pointer to the matrix components.
+    inline const double *getDataPtr(void) const
+      { return theData; }
+    //! @brief Return a pointer to the matrix components.
+    inline double *getDataPtr(void)
+      { return theData; }
+    //! @brief Return the (row, col) component.
+    inline const double &operator()(const int &row, const int &col) const
+      { return theData[col*R+row]; }
+    //! @brief Return the (row, col) component.
+    inline double &operator()(const int &row, const int &col)
+      { return theData[col*R+row]; }
+
+    //! @brief Set all the components to zero.
+    inline void Zero(void)
+      { std::fill(theData, theData+R*C, 0.0); }
+    inline FixedMatrix &operator+=(const FixedMatrix &other)
+      {
+        for(int i= 0;i<R*C;i++)
+          theData[i]+= other.theData[i];
+        return *this;
+      }
+    inline FixedMatrix &operator-=(const FixedMatrix &other)
+      {
+        for(int i= 0;i<R*C;i++)
+          theData[i]-= other.theData[i];
+        return *this;
+      }
+    inline FixedMatrix &operator*=(const double &f)
+      {
+        for(int i= 0;i<R*C;i++)
+          theData[i]*= f;
+        return *this;
+      }
+
+    //! @brief this= thisFact*this+otherFact*other.
+    inline void addMatrix(const double &thisFact, const FixedMatrix &other, const double &otherFact)
+      {
+        scale(thisFact);
+        for(int i= 0;i<R*C;i++)
+          theData[i]+= otherFact*other.theData[i];
+      }
+    void addMatrix(const double &, const Matrix &, const double &);
+    template <int K>
+    void addMatrixProduct(const double &, const FixedMatrix<R,K> &, const FixedMatrix<K,C> &, const double &);
+    template <int K>
+    void addMatrixTransposeProduct(const double &, const FixedMatrix<K,R> &, const FixedMatrix<K,C> &, const double &);
+    template <int K>
+    void addMatrixTripleProduct(const double &, const FixedMatrix<K,R> &, const FixedMatrix<K,K> &, const double &);
+    template <int RA, int CA>
+    void Assemble(const FixedMatrix<RA,CA> &, const int &, const int &, const double &fact= 1.0);
+    template <int RA, int CA>
+    void AssembleTranspose(const FixedMatrix<RA,CA> &, const int &, const int &, const double &fact= 1.0);
+
+    FixedMatrix<C,R> getTrn(void) const;
+
+    //! @brief Return a Matrix that wraps the components of this
+    //! object (no copy). The returned object must not outlive this one.
+    inline Matrix getView(void)
+      { return Matrix(theData, R, C); }
+    //! @brief Return a copy of the components in a Matrix.
+    inline Matrix getMatrix(void) const
+      {
+        Matrix retval(R,C);
+        std::copy(theData, theData+R*C, retval.getDataPtr());
+        return retval;
+      }
+    void copyTo(Matrix &) const;
+  };
+
+//! @brief Constructor: copy the components of the argument.
+template <int R, int C>
+FixedMatrix<R,C>::FixedMatrix(const Matrix &m)
+  {
+    if((m.noRows()!=R) || (m.noCols()!=C))
+      {
+        std::cerr << "FixedMatrix<" << R << "," << C << ">::" << __FUNCTION__
+                  << "; matrix dimensions: " << m.noRows() << "x"
+                  << m.noCols() << " don't match." << std::endl;
+        Zero();
+      }
+    else
+      std::copy(m.getDataPtr(), m.getDataPtr()+R*C, theData);
+  }
+
+//! @brief Copy the components into the argument (which must have
+//! the same dimensions).
+template <int R, int C>
+void FixedMatrix<R,C>::copyTo(Matrix &m) const
+  {
+    if((m.noRows()!=R) || (m.noCols()!=C))
+      std::cerr << "FixedMatrix<" << R << "," << C << ">::" << __FUNCTION__
+                << "; matrix dimensions: " << m.noRows() << "x"
+                << m.noCols() << " don't match." << std::endl;
+    else
+      std::copy(theData, theData+R*C, m.getDataPtr());
+  }
+
+//! @brief this= thisFact*this+otherFact*other.
+template <int R, int C>
+void FixedMatrix<R,C>::addMatrix(const double &thisFact, const Matrix &other, const double &otherFact)
+  {
+    if((other.noRows()!=R) || (other.noCols()!=C))
+      std::cerr << "FixedMatrix<" << R << "," << C << ">::" << __FUNCTION__
+                << "; matrix dimensions: " << other.noRows() << "x"
+                << other.noCols() << " don't match." << std::endl;
+    else
+      {
+        scale(thisFact);
+        const double *otherData= other.getDataPtr();
+        for(int i= 0;i<R*C;i++)
+          theData[i]+= otherFact*otherData[i];
+      }
+  }
+
+//! @brief this= thisFact*this+otherFact*A*B.
+template <int R, int C> template <int K>
+void FixedMatrix<R,C>::addMatrixProduct(const double &thisFact, const FixedMatrix<R,K> &A, const FixedMatrix<K,C> &B, const double &otherFact)
+  {
+    scale(thisFact);
+    for(int j= 0;j<C;j++)
+      for(int k= 0;k<K;k++)
+        {
+          const double bkj= otherFact*B(k,j);
+          if(bkj!=0.0)
+            for(int i= 0;i<R;i++)
+              (*this)(i,j)+= A(i,k)*bkj;
+        }
+  }
+
+//! @brief this= thisFact*this+otherFact*A^T*B.
+template <int R, int C> template <int K>
+void FixedMatrix<R,C>::addMatrixTransposeProduct(const double &thisFact, const FixedMatrix<K,R> &A, const FixedMatrix<K,C> &B, const double &otherFact)
+  {
+    scale(thisFact);
+    for(int j= 0;j<C;j++)
+      for(int i= 0;i<R;i++)
+        {
+          double sum= 0.0;
+          for(int k= 0;k<K;k++)
+            sum+= A(k,i)*B(k,j);
+          (*this)(i,j)+= otherFact*sum;
+        }
+  }
+
+//! @brief this= thisFact*this+otherFact*A^T*B*A.
+template <int R, int C> template <int K>
+void FixedMatrix<R,C>::addMatrixTripleProduct(const double &thisFact, const FixedMatrix<K,R> &A, const FixedMatrix<K,K> &B, const double &otherFact)
+  {
+    static_assert(R==C, "triple product must be square.");
+    FixedMatrix<K,C> BA;
+    BA.addMatrixProduct(0.0, B, A, 1.0);
+    addMatrixTransposeProduct(thisFact, A, BA, otherFact);
+  }
+
+//! @brief Add fact*m to the block of this matrix starting at (init_row, init_col).
+template <int R, int C> template <int RA, int CA>
+void FixedMatrix<R,C>::Assemble(const FixedMatrix<RA,CA> &m, const int &init_row, const int &init_col, const double &fact)
+  {
+    for(int j= 0;j<CA;j++)
+      for(int i= 0;i<RA;i++)
+        (*this)(init_row+i,init_col+j)+= fact*m(i,j);
+  }
+
+//! @brief Add fact*m^T to the block of this matrix starting at (init_row, init_col).
+template <int R, int C> template <int RA, int CA>
+void FixedMatrix<R,C>::AssembleTranspose(const FixedMatrix<RA,CA> &m, const int &init_row, const int &init_col, const double &fact)
+  {
+    for(int j= 0;j<RA;j++)
+      for(int i= 0;i<CA;i++)
+        (*this)(init_row+i,init_col+j)+= fact*m(j,i);
+  }
+
+//! @brief Return the transpose of the matrix.
+template <int R, int C>
+FixedMatrix<C,R> FixedMatrix<R,C>::getTrn(void) const
+  {
+    FixedMatrix<C,R> retval;
+    for(int j= 0;j<C;j++)
+      for(int i= 0;i<R;i++)
+        retval(j,i)= (*this)(i,j);
+    return retval;
+  }
+
+//! @brief this= factThis*this+factOther*m*v.
+template <int N> template <int C>
+void FixedVector<N>::addMatrixVector(const double &factThis, const FixedMatrix<N,C> &m, const FixedVector<C> &v, const double &factOther)
+  {
+    scale(factThis);
+    for(int j= 0;j<C;j++)
+      {
+        const double vj= factOther*v(j);
+        for(int i= 0;i<N;i++)
+          theData[i]+= m(i,j)*vj;
+      }
+  }
+
+//! @brief this= factThis*this+factOther*m^T*v.
+template <int N> template <int R>
+void FixedVector<N>::addMatrixTransposeVector(const double &factThis, const FixedMatrix<R,N> &m, const FixedVector<R> &v, const double &factOther)
+  {
+    scale(factThis);
+    for(int i= 0;i<N;i++)
+      {
+        double sum= 0.0;
+        for(int k= 0;k<R;k++)
+          sum+= m(k,i)*v(k);
+        theData[i]+= factOther*sum;
+      }
+  }
+
+template <int R, int C>
+inline FixedMatrix<R,C> operator+(const FixedMatrix<R,C> &a, const FixedMatrix<R,C> &b)
+  {
+    FixedMatrix<R,C> retval(a);
+    retval+= b;
+    return retval;
+  }
+
+template <int R, int C>
+inline FixedMatrix<R,C> operator-(const FixedMatrix<R,C> &a, const FixedMatrix<R,C> &b)
+  {
+    FixedMatrix<R,C> retval(a);
+    retval-= b;
+    return retval;
+  }
+
+template <int R, int C>
+inline FixedMatrix<R,C> operator*(const double &f, const FixedMatrix<R,C> &a)
+  {
+    FixedMatrix<R,C> retval(a);
+    retval*= f;
+    return retval;
+  }
+
+template <int R, int K, int C>
+inline FixedMatrix<R,C> operator*(const FixedMatrix<R,K> &a, const FixedMatrix<K,C> &b)
+  {
+    FixedMatrix<R,C> retval;
+    retval.addMatrixProduct(0.0, a, b, 1.0);
+    return retval;
+  }
+
+template <int R, int C>
+inline FixedVector<R> operator*(const FixedMatrix<R,C> &m, const FixedVector<C> &v)
+  {
+    FixedVector<R> retval;
+    retval.addMatrixVector(0.0, m, v, 1.0);
+    return retval;
+  }
+
+//! @brief Return the skew symmetric matrix corresponding to the
+//! argument (S(v)*w= v x w).
+inline FixedMatrix<3,3> getSkewSymMatrix(const FixedVector<3> &v)
+  {
+    FixedMatrix<3,3> retval;
+    retval(0,1)= -v(2);
+    retval(0,2)=  v(1);
+    retval(1,0)=  v(2);
+    retval(1,2)= -v(0);
+    retval(2,0)= -v(1);
+    retval(2,1)=  v(0);
+    return retval;
+  }
+
+template <int R, int C>
+std::ostream &operator<<(std::ostream &os, const FixedMatrix<R,C> &m)
+  {
+    os << '[';
+    for(int i= 0;i<R;i++)
+      {
+        if(i>0) os << ',';
+        os << '[';
+        for(int j= 0;j<C;j++)
+          {
+            if(j>0) os << ',';
+            os << m(i,j);
+          }
+        os << ']';
+      }
+    os << ']';
+    return os;
+  }
+
+} // end of XC namespace
+
+#endif
@@ -0,0 +1,239 @@
+// -*-c++-*-
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis C. Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//FixedVector.h
+
+#ifndef FixedVector_h
+#define FixedVector_h
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include "Vector.h"
+
+namespace XC {
+template <int R, int C>
+class FixedMatrix;
+
+//! @ingroup Matrix
+//
+//! @brief Vector of fixed size N stored by value.
+//!
+//! Lightweight alternative to Vector for the small temporaries of
+//! the element kernels: the components live in the object itself
+//! (no heap allocation) and the loops have compile-time bounds. The
+//! interface mimics the Vector one (addVector, Norm, Zero...) so the
+//! kernels can be ported with minimal changes.
+template <int N>
+class FixedVector
+  {
+  private:
+    double theData[N];
+    //! @brief this= f*this (avoids propagating NaN values when f is zero).
+    inline void scale(const double &f)
+      {
+        if(f==0.0)
+          Zero();
+        else if(f!=1.0)
+          (*this)*= f;
+      }
+  public:
+    //! @brief Constructor (all components set to the argument).
+    explicit FixedVector(const double &value= 0.0)
+      { std::fill(theData, theData+N, value); }
+    explicit FixedVector(const Vector &, const int &offset= 0);
+
+    //! @brief Return the vector size.
+    static constexpr int Size(void)
+      { return N; }
+    //! @brief Return a pointer to the vector components.
+    inline const double *getDataPtr(void) const
+      { return theData; }
+    //! @brief Return a pointer to the vector components.
+    inline double *getDataPtr(void)
+      { return theData; }
+    //! @brief Return the i-th component.
+    inline const double &operator()(const int &i) const
+      { return theData[i]; }
+    //! @brief Return the i-th component.
+    inline double &operator()(const int &i)
+      { return theData[i]; }
+    //! @brief Return the i-th component.
+    inline const double &operator[](const int &i) const
+      { return theData[i]; }
+    //! @brief Return the i-th component.
+    inline double &operator[](const int &i)
+      { return theData[i]; }
+
+    //! @brief Set all the components to zero.
+    inline void Zero(void)
+      { std::fill(theData, theData+N, 0.0); }
+    //! @brief this= factThis*this+factOther*other.
+    inline void addVector(const double &factThis, const FixedVector &other, const double &factOther)
+      {
+        scale(factThis);
+        for(int i= 0;i<N;i++)
+          theData[i]+= factOther*other.theData[i];
+      }
+    template <int C>
+    void addMatrixVector(const double &, const FixedMatrix<N,C> &, const FixedVector<C> &, const double &);
+    template <int R>
+    void addMatrixTransposeVector(const double &, const FixedMatrix<R,N> &, const FixedVector<R> &, const double &);
+    //! @brief Return the dot product with the argument.
+    inline double dot(const FixedVector &other) const
+      {
+        double retval= 0.0;
+        for(int i= 0;i<N;i++)
+          retval+= theData[i]*other.theData[i];
+        return retval;
+      }
+    //! @brief Return the squared euclidean norm.
+    inline double Norm2(void) const
+      { return dot(*this); }
+    //! @brief Return the euclidean norm.
+    inline double Norm(void) const
+      { return std::sqrt(Norm2()); }
+
+    inline FixedVector &operator+=(const FixedVector &other)
+      {
+        for(int i= 0;i<N;i++)
+          theData[i]+= other.theData[i];
+        return *this;
+      }
+    inline FixedVector &operator-=(const FixedVector &other)
+      {
+        for(int i= 0;i<N;i++)
+          theData[i]-= other.theData[i];
+        return *this;
+      }
+    inline FixedVector &operator*=(const double &f)
+      {
+        for(int i= 0;i<N;i++)
+          theData[i]*= f;
+        return *this;
+      }
+    inline FixedVector &operator/=(const double &f)
+      { return (*this)*= (1.0/f); }
+
+    //! @brief Return a Vector that wraps the components of this
+    //! object (no copy). The returned object must not outlive this one.
+    inline Vector getView(void)
+      { return Vector(theData, N); }
+    //! @brief Return a copy of the components in a Vector.
+    inline Vector getVector(void) const
+      {
+        Vector retval(N);
+        std::copy(theData, theData+N, retval.getDataPtr());
+        return retval;
+      }
+    void copyTo(Vector &, const int &offset= 0) const;
+  };
+
+//! @brief Constructor: copy the N components of the argument starting
+//! at offset.
+template <int N>
+FixedVector<N>::FixedVector(const Vector &v, const int &offset)
+  {
+    if(v.Size()<offset+N)
+      {
+        std::cerr << "FixedVector<" << N << ">::" << __FUNCTION__
+                  << "; vector of size: " << v.Size()
+                  << " too small (offset: " << offset << ")."
+                  << std::endl;
+        Zero();
+      }
+    else
+      std::copy(v.getDataPtr()+offset, v.getDataPtr()+offset+N, theData);
+  }
+
+//! @brief Copy the components into the argument starting at offset.
+template <int N>
+void FixedVector<N>::copyTo(Vector &v, const int &offset) const
+  {
+    if(v.Size()<offset+N)
+      std::cerr << "FixedVector<" << N << ">::" << __FUNCTION__
+                << "; vector of size: " << v.Size()
+                << " too small (offset: " << offset << ")."
+                << std::endl;
+    else
+      std::copy(theData, theData+N, v.getDataPtr()+offset);
+  }
+
+template <int N>
+inline FixedVector<N> operator+(const FixedVector<N> &a, const FixedVector<N> &b)
+  {
+    FixedVector<N> retval(a);
+    retval+= b;
+    return retval;
+  }
+
+template <int N>
+inline FixedVector<N> operator-(const FixedVector<N> &a, const FixedVector<N> &b)
+  {
+    FixedVector<N> retval(a);
+    retval-= b;
+    return retval;
+  }
+
+template <int N>
+inline FixedVector<N> operator*(const double &f, const FixedVector<N> &a)
+  {
+    FixedVector<N> retval(a);
+    retval*= f;
+    return retval;
+  }
+
+template <int N>
+inline FixedVector<N> operator*(const FixedVector<N> &a, const double &f)
+  { return f*a; }
+
+//! @brief Cross product of two 3D vectors.
+inline FixedVector<3> cross(const FixedVector<3> &a, const FixedVector<3> &b)
+  {
+    FixedVector<3> retval;
+    retval(0)= a(1)*b(2)-a(2)*b(1);
+    retval(1)= a(2)*b(0)-a(0)*b(2);
+    retval(2)= a(0)*b(1)-a(1)*b(0);
+    return retval;
+  }
+
+template <int N>
+std::ostream &operator<<(std::ostream &os, const FixedVector<N> &v)
+  {
+    os << '[';
+    for(int i= 0;i<N;i++)
+      {
+        if(i>0) os << ',';
+        os << v(i);
+      }
+    os << ']';
+    return os;
+  }
+
+} // end of XC namespace
+
+#endif
@@ -0,0 +1,383 @@
+// -*-c++-*-
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis C. Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//FixedTensor.h
+
+#ifndef FIXEDTENSOR_H
+#define FIXEDTENSOR_H
+
+#include <array>
+#include <algorithm>
+#include <cstddef>
+#include <iostream>
+#include "utility/matrix/nDarray/nDarray.h"
+#include "utility/matrix/nDarray/BJtensor.h"
+
+namespace XC {
+
+//! @brief List of tensor dimensions known at compile time.
+template <int... Dims>
+struct fixed_tensor_dims {};
+
+namespace fixed_tensor_detail
+  {
+    //! @brief Return the product of the dimensions.
+    constexpr size_t product(void)
+      { return 1; }
+    template <class... T>
+    constexpr size_t product(int first, T... rest)
+      { return static_cast<size_t>(first)*product(rest...); }
+
+    //! @brief Concatenation of two dimension lists.
+    template <class A, class B>
+    struct concat;
+    template <int... A, int... B>
+    struct concat<fixed_tensor_dims<A...>, fixed_tensor_dims<B...> >
+      { typedef fixed_tensor_dims<A..., B...> type; };
+
+    //! @brief Dimension list without the I-th dimension.
+    template <size_t I, class D>
+    struct remove;
+    template <int H, int... T>
+    struct remove<0, fixed_tensor_dims<H, T...> >
+      { typedef fixed_tensor_dims<T...> type; };
+    template <size_t I, int H, int... T>
+    struct remove<I, fixed_tensor_dims<H, T...> >
+      { typedef typename concat<fixed_tensor_dims<H>, typename remove<I-1, fixed_tensor_dims<T...> >::type>::type type; };
+
+    //! @brief Product of the first n dimensions.
+    template <int... D>
+    constexpr size_t head_product(size_t n)
+      {
+        const int dims[]= {D..., 0};
+        size_t retval= 1;
+        for(size_t i= 0;i<n;i++)
+          retval*= static_cast<size_t>(dims[i]);
+        return retval;
+      }
+    //! @brief I-th dimension.
+    template <int... D>
+    constexpr int get_dim(size_t i)
+      {
+        const int dims[]= {D..., 0};
+        return dims[i];
+      }
+  } // end of fixed_tensor_detail namespace
+
+//! @ingroup Matrix
+//
+//! @brief Tensor whose rank and dimensions are known at compile time.
+//!
+//! The components are stored in place (no heap allocation) in the
+//! same order used by nDarray (the last index varies fastest) and
+//! are accessed with the same one-based indexes, so the code written
+//! with BJtensor can be ported index by index. Intended for the
+//! computations made at each integration point, where the temporaries
+//! created by the BJtensor operators dominate the computational cost.
+template <int... Dims>
+class FixedTensor
+  {
+  public:
+    typedef fixed_tensor_dims<Dims...> dims_type;
+    static constexpr size_t tensor_rank= sizeof...(Dims); //!< tensor rank.
+    static constexpr size_t tensor_size= fixed_tensor_detail::product(Dims...); //!< number of components.
+  private:
+    std::array<double, tensor_size> components;
+
+    template <size_t N>
+    inline static size_t get_offset(const int (&idx)[N])
+      {
+        static const int dims[]= {Dims..., 0};
+        size_t retval= 0;
+        for(size_t i= 0;i<N;i++)
+          retval= retval*dims[i]+(idx[i]-1);
+        return retval;
+      }
+  public:
+    //! @brief Constructor (all components set to the argument).
+    explicit FixedTensor(const double &value= 0.0)
+      { components.fill(value); }
+    explicit FixedTensor(const nDarray &);
+
+    //! @brief Return the dimension of the i-th index (zero-based).
+    static constexpr int dim(size_t i)
+      { return fixed_tensor_detail::get_dim<Dims...>(i); }
+    //! @brief Return the tensor rank.
+    static constexpr size_t rank(void)
+      { return tensor_rank; }
+    //! @brief Return the number of components.
+    static constexpr size_t size(void)
+      { return tensor_size; }
+
+    //! @brief Return a pointer to the components.
+    inline double *data(void)
+      { return components.data(); }
+    //! @brief Return a pointer to the components.
+    inline const double *data(void) const
+      { return components.data(); }
+    //! @brief Return the component at the given position of the storage.
+    inline double &operator[](size_t i)
+      { return components[i]; }
+    //! @brief Return the component at the given position of the storage.
+    inline const double &operator[](size_t i) const
+      { return components[i]; }
+    //! @brief Return the component with the given (one-based) indexes.
+    template <class... T>
+    inline double &operator()(T... idx)
+      {
+        static_assert(sizeof...(T)==tensor_rank, "wrong number of indexes.");
+        const int tmp[]= {static_cast<int>(idx)...};
+        return components[get_offset(tmp)];
+      }
+    //! @brief Return the component with the given (one-based) indexes.
+    template <class... T>
+    inline const double &operator()(T... idx) const
+      {
+        static_assert(sizeof...(T)==tensor_rank, "wrong number of indexes.");
+        const int tmp[]= {static_cast<int>(idx)...};
+        return components[get_offset(tmp)];
+      }
+
+    //! @brief Set all the components to zero.
+    inline void Zero(void)
+      { components.fill(0.0); }
+    FixedTensor &operator+=(const FixedTensor &);
+    FixedTensor &operator-=(const FixedTensor &);
+    FixedTensor &operator*=(const double &);
+    //! @brief Add the other tensor multiplied by the factor.
+    inline void addTensor(const FixedTensor &other, const double &factor)
+      {
+        for(size_t i= 0;i<tensor_size;i++)
+          components[i]+= factor*other.components[i];
+      }
+
+    BJtensor getBJtensor(void) const;
+    void Print(std::ostream &) const;
+  };
+
+//! @brief Constructor from an nDarray with the same dimensions.
+template <int... Dims>
+FixedTensor<Dims...>::FixedTensor(const nDarray &other)
+  {
+    static const int dims[]= {Dims..., 0};
+    bool ok= (static_cast<size_t>(other.rank())==tensor_rank);
+    for(size_t i= 0;ok && (i<tensor_rank);i++)
+      ok= (other.dim(i+1)==dims[i]);
+    if(ok)
+      {
+        const double *values= other.data();
+        std::copy(values, values+tensor_size, components.begin());
+      }
+    else
+      {
+        components.fill(0.0);
+        std::cerr << "FixedTensor::" << __FUNCTION__
+                  << "; dimensions of the nDarray don't match."
+                  << std::endl;
+      }
+  }
+
+//! @brief Sum operator.
+template <int... Dims>
+FixedTensor<Dims...> &FixedTensor<Dims...>::operator+=(const FixedTensor &other)
+  {
+    for(size_t i= 0;i<tensor_size;i++)
+      components[i]+= other.components[i];
+    return *this;
+  }
+
+//! @brief Subtraction operator.
+template <int... Dims>
+FixedTensor<Dims...> &FixedTensor<Dims...>::operator-=(const FixedTensor &other)
+  {
+    for(size_t i= 0;i<tensor_size;i++)
+      components[i]-= other.components[i];
+    return *this;
+  }
+
+//! @brief Product by a scalar.
+template <int... Dims>
+FixedTensor<Dims...> &FixedTensor<Dims...>::operator*=(const double &d)
+  {
+    for(size_t i= 0;i<tensor_size;i++)
+      components[i]*= d;
+    return *this;
+  }
+
+//! @brief Return the equivalent BJtensor.
+template <int... Dims>
+BJtensor FixedTensor<Dims...>::getBJtensor(void) const
+  {
+    const std::vector<int> dims({Dims...});
+    return BJtensor(dims, components.data());
+  }
+
+//! @brief Print stuff.
+template <int... Dims>
+void FixedTensor<Dims...>::Print(std::ostream &os) const
+  {
+    os << '[';
+    for(size_t i= 0;i<tensor_size;i++)
+      {
+        if(i>0) os << ", ";
+        os << components[i];
+      }
+    os << ']';
+  }
+
+template <int... Dims>
+std::ostream &operator<<(std::ostream &os, const FixedTensor<Dims...> &t)
+  {
+    t.Print(os);
+    return os;
+  }
+
+template <int... Dims>
+FixedTensor<Dims...> operator+(const FixedTensor<Dims...> &a, const FixedTensor<Dims...> &b)
+  {
+    FixedTensor<Dims...> retval(a);
+    retval+= b;
+    return retval;
+  }
+
+template <int... Dims>
+FixedTensor<Dims...> operator-(const FixedTensor<Dims...> &a, const FixedTensor<Dims...> &b)
+  {
+    FixedTensor<Dims...> retval(a);
+    retval-= b;
+    return retval;
+  }
+
+template <int... Dims>
+FixedTensor<Dims...> operator*(const double &d, const FixedTensor<Dims...> &a)
+  {
+    FixedTensor<Dims...> retval(a);
+    retval*= d;
+    return retval;
+  }
+
+template <int... Dims>
+FixedTensor<Dims...> operator*(const FixedTensor<Dims...> &a, const double &d)
+  { return d*a; }
+
+namespace fixed_tensor_detail
+  {
+    template <class D>
+    struct tensor_type;
+    template <int... D>
+    struct tensor_type<fixed_tensor_dims<D...> >
+      { typedef FixedTensor<D...> type; };
+
+    //! @brief Type of the result of contracting the index IA of the
+    //! first tensor with the index IB of the second one.
+    template <size_t IA, size_t IB, class A, class B>
+    struct contraction_type
+      {
+        typedef typename concat<typename remove<IA, typename A::dims_type>::type, typename remove<IB, typename B::dims_type>::type>::type dims;
+        typedef typename tensor_type<dims>::type type;
+      };
+  } // end of fixed_tensor_detail namespace
+
+//! @brief Contract the index IA of a with the index IB of b (both
+//! zero-based). The indexes of the result are the free indexes of a
+//! followed by the free indexes of b, in the same order as in the
+//! BJtensor product: a("ij")*b("kj") is written contract<1,1>(a,b).
+//!
+//! The loop bounds are compile-time constants, so the compiler can
+//! unroll and vectorize them.
+template <size_t IA, size_t IB, int... DA, int... DB>
+typename fixed_tensor_detail::contraction_type<IA, IB, FixedTensor<DA...>, FixedTensor<DB...> >::type
+contract(const FixedTensor<DA...> &a, const FixedTensor<DB...> &b)
+  {
+    typedef typename fixed_tensor_detail::contraction_type<IA, IB, FixedTensor<DA...>, FixedTensor<DB...> >::type result_type;
+    static_assert(IA<sizeof...(DA), "index out of range.");
+    static_assert(IB<sizeof...(DB), "index out of range.");
+    constexpr int K= fixed_tensor_detail::get_dim<DA...>(IA);
+    static_assert(K==fixed_tensor_detail::get_dim<DB...>(IB), "contracted dimensions don't match.");
+    // a as (LA, K, RA), b as (LB, K, RB).
+    constexpr size_t LA= fixed_tensor_detail::head_product<DA...>(IA);
+    constexpr size_t RA= FixedTensor<DA...>::tensor_size/(LA*K);
+    constexpr size_t LB= fixed_tensor_detail::head_product<DB...>(IB);
+    constexpr size_t RB= FixedTensor<DB...>::tensor_size/(LB*K);
+    result_type retval;
+    double *r= retval.data();
+    const double *pa= a.data();
+    const double *pb= b.data();
+    for(size_t la= 0;la<LA;la++)
+      for(size_t ra= 0;ra<RA;ra++)
+        for(size_t k= 0;k<static_cast<size_t>(K);k++)
+          {
+            const double va= pa[(la*K+k)*RA+ra];
+            if(va!=0.0)
+              {
+                double *rr= r+(la*RA+ra)*LB*RB;
+                for(size_t lb= 0;lb<LB;lb++)
+                  {
+                    const double *bb= pb+(lb*K+k)*RB;
+                    for(size_t rb= 0;rb<RB;rb++)
+                      rr[lb*RB+rb]+= va*bb[rb];
+                  }
+              }
+          }
+    return retval;
+  }
+
+//! @brief Return the determinant of a 3x3 tensor.
+inline double determinant(const FixedTensor<3,3> &m)
+  {
+    return m(1,1)*(m(2,2)*m(3,3)-m(2,3)*m(3,2))
+          -m(1,2)*(m(2,1)*m(3,3)-m(2,3)*m(3,1))
+          +m(1,3)*(m(2,1)*m(3,2)-m(2,2)*m(3,1));
+  }
+
+//! @brief Return the inverse of a 3x3 tensor.
+inline FixedTensor<3,3> inverse(const FixedTensor<3,3> &m)
+  {
+    FixedTensor<3,3> retval;
+    const double det= determinant(m);
+    if(det==0.0)
+      {
+        std::cerr << "FixedTensor::" << __FUNCTION__
+                  << "; singular tensor." << std::endl;
+        return retval;
+      }
+    const double c= 1.0/det;
+    retval(1,1)= c*(m(2,2)*m(3,3)-m(2,3)*m(3,2));
+    retval(1,2)= c*(m(1,3)*m(3,2)-m(1,2)*m(3,3));
+    retval(1,3)= c*(m(1,2)*m(2,3)-m(1,3)*m(2,2));
+    retval(2,1)= c*(m(2,3)*m(3,1)-m(2,1)*m(3,3));
+    retval(2,2)= c*(m(1,1)*m(3,3)-m(1,3)*m(3,1));
+    retval(2,3)= c*(m(1,3)*m(2,1)-m(1,1)*m(2,3));
+    retval(3,1)= c*(m(2,1)*m(3,2)-m(2,2)*m(3,1));
+    retval(3,2)= c*(m(1,2)*m(3,1)-m(1,1)*m(3,2));
+    retval(3,3)= c*(m(1,1)*m(2,2)-m(1,2)*m(2,1));
+    return retval;
+  }
+
+} // end of XC namespace
+
+#endif
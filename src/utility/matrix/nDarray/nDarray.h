@@ -241,6 +241,8 @@ class nDarray_rep
 //! @ingroup Matrix
 class nDarray
   {
+    template <int... Dims>
+    friend class FixedTensor;
   private:
 //  int rank(void) const;
     size_t total_number(void) const;
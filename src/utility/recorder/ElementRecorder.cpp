@@ -100,43 +100,26 @@ int XC::ElementRecorder::record(int commitTag, double timeStamp)
           }
       }
 
-    assert(theHandler);
     int result = 0;
     if(deltaT == 0.0 || timeStamp >= nextTimeStampToRecord)
       {
         if(deltaT != 0.0) 
           nextTimeStampToRecord = timeStamp + deltaT;
-        int loc = 0;
         if(echoTimeFlag == true) 
-          data(loc++) = timeStamp;
+          data(0) = timeStamp;
     
         //
         // for each element if responses exist, put them in response vector
+        // (at the positions computed in initialize).
         //
-        const size_t numEle= eleID.Size();
-        assert(theResponses.size()>=numEle);
-        for(size_t i=0; i< numEle; i++)
-          { 
-            if(theResponses[i])
-              {
-	        // ask the element for the response
-	        int res;
-	        if(( res = theResponses[i]->getResponse()) < 0)
-	          result += res;
-	        else
-                  {
-	            Information &eleInfo = theResponses[i]->getInformation();
-	            const Vector &eleData = eleInfo.getData();
-	            for(int j=0; j<eleData.Size(); j++)
-	              data(loc++) = eleData(j);
-	          }
-              } 
-          }
+        result= collect_responses(data.getDataPtr());
         //
         // send the response vector to the output handler for o/p
+        // (if any, otherwise the values remain available
+        // through getData).
         //
-
-        theHandler->write(data);
+        if(theHandler)
+          theHandler->write(data);
       }
     // successful completion - return 0
     return result;
@@ -262,10 +245,14 @@ int XC::ElementRecorder::initialize(void)
     // call open in the handler with the data description
     //
 
-    theHandler->open(dbColumns);
+    if(theHandler)
+      theHandler->open(dbColumns);
 
-    // create the vector to hold the data
+    // create the vector to hold the data and make the
+    // responses write their values directly on it.
     data= Vector(numDbColumns);
+    setup_offsets(echoTimeFlag ? 1 : 0);
+    bind_responses(data.getDataPtr());
 
     initializationDone = true;
     return 0;
@@ -85,6 +85,9 @@ class ElementRecorder: public ElementRecorderBase
 
     ~ElementRecorder(void);
 
+    //! @brief Return the values stored in the last record.
+    inline const Vector &getData(void) const
+      { return data; }
     int record(int commitTag, double timeStamp);
     int restart(void);
 
@@ -28,6 +28,7 @@
                                                                         
 #include <utility/recorder/ElementRecorderBase.h>
 #include <utility/recorder/response/Response.h>
+#include "utility/matrix/Vector.h"
 #include "utility/utils/text/text_string.h"
 #include <utility/actor/channel/Channel.h>
 #include <utility/actor/objectBroker/FEM_ObjectBroker.h>
@@ -35,7 +36,8 @@
 #include <utility/actor/message/Message.h>
 
 XC::ElementRecorderBase::ElementRecorderBase(int classTag)
-  : MeshCompRecorder(classTag), eleID(0), theResponses(), responseArgs()
+  : MeshCompRecorder(classTag), eleID(0), theResponses(), responseArgs(),
+    offsets(), parallelCollection(false)
   {}
 
 XC::ElementRecorderBase::ElementRecorderBase(int classTag,const XC::ID &ele, const std::vector<std::string> &argv, 
@@ -43,7 +45,8 @@ XC::ElementRecorderBase::ElementRecorderBase(int classTag,const XC::ID &ele, con
                                  Domain &theDom, DataOutputHandler &theOutputHandler,
                                  double dT)
   :MeshCompRecorder(classTag,theDom,theOutputHandler,dT,echoTime),
-   eleID(ele), theResponses(), responseArgs(argv) {}
+   eleID(ele), theResponses(), responseArgs(argv), offsets(),
+   parallelCollection(false) {}
 
 //! @brief set the responses to get in a record
 void XC::ElementRecorderBase::setup_responses(const std::string &dataToStore)
@@ -55,26 +58,103 @@ void XC::ElementRecorderBase::setup_responses(const std::string &dataToStore)
       responseArgs[i]= campos[i];
   }
 
-//@brief Destructor.
-XC::ElementRecorderBase::~ElementRecorderBase(void)
+//! @brief Delete the response objects.
+void XC::ElementRecorderBase::free_responses(void)
   {
-    const int numEle= eleID.Size();
-    for(int i= 0;i<numEle;i++)
+    for(std::vector<Response *>::iterator i= theResponses.begin(); i!= theResponses.end(); i++)
+      if(*i)
+        {
+          delete *i;
+          *i= nullptr;
+        }
+    theResponses.clear();
+    offsets.clear();
+  }
+
+//! @brief Set the identifiers of the elements whose responses
+//! will be recorded.
+void XC::ElementRecorderBase::setElements(const ID &ids)
+  {
+    free_responses();
+    eleID= ids;
+    initializationDone= false;
+  }
+
+//! @brief Set the responses to record (i.e. "force", "material 1 stress",...).
+void XC::ElementRecorderBase::setResponseArgs(const std::string &dataToStore)
+  {
+    free_responses();
+    setup_responses(dataToStore);
+    initializationDone= false;
+  }
+
+//! @brief Compute the position of the values of each response
+//! in the data buffer, starting at the position argument.
+//!
+//! Must be called once the responses have been created. Return
+//! the position that follows the values of the last response.
+size_t XC::ElementRecorderBase::setup_offsets(const size_t &first)
+  {
+    const size_t numEle= theResponses.size();
+    offsets.resize(numEle+1);
+    size_t loc= first;
+    for(size_t i= 0;i<numEle;i++)
       {
+        offsets[i]= loc;
         if(theResponses[i])
+          loc+= theResponses[i]->getInformation().getData().Size();
+      }
+    offsets[numEle]= loc;
+    return loc;
+  }
+
+//! @brief Make the responses write their values directly
+//! at their slice of the data buffer when possible (see
+//! Response::bindData).
+void XC::ElementRecorderBase::bind_responses(double *buffer)
+  {
+    const size_t numEle= theResponses.size();
+    for(size_t i= 0;i<numEle;i++)
+      if(theResponses[i])
+        theResponses[i]->bindData(buffer+offsets[i], offsets[i+1]-offsets[i]);
+  }
+
+//! @brief Compute the element responses and store their values
+//! at their slices of the data buffer.
+//!
+//! If parallelCollection is true the responses are computed in
+//! parallel. This requires the getResponse methods of the elements
+//! not to use shared (static) work storage, so it's disabled by
+//! default. Return the sum of the negative return values.
+int XC::ElementRecorderBase::collect_responses(double *buffer)
+  {
+    const int numEle= theResponses.size();
+    int result= 0;
+#pragma omp parallel for schedule(dynamic,64) reduction(+:result) if(parallelCollection)
+    for(int i= 0;i<numEle;i++)
+      {
+        Response *r= theResponses[i];
+        if(r)
           {
-            delete theResponses[i];
-            theResponses[i]= nullptr;
+            const int res= r->getResponse(buffer+offsets[i], offsets[i+1]-offsets[i]);
+            if(res<0)
+              result+= res;
           }
       }
+    return result;
   }
 
+//@brief Destructor.
+XC::ElementRecorderBase::~ElementRecorderBase(void)
+  { free_responses(); }
+
 //! @brief Send the object to another process.
 int XC::ElementRecorderBase::sendData(Communicator &comm)
   {
     int res= MeshCompRecorder::sendData(comm);
     res+= comm.sendID(eleID,getDbTagData(),CommMetaData(6));
     res+= comm.sendStrings(responseArgs,getDbTagData(),CommMetaData(7));
+    res+= comm.sendBool(parallelCollection,getDbTagData(),CommMetaData(8));
     return res;
   }
 
@@ -84,6 +164,7 @@ int XC::ElementRecorderBase::receiveData(const Communicator &comm)
     int res= MeshCompRecorder::receiveData(comm);
     res+= comm.receiveID(eleID,getDbTagData(),CommMetaData(6));
     res+= comm.receiveStrings(responseArgs,getDbTagData(),CommMetaData(7));
+    res+= comm.receiveBool(parallelCollection,getDbTagData(),CommMetaData(8));
     return res;
   }
 
@@ -98,7 +179,7 @@ int XC::ElementRecorderBase::sendSelf(Communicator &comm)
       {
         setDbTag(comm);
         const int dataTag= getDbTag();
-        inicComm(8);
+        inicComm(9);
         res= sendData(comm);
         if(comm.sendIdData(getDbTagData(),dataTag)< 0)
           {
@@ -119,7 +200,7 @@ int XC::ElementRecorderBase::recvSelf(const Communicator &comm)
 		<< "; does not recv data to a datastore\n";
     else
       {
-        inicComm(8);
+        inicComm(9);
         const int dataTag= getDbTag();
         res= comm.receiveIdData(getDbTagData(),dataTag);
         if(res < 0)
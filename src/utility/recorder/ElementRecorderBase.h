@@ -51,10 +51,16 @@ class ElementRecorderBase: public MeshCompRecorder
 
     std::vector<Response *> theResponses;
     std::vector<std::string> responseArgs;
+    std::vector<size_t> offsets; //!< position of the values of each response in the data buffer.
+    bool parallelCollection; //!< if true, collect the element responses in parallel.
 
     int sendData(Communicator &);  
     int receiveData(const Communicator &);
     void setup_responses(const std::string &);
+    void free_responses(void);
+    size_t setup_offsets(const size_t &);
+    void bind_responses(double *);
+    int collect_responses(double *);
 
   public:
     ElementRecorderBase(int classTag);
@@ -67,6 +73,15 @@ class ElementRecorderBase: public MeshCompRecorder
     ~ElementRecorderBase(void);
     inline size_t getNumArgs(void) const
       { return responseArgs.size(); }
+    void setElements(const ID &);
+    void setResponseArgs(const std::string &);
+    //! @brief Return true if the element responses are collected in parallel.
+    inline bool getParallelCollection(void) const
+      { return parallelCollection; }
+    //! @brief Set the parallel collection of the element responses
+    //! (see collect_responses).
+    inline void setParallelCollection(const bool &b)
+      { parallelCollection= b; }
     int sendSelf(Communicator &);  
     int recvSelf(const Communicator &);
   };
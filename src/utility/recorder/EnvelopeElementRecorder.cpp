@@ -133,27 +133,9 @@ int XC::EnvelopeElementRecorder::record(int commitTag, double timeStamp)
         if(deltaT != 0.0) 
           nextTimeStampToRecord = timeStamp + deltaT;
       
-        int loc = 0;
         // for each element do a getResponse() & put the result in current data
-        const int numEle= eleID.Size();
-        for(int i=0; i< numEle; i++)
-          {
-            if(theResponses[i] != 0)
-              {
-                // ask the element for the response
-                int res;
-                if(( res = theResponses[i]->getResponse()) < 0)
-                  result += res;
-                else
-                  {
-                    // from the response determine no of cols for each
-                    Information &eleInfo= theResponses[i]->getInformation();
-                    const Vector &eleData= eleInfo.getData();
-                    for(int j=0; j<eleData.Size(); j++) 
-                      (*currentData)(loc++) = eleData(j);
-                  }
-              }
-          }
+        // (at the positions computed in initialize).
+        result= collect_responses(currentData->getDataPtr());
         if(echoTimeFlag == false) {
         // check if max or min
         // check if currentData modifies the saved data
@@ -242,6 +224,9 @@ int XC::EnvelopeElementRecorder::receiveData(const Communicator &comm)
   {
     int res= ElementRecorderBase::receiveData(comm);
     res+= comm.receiveMovable(envelope,getDbTagData(),CommMetaData(14));
+    Vector *currentData= envelope.getCurrentData();
+    if(currentData && (offsets.size()==theResponses.size()+1))
+      bind_responses(currentData->getDataPtr()); // buffer has changed.
     return res;
   }
 
@@ -332,6 +317,8 @@ int XC::EnvelopeElementRecorder::initialize(void)
       numDbColumns *= 2;
 
     envelope.alloc(numDbColumns);
+    setup_offsets(0);
+    bind_responses(envelope.getCurrentData()->getDataPtr());
 
     //
     // now create the columns strings for the database
@@ -94,13 +94,13 @@ XC::Recorder *XC::RecorderContainer::newRecorder(const std::string &cod, DataOut
     else if((cod == "element_recorder") or (cod== "XC::ElementRecorder"))
       {
         ElementRecorder *tmp= new ElementRecorder();
+        // without output handler the values of the last
+        // record are available through getData.
         if(output_handler)
           tmp->SetOutputHandler(output_handler);
-        else
-          std::cerr << Color::red << "RecorderContainer::" << __FUNCTION__
-		    << "; new recorder: " << cod 
-                    << " no output handler."
-		    << Color::def << std::endl;
+        Domain *dom= get_domain_ptr();
+        if(dom)
+          tmp->setDomain(*dom);
         retval= tmp;
       }
     else if((cod == "envelope_element_recorder") or (cod== "XC::EnvelopeElementRecorder"))
@@ -70,7 +70,11 @@ class_<XC::ElementPropRecorder, bases<XC::PropRecorder>, boost::noncopyable >("E
 
 class_<XC::MeshCompRecorder, bases<XC::HandlerRecorder>, boost::noncopyable >("MeshCompRecorder", no_init);
 
-class_<XC::ElementRecorderBase, bases<XC::MeshCompRecorder>, boost::noncopyable >("ElementRecorderBase", no_init);
+class_<XC::ElementRecorderBase, bases<XC::MeshCompRecorder>, boost::noncopyable >("ElementRecorderBase", no_init)
+  .add_property("parallelCollection", &XC::ElementRecorderBase::getParallelCollection, &XC::ElementRecorderBase::setParallelCollection, "If true, collect the element responses in parallel (the element response computation must not use shared work storage).")
+  .def("setElements",&XC::ElementRecorderBase::setElements,"Assigns elements to the recorder.")
+  .def("setResponseArgs",&XC::ElementRecorderBase::setResponseArgs,"Set the responses to record (i.e. 'force', 'material 1 stress',...).")
+  ;
 
 class_<XC::NodeRecorderBase, bases<XC::MeshCompRecorder>, boost::noncopyable >("NodeRecorderBase", no_init);
 
@@ -78,7 +82,9 @@ class_<XC::NodeRecorder, bases<XC::NodeRecorderBase>, boost::noncopyable >("Node
 
 class_<XC::EnvelopeNodeRecorder, bases<XC::NodeRecorderBase>, boost::noncopyable >("EnvelopeNodeRecorder", no_init);
 
-class_<XC::ElementRecorder, bases<XC::ElementRecorderBase>, boost::noncopyable >("ElementRecorder", no_init);
+class_<XC::ElementRecorder, bases<XC::ElementRecorderBase>, boost::noncopyable >("ElementRecorder", no_init)
+  .add_property("data", make_function(&XC::ElementRecorder::getData, return_internal_reference<>()), "Values stored in the last record.")
+  ;
 
 class_<XC::EnvelopeElementRecorder, bases<XC::ElementRecorderBase>, boost::noncopyable >("EnvelopeElementRecorder", no_init);
 
@@ -55,6 +55,7 @@
 
 #include "Response.h"
 #include <iostream>
+#include "utility/matrix/Vector.h"
 
 XC::Response::Response(void)
   :myInfo()
@@ -83,3 +84,35 @@ void XC::Response::Print(std::ofstream &s, int flag) const
 
 XC::Information &XC::Response::getInformation(void)
   { return myInfo; }
+
+//! @brief Make the response values be written directly at the
+//! memory pointed by the argument (that must be able to hold
+//! n values) when possible.
+//!
+//! Return 0 if the values will be written there, -1 if they will
+//! be copied from the information object (see getResponse(double *, n)).
+int XC::Response::bindData(double *dest, const size_t &n)
+  { return getInformation().bindVector(dest, n); }
+
+//! @brief Compute the response and store its values (at most n) at
+//! the memory pointed by the argument.
+//!
+//! If the storage was previously bound to the memory
+//! argument (see bindData) the values are already there
+//! after computing the response, otherwise they are copied
+//! from the information object. If the size of the response
+//! has changed, the values that don't fit are discarded and
+//! the positions not used are set to zero.
+int XC::Response::getResponse(double *dest, const size_t &n)
+  {
+    const int retval= getResponse();
+    Information &info= getInformation();
+    if((retval>=0) && !info.isBoundTo(dest))
+      {
+        const Vector &values= info.getData();
+        const size_t sz= std::min(size_t(values.Size()), n);
+        std::copy(values.getDataPtr(), values.getDataPtr()+sz, dest);
+        std::fill(dest+sz, dest+n, 0.0); // the response got smaller.
+      }
+    return retval;
+  }
@@ -94,6 +94,8 @@ class Response
   
     virtual int getResponse(void) = 0;
     virtual Information &getInformation(void);
+    virtual int bindData(double *, const size_t &);
+    virtual int getResponse(double *, const size_t &);
 
     virtual void Print(std::ofstream &s, int flag = 0) const;
   };
@@ -410,6 +410,7 @@ python tests/elements/trusses/truss_test_00.py
 python tests/elements/trusses/truss_test_01.py
 python tests/elements/trusses/truss_test_02.py
 python tests/elements/trusses/truss_test_03.py
+python tests/elements/trusses/truss_batch_update_test.py
 echo "$BLEU" "  Coordinate transformations tests." "$NORMAL"
 python tests/elements/crd_transf/test_linear_crd_transf_2d_01.py
 python tests/elements/crd_transf/test_pdelta_crd_transf_2d_01.py
@@ -507,6 +508,7 @@ python tests/elements/beam_column/force_beam_column_3d/test_force_beam_column_3d
 python tests/elements/beam_column/force_beam_column_3d/test_force_beam_column_3d_08.py
 python tests/elements/beam_column/force_beam_column_3d/test_force_beam_column_3d_09.py
 python tests/elements/beam_column/force_beam_column_3d/test_integration_options_01.py
+python tests/elements/beam_column/force_beam_column_3d/test_elastic_range_bypass_01.py
 python tests/elements/beam_column/force_beam_column_3d/test_strains_sign_01.py
 echo "$BLEU" "  Zero length elements tests." "$NORMAL"
 python tests/elements/zero_length/zero_length_element_test_01.py
@@ -523,6 +525,8 @@ python tests/elements/zero_length/test_strains_sign03.py
 python tests/elements/zero_length/test_strains_sign04.py
 python tests/elements/zero_length/test_winkler.py
 python tests/elements/zero_length/test_quasi_winkler.py
+python tests/elements/zero_length/test_contact_manager.py
+python tests/elements/zero_length/test_contact_manager_analysis.py
 echo "$BLEU" "  Plane elasticity elements tests." "$NORMAL"
 python tests/elements/plane/test_tri31.py
 python tests/elements/plane/test_four_node_quad_01.py
@@ -584,6 +588,8 @@ python tests/elements/volume/test_brick_05.py
 python tests/elements/volume/test_extrapolation_matrix.py
 python tests/elements/volume/test_brick_shape_functions.py
 python tests/elements/volume/test_extrapolate_values_brick.py
+python tests/elements/volume/test_high_order_bricks.py
+python tests/elements/volume/test_gauss_point_cache_policy.py
 
 echo "$BLEU" "  Bridge bearing modelization tests." "$NORMAL"
 python tests/elements/bridge_bearings/test_elastomeric_bearing_01.py
@@ -632,6 +638,7 @@ python tests/solution/superlu_solver_test_01.py
 python tests/solution/superlu_solver_test_02.py
 python tests/solution/umf_solver_test_01.py
 python tests/solution/mumps_solver_test_01.py
+python tests/solution/test_element_recorder_data.py
 echo "$BLEU" "  Ill conditioning tests." "$NORMAL"
 python tests/solution/ill_conditioning/ill_conditioning_01.py
 python tests/solution/ill_conditioning/get_floating_nodes_01.py
@@ -689,6 +696,7 @@ python tests/solution/eigenvalues/linear_buckling_analysis/linear_buckling_colum
 python tests/solution/eigenvalues/linear_buckling_analysis/linear_buckling_column05.py
 python tests/solution/eigenvalues/linear_buckling_analysis/linear_buckling_column06.py # Depends on spectra library.
 python tests/solution/eigenvalues/linear_buckling_analysis/linear_buckling_column07.py # Depends on spectra library.
+python tests/solution/eigenvalues/linear_buckling_analysis/linear_buckling_column08.py
 python tests/solution/eigenvalues/linear_buckling_analysis/micropile_buckling_reduction_factor.py
 python tests/solution/eigenvalues/linear_buckling_analysis/square_plate_buckling_01.py
 python tests/solution/eigenvalues/linear_buckling_analysis/square_plate_buckling_02.py # Depends on spectra library.
@@ -717,6 +725,11 @@ echo "$BLEU" "  Time history solution tests." "$NORMAL"
 python tests/solution/time_history/test_time_history_00.py
 python tests/solution/time_history/test_time_history_01.py
 python tests/solution/time_history/test_pseudo_time_history.py
+python tests/solution/time_history/test_modal_damping_01.py
+
+## Harmonic (frequency-domain) analysis.
+echo "$BLEU" "  Steady-state harmonic analysis tests." "$NORMAL"
+python tests/solution/harmonic_analysis/test_harmonic_analysis_01.py
 
 ## Convergence tests.
 echo "$BLEU" "  Convergence tests." "$NORMAL"
@@ -994,10 +1007,13 @@ python tests/loads/time_series/test_ground_motion_15.py
 python tests/loads/time_series/test_ground_motion_16.py
 python tests/loads/time_series/test_ground_motion_17.py
 python tests/loads/time_series/test_ground_motion_18.py
+python tests/loads/time_series/test_ground_motion_19.py
+python tests/loads/time_series/test_uniform_excitation_distributed_mass.py
 echo "$BLEU" "    Path time series tests." "$NORMAL"
 python tests/loads/time_series/test_path_01.py
 python tests/loads/time_series/test_path_time_01.py
 python tests/loads/time_series/test_path_time_02.py
+python tests/loads/time_series/test_path_time_03.py
 python tests/loads/time_series/constant_and_path_load_test.py
 echo "$BLEU" "  Loads tests." "$NORMAL"
 python tests/loads/beam2dNodalLoad.py
@@ -1188,6 +1204,7 @@ python tests/materials/xc_materials/uniaxial/concrete/test_concrete02_01.py
 python tests/materials/xc_materials/uniaxial/concrete/test_concrete02_02.py
 python tests/materials/xc_materials/uniaxial/concrete/test_tdconcrete_material_01.py
 python tests/materials/xc_materials/uniaxial/concrete/test_tdconcrete_material_02.py
+python tests/materials/xc_materials/uniaxial/concrete/test_tdconcrete_material_03.py
 python tests/materials/xc_materials/uniaxial/concrete/test_tdconcrete_mc10_material_01.py
 python tests/materials/xc_materials/uniaxial/concrete/test_tdconcrete_mc10_material_02.py
 python tests/materials/xc_materials/uniaxial/concrete/test_tdconcrete_mc10nl_material_01.py
@@ -1247,6 +1264,9 @@ python tests/materials/xc_materials/nD/test_elastic_isotropic_3d_strain_load.py
 echo "$BLEU" "      J2 (Von Mises) materials tests." "$NORMAL"
 python tests/materials/xc_materials/nD/test_j2_plate_fibre.py
 python tests/materials/xc_materials/nD/test_j2_plate_fibre_strain_load.py
+python tests/materials/xc_materials/nD/test_j2_radial_return.py
+python tests/materials/xc_materials/nD/test_j2_radial_return_plane.py
+python tests/materials/xc_materials/nD/test_j2_plasticity_response.py
 echo "$BLEU" "      Soil materials tests." "$NORMAL"
 python tests/materials/xc_materials/nD/soil/test_pressure_independent_multiyield_material_01.py
 python tests/materials/xc_materials/nD/soil/test_pressure_independent_multiyield_material_02.py
@@ -1266,6 +1286,7 @@ python tests/materials/xc_materials/sections/plate_section/test_material_elastic
 python tests/materials/xc_materials/sections/plate_section/test_material_elastic_plate_section_01.py
 python tests/materials/xc_materials/sections/plate_section/test_membrane_plate_fiber_section_01.py
 python tests/materials/xc_materials/sections/plate_section/test_layered_shell_fiber_section_material_01.py
+python tests/materials/xc_materials/sections/plate_section/test_layered_shell_fiber_section_material_02.py
 
 #Cross sections.
 echo "$BLEU" "    Sections." "$NORMAL"
@@ -1341,6 +1362,7 @@ python tests/materials/xc_materials/sections/fiber_section/test_fiber3d_06.py
 python tests/materials/xc_materials/sections/fiber_section/test_fiber3d_07.py
 python tests/materials/xc_materials/sections/fiber_section/test_fiber3d_08.py
 python tests/materials/xc_materials/sections/fiber_section/test_fiber3d_09.py
+python tests/materials/xc_materials/sections/fiber_section/test_fiber_material_replacement.py
 echo "$BLEU" "        Beam fiber section tests." "$NORMAL"
 python tests/materials/xc_materials/sections/fiber_section/beam_fiber_sections/test_section_aggregator_01.py
 python tests/materials/xc_materials/sections/fiber_section/beam_fiber_sections/test_fiber_section_sign_convention01.py
@@ -1372,6 +1394,9 @@ python tests/materials/xc_materials/sections/fiber_section/interaction_diagram/t
 python tests/materials/xc_materials/sections/fiber_section/interaction_diagram/test_interaction_diagram02.py
 python tests/materials/xc_materials/sections/fiber_section/interaction_diagram/test_interaction_diagram03.py
 python tests/materials/xc_materials/sections/fiber_section/interaction_diagram/test_interaction_diagram04.py
+python tests/materials/xc_materials/sections/fiber_section/interaction_diagram/test_interaction_diagram07.py
+python tests/materials/xc_materials/sections/fiber_section/interaction_diagram/test_interaction_diagram08.py
+python tests/materials/xc_materials/sections/fiber_section/interaction_diagram/test_polygonal_section_integrator_01.py
 python tests/materials/xc_materials/sections/fiber_section/interaction_diagram/test_interaction_diagram05.py
 python tests/materials/xc_materials/sections/fiber_section/interaction_diagram/test_interaction_diagram06.py
 python tests/materials/xc_materials/sections/fiber_section/plastic_hinge_on_IPE200.py
@@ -0,0 +1,122 @@
+# -*- coding: utf-8 -*-
+''' Horizontal cantilever under horizontal load at his front end. Check
+    that the results obtained skipping the fiber updates while the
+    sections remain elastic (elasticRangeBypass) are the same that those
+    obtained with the full fiber integration.'''
+
+from __future__ import print_function
+
+__author__= "Luis C. Pérez Tato (LCPT) and Ana Ortega (AOO)"
+__copyright__= "Copyright 2025, LCPT and AOO"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+import math
+import sys
+import os
+import xc
+from solution import predefined_solutions
+from model import predefined_spaces
+from materials import typical_materials
+
+# Geometry
+width= .05
+depth= .1
+nDivIJ= 5
+nDivJK= 10
+y0= 0
+z0= 0
+L= 1.5 # Bar length (m)
+
+# Load
+F= 1.5e3 # Load magnitude en N
+
+pth= os.path.dirname(__file__)
+if(not pth):
+    pth= "."
+auxModulePath= pth+"/../../../aux"
+sys.path.append(auxModulePath)
+import test_quad_region as tqr
+
+def solve(elasticRangeBypass):
+    ''' Solve the problem and return the tip displacement, the bending
+        moment at the first section and the maximum stress in its fibers.
+
+    :param elasticRangeBypass: if true skip the fiber updates while
+                               the sections remain elastic.
+    '''
+    feProblem= xc.FEProblem()
+    preprocessor=  feProblem.getPreprocessor   
+    nodes= preprocessor.getNodeHandler
+    # Problem type
+    modelSpace= predefined_spaces.StructuralMechanics3D(nodes)
+    n1= nodes.newNodeXYZ(0,0.0,0.0)
+    n2= nodes.newNodeXYZ(L,0.0,0.0)
+    lin= modelSpace.newLinearCrdTransf("lin",xc.Vector([0,1,0]))
+
+    # Materials definition
+    fy= 275e6 # Yield stress of the steel.
+    E= 210e9 # Young modulus of the steel.
+    steel= typical_materials.defSteel01(preprocessor, "steel",E,fy,0.001)
+    respT= typical_materials.defElasticMaterial(preprocessor, "respT",1e10) # Torsion response.
+    respVy= typical_materials.defElasticMaterial(preprocessor, "respVy",1e9) # Shear response in y direction.
+    respVz= typical_materials.defElasticMaterial(preprocessor, "respVz",1e9) # Shear response in z direction.
+    # Sections
+    materialHandler= preprocessor.getMaterialHandler
+    quadFibers= materialHandler.newMaterial("fiber_section_3d","quadFibers")
+    fiberSectionRepr= quadFibers.getFiberSectionRepr()
+    testQuadRegion= tqr.get_test_quad_region(preprocessor, y0, z0, width, depth, nDivIJ, nDivJK)
+    fiberSectionRepr.setGeomNamed(testQuadRegion.name)
+    quadFibers.setupFibers()
+    quadFibers.elasticRangeBypass= elasticRangeBypass
+
+    agg= materialHandler.newMaterial("section_aggregator","agg")
+    agg.setSection("quadFibers")
+    agg.setAdditions(["T","Vy","Vz"],["respT","respVy","respVz"])
+
+    # Elements definition
+    elements= preprocessor.getElementHandler
+    elements.defaultTransformation= lin.name
+    elements.defaultMaterial= agg.name
+    elements.numSections= 3 # Number of sections along the element.
+    el= elements.newElement("ForceBeamColumn3d",xc.ID([n1.tag, n2.tag]))
+
+    # Constraints
+    modelSpace.fixNode000_000(n1.tag)
+
+    # Load definition.
+    lp0= modelSpace.newLoadPattern(name= '0')
+    lp0.newNodalLoad(n2.tag,xc.Vector([0,-F,0,0,0,0]))
+    modelSpace.addLoadCaseToDomain(lp0.name)
+
+    # Solution procedure
+    analysis= predefined_solutions.plain_static_modified_newton(feProblem)
+    result= analysis.analyze(10)
+
+    delta= n2.getDisp[1]
+    el.getResistingForce()
+    scc= el.getSections()[0]
+    M= scc.getStressResultantComponent("My")
+    sgMax= max(abs(scc.getFibers().getStressMax()), abs(scc.getFibers().getStressMin()))
+    return result, delta, M, sgMax
+
+result0, delta0, M0, sgMax0= solve(elasticRangeBypass= False)
+result1, delta1, M1, sgMax1= solve(elasticRangeBypass= True)
+
+ratio1= abs(delta1-delta0)/abs(delta0)
+ratio2= abs(M1-M0)/abs(M0)
+ratio3= abs(sgMax1-sgMax0)/sgMax0
+
+''' 
+print("delta0= ", delta0, " delta1= ", delta1, " ratio1= ", ratio1)
+print("M0= ", M0, " M1= ", M1, " ratio2= ", ratio2)
+print("sgMax0= ", sgMax0/1e6, " sgMax1= ", sgMax1/1e6, " ratio3= ", ratio3)
+   '''
+
+from misc_utils import log_messages as lmsg
+fname= os.path.basename(__file__)
+if (result0==0) and (result1==0) and (ratio1<1e-8) and (ratio2<1e-8) and (ratio3<1e-8):
+    print('test '+fname+': ok.')
+else:
+    lmsg.error(fname+' ERROR.')
@@ -0,0 +1,122 @@
+# -*- coding: utf-8 -*-
+''' Check that the batch update of the trusses (materials of the same
+    class updated together, see Truss::updateBatch) gives the same
+    response as updating the materials of the elements one by one.
+    The model has bars with different materials (elastic, Steel01 and
+    Steel02) that are loaded beyond the yield point in a static
+    analysis (zero strain rates, batch path) and then vibrate in a
+    dynamic analysis (non-zero strain rates). Each step the material
+    of each bar is compared with a material of the same type updated
+    with the bar strain. Home made test.'''
+
+from __future__ import print_function
+from __future__ import division
+
+__author__= "Luis C. Pérez Tato (LCPT) and Ana Ortega (AOO)"
+__copyright__= "Copyright 2026, LCPT and AOO"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+import xc
+from model import predefined_spaces
+from materials import typical_materials
+from solution import predefined_solutions
+
+E= 200e9 # Young modulus.
+fy= 250e6 # Yield stress.
+b= 0.02 # Strain hardening ratio.
+A= 1e-4 # Bar area.
+L= 2.0 # Bar length.
+m= 1000.0 # Mass at the free end of the bars.
+
+feProblem= xc.FEProblem()
+preprocessor=  feProblem.getPreprocessor
+nodes= preprocessor.getNodeHandler
+modelSpace= predefined_spaces.SolidMechanics2D(nodes)
+
+# Materials of the bars and reference materials.
+def defMaterial(materialType, name):
+    ''' Define a material of the given type.'''
+    if(materialType=='elastic'):
+        retval= typical_materials.defElasticMaterial(preprocessor, name, E)
+    elif(materialType=='steel01'):
+        retval= typical_materials.defSteel01(preprocessor, name, E, fy, b)
+    else:
+        retval= typical_materials.defSteel02(preprocessor, name, E, fy, b)
+    return retval
+
+# (material type, load factor) for each bar (two bars of each class
+# so the groups have more than one material).
+barData= [('elastic', 0.5), ('steel01', 1.2), ('steel02', 1.4), ('steel01', 0.8), ('elastic', 1.1), ('steel02', 0.6)]
+
+elements= preprocessor.getElementHandler
+elements.dimElem= 2
+lp0= modelSpace.newLoadPattern(name= '0')
+bars= list()
+for i, (materialType, factor) in enumerate(barData):
+    material= defMaterial(materialType, 'mat'+str(i))
+    reference= defMaterial(materialType, 'ref'+str(i))
+    nA= nodes.newNodeXY(0.0, i)
+    nB= nodes.newNodeXY(L, i)
+    nB.mass= xc.Matrix([[m, 0.0], [0.0, m]])
+    modelSpace.fixNode00(nA.tag)
+    modelSpace.fixNodeF0(nB.tag)
+    elements.defaultMaterial= material.name
+    truss= elements.newElement("Truss", xc.ID([nA.tag, nB.tag]))
+    truss.sectionArea= A
+    lp0.newNodalLoad(nB.tag, xc.Vector([factor*fy*A, 0.0]))
+    bars.append((truss, nB, reference))
+modelSpace.addLoadCaseToDomain(lp0.name)
+
+def compareBars():
+    ''' Update the reference materials with the strains of the bars
+        and return the maximum relative differences between their
+        stresses and tangents and those of the bar materials.'''
+    errStress= 0.0
+    errTangent= 0.0
+    for (truss, nB, reference) in bars:
+        strain= nB.getDisp[0]/L
+        reference.setTrialStrain(strain, 0.0)
+        reference.commitState()
+        material= truss.getMaterial()
+        errStress= max(errStress, abs(material.getStress()-reference.getStress())/fy)
+        errTangent= max(errTangent, abs(material.getTangent()-reference.getTangent())/E)
+    return errStress, errTangent
+
+# Static analysis (zero strain rates).
+numSteps= 10
+solProc= predefined_solutions.PlainNewtonRaphson(feProblem, convergenceTestTol= 1e-6)
+solProc.setup()
+solProc.integrator.dLambda1= 1.0/numSteps
+errors= list()
+ok= True
+for i in range(0, numSteps):
+    ok= ok and (solProc.analysis.analyze(1)==0)
+    errors.append(compareBars())
+
+# Dynamic analysis (non-zero strain rates): remove the loads and
+# let the bars vibrate.
+modelSpace.removeLoadCaseFromDomain(lp0.name)
+dynSolProc= predefined_solutions.PenaltyNewmarkNewtonRaphson(feProblem, timeStep= 0.002, convergenceTestTol= 1e-6)
+dynSolProc.setup()
+for i in range(0, 20):
+    ok= ok and (dynSolProc.analysis.analyze(1, 0.002)==0)
+    errors.append(compareBars())
+
+errStress= max([e[0] for e in errors])
+errTangent= max([e[1] for e in errors])
+
+'''
+print('ok= ', ok)
+print('stress error: ', errStress)
+print('tangent error: ', errTangent)
+'''
+
+import os
+from misc_utils import log_messages as lmsg
+fname= os.path.basename(__file__)
+if ok and (errStress<1e-10) and (errTangent<1e-10):
+    print('test '+fname+': ok.')
+else:
+    lmsg.error(fname+' ERROR.')
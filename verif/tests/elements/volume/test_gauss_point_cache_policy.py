@@ -0,0 +1,104 @@
+# -*- coding: utf-8 -*-
+''' Check that the EightNodeBrick, TwentyNodeBrick and TwentySevenNodeBrick
+    elements give the same response whether they store the shape
+    function derivatives at their Gauss points or not (see
+    GaussPointCachePolicy). A column made of two elements is fixed at
+    its base and loaded laterally at its top. The analysis is run
+    twice, so the second time the elements use the data stored in
+    the first one (if any).
+    Home made test.
+'''
+
+from __future__ import print_function
+
+__author__= "Luis C. Pérez Tato (LCPT) and Ana Ortega (AOO)"
+__copyright__= "Copyright 2026, LCPT and AOO"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+import xc
+from solution import predefined_solutions
+from model import predefined_spaces
+from materials import typical_materials
+
+E= 30e9 # Young modulus.
+nu= 0.25 # Poisson's ratio.
+L= 1.0 # Element side.
+F= 1e5 # Lateral load.
+
+# Natural coordinates of the element nodes (see the interpolation
+# functions of each element).
+corners= [(1,1,1),(-1,1,1),(-1,-1,1),(1,-1,1),(1,1,-1),(-1,1,-1),(-1,-1,-1),(1,-1,-1)]
+naturalCoordinates= dict()
+naturalCoordinates['EightNodeBrick']= corners
+naturalCoordinates['TwentyNodeBrick']= corners+[(0,1,1),(-1,0,1),(0,-1,1),(1,0,1),(0,1,-1),(-1,0,-1),(0,-1,-1),(1,0,-1),(1,1,0),(-1,1,0),(-1,-1,0),(1,-1,0)]
+naturalCoordinates['TwentySevenNodeBrick']= corners+[(1,1,0),(-1,1,0),(-1,-1,0),(1,-1,0),(0,1,1),(-1,0,1),(0,-1,1),(1,0,1),(0,1,-1),(-1,0,-1),(0,-1,-1),(1,0,-1),(0,1,0),(-1,0,0),(0,-1,0),(1,0,0),(0,0,1),(0,0,-1),(0,0,0)]
+
+def columnDisplacements(elementType):
+    ''' Return the displacements of the column nodes obtained in
+        two consecutive analysis.'''
+    feProblem= xc.FEProblem()
+    preprocessor=  feProblem.getPreprocessor
+    nodes= preprocessor.getNodeHandler
+    modelSpace= predefined_spaces.SolidMechanics3D(nodes)
+    elast3d= typical_materials.defElasticIsotropic3d(preprocessor, "elast3d", E, nu, 0.0)
+    elements= preprocessor.getElementHandler
+    elements.defaultMaterial= elast3d.name
+    nodeDict= dict()
+    for k in range(0,2): # two elements, one on top of the other.
+        nodeList= list()
+        for (r,s,t) in naturalCoordinates[elementType]:
+            key= (r, s, 2*k+t)
+            if(not key in nodeDict):
+                nodeDict[key]= nodes.newNodeXYZ(0.5*L*(1+r), 0.5*L*(1+s), 0.5*L*(1+2*k+t))
+            nodeList.append(nodeDict[key])
+        elements.newElement(elementType, xc.ID([n.tag for n in nodeList]))
+    # Fixed base and lateral load on the top face.
+    lp0= modelSpace.newLoadPattern(name= '0')
+    topNodes= list()
+    for key in nodeDict:
+        n= nodeDict[key]
+        if(key[2]==-1):
+            modelSpace.fixNode000(n.tag)
+        elif(key[2]==3):
+            topNodes.append(n)
+    for n in topNodes:
+        lp0.newNodalLoad(n.tag, xc.Vector([F/len(topNodes), 0.3*F/len(topNodes), 0.0]))
+    modelSpace.addLoadCaseToDomain(lp0.name)
+    retval= list()
+    analysis= predefined_solutions.simple_static_linear(feProblem)
+    for step in range(0,2):
+        analysis.analyze(1)
+        for key in sorted(nodeDict):
+            retval.extend(nodeDict[key].getDisp)
+    return retval
+
+defaultPolicy= xc.GaussPointCachePolicy.getStoreElementGeometry()
+err= 0.0
+policyOk= True
+for elementType in naturalCoordinates:
+    xc.GaussPointCachePolicy.setStoreElementGeometry(True)
+    policyOk= policyOk and xc.GaussPointCachePolicy.getStoreElementGeometry()
+    stored= columnDisplacements(elementType)
+    xc.GaussPointCachePolicy.setStoreElementGeometry(False)
+    policyOk= policyOk and (not xc.GaussPointCachePolicy.getStoreElementGeometry())
+    recomputed= columnDisplacements(elementType)
+    norm= max([abs(u) for u in stored])
+    policyOk= policyOk and (len(stored)==len(recomputed)) and (norm>0.0)
+    for (a, b) in zip(stored, recomputed):
+        err= max(err, abs(a-b)/norm)
+xc.GaussPointCachePolicy.setStoreElementGeometry(defaultPolicy)
+
+'''
+print('default policy: ', defaultPolicy)
+print('err= ', err)
+'''
+
+import os
+from misc_utils import log_messages as lmsg
+fname= os.path.basename(__file__)
+if policyOk and defaultPolicy and (err<1e-12):
+    print('test '+fname+': ok.')
+else:
+    lmsg.error(fname+' ERROR.')
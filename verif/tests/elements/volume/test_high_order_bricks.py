@@ -0,0 +1,119 @@
+# -*- coding: utf-8 -*-
+''' Patch test for the EightNodeBrick, TwentyNodeBrick and
+    TwentySevenNodeBrick elements (stiffness computed with fixed size
+    tensors). A cube under uniform vertical pressure on its top face and
+    supported on rollers must reproduce the exact uniform stress state,
+    so the displacements must be linear, the reactions must equilibrate
+    the load and the consistent mass matrix must add up to the cube mass.
+'''
+
+from __future__ import print_function
+
+__author__= "Luis C. Pérez Tato (LCPT) and Ana Ortega (AOO)"
+__copyright__= "Copyright 2026, LCPT and AOO"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+import xc
+from solution import predefined_solutions
+from model import predefined_spaces
+from materials import typical_materials
+
+E= 30e9 # Young modulus.
+nu= 0.25 # Poisson's ratio.
+rho= 2500.0 # Density.
+L= 2.0 # Cube side.
+p= 1e6 # Pressure on the top face.
+
+# Natural coordinates of the element nodes (see the interpolation
+# functions of each element).
+corners= [(1,1,1),(-1,1,1),(-1,-1,1),(1,-1,1),(1,1,-1),(-1,1,-1),(-1,-1,-1),(1,-1,-1)]
+naturalCoordinates= dict()
+naturalCoordinates['EightNodeBrick']= corners
+naturalCoordinates['TwentyNodeBrick']= corners+[(0,1,1),(-1,0,1),(0,-1,1),(1,0,1),(0,1,-1),(-1,0,-1),(0,-1,-1),(1,0,-1),(1,1,0),(-1,1,0),(-1,-1,0),(1,-1,0)]
+naturalCoordinates['TwentySevenNodeBrick']= corners+[(1,1,0),(-1,1,0),(-1,-1,0),(1,-1,0),(0,1,1),(-1,0,1),(0,-1,1),(1,0,1),(0,1,-1),(-1,0,-1),(0,-1,-1),(1,0,-1),(0,1,0),(-1,0,0),(0,-1,0),(1,0,0),(0,0,1),(0,0,-1),(0,0,0)]
+
+# Consistent nodal loads for a uniform pressure on the top face
+# (indexed by the number of zero natural coordinates of the node
+# in the face plane: 0-> corner, 1-> mid-side, 2-> center).
+faceLoadFactors= dict()
+faceLoadFactors['EightNodeBrick']= [1/4.0]
+faceLoadFactors['TwentyNodeBrick']= [-1/12.0, 1/3.0]
+faceLoadFactors['TwentySevenNodeBrick']= [1/36.0, 1/9.0, 4/9.0]
+
+def patchTest(elementType):
+    ''' Return the errors in the displacements, reactions and mass of
+        the patch test for the element type argument.'''
+    feProblem= xc.FEProblem()
+    preprocessor=  feProblem.getPreprocessor
+    nodes= preprocessor.getNodeHandler
+    modelSpace= predefined_spaces.SolidMechanics3D(nodes)
+    elast3d= typical_materials.defElasticIsotropic3d(preprocessor, "elast3d", E, nu, rho)
+    nodeList= list()
+    for (r,s,t) in naturalCoordinates[elementType]:
+        nodeList.append(nodes.newNodeXYZ(0.5*L*(1+r), 0.5*L*(1+s), 0.5*L*(1+t)))
+    elements= preprocessor.getElementHandler
+    elements.defaultMaterial= elast3d.name
+    brick= elements.newElement(elementType, xc.ID([n.tag for n in nodeList]))
+    # Rollers on the x=0, y=0 and z=0 faces.
+    for n in nodeList:
+        pos= n.getInitialPos3d
+        if(abs(pos.x)<1e-9):
+            modelSpace.newSPConstraint(n.tag,0,0.0)
+        if(abs(pos.y)<1e-9):
+            modelSpace.newSPConstraint(n.tag,1,0.0)
+        if(abs(pos.z)<1e-9):
+            modelSpace.newSPConstraint(n.tag,2,0.0)
+    # Consistent loads on the top face.
+    lp0= modelSpace.newLoadPattern(name= '0')
+    F= -p*L*L
+    for n, (r,s,t) in zip(nodeList, naturalCoordinates[elementType]):
+        if(t==1):
+            numZeros= [r,s].count(0)
+            lp0.newNodalLoad(n.tag,xc.Vector([0,0,faceLoadFactors[elementType][numZeros]*F]))
+    modelSpace.addLoadCaseToDomain(lp0.name)
+    # Solution
+    analysis= predefined_solutions.simple_static_linear(feProblem)
+    result= analysis.analyze(1)
+    modelSpace.calculateNodalReactions()
+    # Exact solution: uniform stress state.
+    epsZ= -p/E
+    epsXY= nu*p/E
+    dispError= 0.0
+    Rz= 0.0
+    for n in nodeList:
+        pos= n.getInitialPos3d
+        u= n.getDisp
+        dispError+= (u-xc.Vector([epsXY*pos.x, epsXY*pos.y, epsZ*pos.z])).Norm()
+        Rz+= n.getReaction[2]
+    dispError/= abs(epsZ*L)
+    reactionError= abs(Rz+F)/abs(F)
+    # Consistent mass matrix: the sum of all its terms must be
+    # three times the cube mass (one for each direction).
+    M= brick.mass
+    massSum= 0.0
+    for i in range(0,M.noRows):
+        for j in range(0,M.noCols):
+            massSum+= M(i,j)
+    massError= abs(massSum-3*rho*L**3)/(3*rho*L**3)
+    return result, dispError, reactionError, massError
+
+ok= True
+for elementType in naturalCoordinates:
+    result, dispError, reactionError, massError= patchTest(elementType)
+    ok= ok and (result==0) and (dispError<1e-8) and (reactionError<1e-8) and (massError<1e-8)
+    '''
+    print(elementType)
+    print('  displacement error: ', dispError)
+    print('  reaction error: ', reactionError)
+    print('  mass error: ', massError)
+    '''
+
+import os
+from misc_utils import log_messages as lmsg
+fname= os.path.basename(__file__)
+if ok:
+    print('test '+fname+': ok.')
+else:
+    lmsg.error(fname+' ERROR.')
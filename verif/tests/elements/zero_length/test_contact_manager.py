@@ -0,0 +1,87 @@
+# -*- coding: utf-8 -*-
+''' Check the automatic creation, activation and deactivation of the
+    contact pairs by the contact manager of the mesh.'''
+
+from __future__ import division
+from __future__ import print_function
+
+__author__= "Luis C. Pérez Tato (LCPT) and Ana Ortega (AOO)"
+__copyright__= "Copyright 2026, LCPT and AOO"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+import xc
+from model import predefined_spaces
+
+feProblem= xc.FEProblem()
+preprocessor=  feProblem.getPreprocessor
+nodes= preprocessor.getNodeHandler
+modelSpace= predefined_spaces.SolidMechanics2D(nodes)
+
+# Primary surface.
+primaryNodes= list()
+for i in range(0,5):
+    primaryNodes.append(nodes.newNodeXY(i,0.0))
+# Secondary surface.
+s0= nodes.newNodeXY(0,0.0) # In contact.
+s1= nodes.newNodeXY(1,0.005) # Near.
+s2= nodes.newNodeXY(2,0.5) # Far.
+secondaryNodes= [s0, s1, s2]
+
+# Prototype of the contact elements.
+elements= preprocessor.getElementHandler
+prototype= elements.seedElemHandler.newElement("ZeroLengthContact2D")
+
+# Contact manager.
+mesh= preprocessor.getDomain.getMesh
+contactManager= mesh.contactManager
+contactManager.setPrimaryNodeTags(xc.ID([n.tag for n in primaryNodes]))
+contactManager.setSecondaryNodeTags(xc.ID([n.tag for n in secondaryNodes]))
+contactManager.setPrototype(prototype)
+contactManager.activationGap= 0.01
+contactManager.releaseGap= 0.02
+
+# Initial search: pairs (s0, p0) and (s1, p1).
+contactManager.update()
+numCreated0= contactManager.numCreated
+pairTag= contactManager.getPairElementTag(s1.tag, primaryNodes[1].tag)
+pairElement= mesh.getElement(pairTag)
+pairNodes= pairElement.nodes.getExternalNodes
+
+# Move s1 away and s2 near the primary surface. The pairs are updated
+# when the domain is committed.
+s1.setTrialDisp(xc.Vector([0.0,0.1]))
+s2.setTrialDisp(xc.Vector([0.0,-0.495]))
+preprocessor.getDomain.commit()
+numCreated1= contactManager.numCreated
+numReleased1= contactManager.numReleased
+numActive1= contactManager.numActivePairs
+deadPair1= pairElement.isDead
+
+# Move s1 back: the existing pair is reactivated, not created again.
+s1.setTrialDisp(xc.Vector([0.0,0.0]))
+preprocessor.getDomain.commit()
+numCreated2= contactManager.numCreated
+numActivated2= contactManager.numActivated
+numActive2= contactManager.numActivePairs
+
+testOK= (numCreated0==2) and (pairNodes[0]==s1.tag) and (pairNodes[1]==primaryNodes[1].tag)
+testOK= testOK and (numCreated1==1) and (numReleased1==1) and (numActive1==2) and deadPair1
+testOK= testOK and (numCreated2==0) and (numActivated2==1) and (numActive2==3)
+testOK= testOK and (contactManager.numPairs==3) and (mesh.getNumElements()==3)
+
+'''
+print('created: ', numCreated0, numCreated1, numCreated2)
+print('released: ', numReleased1)
+print('activated: ', numActivated2)
+print('active: ', numActive1, numActive2)
+'''
+
+import os
+from misc_utils import log_messages as lmsg
+fname= os.path.basename(__file__)
+if(testOK):
+    print('test '+fname+': ok.')
+else:
+    lmsg.error(fname+' ERROR.')
@@ -0,0 +1,140 @@
+# -*- coding: utf-8 -*-
+''' Static analysis of a node (secondary surface) hanging from a truss
+    that is pushed onto a primary surface. The ZeroLengthContact2D
+    element that transmits the load to the primary surface is created
+    by the contact manager of the mesh when the domain is committed,
+    so it must be assembled in the next step. Then the node is pulled
+    away (the contact pair is released) and pushed again: the pair is
+    reactivated and carries the contact force again. Home made test.'''
+
+from __future__ import division
+from __future__ import print_function
+
+__author__= "Luis C. Pérez Tato (LCPT) and Ana Ortega (AOO)"
+__copyright__= "Copyright 2026, LCPT and AOO"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+import xc
+from model import predefined_spaces
+from materials import typical_materials
+from solution import predefined_solutions
+
+E= 1e6 # Young modulus of the truss.
+A= 1.0 # Area of the truss.
+L= 1.0 # Length of the truss.
+k= E*A/L # Stiffness of the truss.
+Kn= 1e9 # Normal penalty of the contact elements.
+h0= 0.05 # Initial distance from the secondary node to the primary surface.
+
+feProblem= xc.FEProblem()
+preprocessor=  feProblem.getPreprocessor
+nodes= preprocessor.getNodeHandler
+modelSpace= predefined_spaces.SolidMechanics2D(nodes)
+
+# Primary surface.
+primaryNodes= list()
+for i in range(0,5):
+    primaryNodes.append(nodes.newNodeXY(i,0.0))
+# Secondary node hanging from a truss.
+s= nodes.newNodeXY(2,h0)
+anchor= nodes.newNodeXY(2,h0+L)
+
+# Truss.
+elast= typical_materials.defElasticMaterial(preprocessor, "elast", E)
+elements= preprocessor.getElementHandler
+elements.defaultMaterial= elast.name
+elements.dimElem= 2 # Dimension of element space
+truss= elements.newElement("Truss",xc.ID([anchor.tag,s.tag]))
+truss.sectionArea= A
+
+# Constraints.
+for n in primaryNodes:
+    modelSpace.fixNode00(n.tag)
+modelSpace.fixNode00(anchor.tag)
+modelSpace.fixNode0F(s.tag) # Only vertical displacement.
+
+# Prototype of the contact elements.
+prototype= elements.seedElemHandler.newElement("ZeroLengthContact2D")
+prototype.Kn= Kn
+prototype.Kt= 0.0
+prototype.frictionRatio= 0.0
+prototype.contactNormal= xc.Vector([0.0,1.0]) # Outward normal of the primary surface.
+
+# Contact manager (updated each time the domain is committed).
+mesh= preprocessor.getDomain.getMesh
+contactManager= mesh.contactManager
+contactManager.setPrimaryNodeTags(xc.ID([n.tag for n in primaryNodes]))
+contactManager.setSecondaryNodeTags(xc.ID([s.tag]))
+contactManager.setPrototype(prototype)
+contactManager.activationGap= 0.01
+contactManager.releaseGap= 0.02
+
+# Load history: push (no contact element yet), push harder (contact),
+# release, push and push harder again.
+F= 0.9*k*h0 # Leaves the secondary node at 0.1*h0 from the primary surface.
+ts= modelSpace.newTimeSeries(name= 'ts', tsType= 'path_time_ts')
+ts.path= xc.Vector([0.0, 1.0, 2.0, 0.0, 1.0, 2.0])
+ts.time= xc.Vector([0.0, 1.0, 2.0, 3.0, 4.0, 5.0])
+lp0= modelSpace.newLoadPattern(name= '0')
+lp0.newNodalLoad(s.tag,xc.Vector([0.0,-F]))
+modelSpace.addLoadCaseToDomain(lp0.name)
+
+solProc= predefined_solutions.PlainNewtonRaphson(feProblem, maxNumIter= 20, printFlag= 0)
+solProc.setup()
+contactPrimary= primaryNodes[2] # Primary node under the secondary one.
+results= list()
+for step in range(0,5):
+    ok= solProc.analysis.analyze(1)
+    modelSpace.calculateNodalReactions()
+    R= contactPrimary.getReaction[1]
+    RTotal= sum([n.getReaction[1] for n in primaryNodes])
+    RAnchor= anchor.getReaction[1]
+    pairTag= contactManager.getPairElementTag(s.tag, contactPrimary.tag)
+    dead= mesh.getElement(pairTag).isDead if (pairTag>=0) else None
+    results.append((ok, s.getDisp[1], R, RTotal, RAnchor, contactManager.numCreated, contactManager.numActivated, contactManager.numReleased, dead))
+
+# Penetration and reactions when the node is pushed with 2F.
+delta= (2*F-k*h0)/(k+Kn)
+RRef= Kn*delta
+RAnchorRef= k*(h0+delta)
+
+def checkNoContact(r, uRef):
+    ''' Check a step in which the truss takes all the load.'''
+    ok, u, R, RTotal, RAnchor= r[:5]
+    return (ok==0) and (abs(u-uRef)<1e-12) and (abs(RTotal)<1e-6) and (abs(RAnchor+k*uRef)/F<1e-10)
+
+def checkContact(r):
+    ''' Check a step in which the contact element takes part of the load.'''
+    ok, u, R, RTotal, RAnchor= r[:5]
+    return (ok==0) and (abs(u+h0+delta)<1e-12) and (abs(R-RRef)/RRef<1e-8) and (abs(RTotal-R)<1e-6) and (abs(RAnchor-RAnchorRef)/RAnchorRef<1e-8)
+
+# Step 1: the pair is created at the end of the step.
+testOK= checkNoContact(results[0], -F/k)
+testOK= testOK and (results[0][5]==1) and (results[0][8]==False)
+# Step 2: the new contact element is assembled.
+testOK= testOK and checkContact(results[1]) and (results[1][5]==0)
+# Step 3: the node goes back to its initial position and the pair is released.
+testOK= testOK and checkNoContact(results[2], 0.0)
+testOK= testOK and (results[2][7]==1) and (results[2][8]==True)
+# Step 4: the pair is reactivated (not created again).
+testOK= testOK and checkNoContact(results[3], -F/k)
+testOK= testOK and (results[3][5]==0) and (results[3][6]==1) and (results[3][8]==False)
+# Step 5: the reactivated pair carries the contact force again.
+testOK= testOK and checkContact(results[4])
+testOK= testOK and (contactManager.numPairs==1) and (mesh.getNumElements()==2)
+
+'''
+for r in results:
+    print(r)
+print('delta= ', delta, ' RRef= ', RRef, ' RAnchorRef= ', RAnchorRef)
+'''
+
+import os
+from misc_utils import log_messages as lmsg
+fname= os.path.basename(__file__)
+if(testOK):
+    print('test '+fname+': ok.')
+else:
+    lmsg.error(fname+' ERROR.')
@@ -0,0 +1,105 @@
+# -*- coding: utf-8 -*-
+''' Check that two uniform excitations acting simultaneously along different
+    directions produce the expected response. Each excitation computes the
+    inertial loads from its own cached M*r products so they must not
+    interfere with each other.
+
+    Free mass subjected to ground accelerations along X and Y, the
+    displacements must be equal to the double integral of the accelerations.
+'''
+__author__= "Luis C. Pérez Tato (LCPT) and Ana Ortega (AOO)"
+__copyright__= "Copyright 2026, LCPT and AOO"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+import math
+import xc
+import numpy as np
+from scipy.integrate import cumulative_trapezoid
+from model import predefined_spaces
+from solution import predefined_solutions
+
+time_values= np.linspace(0.0, 2.0, 101)
+duration= time_values[-1] - time_values[0]
+dt= time_values[1] - time_values[0]
+accelX_values= np.sin(2.0 * np.pi * time_values)
+accelY_values= 2.0*np.sin(np.pi * time_values)
+dispX_values= cumulative_trapezoid(cumulative_trapezoid(accelX_values, time_values, initial=0), time_values, initial=0)
+dispY_values= cumulative_trapezoid(cumulative_trapezoid(accelY_values, time_values, initial=0), time_values, initial=0)
+
+feProblem= xc.FEProblem()
+preprocessor=  feProblem.getPreprocessor
+
+# Create time series for acceleration.
+loadHandler= preprocessor.getLoadHandler
+lPatterns= loadHandler.getLoadPatterns
+dummyTs= lPatterns.newTimeSeries("constant_ts","dummyTs") # Dummy time series.
+## Acceleration along X.
+accelXLP= lPatterns.newLoadPattern("uniform_excitation","accelX")
+accelXLP.factor= -1.0
+accelXLP.dof= 0 # excitation along the global X axis
+hist= accelXLP.motionRecord.history
+hist.accel= lPatterns.newTimeSeries("path_time_ts","accelX_ts")
+hist.accel.path= xc.Vector(accelX_values.tolist())
+hist.accel.time= xc.Vector(time_values.tolist())
+## Acceleration along Y.
+accelYLP= lPatterns.newLoadPattern("uniform_excitation","accelY")
+accelYLP.factor= -1.0
+accelYLP.dof= 1 # excitation along the global Y axis
+hist= accelYLP.motionRecord.history
+hist.accel= lPatterns.newTimeSeries("path_time_ts","accelY_ts")
+hist.accel.path= xc.Vector(accelY_values.tolist())
+hist.accel.time= xc.Vector(time_values.tolist())
+
+# Create FE model.
+nodes= preprocessor.getNodeHandler
+modelSpace= predefined_spaces.StructuralMechanics2D(nodes)
+node= modelSpace.newNode(0,0)
+node.mass= xc.Matrix([[1,0,0],[0,1,0],[0,0,1]])  # node mass matrix.
+# Constraints (rotation fixed).
+modelSpace.fixNode('FF0', node.tag)
+
+## Define RECORDERS
+dFree= list() # Create a list to store (time, displacement) tuples.
+recDFree= preprocessor.getDomain.newRecorder("node_prop_recorder",None)
+recDFree.setNodes(xc.ID([node.tag]))
+recDFree.callbackRecord= "dFree.append([self.getDomain.getTimeTracker.getCurrentTime,self.getDisp[0],self.getDisp[1]])"
+
+# Both excitations act simultaneously.
+modelSpace.addLoadCaseToDomain(accelXLP.name)
+modelSpace.addLoadCaseToDomain(accelYLP.name)
+
+# Run transient analysis
+Nsteps = int(duration/dt)
+solProc= predefined_solutions.PlainLinearNewmark(feProblem, numSteps= Nsteps, timeStep= dt)
+if(solProc.solve()!=0):
+    lmsg.error('Transient analysis failed.')
+    quit()
+
+# Check results.
+maxX= max(abs(dispX_values))
+maxY= max(abs(dispY_values))
+errX= 0.0
+errY= 0.0
+for (t, ux, uy) in dFree:
+    refX= np.interp(t, time_values, dispX_values)
+    refY= np.interp(t, time_values, dispY_values)
+    errX= max(errX, abs(ux-refX)/maxX)
+    errY= max(errY, abs(uy-refY)/maxY)
+
+testOK= (len(dFree)==Nsteps) and (errX<1e-6) and (errY<1e-6)
+
+'''
+print(len(dFree), Nsteps)
+print(errX)
+print(errY)
+'''
+
+import os
+from misc_utils import log_messages as lmsg
+fname= os.path.basename(__file__)
+if (testOK):
+    print('test '+fname+': ok.')
+else:
+    lmsg.error(fname+' ERROR.')
@@ -0,0 +1,109 @@
+# -*- coding: utf-8 -*-
+''' Test path time series queried at non-monotonic times and read from
+    binary files. Check also that the integrated ground motions are
+    reused.'''
+from __future__ import print_function
+
+__author__= "Luis C. Pérez Tato (LCPT)"
+__copyright__= "Copyright 2024, LCPT"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+import os
+import math
+import tempfile
+import xc
+
+feProblem= xc.FEProblem()
+preprocessor=  feProblem.getPreprocessor
+
+loadHandler= preprocessor.getLoadHandler
+lPatterns= loadHandler.getLoadPatterns
+
+def interpolate(t, timeValues, loadValues):
+    ''' Linear interpolation (zero outside the series).'''
+    if(t<timeValues[0]) or (t>timeValues[-1]):
+        return 0.0
+    for i in range(0,len(timeValues)-1):
+        t1= timeValues[i]; t2= timeValues[i+1]
+        if(t>=t1) and (t<=t2):
+            v1= loadValues[i]; v2= loadValues[i+1]
+            return v1+(v2-v1)*(t-t1)/(t2-t1)
+
+#### Non-uniform time series.
+timeValues= [0.0, 0.1, 0.25, 0.3, 0.7, 1.0, 1.6, 2.0]
+loadValues= [math.sin(3*t)+t for t in timeValues]
+ts1= lPatterns.newTimeSeries("path_time_ts","ts1")
+ts1.path= xc.Vector(loadValues)
+ts1.time= xc.Vector(timeValues)
+#### Uniform time series.
+dt= 0.05
+numPoints= 41
+timeValuesU= [i*dt for i in range(0,numPoints)]
+loadValuesU= [math.cos(2*t) for t in timeValuesU]
+ts2= lPatterns.newTimeSeries("path_time_ts","ts2")
+ts2.path= xc.Vector(loadValuesU)
+ts2.time= xc.Vector(timeValuesU)
+
+# Query at non-monotonic times (sub-stepping, revert to last commit...).
+queryTimes= [1.9, 0.05, 0.3, 0.29, 1.75, -0.1, 2.0, 0.0, 0.7, 0.71, 0.12, 2.5, 1.0]
+err= 0.0
+for t in queryTimes:
+    err+= (ts1.getFactor(t)-interpolate(t, timeValues, loadValues))**2
+    err+= (ts2.getFactor(t)-interpolate(t, timeValuesU, loadValuesU))**2
+err= math.sqrt(err)
+
+# Write and read back binary files.
+tmpDir= tempfile.mkdtemp()
+binFile1= os.path.join(tmpDir, 'ts1.bin')
+binFile2= os.path.join(tmpDir, 'ts2.bin')
+ok= ts1.writeToBinaryFile(binFile1)
+ts3= lPatterns.newTimeSeries("path_time_ts","ts3")
+ok= ok and ts3.readFromBinaryFile(binFile1)
+uniformPath= lPatterns.newTimeSeries("path_ts","ts4")
+uniformPath.path= xc.Vector(loadValuesU)
+uniformPath.timeIncr= dt
+ok= ok and uniformPath.writeToBinaryFile(binFile2)
+ts5= lPatterns.newTimeSeries("path_time_ts","ts5") # read uniform series.
+ok= ok and ts5.readFromBinaryFile(binFile2)
+ts6= lPatterns.newTimeSeries("path_ts","ts6")
+ok= ok and ts6.readFromBinaryFile(binFile2)
+errBin= 0.0
+for t in queryTimes:
+    errBin+= (ts3.getFactor(t)-ts1.getFactor(t))**2
+    errBin+= (ts5.getFactor(t)-ts2.getFactor(t))**2
+    errBin+= (ts6.getFactor(t)-ts2.getFactor(t))**2
+errBin= math.sqrt(errBin)
+errBin+= abs(ts6.timeIncr-dt)
+
+# Integration of the same record in two ground motions.
+xc.TimeSeriesIntegrator.clearCache()
+velocities= list()
+for name in ['gm1', 'gm2']:
+    gm= lPatterns.newLoadPattern("uniform_excitation",name)
+    hist= gm.motionRecord.history
+    hist.loadAccelBinaryFile(binFile2, 1.0)
+    hist.delta= dt
+    velocities.append(gm.motionRecord.getVel(1.0))
+cacheSize= xc.TimeSeriesIntegrator.getCacheSize()
+refVel= math.sin(2.0)/2.0
+errVel= max(abs(velocities[0]-refVel), abs(velocities[1]-refVel))
+
+os.remove(binFile1)
+os.remove(binFile2)
+os.rmdir(tmpDir)
+
+'''
+print('err= ', err)
+print('errBin= ', errBin)
+print('velocities: ', velocities, refVel)
+print('cacheSize= ', cacheSize)
+'''
+
+from misc_utils import log_messages as lmsg
+fname= os.path.basename(__file__)
+if ok and (err<1e-12) and (errBin<1e-12) and (errVel<1e-3) and (cacheSize==1):
+    print('test '+fname+': ok.')
+else:
+    lmsg.error(fname+' ERROR.')
@@ -0,0 +1,84 @@
+# -*- coding: utf-8 -*-
+''' Check the inertia loads of the distributed mass of an element
+    under uniform excitation (the elements ask the nodes for the
+    product R*accel). Home made test.'''
+
+from __future__ import print_function
+from __future__ import division
+
+__author__= "Luis C. Pérez Tato (LCPT) and Ana Ortega (AOO)"
+__copyright__= "Copyright 2024, LCPT and AOO"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+import xc
+from model import predefined_spaces
+from materials import typical_materials
+from solution import predefined_solutions
+
+E= 210e9 # Young modulus.
+rho= 7850.0 # density.
+A= 0.01 # cross-section area.
+L= 2.0 # bar length.
+ag= 3.0 # ground acceleration.
+
+# Define FE problem.
+feProblem= xc.FEProblem()
+preprocessor=  feProblem.getPreprocessor
+nodes= preprocessor.getNodeHandler
+modelSpace= predefined_spaces.SolidMechanics2D(nodes)
+
+# Bar with distributed mass between two fixed nodes and a massless
+# bar that connects the second node with a free one (so the system of
+# equations is not empty).
+n1= nodes.newNodeXY(0,0)
+n2= nodes.newNodeXY(L,0)
+n3= nodes.newNodeXY(2*L,0)
+
+heavy= typical_materials.defElasticMaterial(preprocessor, "heavy", E, rho= rho)
+light= typical_materials.defElasticMaterial(preprocessor, "light", E)
+elements= preprocessor.getElementHandler
+elements.dimElem= 2
+elements.defaultMaterial= heavy.name
+truss1= elements.newElement("Truss",xc.ID([n1.tag,n2.tag]))
+truss1.sectionArea= A
+elements.defaultMaterial= light.name
+truss2= elements.newElement("Truss",xc.ID([n2.tag,n3.tag]))
+truss2.sectionArea= A
+
+modelSpace.fixNode00(n1.tag)
+modelSpace.fixNode00(n2.tag)
+modelSpace.fixNodeF0(n3.tag)
+
+# Constant ground acceleration along the X axis.
+loadPatterns= preprocessor.getLoadHandler.getLoadPatterns
+gm= loadPatterns.newLoadPattern("uniform_excitation","gm")
+gm.dof= 0
+hist= gm.motionRecord.history
+hist.accel= loadPatterns.newTimeSeries("path_ts","accel")
+hist.accel.path= xc.Vector([ag, ag, ag, ag])
+hist.accel.setTimeIncr(0.01)
+loadPatterns.addToDomain(gm.getName())
+
+solProc= predefined_solutions.PlainLinearNewmark(feProblem, numSteps= 2, timeStep= 0.01)
+result= solProc.solve()
+
+preprocessor.getDomain.calculateNodalReactions(True,1e-7)
+Rx= n1.getReaction[0]+n2.getReaction[0]
+RxRef= rho*A*L*ag
+ratio= abs(abs(Rx)-RxRef)/RxRef
+
+'''
+print('Rx= ', Rx)
+print('RxRef= ', RxRef)
+print('ratio= ', ratio)
+'''
+
+import os
+from misc_utils import log_messages as lmsg
+fname= os.path.basename(__file__)
+if (result==0) and (ratio<1e-6):
+    print('test '+fname+': ok.')
+else:
+    lmsg.error(fname+' ERROR.')
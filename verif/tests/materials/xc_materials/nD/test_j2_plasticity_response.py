@@ -0,0 +1,98 @@
+# -*- coding: utf-8 -*-
+''' Check the response of the J2ThreeDimensional, J2PlaneStrain and
+    J2AxiSymm materials against the closed-form solution of the radial
+    return with linear isotropic hardening. Home made test.
+
+    The expected values correspond to the 1/3, 2/3 and 4/3 constants
+    of J2Plasticity evaluated in floating point (they were evaluated
+    to zero before, so the trace of the strain was not removed from
+    the deviatoric strain and the hardening was ignored).
+'''
+
+from __future__ import print_function
+from __future__ import division
+
+__author__= "Luis C. Pérez Tato (LCPT) and Ana Ortega (AOO)"
+__copyright__= "Copyright 2024, LCPT and AOO"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+import math
+import xc
+
+K= 166.67e9 # bulk modulus.
+G= 76.92e9 # shear modulus.
+sigma0= 250e6 # yield stress.
+H= 1e9 # linear hardening parameter.
+
+def expectedStress(eps):
+    ''' Return the stress tensor obtained in one step from the virgin
+        state for the strain tensor argument.'''
+    trace= eps[0][0]+eps[1][1]+eps[2][2]
+    dev= [[eps[i][j]-(trace/3.0 if i==j else 0.0) for j in range(3)] for i in range(3)]
+    s= [[2.0*G*dev[i][j] for j in range(3)] for i in range(3)]
+    normS= math.sqrt(sum(s[i][j]**2 for i in range(3) for j in range(3)))
+    phi= normS-math.sqrt(2.0/3.0)*sigma0
+    factor= 1.0
+    if(phi>0.0):
+        gamma= phi/(2.0*G+2.0/3.0*H)
+        factor= 1.0-2.0*G*gamma/normS
+    return [[factor*s[i][j]+(K*trace if i==j else 0.0) for j in range(3)] for i in range(3)]
+
+# Strain vector, tensor components of the strain vector
+# (engineering shear strains) and tensor components of the
+# stress vector for each material.
+materials= dict()
+materials['J2_three_dimensional']= (xc.Vector([1.0, -0.3, -0.2, 0.8, 0.1, -0.4]), [(0,0),(1,1),(2,2),(0,1),(1,2),(2,0)])
+materials['J2_plane_strain']= (xc.Vector([1.0, -0.3, 0.8]), [(0,0),(1,1),(0,1)])
+materials['J2_axy_symm']= (xc.Vector([1.0, -0.3, -0.2, 0.8]), [(0,0),(1,1),(2,2),(0,1)])
+
+# Define problem
+feProblem= xc.FEProblem()
+preprocessor= feProblem.getPreprocessor
+materialHandler= preprocessor.getMaterialHandler
+
+err= 0.0
+for key in materials:
+    direction, components= materials[key]
+    for scale in [1e-4, 2e-3]: # elastic and plastic.
+        mat= materialHandler.newMaterial(key, key+str(scale))
+        mat.setup(K, G, sigma0, sigma0, 0.0, H, 0.0)
+        strain= scale*direction
+        eps= [[0.0]*3 for i in range(3)]
+        for k, (i,j) in enumerate(components):
+            value= strain[k] if i==j else 0.5*strain[k]
+            eps[i][j]= value
+            eps[j][i]= value
+        mat.setTrialStrain(strain)
+        sg= mat.getStress()
+        sgRef= expectedStress(eps)
+        refNorm= math.sqrt(sum(sgRef[i][j]**2 for (i,j) in components))
+        for k, (i,j) in enumerate(components):
+            err= max(err, abs(sg[k]-sgRef[i][j])/refNorm)
+    # Elastic tangent.
+    mat= materialHandler.newMaterial(key, key+'_tangent')
+    mat.setup(K, G, sigma0, sigma0, 0.0, H, 0.0)
+    tg= mat.getInitialTangent()
+    for k, (i,j) in enumerate(components):
+        for l, (m,n) in enumerate(components):
+            if(i==j) and (m==n):
+                ref= K+4.0/3.0*G if (i==m) else K-2.0/3.0*G
+            elif(i!=j) and (m!=n) and (k==l):
+                ref= G
+            else:
+                ref= 0.0
+            err= max(err, abs(tg(k,l)-ref)/(K+4.0/3.0*G))
+
+'''
+print('err= ', err)
+'''
+
+import os
+from misc_utils import log_messages as lmsg
+fname= os.path.basename(__file__)
+if (err<1e-6):
+    print('test '+fname+': ok.')
+else:
+    lmsg.error(fname+' ERROR.')
@@ -0,0 +1,79 @@
+# -*- coding: utf-8 -*-
+''' Compare the response of the J2 materials integrated with the fixed
+    size radial return algorithm with the response of the generic J2
+    implementation and check the consistency of the Drucker-Prager
+    radial return. Home made test.'''
+
+from __future__ import print_function
+from __future__ import division
+
+__author__= "Luis C. Pérez Tato (LCPT) and Ana Ortega (AOO)"
+__copyright__= "Copyright 2024, LCPT and AOO"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+import math
+import xc
+
+K= 166.67e9 # bulk modulus.
+G= 76.92e9 # shear modulus.
+sigma0= 250e6 # initial yield stress.
+sigmaInf= 300e6 # saturation yield stress.
+delta= 100.0 # exponential hardening parameter.
+H= 1e9 # linear hardening parameter.
+
+# Define problem
+feProblem= xc.FEProblem()
+preprocessor= feProblem.getPreprocessor
+materialHandler= preprocessor.getMaterialHandler
+
+# Generic and radial return J2 materials.
+generic= materialHandler.newMaterial("J2_three_dimensional", "generic")
+generic.setup(K, G, sigma0, sigmaInf, delta, H, 0.0)
+fast= materialHandler.newMaterial("J2_radial_return_3d", "fast")
+fast.setup(K, G, sigma0, sigmaInf, delta, H, 0.0)
+
+# Strain path (engineering shear strains).
+direction= xc.Vector([1.0, -0.3, -0.2, 0.8, 0.1, -0.4])
+errStress= 0.0
+errTangent= 0.0
+for i in range(1,21):
+    strain= (0.0005*i)*direction
+    for m in [generic, fast]:
+        m.setTrialStrain(strain)
+        m.commitState()
+    sgGeneric= generic.getStress()
+    errStress= max(errStress, (fast.getStress()-sgGeneric).Norm()/sgGeneric.Norm())
+    tgGeneric= generic.getTangent()
+    errTangent= max(errTangent, (fast.getTangent()-tgGeneric).Norm()/tgGeneric.Norm())
+xi= fast.xi
+
+# Drucker-Prager: the stress must lie on the yield surface after
+# the return to the cone.
+sigY= 5.0
+mRho= 0.2
+dp= materialHandler.newMaterial("drucker-prager_radial_return_3d", "dp")
+dp.setup(27777.78, 9259.26, sigY, mRho, mRho, 0.0, 0.0, 0.0, 100.0)
+dp.setTrialStrain(xc.Vector([0.001, 0.0, 0.0, 0.002, 0.0, 0.0]))
+sg= dp.getStress()
+I1= sg[0]+sg[1]+sg[2]
+p= I1/3.0
+normS= math.sqrt((sg[0]-p)**2+(sg[1]-p)**2+(sg[2]-p)**2+2.0*(sg[3]**2+sg[4]**2+sg[5]**2))
+yieldFunction= normS+mRho*I1-math.sqrt(2.0/3.0)*(sigY+100.0*dp.alpha)
+
+'''
+print('xi= ', xi)
+print('errStress= ', errStress)
+print('errTangent= ', errTangent)
+print('alpha= ', dp.alpha)
+print('yield function= ', yieldFunction)
+'''
+
+import os
+from misc_utils import log_messages as lmsg
+fname= os.path.basename(__file__)
+if (xi>0.0) and (errStress<1e-6) and (errTangent<1e-5) and (dp.alpha>0.0) and (abs(yieldFunction)<1e-6):
+    print('test '+fname+': ok.')
+else:
+    lmsg.error(fname+' ERROR.')
@@ -0,0 +1,93 @@
+# -*- coding: utf-8 -*-
+''' Compare the response of the plane stress and plane strain materials
+    integrated with the fixed size radial return algorithm with the
+    response of the generic J2PlaneStress and J2PlaneStrain materials.
+    The Drucker-Prager plane strain material without pressure
+    dependence (rho= rhoBar= 0) and with linear hardening must give
+    the same response as J2PlaneStrain. Checks also that
+    revertToLastCommit discards the plastic strain of the trial
+    state. Home made test.'''
+
+from __future__ import print_function
+from __future__ import division
+
+__author__= "Luis C. Pérez Tato (LCPT) and Ana Ortega (AOO)"
+__copyright__= "Copyright 2024, LCPT and AOO"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+import xc
+
+K= 166.67e9 # bulk modulus.
+G= 76.92e9 # shear modulus.
+sigma0= 250e6 # initial yield stress.
+H= 1e9 # linear hardening parameter.
+
+# Define problem
+feProblem= xc.FEProblem()
+preprocessor= feProblem.getPreprocessor
+materialHandler= preprocessor.getMaterialHandler
+
+def newJ2(typeName, name):
+    ''' Return a new J2 material with linear hardening.'''
+    retval= materialHandler.newMaterial(typeName, name)
+    retval.setup(K, G, sigma0, sigma0, 0.0, H, 0.0)
+    return retval
+
+def compare(generic, fast, direction):
+    ''' Return the maximum relative differences between the stresses
+        and the tangents of both materials along a strain path.'''
+    errStress= 0.0
+    errTangent= 0.0
+    for i in range(1,21):
+        strain= (0.0005*i)*direction
+        for m in [generic, fast]:
+            m.setTrialStrain(strain)
+            m.commitState()
+        sgGeneric= generic.getStress()
+        errStress= max(errStress, (fast.getStress()-sgGeneric).Norm()/sgGeneric.Norm())
+        tgGeneric= generic.getTangent()
+        errTangent= max(errTangent, (fast.getTangent()-tgGeneric).Norm()/tgGeneric.Norm())
+    return errStress, errTangent
+
+direction= xc.Vector([1.0, -0.3, 0.8]) # (eps_xx, eps_yy, 2*eps_xy)
+
+# Plane stress.
+errors= [compare(newJ2("J2_plane_stress", "genericPlaneStress"), newJ2("J2_radial_return_plane_stress", "fastPlaneStress"), direction)]
+# Plane strain.
+errors.append(compare(newJ2("J2_plane_strain", "genericPlaneStrain"), newJ2("J2_radial_return_plane_strain", "fastPlaneStrain"), direction))
+# Drucker-Prager plane strain without pressure dependence.
+dp= materialHandler.newMaterial("drucker-prager_radial_return_plane_strain", "dpPlaneStrain")
+dp.setup(K, G, sigma0, 0.0, 0.0, 0.0, 0.0, 0.0, H)
+errors.append(compare(newJ2("J2_plane_strain", "genericPlaneStrain2"), dp, direction))
+
+# Revert to the last committed state.
+mat= newJ2("J2_radial_return_plane_strain", "revertPlaneStrain")
+mat.setTrialStrain(0.002*direction)
+mat.commitState()
+xiCommitted= mat.xi
+mat.setTrialStrain(0.004*direction)
+xiTrial= mat.xi
+mat.revertToLastCommit()
+mat.commitState()
+xiReverted= mat.xi
+
+'''
+print('errors= ', errors)
+print('xi committed= ', xiCommitted)
+print('xi trial= ', xiTrial)
+print('xi reverted= ', xiReverted)
+'''
+
+ok= (xiCommitted>0.0) and (xiTrial>xiCommitted) and (xiReverted==xiCommitted)
+for (errStress, errTangent) in errors:
+    ok= ok and (errStress<1e-6) and (errTangent<1e-5)
+
+import os
+from misc_utils import log_messages as lmsg
+fname= os.path.basename(__file__)
+if ok:
+    print('test '+fname+': ok.')
+else:
+    lmsg.error(fname+' ERROR.')
@@ -0,0 +1,51 @@
+# -*- coding: utf-8 -*-
+''' Check that the capacity factors computed in batch (one internal
+    forces triplet on each row of a matrix) are equal to those computed
+    one by one. Home made test. '''
+
+from __future__ import print_function
+
+import math
+import geom
+import xc
+
+__author__= "Luis C. Pérez Tato (LCPT) and Ana Ortega (A_OO)"
+__copyright__= "Copyright 2024, LCPT and AO_O"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com ana.ortega.ort@gmal.com"
+
+feProblem= xc.FEProblem()
+preprocessor=  feProblem.getPreprocessor
+materialHandler= preprocessor.getMaterialHandler
+diagInteg= materialHandler.newInteractionDiagram("diagInteg")
+diagInteg.readFrom("/tmp/interaction_diagram_test_02.dat") # Written by test_interaction_diagram02
+
+# Internal forces triplets spread over all the octants.
+rows= list()
+for i in range(0,12):
+    theta= 2.0*math.pi*i/12.0
+    for N in [-6000e3, -3000e3, -500e3, 0.0, 1000e3, 2000e3]:
+        for M in [50e3, 400e3, 900e3]:
+            rows.append([N, M*math.cos(theta), M*math.sin(theta)])
+
+FCs= diagInteg.getCapacityFactors(xc.Matrix(rows))
+
+err= 0.0
+for i, r in enumerate(rows):
+    fc= diagInteg.getCapacityFactor(geom.Pos3d(r[0], r[1], r[2]))
+    err+= (FCs[i]-fc)**2
+err= math.sqrt(err)
+
+''' 
+print("FCs= ",FCs)
+print("err= ",err)
+ '''
+
+import os
+from misc_utils import log_messages as lmsg
+fname= os.path.basename(__file__)
+if((len(FCs)==len(rows)) and (err<1e-10)):
+    print('test '+fname+': ok.')
+else:
+    lmsg.error(fname+' ERROR.')
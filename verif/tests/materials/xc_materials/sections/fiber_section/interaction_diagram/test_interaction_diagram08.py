@@ -0,0 +1,103 @@
+# -*- coding: utf-8 -*-
+''' Check the persistent cache of interaction diagrams: the diagram read
+    from the cache must be equal to the computed one and the fingerprint
+    must change when the section changes. Home made test. '''
+
+from __future__ import print_function
+
+import os
+import math
+import shutil
+import tempfile
+import geom
+import xc
+from materials.ehe import EHE_materials
+
+__author__= "Luis C. Pérez Tato (LCPT) and Ana Ortega (A_OO)"
+__copyright__= "Copyright 2024, LCPT and AO_O"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com ana.ortega.ort@gmal.com"
+
+width= 0.3  # Cross-section width [m]
+depth= 0.5 # Cross-section depth [m]
+cover= 0.05 # Cover [m]
+areaFi16= 2.01e-4 # Rebars cross-section area [m2]
+
+feProblem= xc.FEProblem()
+preprocessor=  feProblem.getPreprocessor
+# Materials definition
+concr= EHE_materials.HA25
+concrMatTag25= concr.defDiagD(preprocessor)
+tagB500S= EHE_materials.B500S.defDiagD(preprocessor)
+
+def defineSection(sectionName, numBars):
+    ''' Define a rectangular reinforced concrete section.'''
+    geomSec= preprocessor.getMaterialHandler.newSectionGeometry("geom"+sectionName)
+    concrete= geomSec.getRegions.newQuadRegion(EHE_materials.HA25.nmbDiagD)
+    concrete.nDivIJ= 8
+    concrete.nDivJK= 8
+    concrete.pMin= geom.Pos2d(-depth/2.0,-width/2.0)
+    concrete.pMax= geom.Pos2d(depth/2.0,width/2.0)
+    reinforcement= geomSec.getReinfLayers
+    reinforcementInf= reinforcement.newStraightReinfLayer(EHE_materials.B500S.nmbDiagD)
+    reinforcementInf.numReinfBars= numBars
+    reinforcementInf.barArea= areaFi16
+    reinforcementInf.p1= geom.Pos2d(cover-depth/2.0,width/2.0-cover) # bottom layer.
+    reinforcementInf.p2= geom.Pos2d(cover-depth/2.0,cover-width/2.0)
+    reinforcementSup= reinforcement.newStraightReinfLayer(EHE_materials.B500S.nmbDiagD)
+    reinforcementSup.numReinfBars= numBars
+    reinforcementSup.barArea= areaFi16
+    reinforcementSup.p1= geom.Pos2d(depth/2.0-cover,width/2.0-cover) # top layer.
+    reinforcementSup.p2= geom.Pos2d(depth/2.0-cover,cover-width/2.0)
+    retval= preprocessor.getMaterialHandler.newMaterial("fiber_section_3d",sectionName)
+    retval.getFiberSectionRepr().setGeomNamed(geomSec.name)
+    retval.setupFibers()
+    return retval
+
+secA= defineSection('secA', 3)
+secA2= defineSection('secA2', 3) # Same section with other name.
+secB= defineSection('secB', 4)
+
+param= xc.InteractionDiagramParameters()
+param.concreteTag= EHE_materials.HA25.matTagD
+param.reinforcementTag= EHE_materials.B500S.matTagD
+
+cacheDir= tempfile.mkdtemp()
+xc.InteractionDiagram.setCacheDirectory(cacheDir)
+
+fpA= secA.getInteractionDiagramFingerprint(param)
+fpA2= secA2.getInteractionDiagramFingerprint(param)
+fpB= secB.getInteractionDiagramFingerprint(param)
+diagA= preprocessor.getMaterialHandler.calcInteractionDiagram(secA.name, param) # Computed and stored.
+numCacheFiles= len(os.listdir(cacheDir))
+cachedDiag= preprocessor.getMaterialHandler.calcInteractionDiagram(secA2.name, param) # Read from cache.
+
+rows= list()
+for i in range(0,8):
+    theta= 2.0*math.pi*i/8.0
+    for N in [-2000e3, -500e3, 0.0, 300e3]:
+        rows.append([N, 100e3*math.cos(theta), 100e3*math.sin(theta)])
+m= xc.Matrix(rows)
+FCs= diagA.getCapacityFactors(m)
+cachedFCs= cachedDiag.getCapacityFactors(m)
+err= 0.0
+for a, b in zip(FCs, cachedFCs):
+    err+= (a-b)**2
+err= math.sqrt(err)
+
+xc.InteractionDiagram.setCacheDirectory('')
+shutil.rmtree(cacheDir)
+
+''' 
+print("fingerprints: ", fpA, fpA2, fpB)
+print("number of cache files: ", numCacheFiles)
+print("err= ",err)
+ '''
+
+from misc_utils import log_messages as lmsg
+fname= os.path.basename(__file__)
+if((fpA==fpA2) and (fpA!=fpB) and (numCacheFiles==1) and (err<1e-12)):
+    print('test '+fname+': ok.')
+else:
+    lmsg.error(fname+' ERROR.')
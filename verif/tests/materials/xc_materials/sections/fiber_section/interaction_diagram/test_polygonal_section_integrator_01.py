@@ -0,0 +1,97 @@
+# -*- coding: utf-8 -*-
+''' Check the stress resultants obtained by integrating over the section
+    contour (without fibers) against those obtained with a fine fiber
+    mesh. Home made test. '''
+
+from __future__ import print_function
+
+import math
+import geom
+import xc
+from materials.ehe import EHE_materials
+
+__author__= "Luis C. Pérez Tato (LCPT) and Ana Ortega (A_OO)"
+__copyright__= "Copyright 2024, LCPT and AO_O"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com ana.ortega.ort@gmal.com"
+
+width= 0.4  # Cross-section width [m]
+depth= 0.6 # Cross-section depth [m]
+cover= 0.05 # Cover [m]
+areaFi20= 3.14e-4 # Rebars cross-section area [m2]
+
+feProblem= xc.FEProblem()
+preprocessor=  feProblem.getPreprocessor
+# Materials definition
+concr= EHE_materials.HA25
+concrMatTag25= concr.defDiagD(preprocessor) # parabola-rectangle (Concrete01).
+tagB500S= EHE_materials.B500S.defDiagD(preprocessor) # bilinear (Steel01).
+
+# Section geometry
+geomSec= preprocessor.getMaterialHandler.newSectionGeometry("geomSec")
+concrete= geomSec.getRegions.newQuadRegion(EHE_materials.HA25.nmbDiagD)
+concrete.nDivIJ= 60
+concrete.nDivJK= 60
+concrete.pMin= geom.Pos2d(-depth/2.0,-width/2.0)
+concrete.pMax= geom.Pos2d(depth/2.0,width/2.0)
+reinforcement= geomSec.getReinfLayers
+reinforcementInf= reinforcement.newStraightReinfLayer(EHE_materials.B500S.nmbDiagD)
+reinforcementInf.numReinfBars= 4
+reinforcementInf.barArea= areaFi20
+reinforcementInf.p1= geom.Pos2d(cover-depth/2.0,width/2.0-cover) # bottom layer.
+reinforcementInf.p2= geom.Pos2d(cover-depth/2.0,cover-width/2.0)
+reinforcementSup= reinforcement.newStraightReinfLayer(EHE_materials.B500S.nmbDiagD)
+reinforcementSup.numReinfBars= 3
+reinforcementSup.barArea= areaFi20
+reinforcementSup.p1= geom.Pos2d(depth/2.0-cover,width/2.0-cover) # top layer.
+reinforcementSup.p2= geom.Pos2d(depth/2.0-cover,cover-width/2.0)
+
+materialHandler= preprocessor.getMaterialHandler
+section= materialHandler.newMaterial("fiber_section_3d","section")
+section.getFiberSectionRepr().setGeomNamed(geomSec.name)
+section.setupFibers()
+
+integrator= xc.PolygonalSectionIntegrator(geomSec)
+
+# Generalized strains (epsilon, curvZ, curvY).
+strains= [[-1.5e-3, 0.0, 0.0],
+          [-1e-3, 8e-3, 0.0],
+          [0.0, -5e-3, 4e-3],
+          [1e-3, 10e-3, -6e-3],
+          [-2e-3, 3e-3, 2e-3]]
+err= 0.0
+for s in strains:
+    plane= xc.DeformationPlane()
+    plane.setStrains(xc.Vector(s))
+    section.setTrialDeformationPlane(plane)
+    ref= [section.getN(), section.getMy(), section.getMz()]
+    nmm= integrator.getNMyMz(plane)
+    scale= max(1e3, abs(ref[0]))
+    err+= ((nmm.x-ref[0])/scale)**2
+    scale= max(1e3, abs(ref[1]), abs(ref[2]))
+    err+= ((nmm.y-ref[1])/scale)**2+((nmm.z-ref[2])/scale)**2
+err= math.sqrt(err)
+
+# Interaction diagrams.
+param= xc.InteractionDiagramParameters()
+param.concreteTag= EHE_materials.HA25.matTagD
+param.reinforcementTag= EHE_materials.B500S.matTagD
+param.polygonIntegration= True
+diag= materialHandler.calcInteractionDiagram(section.name, param)
+fc= diag.getCapacityFactor(geom.Pos3d(-1500e3, 100e3, 150e3))
+
+''' 
+print("numRegions= ", integrator.numRegions)
+print("numBars= ", integrator.numBars)
+print("err= ",err)
+print("fc= ",fc)
+ '''
+
+import os
+from misc_utils import log_messages as lmsg
+fname= os.path.basename(__file__)
+if((integrator.numRegions==1) and (integrator.numBars==7) and (err<5e-3) and (fc>0.0) and (fc<1.0)):
+    print('test '+fname+': ok.')
+else:
+    lmsg.error(fname+' ERROR.')
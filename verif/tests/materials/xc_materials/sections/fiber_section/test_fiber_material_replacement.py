@@ -0,0 +1,111 @@
+# -*- coding: utf-8 -*-
+''' Replace the material of a fiber of a section whose material states
+    are stored in the section state arena (see MaterialStateArena)
+    and check that the section uses the new material. Then the fibers
+    of the section are set up again and, finally, the section is
+    destroyed; the replaced material (already deleted) must not be
+    touched in any of those operations. Home made test.'''
+
+from __future__ import print_function
+from __future__ import division
+
+__author__= "Luis C. Pérez Tato (LCPT) and Ana Ortega (AOO)"
+__copyright__= "Copyright 2026, LCPT and AOO"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+import os
+import sys
+import xc
+from materials import typical_materials
+
+width= 1
+depth= 1
+nDivIJ= 2
+nDivJK= 2
+A= width*depth/(nDivIJ*nDivJK) # Area of each fiber.
+
+feProblem= xc.FEProblem()
+preprocessor=  feProblem.getPreprocessor
+
+# Materials definition.
+fy= 2600 # Yield stress.
+E= 2.1e6 # Young modulus.
+b= 0.001 # Strain-hardening ratio.
+steel= typical_materials.defSteel01(preprocessor= preprocessor, name= "steel", E= E, fy= fy, b= b)
+E2= 2*E # Young modulus of the replacement material.
+elast= typical_materials.defElasticMaterial(preprocessor, "elast", E2)
+
+def steelStress(eps):
+    ''' Stress of the steel under monotonic tension.'''
+    epsY= fy/E
+    return E*eps if (eps<=epsY) else fy+b*E*(eps-epsY)
+
+# Section.
+pth= os.path.dirname(__file__)
+if(not pth):
+    pth= "."
+auxModulePath= pth+"/../../../../aux"
+sys.path.append(auxModulePath)
+import test_quad_region as tqr
+
+quadFibers= preprocessor.getMaterialHandler.newMaterial("fiber_section_3d","quadFibers")
+fiberSectionRepr= quadFibers.getFiberSectionRepr()
+testQuadRegion= tqr.get_test_quad_region(preprocessor, 0.0, 0.0, width, depth, nDivIJ, nDivJK)
+fiberSectionRepr.setGeomNamed(testQuadRegion.name)
+quadFibers.setupFibers()
+
+# Yield the steel fibers and commit (the state of the fibers
+# goes to the arena).
+quadFibers.sectionDeformation= xc.Vector([2e-3, 0.0, 0.0])
+quadFibers.commitState()
+
+# Replace the material of the first fiber.
+fibers= quadFibers.getFibers()
+for f in fibers:
+    f.setMaterial(elast)
+    break
+
+eps= 2.5e-3
+quadFibers.sectionDeformation= xc.Vector([eps, 0.0, 0.0])
+quadFibers.commitState()
+# Go beyond and revert to the last committed state.
+quadFibers.sectionDeformation= xc.Vector([3e-3, 0.0, 0.0])
+quadFibers.revertToLastCommit()
+quadFibers.sectionDeformation= xc.Vector([eps, 0.0, 0.0])
+N= quadFibers.getStressResultant()[0]
+EA= quadFibers.getTangentStiffness()(0,0)
+NRef= 3*A*steelStress(eps)+A*E2*eps
+EARef= 3*A*b*E+A*E2
+ratio1= abs(N-NRef)/NRef
+ratio2= abs(EA-EARef)/EARef
+
+# Set up the fibers again (the old fibers and materials are deleted).
+quadFibers.setupFibers()
+eps= 1e-4
+quadFibers.sectionDeformation= xc.Vector([eps, 0.0, 0.0])
+quadFibers.commitState()
+N= quadFibers.getStressResultant()[0]
+NRef= 4*A*E*eps
+ratio3= abs(N-NRef)/NRef
+
+# Replace a material again and destroy the section.
+fibers= quadFibers.getFibers()
+for f in fibers:
+    f.setMaterial(elast)
+    break
+feProblem.clearAll()
+
+'''
+print('ratio1= ', ratio1)
+print('ratio2= ', ratio2)
+print('ratio3= ', ratio3)
+'''
+
+from misc_utils import log_messages as lmsg
+fname= os.path.basename(__file__)
+if (ratio1<1e-10) and (ratio2<1e-10) and (ratio3<1e-10):
+    print('test '+fname+': ok.')
+else:
+    lmsg.error(fname+' ERROR.')
@@ -0,0 +1,141 @@
+# -*- coding: utf-8 -*-
+''' Check the stress resultant and the tangent stiffness of a
+    LayeredShellFiberSection made of layers of different classes
+    (concrete, elastic and J2 plate fibres and rebars) against the
+    values obtained integrating the response of each layer along
+    the thickness (per-fiber loop). The layer materials are grouped
+    by class inside the section (see PlateFiberLayers) so this
+    checks also that the results go back to the right layers.
+    The layers are then redefined with other materials (same number
+    of layers) to check that the section uses the new ones.
+    Home made test.'''
+
+from __future__ import print_function
+from __future__ import division
+
+__author__= "Luis C. Pérez Tato (LCPT) and Ana Ortega (AOO)"
+__copyright__= "Copyright 2026, LCPT and AOO"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+import math
+import xc
+from materials import typical_materials
+
+# Model definition
+feProblem= xc.FEProblem()
+preprocessor=  feProblem.getPreprocessor
+
+def defLayerMaterial(kind, name):
+    ''' Define a layer material of the given kind.'''
+    if(kind=='concrete'):
+        concrete= typical_materials.defPlasticDamageConcretePlaneStress(preprocessor, name= name+'PlaneStress', E= 25743.0e6, nu= 0.25, ft= 2.07e6, fc= 20.7e6, beta= 0.6, Ap= 0.1, An= 2.0, Bn= 0.75)
+        retval= typical_materials.defPlateFromPlaneStress(preprocessor, name= name, underlyingMaterial= concrete, outOfPlaneShearModulus= 1.25e10)
+    elif(kind=='elastic'):
+        elastic= typical_materials.defElasticIsotropicPlaneStress(preprocessor, name= name+'PlaneStress', E= 30e9, nu= 0.2)
+        retval= typical_materials.defPlateFromPlaneStress(preprocessor, name= name, underlyingMaterial= elastic, outOfPlaneShearModulus= 1.25e10)
+    elif(kind=='j2'):
+        retval= typical_materials.defJ2PlateFibre(preprocessor, name= name, E= 200e9, nu= 0.3, fy= 250e6, alpha= 0.02)
+    else: # rebar.
+        steel= typical_materials.defSteel02(preprocessor, name= name+'Steel', E= 200.6e9, fy= 392e6, b= .01, params= [18.5, 0.925, 0.15], initialStress= 0.0)
+        angle= 0.0 if (kind=='rebarX') else math.radians(90)
+        retval= typical_materials.defPlateRebar(preprocessor, name= name, uniaxialMaterial= steel, angle= angle)
+    return retval
+
+counter= 0
+def defLayers(layerData):
+    ''' Define the materials of the layers (kind, thickness) and the
+        reference materials used to check the section response.'''
+    global counter
+    layers= list()
+    references= list()
+    for (kind, thickness) in layerData:
+        counter+= 1
+        layers.append((defLayerMaterial(kind, 'layer'+str(counter)).name, thickness))
+        references.append(defLayerMaterial(kind, 'ref'+str(counter)))
+    return layers, references
+
+def perFiberResponse(references, thicknesses, e):
+    ''' Integrate the response of the reference materials along the
+        thickness for the generalized strains e.'''
+    h= sum(thicknesses)
+    r= [0.0]*8
+    k= [[0.0]*8 for i in range(8)]
+    zPos= -h/2.0
+    for (m, t) in zip(references, thicknesses):
+        z= zPos+t/2.0
+        zPos+= t
+        m.setTrialStrain(xc.Vector([e[0]-z*e[3], e[1]-z*e[4], e[2]-z*e[5], e[6], e[7]]))
+        m.commitState()
+        s= m.getStress()
+        d= m.getTangent()
+        # Stress resultant: membrane, bending and shear.
+        for i in range(0,3):
+            r[i]+= s[i]*t
+            r[i+3]+= z*s[i]*t
+        r[6]+= s[3]*t
+        r[7]+= s[4]*t
+        # Tangent: stress component and factor of each row
+        # and strain component and factor of each column.
+        comp= [0, 1, 2, 0, 1, 2, 3, 4]
+        rowFactor= [1.0, 1.0, 1.0, z, z, z, 1.0, 1.0]
+        colFactor= [1.0, 1.0, 1.0, -z, -z, -z, 1.0, 1.0]
+        for i in range(0,8):
+            for j in range(0,8):
+                k[i][j]+= rowFactor[i]*colFactor[j]*d(comp[i],comp[j])*t
+    return r, k
+
+def compare(section, references, thicknesses, direction, numSteps):
+    ''' Return the maximum relative differences between the stress
+        resultant and the tangent of the section and those obtained
+        with the per-fiber loop along a strain path.'''
+    errStress= 0.0
+    errTangent= 0.0
+    for step in range(1, numSteps+1):
+        e= [step*v for v in direction]
+        section.sectionDeformation= xc.Vector(e)
+        section.commitState()
+        r= section.getStressResultant()
+        k= section.getTangentStiffness()
+        rRef, kRef= perFiberResponse(references, thicknesses, e)
+        rNorm= math.sqrt(sum([v**2 for v in rRef]))
+        kNorm= math.sqrt(sum([v**2 for row in kRef for v in row]))
+        errStress= max(errStress, math.sqrt(sum([(r[i]-rRef[i])**2 for i in range(0,8)]))/rNorm)
+        errTangent= max(errTangent, math.sqrt(sum([(k(i,j)-kRef[i][j])**2 for i in range(0,8) for j in range(0,8)]))/kNorm)
+    return errStress, errTangent
+
+# Generalized strains increment for each step:
+# (e_xx, e_yy, e_xy, k_xx, k_yy, k_xy, gamma_xz, gamma_yz)
+direction= [2e-5, -0.5e-5, 1e-5, 1e-3, -0.4e-3, 0.3e-3, 1e-5, -0.5e-5]
+numSteps= 10
+
+# Layers of different classes mixed along the thickness.
+layerData= [('concrete', 0.0125), ('rebarX', 0.0003), ('j2', 0.002), ('concrete', 0.025), ('elastic', 0.02), ('concrete', 0.025), ('rebarY', 0.0003), ('j2', 0.002), ('concrete', 0.0125)]
+thicknesses= [t for (kind, t) in layerData]
+layers, references= defLayers(layerData)
+layeredShell= typical_materials.defLayeredShellFiberSection(preprocessor, name= 'layeredShell', materialThicknessPairs= layers)
+errors= [compare(layeredShell, references, thicknesses, direction, numSteps)]
+
+# Same number of layers with other materials.
+newLayerData= [('j2', 0.0125), ('concrete', 0.0003), ('rebarY', 0.002), ('elastic', 0.025), ('concrete', 0.02), ('j2', 0.025), ('concrete', 0.0003), ('rebarX', 0.002), ('elastic', 0.0125)]
+newThicknesses= [t for (kind, t) in newLayerData]
+newLayers, newReferences= defLayers(newLayerData)
+layeredShell.setLayers(newLayers)
+errors.append(compare(layeredShell, newReferences, newThicknesses, direction, numSteps))
+
+'''
+print('errors= ', errors)
+'''
+
+ok= True
+for (errStress, errTangent) in errors:
+    ok= ok and (errStress<1e-10) and (errTangent<1e-10)
+
+import os
+from misc_utils import log_messages as lmsg
+fname= os.path.basename(__file__)
+if ok:
+    print('test '+fname+': ok.')
+else:
+    lmsg.error(fname+' ERROR.')
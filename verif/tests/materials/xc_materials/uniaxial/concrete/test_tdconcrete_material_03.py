@@ -0,0 +1,144 @@
+# -*- coding: utf-8 -*-
+''' Check the recursive (Kelvin chain) computation of the creep strain of the
+TDConcrete material against the summation over the whole stress history.
+
+Based on the example: https://portwooddigital.com/2023/05/28/minimal-creep-and-shrinkage-example/
+'''
+
+from __future__ import print_function
+
+
+__author__= "Luis C. Pérez Tato (LCPT) and Ana Ortega (AOO)"
+__copyright__= "Copyright 2024, LCPT and AOO"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+import math
+import xc
+from materials import typical_materials
+from model import predefined_spaces
+from solution import predefined_solutions
+
+# Define FE problem.
+feProblem= xc.FEProblem()
+preprocessor=  feProblem.getPreprocessor
+
+# Units: kN, mm
+kN = 1
+mm = 1
+GPa = kN/mm**2
+MPa = 0.001*GPa
+
+# Define materials.
+
+## Steel.
+Es = 200*GPa
+elast= typical_materials.defElasticMaterial(preprocessor, "elast",Es)
+ 
+Ec = 25*GPa # concrete modulus of elasticity
+fc = -28*MPa # concrete compressive strength (compression is negative)
+ft = 3*MPa # concrete tensile strength (tension is positive)
+beta = 0.4 # Recommended value for the tension softening parameter (tension softening exponent).
+tDry = 14 # days
+epsshu = -600e-6 # Ultimate shrinkage strain
+psish = 75.4218 # Based on section dimensions
+Tcr = 28 # creep model age (in days)
+phiu = 3.0 # ultimate creep coefficient as per ACI 209R-92
+psicr1 = 1.0 # Recommended value
+psicr2 = 75.4218 # fitting parameter of the creep time evolution function as per ACI 209R-92. Based on section dimensions
+tcast = 0 # analysis time corresponding to concrete casting (in days; minimum value 2.0)
+
+## Concrete able to creep (summation over the stress history).
+tdConcrete= typical_materials.defTDConcrete(preprocessor= preprocessor, name= 'tdConcrete',fpc= fc,ft= ft, Ec= Ec, beta= beta, age= tDry, epsshu= epsshu, epssha= psish, tcr= Tcr, epscru= phiu, epscra= psicr1, epscrd= psicr2, tcast= tcast)
+## Concrete able to creep (Kelvin chain).
+tdConcreteRec= typical_materials.defTDConcrete(preprocessor= preprocessor, name= 'tdConcreteRec',fpc= fc,ft= ft, Ec= Ec, beta= beta, age= tDry, epsshu= epsshu, epssha= psish, tcr= Tcr, epscru= phiu, epscra= psicr1, epscrd= psicr2, tcast= tcast)
+tdConcreteRec.recursiveCreep= True
+
+b = 300*mm
+h = 300*mm
+As = 1500*mm**2
+Ag = b*h
+Ac = Ag-As
+
+# Define mesh
+nodes= preprocessor.getNodeHandler
+modelSpace= predefined_spaces.StructuralMechanics2D(nodes) # Problem space.
+elements= preprocessor.getElementHandler
+elements.dimElem= 1 # Dimension of element space
+
+## Define a zero length element for each concrete material.
+P= 1000*kN # axial load.
+ts= modelSpace.newTimeSeries(name= "ts", tsType= "constant_ts")
+lp0= modelSpace.newLoadPattern(name= 'lp0')
+modelSpace.setCurrentLoadPattern(lp0.name)
+concreteFibers= list()
+for concrete in [tdConcrete, tdConcreteRec]:
+    n1= modelSpace.newNode(0, 0)
+    n2= modelSpace.newNode(0, 0)
+    modelSpace.fixNode000(n1.tag)
+    modelSpace.fixNodeF00(n2.tag)
+    section= preprocessor.getMaterialHandler.newMaterial("fiber_section_3d", concrete.name+'Section')
+    section.addFiber(elast.name, As, xc.Vector([0,0]))
+    concreteFiber= section.addFiber(concrete.name, Ac, xc.Vector([0,0]))
+    elements.defaultMaterial= section.name
+    zl= elements.newElement("ZeroLengthSection",xc.ID([n1.tag, n2.tag]))
+    concreteFibers.append(zl.getMaterial().getFibers().findFiber(concreteFiber.tag))
+    lp0.newNodalLoad(n2.tag, xc.Vector([-P, 0, 0]))
+modelSpace.addLoadCaseToDomain(lp0.name)
+
+# Check that the flag has been copied to the fibers.
+flagsOk= (not concreteFibers[0].getMaterial().recursiveCreep) and concreteFibers[1].getMaterial().recursiveCreep
+
+# Define recorders.
+concreteStresses= list()
+concreteStressesRec= list()
+recorder= feProblem.getDomain.newRecorder("element_prop_recorder",None)
+recorder.setElements(xc.ID([zl.tag]))
+recorder.callbackRecord= "concreteStresses.append(concreteFibers[0].getStress()); concreteStressesRec.append(concreteFibers[1].getStress())"
+
+modelSpace.setCurrentTime(Tcr)
+
+solProc= predefined_solutions.PlainNewtonRaphson(feProblem, printFlag= 0)
+solProc.setup()
+# Set the load control integrator with dt=0 so that the domain time doesn’t advance.
+solProc.integrator.dLambda1= 0.0  
+result= solProc.analysis.analyze(1)
+
+dt = 10 # days
+solProc.integrator.dLambda1= dt # set new increment for the integrator.
+solProc.integrator.setNumIncr(10) # IMPORTANT! otherwise it got stuck.
+
+modelSpace.setCreepOn() # Turn creep on
+
+t = 0
+while t < 10000:
+    ok = solProc.analysis.analyze(1)
+    t+= dt
+
+# Compare the stress histories.
+maxDiff= 0.0
+for sg, sgRec in zip(concreteStresses, concreteStressesRec):
+    maxDiff= max(maxDiff, abs(sgRec-sg))
+ratio0= maxDiff/abs(concreteStresses[0])
+
+avgConcreteStress= sum(concreteStresses)/len(concreteStresses)
+avgConcreteStressRec= sum(concreteStressesRec)/len(concreteStressesRec)
+avgConcreteStressRef= 0.005974877488588469 # see test_tdconcrete_material_02.py
+ratio1= abs(avgConcreteStress+avgConcreteStressRef)/avgConcreteStressRef
+ratio2= abs(avgConcreteStressRec+avgConcreteStressRef)/avgConcreteStressRef
+
+'''
+print('flags ok: ', flagsOk)
+print('max. difference: ', maxDiff*1e3, 'MPa', ratio0)
+print('average concrete stress (summation): ', avgConcreteStress, ratio1)
+print('average concrete stress (Kelvin chain): ', avgConcreteStressRec, ratio2)
+'''
+
+import os
+from misc_utils import log_messages as lmsg
+fname= os.path.basename(__file__)
+if flagsOk and (ratio0<1e-3) and (ratio1<1e-9) and (ratio2<1e-3):
+    print('test '+fname+': ok.')
+else:
+    lmsg.error(fname+' ERROR.')
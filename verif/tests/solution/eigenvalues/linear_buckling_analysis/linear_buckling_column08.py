@@ -0,0 +1,133 @@
+# -*- coding: utf-8 -*-
+''' Linear buckling analysis of a column under several load combinations
+    sharing the factorization of the elastic stiffness matrix.
+    Based on the SOLVIA Verification Manual example B46 (see
+    linear_buckling_column01.py).
+
+    We use 6 elements instead of 2 to capture the P-d (small delta) effect.
+    To capture the geometric non-linearity "inside" the element you need to 
+    use a different element formulation, e.g., nonlinear strain in the 
+    displacement-based formulation or curvature-based displacement 
+    interpolation (CBDI) in the force-based formulation.
+
+    See the article 'Meshing for Column Loads <https://portwooddigital.com/2020/05/10/meshing-for-column-loads/amp/>'
+  '''
+from __future__ import print_function
+from __future__ import division
+import geom
+import xc
+
+import math
+from model import predefined_spaces
+from solution import predefined_solutions
+from materials import typical_materials
+# from postprocess import output_handler
+
+__author__= "Luis C. Pérez Tato (LCPT)"
+__copyright__= "Copyright 2024, LCPT"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+L= 4.0 # Column length in meters
+b= 0.2 # Cross section width in meters
+h= 0.2 # Cross section depth in meters
+A= b*h # Cross section area en m2
+I= 1/12.0*b*h**3 # Moment of inertia in m4
+E=30E9 # Elastic modulus en N/m2
+P= -100 # Vertical load over the column.
+
+NumDiv= 6
+
+feProblem= xc.FEProblem()
+preprocessor=  feProblem.getPreprocessor
+nodes= preprocessor.getNodeHandler
+
+# Problem type
+modelSpace= predefined_spaces.StructuralMechanics2D(nodes)
+# Materials definition
+scc= typical_materials.defElasticSection2d(preprocessor, "scc",A,E,I)
+
+nodes.newSeedNode(2,3)
+
+# Geometric transformation(s)
+lin= modelSpace.newPDeltaCrdTransf("lin")
+
+
+# Seed element definition
+seedElemHandler= preprocessor.getElementHandler.seedElemHandler
+seedElemHandler.defaultMaterial= scc.name
+seedElemHandler.defaultTransformation= lin.name
+beam2d= seedElemHandler.newElement("ElasticBeam2d")
+beam2d.h= h
+beam2d.rho= 0.0
+
+points= preprocessor.getMultiBlockTopology.getPoints
+pt1= points.newPoint(1,geom.Pos3d(0.0,0.0,0.0))
+pt2= points.newPoint(2,geom.Pos3d(0.0,L,0.0))
+lines= preprocessor.getMultiBlockTopology.getLines
+l= lines.newLine(pt1.tag,pt2.tag)
+l.nDiv= NumDiv
+
+
+setTotal= preprocessor.getSets.getSet("total")
+setTotal.genMesh(xc.meshDir.I)
+n1= pt1.getNode() # Back end node.
+n2= pt2.getNode() # Front end node.
+# Constraints
+constraints= preprocessor.getBoundaryCondHandler
+
+#
+spc= constraints.newSPConstraint(n1.tag,0,0.0) # Node 2,gdl 0 # Back end node.
+spc= constraints.newSPConstraint(n1.tag,1,0.0) # Node 2,gdl 1
+spc= constraints.newSPConstraint(n2.tag,0,0.0) # Node 2,gdl 0 # Front end node.
+
+# Loads definition
+lpG= modelSpace.newLoadPattern(name= 'G')
+lpG.newNodalLoad(n2.tag,xc.Vector([0,P,0]))
+lpQ= modelSpace.newLoadPattern(name= 'Q')
+lpQ.newNodalLoad(n2.tag,xc.Vector([0,P/2.0,0]))
+
+# We add the load cases to domain.
+modelSpace.addLoadCaseToDomain(lpG.name)
+modelSpace.addLoadCaseToDomain(lpQ.name)
+
+
+# Solution procedure
+combinations= {'C1': {'G':1.0}, 'C2': {'G':1.35, 'Q':1.5}, 'C3': {'Q':-1.0}}
+bucklingAnalysis= predefined_solutions.BatchedLinearBucklingAnalysis(prb= feProblem, numModes= 2, combinations= combinations)
+analOk= bucklingAnalysis.solve()
+
+blTeor= -1*math.pi**2*E*I/(L**2) # Theoretical buckling load
+# Combination 1
+eig1C1= bucklingAnalysis.analysis.getCriticalLoadFactor('C1', 1)
+blCalcC1= eig1C1*P # Computed buckling load.
+ratio1= (blCalcC1-blTeor)/blTeor
+# Combination 2
+eig1C2= bucklingAnalysis.analysis.getCriticalLoadFactor('C2', 1)
+blCalcC2= eig1C2*(1.35*P+1.5*P/2.0) # Computed buckling load.
+ratio2= (blCalcC2-blCalcC1)/blCalcC1
+# Combination 3 (tension, no buckling).
+numModesC3= len(bucklingAnalysis.analysis.getCriticalLoadFactors('C3'))
+# Buckling mode (the top and bottom nodes don't move laterally).
+mode1= bucklingAnalysis.analysis.getNodeEigenvector('C1', 1, n2.tag)
+ratio3= abs(mode1[0])
+
+'''
+print("eig1C1= ",(eig1C1))
+print("blCalcC1= ",(blCalcC1/1e6)," MN")
+print("blTeor= ",(blTeor/1e6)," MN")
+print("ratio1= ",(ratio1))
+print("eig1C2= ",(eig1C2))
+print("ratio2= ",(ratio2))
+print("numModesC3= ",(numModesC3))
+print("ratio3= ",(ratio3))
+   '''
+
+import os
+from misc_utils import log_messages as lmsg
+fname= os.path.basename(__file__)
+if (analOk==0) and (abs(ratio1)<0.03) and (abs(ratio2)<1e-6) and (numModesC3==0) and (ratio3<1e-10):
+    print('test '+fname+': ok.')
+else:
+    lmsg.error(fname+' ERROR.')
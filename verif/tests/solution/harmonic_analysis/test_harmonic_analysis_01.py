@@ -0,0 +1,106 @@
+# -*- coding: utf-8 -*-
+'''Steady-state harmonic response of a damped SDOF system. The computed
+   amplitudes and phases are compared with the closed-form solution:
+
+   X(w)= P/(k*(1+i*eta)-w^2*m+i*w*c)
+'''
+
+from __future__ import division
+from __future__ import print_function
+
+__author__= "Luis C. Pérez Tato (LCPT)"
+__copyright__= "Copyright 2024, LCPT"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+import math
+import cmath
+import xc
+from model import predefined_spaces
+from materials import typical_materials
+from solution import predefined_solutions
+
+# *** PROBLEM
+feProblem= xc.FEProblem()
+prep=feProblem.getPreprocessor
+nodes= prep.getNodeHandler
+modelSpace= predefined_spaces.SolidMechanics2D(nodes) #defines dimension of
+                  #the space: nodes by two coordinates (x,y) and
+                  #two DOF for each node (Ux,Uy)
+
+## *** MESH ***
+### *** GEOMETRY ***
+n1= nodes.newNodeXY(0.0,0.0)
+n2= nodes.newNodeXY(0.0,0.0)
+
+### Single point constraints -- Boundary Conditions
+modelSpace.fixNode00(n1.tag)
+modelSpace.fixNodeF0(n2.tag)
+
+### nodal masses:
+mass= 10/(2*math.pi)**2
+n2.mass= xc.Matrix([[mass,0],[0,0]])  # node mass matrix.
+
+### Define materials.
+k_x= 1000.0
+kX= typical_materials.defElasticMaterial(prep, "kX",k_x)
+wn= math.sqrt(k_x/mass) # natural angular frequency.
+dampRatio= 0.05
+c_x= 2.0*dampRatio*mass*wn
+cX= typical_materials.defViscousMaterial(prep, "cX", C= c_x, Alpha= 1.0)
+### Define ELEMENTS
+elems= modelSpace.getElementHandler()
+elems.dimElem= 2 # space dimension.
+elems.defaultMaterial= kX.name
+spring= elems.newElement("ZeroLength",xc.ID([n1.tag,n2.tag]))
+spring.setupVectors(xc.Vector([1,0,0]),xc.Vector([0,1,0]))
+elems.defaultMaterial= cX.name
+dashpot= elems.newElement("ZeroLength",xc.ID([n1.tag,n2.tag]))
+dashpot.setupVectors(xc.Vector([1,0,0]),xc.Vector([0,1,0]))
+
+### Harmonic load.
+P= 10.0
+lp0= modelSpace.newLoadPattern(name= '0')
+lp0.newNodalLoad(n2.tag,xc.Vector([P,0.0]))
+modelSpace.addLoadCaseToDomain(lp0.name)
+
+### Frequency sweep.
+fn= wn/(2.0*math.pi)
+numFreq= 41
+frequencies= [fn*(0.5+1.5*i/(numFreq-1)) for i in range(0,numFreq)]
+lossFactor= 0.02
+solProc= predefined_solutions.HarmonicSteadyStateAnalysis(feProblem, frequencies= frequencies, lossFactor= lossFactor)
+result= solProc.solve()
+
+amplitudes= solProc.analysis.getNodeDOFAmplitudes(n2.tag, 0)
+phases= solProc.analysis.getNodeDOFPhases(n2.tag, 0)
+err= 0.0
+for i, f in enumerate(frequencies):
+    w= 2.0*math.pi*f
+    xRef= P/complex(k_x-w**2*mass, lossFactor*k_x+w*c_x)
+    err+= (amplitudes[i]-abs(xRef))**2/abs(xRef)**2
+    err+= (phases[i]-cmath.phase(xRef))**2
+err= math.sqrt(err)
+
+# Check that the response at a single frequency is consistent.
+iRes= numFreq//3
+xRe= solProc.analysis.getNodeResponseRealPart(iRes, n2.tag)
+xIm= solProc.analysis.getNodeResponseImagPart(iRes, n2.tag)
+ratio= abs(complex(xRe[0], xIm[0])-amplitudes[iRes]*cmath.exp(1j*phases[iRes]))/amplitudes[iRes]
+
+'''
+print('natural frequency: ', fn, ' Hz')
+print('amplitudes: ', amplitudes)
+print('phases: ', phases)
+print('err= ', err)
+print('ratio= ', ratio)
+'''
+
+import os
+from misc_utils import log_messages as lmsg
+fname= os.path.basename(__file__)
+if((result==0) and (err<1e-8) and (ratio<1e-10)):
+    print('test '+fname+': ok.')
+else:
+    lmsg.error(fname+' ERROR.')
@@ -0,0 +1,123 @@
+# -*- coding: utf-8 -*-
+''' Check the values stored by the element recorders: responses
+    written directly in the recorder buffer (quad forces), responses
+    copied to it (truss axial forces) and responses whose size is
+    not the size reserved when the recorder was initialized (the
+    quad "stresses" response reserves the size of the element
+    forces but returns the stresses at all the Gauss points, so
+    only the values that fit are stored). The values must be the
+    same whether the responses are collected in parallel or not.
+    Home made test.'''
+
+from __future__ import print_function
+from __future__ import division
+
+__author__= "Luis C. Pérez Tato (LCPT) and Ana Ortega (AOO)"
+__copyright__= "Copyright 2026, LCPT and AOO"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+import xc
+from solution import predefined_solutions
+from model import predefined_spaces
+from materials import typical_materials
+
+feProblem= xc.FEProblem()
+preprocessor=  feProblem.getPreprocessor
+nodes= preprocessor.getNodeHandler
+modelSpace= predefined_spaces.SolidMechanics2D(nodes)
+
+# Materials definition
+elast2d= typical_materials.defElasticIsotropicPlaneStress(preprocessor, "elast2d",E= 1e6,nu= 0.25, rho= 0.0)
+elast= typical_materials.defElasticMaterial(preprocessor, "elast", 2e6)
+
+# Mesh: a quad with two bars that connect its top corners to
+# fixed nodes.
+nod0= nodes.newNodeXY(0,0)
+nod1= nodes.newNodeXY(1,0)
+nod2= nodes.newNodeXY(1,1)
+nod3= nodes.newNodeXY(0,1)
+nod4= nodes.newNodeXY(2,2)
+nod5= nodes.newNodeXY(-1,2)
+
+elements= preprocessor.getElementHandler
+elements.defaultMaterial= elast2d.name
+quad= elements.newElement('FourNodeQuad',xc.ID([nod0.tag, nod1.tag, nod2.tag, nod3.tag]))
+quad.thickness= 1
+elements.dimElem= 2
+elements.defaultMaterial= elast.name
+trusses= list()
+for (nA, nB) in [(nod2, nod4), (nod3, nod5)]:
+    truss= elements.newElement('Truss', xc.ID([nA.tag, nB.tag]))
+    truss.sectionArea= 0.01
+    trusses.append(truss)
+
+modelSpace.fixNode00(nod0.tag)
+modelSpace.fixNode00(nod1.tag)
+modelSpace.fixNode00(nod4.tag)
+modelSpace.fixNode00(nod5.tag)
+
+# Load definition (increasing with time).
+P= 10e3
+lPatterns= preprocessor.getLoadHandler.getLoadPatterns
+ts= lPatterns.newTimeSeries("linear_ts","ts")
+lPatterns.currentTimeSeries= ts.name
+lp0= lPatterns.newLoadPattern("default","0")
+lp0.newNodalLoad(nod2.tag,xc.Vector([P,0.5*P]))
+lp0.newNodalLoad(nod3.tag,xc.Vector([-0.3*P,P]))
+modelSpace.addLoadCaseToDomain(lp0.name)
+
+# Recorders (sequential and parallel collection).
+responses= [('force', [quad]), ('axialForce', trusses), ('stresses', [quad])]
+recorders= list()
+for parallel in [False, True]:
+    for (args, elems) in responses:
+        recorder= preprocessor.getDomain.newRecorder("element_recorder", None)
+        recorder.setElements(xc.ID([e.tag for e in elems]))
+        recorder.setResponseArgs(args)
+        recorder.parallelCollection= parallel
+        recorders.append((args, recorder))
+
+def getExpectedValues(args):
+    ''' Return the values of the response obtained from the elements.'''
+    retval= list()
+    if(args=='force'):
+        retval.extend(quad.getResistingForce())
+    elif(args=='axialForce'):
+        retval.extend([t.getN() for t in trusses])
+    else:
+        # Stresses at the Gauss points, only the values that fit
+        # in the size of the element forces (8 values) are stored.
+        for m in quad.physicalProperties.getVectorMaterials:
+            retval.extend(m.getStress())
+        retval= retval[:8]
+    return retval
+
+# Solution
+analysis= predefined_solutions.simple_static_linear(feProblem)
+err= 0.0
+ok= True
+numSteps= 3
+for i in range(0, numSteps):
+    ok= ok and (analysis.analyze(1)==0)
+    for (args, recorder) in recorders:
+        values= recorder.data
+        expected= getExpectedValues(args)
+        ok= ok and (len(values)==len(expected))
+        norm= max([abs(v) for v in expected])
+        for (v, e) in zip(values, expected):
+            err= max(err, abs(v-e)/norm)
+
+'''
+print('ok= ', ok)
+print('err= ', err)
+'''
+
+import os
+from misc_utils import log_messages as lmsg
+fname= os.path.basename(__file__)
+if ok and (err<1e-12):
+    print('test '+fname+': ok.')
+else:
+    lmsg.error(fname+' ERROR.')
@@ -0,0 +1,110 @@
+# -*- coding: utf-8 -*-
+'''Free vibration of an SDOF system with modal damping. The decay of the
+   displacement peaks is compared with the logarithmic decrement that
+   corresponds to the damping ratio.'''
+
+from __future__ import division
+from __future__ import print_function
+
+__author__= "Luis C. Pérez Tato (LCPT)"
+__copyright__= "Copyright 2024, LCPT"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+import os
+import math
+import xc
+from model import predefined_spaces
+from materials import typical_materials
+from solution import predefined_solutions
+from misc_utils import log_messages as lmsg
+
+# *** PROBLEM
+feProblem= xc.FEProblem()
+prep=feProblem.getPreprocessor
+nodes= prep.getNodeHandler
+modelSpace= predefined_spaces.SolidMechanics2D(nodes) #defines dimension of
+                  #the space: nodes by two coordinates (x,y) and
+                  #two DOF for each node (Ux,Uy)
+
+## *** MESH ***
+### *** GEOMETRY ***
+n1= nodes.newNodeXY(0.0,0.0)
+n2= nodes.newNodeXY(0.0,0.0)
+
+### Single point constraints -- Boundary Conditions
+modelSpace.fixNode00(n1.tag)
+modelSpace.fixNodeF0(n2.tag)
+
+### nodal masses:
+mass= 10/(2*math.pi)**2
+n2.mass= xc.Matrix([[mass,0],[0,0]])  # node mass matrix.
+
+### Define materials.
+k_x= 1000.0
+kX= typical_materials.defElasticMaterial(prep, "kX",k_x)
+### Define ELEMENTS
+elems= modelSpace.getElementHandler()
+elems.dimElem= 2 # space dimension.
+elems.defaultMaterial= kX.name
+zl= elems.newElement("ZeroLength",xc.ID([n1.tag,n2.tag]))
+zl.setupVectors(xc.Vector([1,0,0]),xc.Vector([0,1,0]))
+
+### Eigen analysis (the modal damping uses the computed eigenvectors).
+modalAnalysis= predefined_solutions.FrequencyAnalysis(feProblem, systemPrefix= 'full_gen')
+if(modalAnalysis.solve()!=0):
+    lmsg.error('Eigen analysis failed.')
+    quit()
+w= math.sqrt(modalAnalysis.analysis.getEigenvalue(1))
+
+# Define RECORDERS
+cDisp= list()
+recDisp= prep.getDomain.newRecorder("node_prop_recorder",None)
+recDisp.setNodes(xc.ID([n2.tag]))
+recDisp.callbackRecord= "cDisp.append([self.getDomain.getTimeTracker.getCurrentTime,self.getDisp[0]])"
+
+## Initial displacement.
+x0= .01
+n2.setTrialDisp(xc.Vector([x0, 0]))
+prep.getDomain.commit() # Commit the initial displacement.
+
+## Solution
+dampingRatio= 0.05
+T= 2*math.pi/w
+duration= 3*T # three cycles.
+timeStep= T/100.0
+numberOfSteps= int(duration/timeStep)+1
+### Dynamic analysis.
+prep.getDomain.setTime(0.0)
+solProc= predefined_solutions.PlainLinearNewmark(feProblem, numSteps= numberOfSteps, timeStep= timeStep)
+solProc.setup()
+solProc.integrator.modalDampingRatios= xc.Vector([dampingRatio])
+if(solProc.solve()!=0):
+    lmsg.error('Dynamic analysis failed.')
+    quit()
+
+# Extract the displacement peaks.
+peaks= list()
+for i in range(1,len(cDisp)-1):
+    x= cDisp[i][1]
+    if((x>cDisp[i-1][1]) and (x>=cDisp[i+1][1])):
+        peaks.append(x)
+# Logarithmic decrement.
+deltaRef= 2*math.pi*dampingRatio/math.sqrt(1-dampingRatio**2)
+delta= math.log(peaks[0]/peaks[1])
+ratio= abs(delta-deltaRef)/deltaRef
+
+'''
+print('pulsation: ', w, ' rad/s')
+print('peaks: ', peaks)
+print('log. decrement: ', delta)
+print('reference log. decrement: ', deltaRef)
+print('ratio: ', ratio)
+'''
+
+fname= os.path.basename(__file__)
+if((len(peaks)>=2) and (ratio<0.02)):
+    print('test '+fname+': ok.')
+else:
+    lmsg.error(fname+' ERROR.')